@@ -133,6 +133,8 @@ let package = Package(
         "src/core/call/client_call.cc",
         "src/core/call/client_call.h",
         "src/core/call/custom_metadata.h",
+        "src/core/call/deadline_coalescer.cc",
+        "src/core/call/deadline_coalescer.h",
         "src/core/call/filter_fusion.h",
         "src/core/call/interception_chain.cc",
         "src/core/call/interception_chain.h",
@@ -353,6 +355,8 @@ let package = Package(
         "src/core/ext/filters/http/client_authority_filter.cc",
         "src/core/ext/filters/http/client_authority_filter.h",
         "src/core/ext/filters/http/http_filters_plugin.cc",
+        "src/core/ext/filters/http/message_compress/adaptive_compression_policy.cc",
+        "src/core/ext/filters/http/message_compress/adaptive_compression_policy.h",
         "src/core/ext/filters/http/message_compress/compression_filter.cc",
         "src/core/ext/filters/http/message_compress/compression_filter.h",
         "src/core/ext/filters/http/server/http_server_filter.cc",
@@ -382,8 +386,6 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h",
         "src/core/ext/transport/chttp2/transport/chttp2_transport.cc",
         "src/core/ext/transport/chttp2/transport/chttp2_transport.h",
-        "src/core/ext/transport/chttp2/transport/decode_huff.cc",
-        "src/core/ext/transport/chttp2/transport/decode_huff.h",
         "src/core/ext/transport/chttp2/transport/flow_control.cc",
         "src/core/ext/transport/chttp2/transport/flow_control.h",
         "src/core/ext/transport/chttp2/transport/frame.cc",
@@ -426,6 +428,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/http2_transport.cc",
         "src/core/ext/transport/chttp2/transport/http2_transport.h",
         "src/core/ext/transport/chttp2/transport/http2_ztrace_collector.h",
+        "src/core/ext/transport/chttp2/transport/huff_table_decoder.cc",
+        "src/core/ext/transport/chttp2/transport/huff_table_decoder.h",
         "src/core/ext/transport/chttp2/transport/huffsyms.cc",
         "src/core/ext/transport/chttp2/transport/huffsyms.h",
         "src/core/ext/transport/chttp2/transport/internal.h",
@@ -443,6 +447,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/ping_promise.h",
         "src/core/ext/transport/chttp2/transport/ping_rate_policy.cc",
         "src/core/ext/transport/chttp2/transport/ping_rate_policy.h",
+        "src/core/ext/transport/chttp2/transport/simd_base64.cc",
+        "src/core/ext/transport/chttp2/transport/simd_base64.h",
         "src/core/ext/transport/chttp2/transport/stream_lists.cc",
         "src/core/ext/transport/chttp2/transport/stream_lists.h",
         "src/core/ext/transport/chttp2/transport/transport_common.cc",
@@ -684,6 +690,9 @@ let package = Package(
         "src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/common/v3/common.upb.h",
         "src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/common/v3/common.upb_minitable.c",
         "src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/common/v3/common.upb_minitable.h",
+        "src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/least_request/v3/least_request.upb.h",
+        "src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/least_request/v3/least_request.upb_minitable.c",
+        "src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/least_request/v3/least_request.upb_minitable.h",
         "src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/pick_first/v3/pick_first.upb.h",
         "src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/pick_first/v3/pick_first.upb_minitable.c",
         "src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/pick_first/v3/pick_first.upb_minitable.h",
@@ -1379,6 +1388,8 @@ let package = Package(
         "src/core/lib/event_engine/posix.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1416,6 +1427,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.cc",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.h",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc",
@@ -1465,6 +1478,8 @@ let package = Package(
         "src/core/lib/event_engine/windows/windows_listener.h",
         "src/core/lib/event_engine/work_queue/basic_work_queue.cc",
         "src/core/lib/event_engine/work_queue/basic_work_queue.h",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h",
         "src/core/lib/event_engine/work_queue/work_queue.h",
         "src/core/lib/experiments/config.cc",
         "src/core/lib/experiments/config.h",
@@ -1755,6 +1770,8 @@ let package = Package(
         "src/core/load_balancing/delegating_helper.h",
         "src/core/load_balancing/endpoint_list.cc",
         "src/core/load_balancing/endpoint_list.h",
+        "src/core/load_balancing/endpoint_list_policy.cc",
+        "src/core/load_balancing/endpoint_list_policy.h",
         "src/core/load_balancing/grpclb/client_load_reporting_filter.cc",
         "src/core/load_balancing/grpclb/client_load_reporting_filter.h",
         "src/core/load_balancing/grpclb/grpclb.cc",
@@ -1773,16 +1790,22 @@ let package = Package(
         "src/core/load_balancing/lb_policy_factory.h",
         "src/core/load_balancing/lb_policy_registry.cc",
         "src/core/load_balancing/lb_policy_registry.h",
+        "src/core/load_balancing/least_request/least_request.cc",
         "src/core/load_balancing/oob_backend_metric.cc",
         "src/core/load_balancing/oob_backend_metric.h",
         "src/core/load_balancing/oob_backend_metric_internal.h",
         "src/core/load_balancing/outlier_detection/outlier_detection.cc",
         "src/core/load_balancing/outlier_detection/outlier_detection.h",
+        "src/core/load_balancing/peak_ewma/peak_ewma.cc",
+        "src/core/load_balancing/peak_ewma/peak_ewma_load.cc",
+        "src/core/load_balancing/peak_ewma/peak_ewma_load.h",
         "src/core/load_balancing/pick_first/pick_first.cc",
         "src/core/load_balancing/pick_first/pick_first.h",
         "src/core/load_balancing/priority/priority.cc",
         "src/core/load_balancing/ring_hash/ring_hash.cc",
         "src/core/load_balancing/ring_hash/ring_hash.h",
+        "src/core/load_balancing/ring_hash/ring_hash_table.cc",
+        "src/core/load_balancing/ring_hash/ring_hash_table.h",
         "src/core/load_balancing/rls/rls.cc",
         "src/core/load_balancing/rls/rls.h",
         "src/core/load_balancing/round_robin/round_robin.cc",
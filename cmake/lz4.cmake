@@ -0,0 +1,35 @@
+# Copyright 2026 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+set(gRPC_USE_LZ4 "OFF" CACHE STRING "Build with the lz4 message compression algorithm, using the system's liblz4. Can be ON, OFF or AUTO")
+
+if (NOT gRPC_USE_LZ4 STREQUAL "OFF")
+  if (gRPC_USE_LZ4 STREQUAL "ON")
+    find_package(PkgConfig REQUIRED)
+    pkg_check_modules(LZ4 REQUIRED liblz4)
+  elseif (gRPC_USE_LZ4 STREQUAL "AUTO")
+    find_package(PkgConfig)
+    if(PKG_CONFIG_FOUND)
+      pkg_check_modules(LZ4 liblz4)
+    endif()
+  else()
+    message(FATAL_ERROR "Unknown value for gRPC_USE_LZ4 = ${gRPC_USE_LZ4}")
+  endif()
+
+  if(LZ4_FOUND)
+    include_directories(${LZ4_INCLUDE_DIRS})
+    set(_gRPC_LZ4_LIBRARIES ${LZ4_LINK_LIBRARIES})
+    add_definitions(-DGRPC_HAVE_LZ4)
+  endif()
+endif()
@@ -0,0 +1,35 @@
+# Copyright 2026 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+set(gRPC_USE_ZSTD "OFF" CACHE STRING "Build with the zstd message compression algorithm, using the system's libzstd. Can be ON, OFF or AUTO")
+
+if (NOT gRPC_USE_ZSTD STREQUAL "OFF")
+  if (gRPC_USE_ZSTD STREQUAL "ON")
+    find_package(PkgConfig REQUIRED)
+    pkg_check_modules(ZSTD REQUIRED libzstd)
+  elseif (gRPC_USE_ZSTD STREQUAL "AUTO")
+    find_package(PkgConfig)
+    if(PKG_CONFIG_FOUND)
+      pkg_check_modules(ZSTD libzstd)
+    endif()
+  else()
+    message(FATAL_ERROR "Unknown value for gRPC_USE_ZSTD = ${gRPC_USE_ZSTD}")
+  endif()
+
+  if(ZSTD_FOUND)
+    include_directories(${ZSTD_INCLUDE_DIRS})
+    set(_gRPC_ZSTD_LIBRARIES ${ZSTD_LINK_LIBRARIES})
+    add_definitions(-DGRPC_HAVE_ZSTD)
+  endif()
+endif()
@@ -63,6 +63,14 @@
  * channel goes back into IDLE state. Int valued, milliseconds. INT_MAX means
  * unlimited. The default value is 30 minutes and the min value is 1 second. */
 #define GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS "grpc.client_idle_timeout_ms"
+/** EXPERIMENTAL. If positive, calls on the channel (or server) share deadline
+ * timers: each call deadline is rounded up to a multiple of this many
+ * milliseconds, and all calls whose rounded deadlines are equal are expired by
+ * one timer. Calls are never expired early, but may outlive their deadline by
+ * up to this long. Int valued, milliseconds. Defaults to 0 (one timer per
+ * call). */
+#define GRPC_ARG_CALL_DEADLINE_COALESCING_MS \
+  "grpc.experimental.call_deadline_coalescing_ms"
 /** Enable/disable support for per-message compression. Boolean valued. Defaults
    to true, unless GRPC_ARG_MINIMAL_STACK is enabled, in which case it defaults
    to false. */
@@ -207,6 +215,15 @@
  *  protector. Defaults to zero.
  */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** EXPERIMENTAL. If non-zero, once a TLS handshake on a TCP connection
+    completes, hand the negotiated AES-GCM transmit key to the Linux kernel
+    (kTLS) so that outgoing records are encrypted in the kernel instead of by
+    the frame protector, which still decrypts incoming records. gRPC falls
+    back to the frame protector whenever the kernel, TLS library, protocol
+    version or cipher does not support it, or when
+    GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED is set. Defaults to 0. */
+#define GRPC_ARG_TLS_KERNEL_OFFLOAD_ENABLED \
+  "grpc.experimental.tls_kernel_offload_enabled"
 /** Maximum metadata size (soft limit), in bytes. Note this limit applies to the
    max sum of all metadata key-value entries in a batch of headers. Some random
    sample of requests between this limit and
@@ -284,6 +301,17 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map the received pages into read-only slices with
+   TCP_ZEROCOPY_RECEIVE (linux only) instead of copying them. By default, it is
+   disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy receive threshold: only map received data if a read is
+   expected to return >= this many bytes. Smaller reads are copied. By default,
+   this is set to 256KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_receive_bytes_threshold"
 /* Overrides the TCP socket receive buffer size, SO_RCVBUF.
     Default value is -1(kReadBufferSizeUnset) indicating that the system will
     decide the buffer size. Range varies from 0 to INT_MAX. */
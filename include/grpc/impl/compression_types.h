@@ -45,13 +45,40 @@ extern "C" {
  * Valid values are defined by the enum type grpc_compression_level, defaults to
  * GRPC_COMPRESS_LEVEL_NONE. */
 #define GRPC_COMPRESSION_CHANNEL_DEFAULT_LEVEL "grpc.default_compression_level"
+/** The zlib compression level used by the deflate and gzip algorithms, from 1
+ * (fastest) to 9 (smallest output). Defaults to zlib's default, 6. Lower
+ * levels trade compression ratio for throughput on fast links. */
+#define GRPC_COMPRESSION_CHANNEL_ZLIB_LEVEL "grpc.compression_zlib_level"
+/** The level used by the zstd algorithm, from 1 (fastest) to 22 (smallest
+ * output). Defaults to zstd's default, 3. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL "grpc.compression_zstd_level"
+/** Path to a zstd dictionary, as trained by `zstd --train` on typical
+ * messages. Messages sent with the zstd algorithm are compressed with it, and
+ * received ones that were compressed with it can be decompressed. Small
+ * messages that resemble one another compress far better with a dictionary,
+ * but both peers must be configured with the same one. EXPERIMENTAL. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY \
+  "grpc.experimental.compression_zstd_dictionary"
+/** If non-zero, whether and how hard to compress outgoing messages is decided
+ * per method from the compression ratio and encode time of recent messages,
+ * rather than always as configured. Messages that would not shrink enough to
+ * pay for the CPU spent compressing them are compressed at a faster level or
+ * sent uncompressed. Defaults to 0. EXPERIMENTAL. */
+#define GRPC_COMPRESSION_CHANNEL_ADAPTIVE \
+  "grpc.experimental.adaptive_compression"
+/** With GRPC_COMPRESSION_CHANNEL_ADAPTIVE, the CPU time in nanoseconds worth
+ * spending to save one byte on the wire. Defaults to 100. EXPERIMENTAL. */
+#define GRPC_COMPRESSION_CHANNEL_ADAPTIVE_NS_PER_SAVED_BYTE \
+  "grpc.experimental.adaptive_compression_ns_per_saved_byte"
 /** Compression algorithms supported by the channel.
  * Its value is a bitset (an int). Bits correspond to algorithms in \a
  * grpc_compression_algorithm. For example, its LSB corresponds to
  * GRPC_COMPRESS_NONE, the next bit to GRPC_COMPRESS_DEFLATE, etc.
  * Unset bits disable support for the algorithm. By default all algorithms are
- * supported. It's not possible to disable GRPC_COMPRESS_NONE (the attempt will
- * be ignored). */
+ * supported, except for zstd and lz4 in builds of gRPC that leave them out
+ * (see GRPC_COMPRESS_ZSTD and GRPC_COMPRESS_LZ4), which are never enabled.
+ * It's not possible to disable GRPC_COMPRESS_NONE (the attempt will be
+ * ignored). */
 #define GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET \
   "grpc.compression_enabled_algorithms_bitset"
 /** \} */
@@ -62,6 +89,12 @@ typedef enum {
   GRPC_COMPRESS_NONE = 0,
   GRPC_COMPRESS_DEFLATE,
   GRPC_COMPRESS_GZIP,
+  /** Only supported when gRPC is built with zstd: with
+   * --define=grpc_zstd=true in Bazel, or -DgRPC_USE_ZSTD=ON in CMake. */
+  GRPC_COMPRESS_ZSTD,
+  /** The LZ4 frame format. Only supported when gRPC is built with lz4: with
+   * --define=grpc_lz4=true in Bazel, or -DgRPC_USE_LZ4=ON in CMake. */
+  GRPC_COMPRESS_LZ4,
   /* TODO(ctiller): snappy */
   GRPC_COMPRESS_ALGORITHMS_COUNT
 } grpc_compression_algorithm;
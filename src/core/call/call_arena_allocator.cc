@@ -14,14 +14,171 @@
 
 #include "src/core/call/call_arena_allocator.h"
 
+#include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <atomic>
+#include <optional>
+#include <utility>
+
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
+// Arena storage put aside by finished calls, sharded to keep calls on
+// different cpus from contending.
+class CallArenaAllocator::StoragePool final
+    : public RefCounted<StoragePool, NonPolymorphicRefCount> {
+ public:
+  explicit StoragePool(MemoryOwner owner) : owner_(std::move(owner)) {}
+
+  // Find pooled storage of at least `size` bytes, and not so much larger that
+  // reusing it would waste memory. On success `size` is updated to the size
+  // of the storage, which is no longer charged to the pool.
+  void* Take(size_t& size) {
+    Shard& shard = shards_.this_cpu();
+    MutexLock lock(&shard.mu);
+    for (size_t i = 0; i < shard.count;) {
+      Entry& entry = shard.entries[i];
+      if (entry.size < size) {
+        // Too small for calls of the current estimate: this will never be
+        // used again.
+        Free(entry);
+        entry = shard.entries[--shard.count];
+        continue;
+      }
+      if (entry.size <= 2 * size) {
+        void* storage = entry.storage;
+        size = entry.size;
+        owner_.Release(size);
+        entry = shard.entries[--shard.count];
+        return storage;
+      }
+      ++i;
+    }
+    return nullptr;
+  }
+
+  // Keep `storage` for a future call. Returns false if the pool is full or
+  // shut down, in which case the caller frees the storage.
+  bool Put(void* storage, size_t size) {
+    if (size > kMaxPooledSize) return false;
+    {
+      Shard& shard = shards_.this_cpu();
+      MutexLock lock(&shard.mu);
+      if (shard.shutdown || shard.count == kEntriesPerShard) return false;
+      owner_.Reserve(size);
+      shard.entries[shard.count++] = Entry{storage, size};
+    }
+    if (!reclaimer_posted_.exchange(true, std::memory_order_acq_rel)) {
+      PostReclaimer();
+    }
+    return true;
+  }
+
+  // Free all pooled storage, and stop pooling.
+  void Shutdown() {
+    for (Shard& shard : shards_) {
+      MutexLock lock(&shard.mu);
+      shard.shutdown = true;
+      DrainLocked(shard);
+    }
+    // Drops the reclaimer, and with it the reclaimer's ref to the pool.
+    owner_.Reset();
+  }
+
+ private:
+  static constexpr size_t kEntriesPerShard = 8;
+  static constexpr size_t kMaxPooledSize = 64 * 1024;
+
+  struct Entry {
+    void* storage;
+    size_t size;
+  };
+
+  struct Shard {
+    Mutex mu;
+    Entry entries[kEntriesPerShard] ABSL_GUARDED_BY(mu);
+    size_t count ABSL_GUARDED_BY(mu) = 0;
+    bool shutdown ABSL_GUARDED_BY(mu) = false;
+  };
+
+  void Free(const Entry& entry) {
+    gpr_free_aligned(entry.storage);
+    owner_.Release(entry.size);
+  }
+
+  void DrainLocked(Shard& shard) ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) {
+    for (size_t i = 0; i < shard.count; ++i) Free(shard.entries[i]);
+    shard.count = 0;
+  }
+
+  void PostReclaimer() {
+    owner_.PostReclaimer(
+        ReclamationPass::kBenign,
+        [self = Ref()](std::optional<ReclamationSweep> sweep) {
+          if (!sweep.has_value()) return;
+          // Storage pooled from here on needs a new reclaimer.
+          self->reclaimer_posted_.store(false, std::memory_order_release);
+          for (Shard& shard : self->shards_) {
+            MutexLock lock(&shard.mu);
+            if (!shard.shutdown) self->DrainLocked(shard);
+          }
+        });
+  }
+
+  // Reserve() and Release() are called under a shard lock.  PostReclaimer()
+  // (from Put()) and Reset() (from Shutdown()) are called unlocked; they
+  // cannot race because Shutdown() runs when the CallArenaAllocator is
+  // destroyed, and it outlives every arena that calls Put().
+  MemoryOwner owner_;
+  std::atomic<bool> reclaimer_posted_{false};
+  PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(16)};
+};
+
+CallArenaAllocator::CallArenaAllocator(MemoryAllocator allocator,
+                                       size_t initial_size)
+    : ArenaFactory(std::move(allocator)), call_size_estimator_(initial_size) {}
+
+CallArenaAllocator::CallArenaAllocator(MemoryAllocator allocator,
+                                       size_t initial_size,
+                                       MemoryOwner pool_owner)
+    : ArenaFactory(std::move(allocator)),
+      call_size_estimator_(initial_size),
+      storage_pool_(MakeRefCounted<StoragePool>(std::move(pool_owner))) {}
+
+CallArenaAllocator::~CallArenaAllocator() {
+  if (storage_pool_ != nullptr) storage_pool_->Shutdown();
+}
+
 void CallArenaAllocator::FinalizeArena(Arena* arena) {
   call_size_estimator_.UpdateCallSizeEstimate(arena->TotalUsedBytes());
 }
 
+void* CallArenaAllocator::AllocateArenaStorage(size_t& size) {
+  if (storage_pool_ != nullptr) {
+    void* storage = storage_pool_->Take(size);
+    if (storage != nullptr) {
+      global_stats().IncrementCallArenaStorageRecycled();
+      allocator().Reserve(size);
+      return storage;
+    }
+  }
+  global_stats().IncrementCallArenaStorageAllocated();
+  return ArenaFactory::AllocateArenaStorage(size);
+}
+
+void CallArenaAllocator::FreeArenaStorage(void* storage, size_t size,
+                                          size_t reserved) {
+  if (storage_pool_ != nullptr && storage_pool_->Put(storage, size)) {
+    allocator().Release(reserved);
+    return;
+  }
+  ArenaFactory::FreeArenaStorage(storage, size, reserved);
+}
+
 }  // namespace grpc_core
@@ -70,9 +70,13 @@ class CallSizeEstimator final {
 
 class CallArenaAllocator final : public ArenaFactory {
  public:
-  CallArenaAllocator(MemoryAllocator allocator, size_t initial_size)
-      : ArenaFactory(std::move(allocator)),
-        call_size_estimator_(initial_size) {}
+  CallArenaAllocator(MemoryAllocator allocator, size_t initial_size);
+  // As above, but the storage of finished calls' arenas is kept in a per-cpu
+  // pool for the next calls to reuse. Pooled storage is charged to
+  // `pool_owner`, and returned to the quota under memory pressure.
+  CallArenaAllocator(MemoryAllocator allocator, size_t initial_size,
+                     MemoryOwner pool_owner);
+  ~CallArenaAllocator() override;
 
   RefCountedPtr<Arena> MakeArena() override {
     return Arena::Create(call_size_estimator_.CallSizeEstimate(), Ref());
@@ -80,10 +84,16 @@ class CallArenaAllocator final : public ArenaFactory {
 
   void FinalizeArena(Arena* arena) override;
 
+  void* AllocateArenaStorage(size_t& size) override;
+  void FreeArenaStorage(void* storage, size_t size, size_t reserved) override;
+
   size_t CallSizeEstimate() { return call_size_estimator_.CallSizeEstimate(); }
 
  private:
+  class StoragePool;
+
   CallSizeEstimator call_size_estimator_;
+  RefCountedPtr<StoragePool> storage_pool_;
 };
 
 }  // namespace grpc_core
@@ -0,0 +1,131 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/call/deadline_coalescer.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+
+DeadlineCoalescer::DeadlineCoalescer(Duration granularity)
+    : granularity_(granularity) {
+  CHECK_GT(granularity_, Duration::Zero());
+}
+
+RefCountedPtr<DeadlineCoalescer> DeadlineCoalescer::CreateFromChannelArgs(
+    const ChannelArgs& args) {
+  auto shared = args.GetObjectRef<DeadlineCoalescer>();
+  if (shared != nullptr) return shared;
+  const Duration granularity =
+      args.GetDurationFromIntMillis(GRPC_ARG_CALL_DEADLINE_COALESCING_MS)
+          .value_or(Duration::Zero());
+  if (granularity <= Duration::Zero()) return nullptr;
+  return MakeRefCounted<DeadlineCoalescer>(granularity);
+}
+
+ChannelArgs DeadlineCoalescer::ShareFromChannelArgs(const ChannelArgs& args) {
+  auto coalescer = CreateFromChannelArgs(args);
+  if (coalescer == nullptr) return args;
+  return args.SetObject(std::move(coalescer));
+}
+
+Timestamp DeadlineCoalescer::RoundUp(Timestamp deadline) const {
+  const int64_t ms = deadline.milliseconds_after_process_epoch();
+  const int64_t granularity = granularity_.millis();
+  // Leave deadlines within one granularity of infinity as they are.
+  if (ms > std::numeric_limits<int64_t>::max() - granularity) return deadline;
+  int64_t slot = ms / granularity * granularity;
+  if (slot < ms) slot += granularity;
+  return Timestamp::FromMillisecondsAfterProcessEpoch(slot);
+}
+
+void DeadlineCoalescer::Add(Waiter* waiter, Timestamp deadline,
+                            EventEngine::Closure* on_deadline,
+                            EventEngine* event_engine) {
+  const Timestamp slot = RoundUp(deadline);
+  Shard* shard = &shards_.this_cpu();
+  MutexLock lock(&shard->mu);
+  DCHECK_EQ(waiter->bucket_, nullptr);
+  const int64_t slot_ms = slot.milliseconds_after_process_epoch();
+  Bucket*& bucket = shard->buckets[BucketKey(event_engine, slot_ms)];
+  if (bucket == nullptr) {
+    global_stats().IncrementCallDeadlineTimersArmed();
+    bucket = new Bucket;
+    bucket->shard = shard;
+    bucket->event_engine = event_engine;
+    bucket->slot = slot_ms;
+    bucket->head.next_ = bucket->head.prev_ = &bucket->head;
+    bucket->handle = event_engine->RunAfter(
+        slot - Timestamp::Now(),
+        [self = Ref(), bucket]() mutable { self->Fire(bucket); });
+  } else {
+    global_stats().IncrementCallDeadlineTimersShared();
+  }
+  waiter->shard_ = shard;
+  waiter->bucket_ = bucket;
+  waiter->on_deadline_ = on_deadline;
+  waiter->next_ = &bucket->head;
+  waiter->prev_ = bucket->head.prev_;
+  waiter->next_->prev_ = waiter->prev_->next_ = waiter;
+}
+
+bool DeadlineCoalescer::Remove(Waiter* waiter) {
+  Shard* shard = waiter->shard_;
+  if (shard == nullptr) return false;
+  waiter->shard_ = nullptr;
+  MutexLock lock(&shard->mu);
+  Bucket* bucket = waiter->bucket_;
+  if (bucket == nullptr) return false;
+  waiter->next_->prev_ = waiter->prev_;
+  waiter->prev_->next_ = waiter->next_;
+  waiter->bucket_ = nullptr;
+  // Stop the timer once the last call has left its slot. If it is already
+  // running, Fire() cleans up the empty bucket.
+  if (bucket->head.next_ == &bucket->head &&
+      bucket->event_engine->Cancel(bucket->handle)) {
+    shard->buckets.erase(BucketKey(bucket->event_engine, bucket->slot));
+    delete bucket;
+  }
+  return true;
+}
+
+void DeadlineCoalescer::Fire(Bucket* bucket) {
+  std::vector<EventEngine::Closure*> expired;
+  {
+    MutexLock lock(&bucket->shard->mu);
+    bucket->shard->buckets.erase(
+        BucketKey(bucket->event_engine, bucket->slot));
+    for (Waiter* waiter = bucket->head.next_; waiter != &bucket->head;
+         waiter = waiter->next_) {
+      waiter->bucket_ = nullptr;
+      expired.push_back(waiter->on_deadline_);
+    }
+  }
+  delete bucket;
+  // Once its bucket is cleared a waiter may be destroyed, so only the
+  // collected closures are touched from here on.
+  for (EventEngine::Closure* closure : expired) closure->Run();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,145 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_CALL_DEADLINE_COALESCER_H
+#define GRPC_SRC_CORE_CALL_DEADLINE_COALESCER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+// Shares call deadline timers between the calls of a channel.
+//
+// Each deadline is rounded up to a multiple of the granularity, and all calls
+// whose deadlines round to the same slot wait on one EventEngine timer. A
+// server handling thousands of calls per second with similar timeouts thus
+// starts roughly one timer per slot instead of one per call, and most calls
+// finish without touching the timer at all: leaving a slot is a list unlink.
+// Deadlines are never enforced early, and at most one granularity late.
+//
+// Slots are kept per CPU shard, so calls on different CPUs neither share a
+// lock nor, at the cost of a few more timers, a slot.
+//
+// Enabled with GRPC_ARG_CALL_DEADLINE_COALESCING_MS; the channel places its
+// coalescer in the arena of each call it creates. A server shares one
+// coalescer between all of its connections.
+class DeadlineCoalescer final : public RefCounted<DeadlineCoalescer> {
+ private:
+  struct Bucket;
+  struct Shard;
+
+ public:
+  // A call's membership in a slot. Owned by the call, and guarded by the
+  // lock of its shard while added.
+  class Waiter {
+   public:
+    Waiter() = default;
+    Waiter(const Waiter&) = delete;
+    Waiter& operator=(const Waiter&) = delete;
+
+   private:
+    friend class DeadlineCoalescer;
+
+    // Set by Add() and only changed by the owner, so Remove() can find the
+    // lock that guards the rest.
+    Shard* shard_ = nullptr;
+    Bucket* bucket_ = nullptr;
+    Waiter* next_ = nullptr;
+    Waiter* prev_ = nullptr;
+    grpc_event_engine::experimental::EventEngine::Closure* on_deadline_ =
+        nullptr;
+  };
+
+  explicit DeadlineCoalescer(Duration granularity);
+
+  // Returns the coalescer `args` carry, if any, or else a new one if
+  // coalescing is enabled by `args`, or else nullptr.
+  static RefCountedPtr<DeadlineCoalescer> CreateFromChannelArgs(
+      const ChannelArgs& args);
+  // Returns `args` carrying a coalescer, if coalescing is enabled, for the
+  // channels of all the connections of a server to share.
+  static ChannelArgs ShareFromChannelArgs(const ChannelArgs& args);
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.deadline_coalescer";
+  }
+  static int ChannelArgsCompare(const DeadlineCoalescer* a,
+                                const DeadlineCoalescer* b) {
+    return QsortCompare(a, b);
+  }
+
+  Duration granularity() const { return granularity_; }
+
+  // Runs `on_deadline` on `event_engine` once `deadline`, rounded up to the
+  // next slot, has passed. `waiter` must not already be added.
+  void Add(Waiter* waiter, Timestamp deadline,
+           grpc_event_engine::experimental::EventEngine::Closure* on_deadline,
+           grpc_event_engine::experimental::EventEngine* event_engine);
+
+  // Returns true if `waiter` was removed before its closure was scheduled, in
+  // which case the closure will not run. Returns false if the closure has run
+  // or is about to.
+  GRPC_MUST_USE_RESULT bool Remove(Waiter* waiter);
+
+  // The time at which a deadline will be enforced.
+  Timestamp RoundUp(Timestamp deadline) const;
+
+ private:
+  struct Bucket {
+    Shard* shard;
+    grpc_event_engine::experimental::EventEngine* event_engine;
+    int64_t slot;
+    grpc_event_engine::experimental::EventEngine::TaskHandle handle;
+    // Sentinel of the circular list of waiters.
+    Waiter head;
+  };
+
+  using BucketKey =
+      std::pair<grpc_event_engine::experimental::EventEngine*, int64_t>;
+
+  struct Shard {
+    Mutex mu;
+    absl::flat_hash_map<BucketKey, Bucket*> buckets ABSL_GUARDED_BY(mu);
+  };
+
+  void Fire(Bucket* bucket);
+
+  const Duration granularity_;
+  PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
+};
+
+template <>
+struct ArenaContextType<DeadlineCoalescer> {
+  static void Destroy(DeadlineCoalescer*) {}
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_CALL_DEADLINE_COALESCER_H
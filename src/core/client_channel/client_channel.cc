@@ -47,6 +47,7 @@
 #include "absl/strings/string_view.h"
 #include "src/core/call/call_spine.h"
 #include "src/core/call/client_call.h"
+#include "src/core/call/deadline_coalescer.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/call/status_util.h"
 #include "src/core/client_channel/client_channel_internal.h"
@@ -846,6 +847,9 @@ grpc_call* ClientChannel::CreateCall(
   auto arena = call_arena_allocator()->MakeArena();
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       event_engine());
+  if (deadline_coalescer() != nullptr) {
+    arena->SetContext<DeadlineCoalescer>(deadline_coalescer());
+  }
   return MakeClientCall(parent_call, propagation_mask, cq, std::move(path),
                         std::move(authority), false, deadline,
                         compression_options(), std::move(arena), Ref());
@@ -15,6 +15,7 @@
 #include "src/core/client_channel/direct_channel.h"
 
 #include "src/core/call/client_call.h"
+#include "src/core/call/deadline_coalescer.h"
 #include "src/core/call/interception_chain.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
@@ -75,6 +76,9 @@ grpc_call* DirectChannel::CreateCall(
   auto arena = call_arena_allocator()->MakeArena();
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       event_engine_.get());
+  if (deadline_coalescer() != nullptr) {
+    arena->SetContext<DeadlineCoalescer>(deadline_coalescer());
+  }
   return MakeClientCall(parent_call, propagation_mask, cq, std::move(path),
                         std::move(authority), false, deadline,
                         compression_options(), std::move(arena), Ref());
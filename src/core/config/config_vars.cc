@@ -83,6 +83,16 @@ ABSL_FLAG(
     "EXPERIMENTAL: If non-zero, extend the lifetime of channelz nodes past the "
     "underlying object lifetime, up to this many nodes. The value may be "
     "adjusted slightly to account for implementation limits.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_posix_poller_shards, {},
+          "EXPERIMENTAL: If greater than one, the POSIX EventEngine runs this "
+          "many extra pollers, each driven by its own thread pool pinned to a "
+          "disjoint set of CPUs. Listeners open one SO_REUSEPORT socket per "
+          "poller and accepted connections stay on the poller that accepted "
+          "them.");
+ABSL_FLAG(absl::optional<bool>, grpc_posix_timer_wheel, {},
+          "EXPERIMENTAL: If true, the POSIX EventEngine keeps its timers in a "
+          "hierarchical timing wheel, with constant time insertion and "
+          "cancellation, instead of heaps.");
 
 namespace grpc_core {
 
@@ -95,6 +105,9 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_channelz_max_orphaned_nodes,
                      "GRPC_CHANNELZ_MAX_ORPHANED_NODES",
                      overrides.channelz_max_orphaned_nodes, 0)),
+      posix_poller_shards_(LoadConfig(FLAGS_grpc_posix_poller_shards,
+                                      "GRPC_POSIX_POLLER_SHARDS",
+                                      overrides.posix_poller_shards, 0)),
       enable_fork_support_(LoadConfig(
           FLAGS_grpc_enable_fork_support, "GRPC_ENABLE_FORK_SUPPORT",
           overrides.enable_fork_support, GRPC_ENABLE_FORK_SUPPORT_DEFAULT)),
@@ -108,6 +121,9 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_cpp_experimental_disable_reflection,
                      "GRPC_CPP_EXPERIMENTAL_DISABLE_REFLECTION",
                      overrides.cpp_experimental_disable_reflection, false)),
+      posix_timer_wheel_(LoadConfig(FLAGS_grpc_posix_timer_wheel,
+                                    "GRPC_POSIX_TIMER_WHEEL",
+                                    overrides.posix_timer_wheel, false)),
       dns_resolver_(LoadConfig(FLAGS_grpc_dns_resolver, "GRPC_DNS_RESOLVER",
                                overrides.dns_resolver, "")),
       verbosity_(LoadConfig(FLAGS_grpc_verbosity, "GRPC_VERBOSITY",
@@ -158,7 +174,9 @@ std::string ConfigVars::ToString() const {
       ", ssl_cipher_suites: ", "\"", absl::CEscape(SslCipherSuites()), "\"",
       ", cpp_experimental_disable_reflection: ",
       CppExperimentalDisableReflection() ? "true" : "false",
-      ", channelz_max_orphaned_nodes: ", ChannelzMaxOrphanedNodes());
+      ", channelz_max_orphaned_nodes: ", ChannelzMaxOrphanedNodes(),
+      ", posix_poller_shards: ", PosixPollerShards(),
+      ", posix_timer_wheel: ", PosixTimerWheel() ? "true" : "false");
 }
 
 }  // namespace grpc_core
@@ -36,10 +36,12 @@ class GPR_DLL ConfigVars {
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
     absl::optional<int32_t> channelz_max_orphaned_nodes;
+    absl::optional<int32_t> posix_poller_shards;
     absl::optional<bool> enable_fork_support;
     absl::optional<bool> abort_on_leaks;
     absl::optional<bool> not_use_system_ssl_roots;
     absl::optional<bool> cpp_experimental_disable_reflection;
+    absl::optional<bool> posix_timer_wheel;
     absl::optional<std::string> dns_resolver;
     absl::optional<std::string> verbosity;
     absl::optional<std::string> poll_strategy;
@@ -111,6 +113,15 @@ class GPR_DLL ConfigVars {
   int32_t ChannelzMaxOrphanedNodes() const {
     return channelz_max_orphaned_nodes_;
   }
+  // EXPERIMENTAL: If greater than one, the POSIX EventEngine runs this many
+  // extra pollers, each driven by its own thread pool pinned to a disjoint set
+  // of CPUs. Listeners open one SO_REUSEPORT socket per poller and accepted
+  // connections stay on the poller that accepted them.
+  int32_t PosixPollerShards() const { return posix_poller_shards_; }
+  // EXPERIMENTAL: If true, the POSIX EventEngine keeps its timers in a
+  // hierarchical timing wheel, with constant time insertion and cancellation,
+  // instead of heaps.
+  bool PosixTimerWheel() const { return posix_timer_wheel_; }
 
  private:
   explicit ConfigVars(const Overrides& overrides);
@@ -118,10 +129,12 @@ class GPR_DLL ConfigVars {
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
   int32_t channelz_max_orphaned_nodes_;
+  int32_t posix_poller_shards_;
   bool enable_fork_support_;
   bool abort_on_leaks_;
   bool not_use_system_ssl_roots_;
   bool cpp_experimental_disable_reflection_;
+  bool posix_timer_wheel_;
   std::string dns_resolver_;
   std::string verbosity_;
   std::string poll_strategy_;
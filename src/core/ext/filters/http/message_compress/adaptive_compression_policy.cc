@@ -0,0 +1,233 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/http/message_compress/adaptive_compression_policy.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <optional>
+#include <utility>
+
+#include "absl/hash/hash.h"
+#include "absl/log/log.h"
+#include "src/core/lib/debug/trace.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kMetricLabelDecision = "grpc.compression.decision";
+constexpr absl::string_view kMetricLabelMethod = "grpc.method";
+// The method label of unregistered methods, as in the OpenTelemetry plugin.
+constexpr absl::string_view kOtherMethod = "other";
+
+const auto kMetricMessages =
+    GlobalInstrumentsRegistry::RegisterUInt64Counter(
+        "grpc.compression.adaptive.messages",
+        "EXPERIMENTAL.  Number of outgoing messages, by whether the adaptive "
+        "compression policy compressed them and how hard.",
+        "{message}", false)
+        .Labels(kMetricLabelDecision)
+        .OptionalLabels(kMetricLabelMethod)
+        .Build();
+
+const auto kMetricDecisionChanges =
+    GlobalInstrumentsRegistry::RegisterUInt64Counter(
+        "grpc.compression.adaptive.decision_changes",
+        "EXPERIMENTAL.  Number of times the adaptive compression policy "
+        "changed its decision for a method, by the new decision.",
+        "{change}", false)
+        .Labels(kMetricLabelDecision)
+        .OptionalLabels(kMetricLabelMethod)
+        .Build();
+
+const auto kMetricRatio =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.compression.adaptive.ratio",
+        "EXPERIMENTAL.  Compressed size over uncompressed size of the messages "
+        "the adaptive compression policy compressed.",
+        "{ratio}", false)
+        .Labels(kMetricLabelDecision)
+        .OptionalLabels(kMetricLabelMethod)
+        .Build();
+
+// The fastest zlib level.
+constexpr int kLightLevel = 1;
+// The weight of each new sample in the running averages.
+constexpr double kSmoothing = 0.25;
+
+}  // namespace
+
+class AdaptiveCompressionPolicy::MethodState {
+ public:
+  // A running average of what compressing at one level achieves.
+  struct Cost {
+    double ratio = 0;
+    double ns_per_byte = 0;
+    bool measured = false;
+
+    void Update(double sample_ratio, double sample_ns_per_byte) {
+      if (!measured) {
+        ratio = sample_ratio;
+        ns_per_byte = sample_ns_per_byte;
+        measured = true;
+        return;
+      }
+      ratio += (sample_ratio - ratio) * kSmoothing;
+      ns_per_byte += (sample_ns_per_byte - ns_per_byte) * kSmoothing;
+    }
+  };
+
+  explicit MethodState(std::string method) : method(std::move(method)) {}
+
+  const std::string method;
+  Mutex mu;
+  Decision decision ABSL_GUARDED_BY(mu) = Decision::kCompress;
+  uint32_t messages_since_probe ABSL_GUARDED_BY(mu) = 0;
+  // At the configured level.
+  Cost full ABSL_GUARDED_BY(mu);
+  // At kLightLevel.
+  Cost light ABSL_GUARDED_BY(mu);
+};
+
+AdaptiveCompressionPolicy::AdaptiveCompressionPolicy(
+    Options options,
+    std::shared_ptr<GlobalStatsPluginRegistry::StatsPluginGroup> stats_plugins)
+    : options_(options),
+      // Negative levels are zlib's default, 6.
+      has_lighter_level_(options.level < 0 || options.level > kLightLevel),
+      stats_plugins_(std::move(stats_plugins)),
+      other_(std::make_unique<MethodState>(std::string(kOtherMethod))) {}
+
+AdaptiveCompressionPolicy::~AdaptiveCompressionPolicy() = default;
+
+AdaptiveCompressionPolicy::MethodState*
+AdaptiveCompressionPolicy::GetMethodState(absl::string_view method,
+                                          bool registered) {
+  if (!registered) return other_.get();
+  Shard& shard = shards_[absl::HashOf(method) % kNumShards];
+  MutexLock lock(&shard.mu);
+  auto it = shard.methods.find(method);
+  if (it != shard.methods.end()) return it->second.get();
+  // Reserve a slot before adding the method, so that racing shards cannot
+  // overshoot the limit.
+  if (num_methods_.fetch_add(1, std::memory_order_relaxed) >=
+      options_.max_methods) {
+    num_methods_.fetch_sub(1, std::memory_order_relaxed);
+    return other_.get();
+  }
+  auto state = std::make_unique<MethodState>(std::string(method));
+  MethodState* result = state.get();
+  shard.methods.emplace(result->method, std::move(state));
+  return result;
+}
+
+AdaptiveCompressionPolicy::Plan AdaptiveCompressionPolicy::PlanMessage(
+    MethodState* state) {
+  Plan plan;
+  {
+    MutexLock lock(&state->mu);
+    plan.decision = state->decision;
+    if (plan.decision != Decision::kCompress &&
+        ++state->messages_since_probe >= options_.probe_interval) {
+      state->messages_since_probe = 0;
+      plan.decision = plan.decision == Decision::kSkip && has_lighter_level_
+                          ? Decision::kCompressLighter
+                          : Decision::kCompress;
+    }
+  }
+  plan.level = plan.decision == Decision::kCompressLighter ? kLightLevel
+                                                           : options_.level;
+  if (stats_plugins_ != nullptr) {
+    stats_plugins_->AddCounter(kMetricMessages, 1,
+                               {DecisionName(plan.decision)}, {state->method});
+  }
+  return plan;
+}
+
+void AdaptiveCompressionPolicy::RecordSample(MethodState* state,
+                                             const Plan& plan,
+                                             size_t input_size,
+                                             size_t output_size,
+                                             double encode_ns) {
+  if (plan.decision == Decision::kSkip || input_size == 0) return;
+  const double ratio = static_cast<double>(output_size) / input_size;
+  if (stats_plugins_ != nullptr) {
+    stats_plugins_->RecordHistogram(kMetricRatio, ratio,
+                                    {DecisionName(plan.decision)},
+                                    {state->method});
+  }
+  auto worth_it = [this](const MethodState::Cost& cost) {
+    return cost.ratio <= options_.max_ratio &&
+           (1 - cost.ratio) * options_.ns_per_saved_byte >= cost.ns_per_byte;
+  };
+  std::optional<Decision> changed;
+  {
+    MutexLock lock(&state->mu);
+    MethodState::Cost& cost =
+        plan.decision == Decision::kCompress ? state->full : state->light;
+    // Probes are far apart, so what earlier ones found is stale.
+    if (plan.decision != state->decision) cost = {};
+    cost.Update(ratio, encode_ns / input_size);
+    // What the lighter level achieved is stale by the time compressing
+    // normally stops paying off: measure it afresh.
+    if (state->decision == Decision::kCompress && state->full.measured &&
+        !worth_it(state->full)) {
+      state->light = {};
+    }
+    Decision next;
+    if (!state->full.measured || worth_it(state->full)) {
+      next = Decision::kCompress;
+    } else if (has_lighter_level_ &&
+               (!state->light.measured || worth_it(state->light))) {
+      next = Decision::kCompressLighter;
+    } else {
+      next = Decision::kSkip;
+    }
+    if (next != state->decision) {
+      GRPC_TRACE_LOG(compression, INFO)
+          << "adaptive compression for " << state->method << ": "
+          << DecisionName(state->decision) << " -> " << DecisionName(next)
+          << " (ratio " << cost.ratio << ", " << cost.ns_per_byte
+          << "ns/byte at level " << plan.level << ")";
+      state->decision = next;
+      state->messages_since_probe = 0;
+      changed = next;
+    }
+  }
+  if (changed.has_value() && stats_plugins_ != nullptr) {
+    stats_plugins_->AddCounter(kMetricDecisionChanges, 1,
+                               {DecisionName(*changed)}, {state->method});
+  }
+}
+
+AdaptiveCompressionPolicy::Decision AdaptiveCompressionPolicy::CurrentDecision(
+    MethodState* state) {
+  MutexLock lock(&state->mu);
+  return state->decision;
+}
+
+absl::string_view AdaptiveCompressionPolicy::DecisionName(Decision decision) {
+  switch (decision) {
+    case Decision::kCompress:
+      return "compress";
+    case Decision::kCompressLighter:
+      return "compress_lighter";
+    case Decision::kSkip:
+      return "skip";
+  }
+  GPR_UNREACHABLE_CODE(return "unknown");
+}
+
+}  // namespace grpc_core
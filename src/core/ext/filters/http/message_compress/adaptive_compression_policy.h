@@ -0,0 +1,127 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_ADAPTIVE_COMPRESSION_POLICY_H
+#define GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_ADAPTIVE_COMPRESSION_POLICY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "src/core/telemetry/metrics.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// Decides, per method, whether outgoing messages are worth compressing.
+//
+// The compression ratio and encode time of recent messages are tracked for
+// the configured zlib level and for a lighter one. Compression is kept while
+// the CPU it costs is cheaper than the bytes it saves, at an exchange rate
+// given by Options::ns_per_saved_byte. Otherwise the lighter level is tried,
+// and failing that messages are sent uncompressed. While compressing lightly
+// or not at all, one message in every Options::probe_interval is compressed
+// one step harder, so that a method whose payloads become compressible again
+// is noticed.
+class AdaptiveCompressionPolicy {
+ public:
+  enum class Decision : uint8_t {
+    // Compress at the configured level.
+    kCompress,
+    // Compress at the fastest level.
+    kCompressLighter,
+    // Send uncompressed.
+    kSkip,
+  };
+
+  struct Options {
+    // The zlib level messages are normally compressed at, or
+    // GRPC_MSG_COMPRESS_DEFAULT_LEVEL.
+    int level;
+    // The CPU time worth spending to save one byte on the wire.
+    double ns_per_saved_byte = 100;
+    // Messages that do not shrink below this fraction of their size are not
+    // worth compressing at any cost.
+    double max_ratio = 0.9;
+    // While compressing lightly or not at all, one in this many messages is
+    // a probe.
+    uint32_t probe_interval = 64;
+    // Registered methods beyond this many share the state of unregistered
+    // ones.
+    size_t max_methods = 1000;
+  };
+
+  // How to send one message.
+  struct Plan {
+    Decision decision;
+    // The zlib level to compress at, unless skipping.
+    int level;
+  };
+
+  class MethodState;
+
+  AdaptiveCompressionPolicy(
+      Options options,
+      std::shared_ptr<GlobalStatsPluginRegistry::StatsPluginGroup>
+          stats_plugins);
+  ~AdaptiveCompressionPolicy();
+
+  // Returns the state for a method, for the life of the policy. Unregistered
+  // methods, whose paths are chosen by the peer, share one state labelled
+  // "other", so that they can neither fill the table nor the metric labels.
+  MethodState* GetMethodState(absl::string_view method, bool registered);
+
+  // Plans the next message of a method.
+  Plan PlanMessage(MethodState* state);
+  // Records what compressing a message as planned achieved. output_size is
+  // the input size if the message did not shrink.
+  void RecordSample(MethodState* state, const Plan& plan, size_t input_size,
+                    size_t output_size, double encode_ns);
+
+  // The decision currently taken for a method, ignoring probes.
+  Decision CurrentDecision(MethodState* state);
+
+  static absl::string_view DecisionName(Decision decision);
+
+ private:
+  // Methods are spread over shards by hash, so that calls to different
+  // methods do not contend on one lock to find their state.
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    Mutex mu;
+    absl::flat_hash_map<std::string, std::unique_ptr<MethodState>> methods
+        ABSL_GUARDED_BY(mu);
+  };
+
+  const Options options_;
+  // Whether there is a faster level than options_.level to fall back to.
+  const bool has_lighter_level_;
+  std::shared_ptr<GlobalStatsPluginRegistry::StatsPluginGroup> stats_plugins_;
+  // Shared by unregistered methods and by those beyond options_.max_methods.
+  const std::unique_ptr<MethodState> other_;
+  std::array<Shard, kNumShards> shards_;
+  std::atomic<size_t> num_methods_{0};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_ADAPTIVE_COMPRESSION_POLICY_H
@@ -21,9 +21,11 @@
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
 
 #include "absl/log/check.h"
@@ -31,6 +33,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "src/core/call/metadata_batch.h"
+#include "src/core/client_channel/client_channel_args.h"
 #include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
@@ -38,6 +41,7 @@
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/latch.h"
@@ -48,7 +52,9 @@
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/util/latent_see.h"
+#include "src/core/util/load_file.h"
 
 namespace grpc_core {
 
@@ -73,7 +79,26 @@ ServerCompressionFilter::Create(const ChannelArgs& args, ChannelFilter::Args) {
   return std::make_unique<ServerCompressionFilter>(args);
 }
 
-ChannelCompression::ChannelCompression(const ChannelArgs& args)
+namespace {
+
+std::shared_ptr<GlobalStatsPluginRegistry::StatsPluginGroup>
+GetStatsPluginGroup(const ChannelArgs& args, bool is_client) {
+  if (!is_client) {
+    return GlobalStatsPluginRegistry::GetStatsPluginsForServer(args);
+  }
+  grpc_event_engine::experimental::ChannelArgsEndpointConfig endpoint_config(
+      args);
+  experimental::StatsPluginChannelScope scope(
+      args.GetString(GRPC_ARG_SERVER_URI).value_or(""),
+      args.GetString(GRPC_ARG_DEFAULT_AUTHORITY).value_or(""),
+      endpoint_config);
+  return GlobalStatsPluginRegistry::GetStatsPluginsForChannel(scope);
+}
+
+}  // namespace
+
+ChannelCompression::ChannelCompression(const ChannelArgs& args,
+                                       bool is_client)
     : max_recv_size_(GetMaxRecvSizeFromChannelArgs(args)),
       message_size_service_config_parser_index_(
           MessageSizeParser::ParserIndex()),
@@ -82,6 +107,10 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
               GRPC_COMPRESS_NONE)),
       enabled_compression_algorithms_(
           CompressionAlgorithmSet::FromChannelArgs(args)),
+      zlib_level_(args.GetInt(GRPC_COMPRESSION_CHANNEL_ZLIB_LEVEL)
+                      .value_or(GRPC_MSG_COMPRESS_DEFAULT_LEVEL)),
+      zstd_level_(args.GetInt(GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL)
+                      .value_or(GRPC_MSG_COMPRESS_DEFAULT_LEVEL)),
       enable_compression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION).value_or(true)),
       enable_decompression_(
@@ -98,10 +127,62 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
                << " not enabled: switching to none";
     default_compression_algorithm_ = GRPC_COMPRESS_NONE;
   }
+  auto zstd_dictionary_path =
+      args.GetOwnedString(GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY);
+  if (zstd_dictionary_path.has_value()) {
+    auto content = LoadFile(*zstd_dictionary_path, false);
+    absl::StatusOr<RefCountedPtr<ZstdDictionary>> dictionary =
+        content.ok() ? ZstdDictionary::Create(content->as_string_view())
+                     : content.status();
+    if (dictionary.ok()) {
+      zstd_dictionary_ = std::move(*dictionary);
+    } else {
+      LOG(ERROR) << "zstd dictionary " << *zstd_dictionary_path
+                 << " not loaded: " << dictionary.status();
+    }
+  }
+  if (args.GetBool(GRPC_COMPRESSION_CHANNEL_ADAPTIVE).value_or(false)) {
+    AdaptiveCompressionPolicy::Options options;
+    options.level = zlib_level_;
+    auto ns_per_saved_byte =
+        args.GetInt(GRPC_COMPRESSION_CHANNEL_ADAPTIVE_NS_PER_SAVED_BYTE);
+    if (ns_per_saved_byte.has_value() && *ns_per_saved_byte >= 0) {
+      options.ns_per_saved_byte = *ns_per_saved_byte;
+    }
+    adaptive_policy_ = std::make_unique<AdaptiveCompressionPolicy>(
+        options, GetStatsPluginGroup(args, is_client));
+  }
+}
+
+int ChannelCompression::ConfiguredLevel(
+    grpc_compression_algorithm algorithm) const {
+  switch (algorithm) {
+    case GRPC_COMPRESS_DEFLATE:
+    case GRPC_COMPRESS_GZIP:
+      return zlib_level_;
+    case GRPC_COMPRESS_ZSTD:
+      return zstd_level_;
+    default:
+      return GRPC_MSG_COMPRESS_DEFAULT_LEVEL;
+  }
+}
+
+AdaptiveCompressionPolicy::MethodState* ChannelCompression::AdaptiveMethodState(
+    const ClientMetadata& client_initial_metadata) const {
+  if (adaptive_policy_ == nullptr) return nullptr;
+  const Slice* path = client_initial_metadata.get_pointer(HttpPathMetadata());
+  if (path == nullptr) return nullptr;
+  // On clients this is 1 for methods the application registered, and on
+  // servers the method the server registered; either way, non-null.
+  const bool registered =
+      client_initial_metadata.get(GrpcRegisteredMethod()).value_or(nullptr) !=
+      nullptr;
+  return adaptive_policy_->GetMethodState(path->as_string_view(), registered);
 }
 
 MessageHandle ChannelCompression::CompressMessage(
     MessageHandle message, grpc_compression_algorithm algorithm,
+    AdaptiveCompressionPolicy::MethodState* adaptive_state,
     CallTracerInterface* call_tracer) const {
   GRPC_TRACE_LOG(compression, INFO)
       << "CompressMessage: len=" << message->payload()->Length()
@@ -117,11 +198,38 @@ MessageHandle ChannelCompression::CompressMessage(
       (flags & (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS))) {
     return message;
   }
+  // Ask the adaptive policy, if any, whether this message is worth
+  // compressing and how hard.
+  int level = ConfiguredLevel(algorithm);
+  std::optional<AdaptiveCompressionPolicy::Plan> plan;
+  if (adaptive_state != nullptr) {
+    plan = adaptive_policy_->PlanMessage(adaptive_state);
+    if (plan->decision == AdaptiveCompressionPolicy::Decision::kSkip) {
+      GRPC_TRACE_LOG(compression, INFO)
+          << "Adaptive compression skipped message. Input size: "
+          << message->payload()->Length();
+      return message;
+    }
+    // The lighter level is the fastest for every algorithm.
+    if (plan->decision ==
+        AdaptiveCompressionPolicy::Decision::kCompressLighter) {
+      level = plan->level;
+    }
+  }
   // Try to compress the payload.
   SliceBuffer tmp;
   SliceBuffer* payload = message->payload();
-  bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
-                                        tmp.c_slice_buffer());
+  const auto start = std::chrono::steady_clock::now();
+  bool did_compress = grpc_msg_compress_with_level(
+      algorithm, level, payload->c_slice_buffer(), tmp.c_slice_buffer(),
+      zstd_dictionary_.get());
+  if (plan.has_value()) {
+    const std::chrono::duration<double, std::nano> encode_time =
+        std::chrono::steady_clock::now() - start;
+    adaptive_policy_->RecordSample(
+        adaptive_state, *plan, payload->Length(),
+        did_compress ? tmp.Length() : payload->Length(), encode_time.count());
+  }
   // If we achieved compression send it as compressed, otherwise send it as (to
   // avoid spending cycles on the receiver decompressing).
   if (did_compress) {
@@ -179,10 +287,24 @@ absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
       (message->flags() & GRPC_WRITE_INTERNAL_COMPRESS) == 0) {
     return std::move(message);
   }
-  // Try to decompress the payload.
+  // Try to decompress the payload, giving up as soon as it exceeds the max
+  // message length rather than inflating all of it first.
   SliceBuffer decompressed_slices;
-  if (grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
-                          decompressed_slices.c_slice_buffer()) == 0) {
+  const size_t max_decompressed_size =
+      args.max_recv_message_length.has_value()
+          ? static_cast<size_t>(*args.max_recv_message_length)
+          : SIZE_MAX;
+  const int r = grpc_msg_decompress_with_limit(
+      args.algorithm, max_decompressed_size,
+      message->payload()->c_slice_buffer(),
+      decompressed_slices.c_slice_buffer(), zstd_dictionary_.get());
+  if (r == GRPC_MSG_DECOMPRESS_TOO_LARGE) {
+    return absl::ResourceExhaustedError(absl::StrFormat(
+        "%s: Received message larger than max after decompression (more "
+        "than %d bytes)",
+        is_client ? "CLIENT" : "SERVER", *args.max_recv_message_length));
+  }
+  if (r == 0) {
     return absl::InternalError(
         absl::StrCat("Unexpected error decompressing data for algorithm ",
                      CompressionAlgorithmAsString(args.algorithm)));
@@ -233,6 +355,7 @@ void ClientCompressionFilter::Call::OnClientInitialMetadata(
       "ClientCompressionFilter::Call::OnClientInitialMetadata");
   compression_algorithm_ =
       filter->compression_engine_.HandleOutgoingMetadata(md);
+  adaptive_state_ = filter->compression_engine_.AdaptiveMethodState(md);
   call_tracer_ = MaybeGetContext<CallTracerInterface>();
 }
 
@@ -241,7 +364,8 @@ MessageHandle ClientCompressionFilter::Call::OnClientToServerMessage(
   GRPC_LATENT_SEE_SCOPE(
       "ClientCompressionFilter::Call::OnClientToServerMessage");
   return filter->compression_engine_.CompressMessage(
-      std::move(message), compression_algorithm_, call_tracer_);
+      std::move(message), compression_algorithm_, adaptive_state_,
+      call_tracer_);
 }
 
 void ClientCompressionFilter::Call::OnServerInitialMetadata(
@@ -265,6 +389,7 @@ void ServerCompressionFilter::Call::OnClientInitialMetadata(
   GRPC_LATENT_SEE_SCOPE(
       "ServerCompressionFilter::Call::OnClientInitialMetadata");
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
+  adaptive_state_ = filter->compression_engine_.AdaptiveMethodState(md);
 }
 
 absl::StatusOr<MessageHandle>
@@ -290,7 +415,7 @@ MessageHandle ServerCompressionFilter::Call::OnServerToClientMessage(
   GRPC_LATENT_SEE_SCOPE(
       "ServerCompressionFilter::Call::OnServerToClientMessage");
   return filter->compression_engine_.CompressMessage(
-      std::move(message), compression_algorithm_,
+      std::move(message), compression_algorithm_, adaptive_state_,
       MaybeGetContext<CallTracerInterface>());
 }
 
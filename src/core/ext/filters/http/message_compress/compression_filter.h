@@ -25,18 +25,22 @@
 #include <stdint.h>
 
 #include <cstddef>
+#include <memory>
 #include <optional>
 
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/channelz/property_list.h"
+#include "src/core/ext/filters/http/message_compress/adaptive_compression_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted_ptr.h"
 
 namespace grpc_core {
 
@@ -64,7 +68,7 @@ namespace grpc_core {
 
 class ChannelCompression {
  public:
-  explicit ChannelCompression(const ChannelArgs& args);
+  ChannelCompression(const ChannelArgs& args, bool is_client);
 
   struct DecompressArgs {
     grpc_compression_algorithm algorithm;
@@ -83,11 +87,16 @@ class ChannelCompression {
       grpc_metadata_batch& outgoing_metadata);
   DecompressArgs HandleIncomingMetadata(
       const grpc_metadata_batch& incoming_metadata);
+  // The adaptive compression state for the call's method, or nullptr if
+  // messages are compressed as configured.
+  AdaptiveCompressionPolicy::MethodState* AdaptiveMethodState(
+      const ClientMetadata& client_initial_metadata) const;
 
   // Compress one message synchronously.
-  MessageHandle CompressMessage(MessageHandle message,
-                                grpc_compression_algorithm algorithm,
-                                CallTracerInterface* call_tracer) const;
+  MessageHandle CompressMessage(
+      MessageHandle message, grpc_compression_algorithm algorithm,
+      AdaptiveCompressionPolicy::MethodState* adaptive_state,
+      CallTracerInterface* call_tracer) const;
   // Decompress one message synchronously.
   absl::StatusOr<MessageHandle> DecompressMessage(
       bool is_client, MessageHandle message, DecompressArgs args,
@@ -100,11 +109,19 @@ class ChannelCompression {
              CompressionAlgorithmAsString(default_compression_algorithm_))
         .Set("enabled_compression_algorithms",
              enabled_compression_algorithms_.ToString())
+        .Set("zlib_level", zlib_level_)
+        .Set("zstd_level", zstd_level_)
+        .Set("zstd_dictionary", zstd_dictionary_ != nullptr)
+        .Set("adaptive_compression", adaptive_policy_ != nullptr)
         .Set("enable_compression", enable_compression_)
         .Set("enable_decompression", enable_decompression_);
   }
 
  private:
+  // The level messages in 'algorithm' are compressed at, unless the adaptive
+  // policy says to compress lightly.
+  int ConfiguredLevel(grpc_compression_algorithm algorithm) const;
+
   // Max receive message length, if set.
   std::optional<uint32_t> max_recv_size_;
   size_t message_size_service_config_parser_index_;
@@ -112,10 +129,19 @@ class ChannelCompression {
   grpc_compression_algorithm default_compression_algorithm_;
   // Enabled compression algorithms.
   CompressionAlgorithmSet enabled_compression_algorithms_;
+  // The level deflate and gzip compress at.
+  int zlib_level_;
+  // The level zstd compresses at.
+  int zstd_level_;
+  // The dictionary zstd messages are compressed and decompressed with, if
+  // any.
+  RefCountedPtr<ZstdDictionary> zstd_dictionary_;
   // Is compression enabled?
   bool enable_compression_;
   // Is decompression enabled?
   bool enable_decompression_;
+  // Decides per method whether compressing is worth it, if enabled.
+  std::unique_ptr<AdaptiveCompressionPolicy> adaptive_policy_;
 };
 
 class ClientCompressionFilter final
@@ -131,7 +157,7 @@ class ClientCompressionFilter final
 
   explicit ClientCompressionFilter(const ChannelArgs& args)
       : channelz::DataSource(args.GetObjectRef<channelz::BaseNode>()),
-        compression_engine_(args) {
+        compression_engine_(args, /*is_client=*/true) {
     SourceConstructed();
   }
   ~ClientCompressionFilter() override { SourceDestructing(); }
@@ -161,6 +187,7 @@ class ClientCompressionFilter final
    private:
     grpc_compression_algorithm compression_algorithm_;
     ChannelCompression::DecompressArgs decompress_args_;
+    AdaptiveCompressionPolicy::MethodState* adaptive_state_ = nullptr;
     // TODO(yashykt): Remove call_tracer_ after migration to call v3 stack. (See
     // https://github.com/grpc/grpc/pull/38729 for more information.)
     CallTracerInterface* call_tracer_ = nullptr;
@@ -183,7 +210,7 @@ class ServerCompressionFilter final
 
   explicit ServerCompressionFilter(const ChannelArgs& args)
       : channelz::DataSource(args.GetObjectRef<channelz::BaseNode>()),
-        compression_engine_(args) {
+        compression_engine_(args, /*is_client=*/false) {
     SourceConstructed();
   }
   ~ServerCompressionFilter() override { SourceDestructing(); }
@@ -213,6 +240,7 @@ class ServerCompressionFilter final
    private:
     ChannelCompression::DecompressArgs decompress_args_;
     grpc_compression_algorithm compression_algorithm_;
+    AdaptiveCompressionPolicy::MethodState* adaptive_state_ = nullptr;
   };
 
  private:
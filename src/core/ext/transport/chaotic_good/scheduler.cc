@@ -536,6 +536,133 @@ class SpanRoundRobinScheduler final : public SpanScheduler {
   EndOfBurst end_of_burst_ = EndOfBurst::kRandomDeliveryTime;
 };
 
+// DeliveryTimeScheduler sends each message to the channel expected to deliver
+// it soonest, counting the bytes already allocated to that channel this step.
+// Its name is "edt" and takes the parameters:
+//   alpha - the weight given to each new rate measurement of a channel, in
+//     (0, 1]. Rates are smoothed across steps so that one noisy measurement
+//     does not swing a whole step's placement; 1 disables smoothing.
+//   busy - what to do when the best channel is not ready:
+//     wait - hold the message (and so the rest of the queue) until it is
+//     best_ready - send it on the best ready channel instead
+class DeliveryTimeScheduler final : public Scheduler {
+ public:
+  void NewStep(double outstanding_bytes, double min_tokens) override {
+    outstanding_bytes_ = outstanding_bytes;
+    min_tokens_ = min_tokens;
+    channels_.clear();
+  }
+
+  void SetConfig(absl::string_view name, absl::string_view value) override {
+    ParseConfig(name, value)
+        .Var("alpha", alpha_)
+        .Var("busy", busy_, {{"wait", Busy::kWait},
+                             {"best_ready", Busy::kBestReady}})
+        .Check();
+    alpha_ = std::clamp(alpha_, 1e-3, 1.0);
+  }
+
+  void AddChannel(uint32_t id, bool ready, double start_time,
+                  double bytes_per_second) override {
+    if (id >= smoothed_rate_.size()) smoothed_rate_.resize(id + 1, 0.0);
+    double& rate = smoothed_rate_[id];
+    if (rate <= 0.0) {
+      rate = bytes_per_second;
+    } else {
+      rate += alpha_ * (bytes_per_second - rate);
+    }
+    channels_.push_back(Channel{id, ready, start_time, rate, 0.0});
+  }
+
+  void MakePlan(TcpZTraceCollector& ztrace_collector) override {
+    // Break ties between equally good channels at random.
+    std::shuffle(channels_.begin(), channels_.end(), SharedBitGen());
+    size_t num_ready = 0;
+    for (const Channel& channel : channels_) num_ready += channel.ready;
+    if (num_ready == 0) return;
+    ztrace_collector.Append([this, num_ready]() {
+      TraceWriteSchedule trace;
+      trace.channels.reserve(channels_.size());
+      for (const auto& channel : channels_) {
+        trace.channels.push_back(TraceScheduledChannel{
+            channel.id, channel.ready, channel.start_time,
+            channel.bytes_per_second, 0.0});
+      }
+      std::sort(trace.channels.begin(), trace.channels.end(),
+                [](const TraceScheduledChannel& a,
+                   const TraceScheduledChannel& b) { return a.id < b.id; });
+      trace.outstanding_bytes = outstanding_bytes_;
+      trace.end_time_requested = 0.0;
+      trace.end_time_adjusted = 0.0;
+      trace.min_tokens = min_tokens_;
+      trace.num_ready = num_ready;
+      return trace;
+    });
+  }
+
+  std::optional<uint32_t> AllocateMessage(uint64_t bytes) override {
+    Channel* best = nullptr;
+    Channel* best_ready = nullptr;
+    for (Channel& channel : channels_) {
+      const double delivery_time = channel.DeliveryTime(bytes);
+      if (best == nullptr || delivery_time < best->DeliveryTime(bytes)) {
+        best = &channel;
+      }
+      if (channel.ready && (best_ready == nullptr ||
+                            delivery_time < best_ready->DeliveryTime(bytes))) {
+        best_ready = &channel;
+      }
+    }
+    Channel* chosen = busy_ == Busy::kWait ? best : best_ready;
+    if (chosen == nullptr || !chosen->ready) return std::nullopt;
+    chosen->queued_bytes += bytes;
+    return chosen->id;
+  }
+
+  std::string Config() const override {
+    return absl::StrCat("edt:alpha=", alpha_, ":busy=", busy_);
+  }
+
+ private:
+  enum class Busy {
+    kWait,
+    kBestReady,
+  };
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink, Busy busy) {
+    switch (busy) {
+      case Busy::kWait:
+        sink.Append("wait");
+        break;
+      case Busy::kBestReady:
+        sink.Append("best_ready");
+        break;
+    }
+  }
+
+  struct Channel {
+    uint32_t id;
+    bool ready;
+    double start_time;
+    double bytes_per_second;
+    // Bytes allocated to this channel in the current step.
+    double queued_bytes;
+
+    double DeliveryTime(uint64_t bytes) const {
+      return start_time + (queued_bytes + bytes) / bytes_per_second;
+    }
+  };
+
+  double alpha_ = 0.25;
+  Busy busy_ = Busy::kWait;
+  double outstanding_bytes_ = 0.0;
+  double min_tokens_ = 0.0;
+  std::vector<Channel> channels_;
+  // Indexed by channel id; zero until a channel is first seen.
+  std::vector<double> smoothed_rate_;
+};
+
 }  // namespace
 
 std::unique_ptr<Scheduler> MakeScheduler(absl::string_view config) {
@@ -546,6 +673,8 @@ std::unique_ptr<Scheduler> MakeScheduler(absl::string_view config) {
     scheduler = std::make_unique<SpanRoundRobinScheduler>();
   } else if (name == "rand") {
     scheduler = std::make_unique<RandomChoiceScheduler>();
+  } else if (name == "edt") {
+    scheduler = std::make_unique<DeliveryTimeScheduler>();
   } else {
     LOG(ERROR) << "Unknown scheduler type: " << name
                << " using spanrr scheduler";
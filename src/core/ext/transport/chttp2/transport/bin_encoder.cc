@@ -24,6 +24,7 @@
 
 #include "absl/log/check.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+#include "src/core/ext/transport/chttp2/transport/simd_base64.h"
 
 static const char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
@@ -32,7 +33,7 @@ struct b64_huff_sym {
   uint16_t bits;
   uint8_t length;
 };
-static const b64_huff_sym huff_alphabet[64] = {
+static constexpr b64_huff_sym huff_alphabet[64] = {
     {0x21, 6}, {0x5d, 7}, {0x5e, 7},   {0x5f, 7}, {0x60, 7}, {0x61, 7},
     {0x62, 7}, {0x63, 7}, {0x64, 7},   {0x65, 7}, {0x66, 7}, {0x67, 7},
     {0x68, 7}, {0x69, 7}, {0x6a, 7},   {0x6b, 7}, {0x6c, 7}, {0x6d, 7},
@@ -47,6 +48,63 @@ static const b64_huff_sym huff_alphabet[64] = {
 
 static const uint8_t tail_xtra[3] = {0, 2, 3};
 
+// Huffman codes of every pair of base64 symbols, indexed by the 12 bits of
+// input they encode: bits 5-26 hold the two codes, bits 0-4 their length.
+struct b64_huff_pair_table {
+  constexpr b64_huff_pair_table() : pairs() {
+    for (uint32_t i = 0; i < 4096; i++) {
+      const b64_huff_sym a = huff_alphabet[i >> 6];
+      const b64_huff_sym b = huff_alphabet[i & 0x3f];
+      pairs[i] = ((((static_cast<uint32_t>(a.bits) << b.length) | b.bits))
+                  << 5) |
+                 (a.length + b.length);
+    }
+  }
+  uint32_t pairs[4096];
+};
+static constexpr b64_huff_pair_table huff_pairs;
+
+// Accumulates Huffman codes, writing out whole bytes up to eight at a time.
+// The output buffer needs eight bytes of slack past the encoded length.
+class huff_writer {
+ public:
+  explicit huff_writer(uint8_t* out) : out_(out) {}
+
+  // At most 64 bits may be pending when Flush() is next called.
+  void Add(uint64_t bits, uint32_t length) {
+    temp_ = (temp_ << length) | bits;
+    temp_length_ += length;
+  }
+
+  uint32_t pending_bits() const { return temp_length_; }
+
+  void Flush() {
+    if (temp_length_ < 8) return;
+    const uint64_t v = temp_ << (64 - temp_length_);
+    for (int i = 0; i < 8; i++) {
+      out_[i] = static_cast<uint8_t>(v >> (56 - 8 * i));
+    }
+    out_ += temp_length_ / 8;
+    temp_length_ %= 8;
+  }
+
+  // Pads the last byte with the most significant bits of EOS (all ones), and
+  // returns the end of the output.
+  uint8_t* Finish() {
+    Flush();
+    if (temp_length_ != 0) {
+      *out_++ = static_cast<uint8_t>((temp_ << (8 - temp_length_)) |
+                                     (0xffu >> temp_length_));
+    }
+    return out_;
+  }
+
+ private:
+  uint8_t* out_;
+  uint64_t temp_ = 0;
+  uint32_t temp_length_ = 0;
+};
+
 grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   size_t input_length = GRPC_SLICE_LENGTH(input);
   size_t input_triplets = input_length / 3;
@@ -55,17 +113,12 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   grpc_slice output = GRPC_SLICE_MALLOC(output_length);
   const uint8_t* in = GRPC_SLICE_START_PTR(input);
   char* out = reinterpret_cast<char*> GRPC_SLICE_START_PTR(output);
-  size_t i;
 
   // encode full triplets
-  for (i = 0; i < input_triplets; i++) {
-    out[0] = alphabet[in[0] >> 2];
-    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
-    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
-    out[3] = alphabet[in[2] & 0x3f];
-    out += 4;
-    in += 3;
-  }
+  grpc_core::Base64EncodeTriplets(in, input_triplets,
+                                  reinterpret_cast<uint8_t*>(out));
+  out += input_triplets * 4;
+  in += input_triplets * 3;
 
   // encode the remaining bytes
   switch (tail_case) {
@@ -92,80 +145,30 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
 }
 
 grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
-  size_t nbits;
-  const uint8_t* in;
-  uint8_t* out;
-  grpc_slice output;
-  uint64_t temp = 0;
-  uint32_t temp_length = 0;
-
-  nbits = 0;
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
+  size_t nbits = 0;
+  for (const uint8_t* in = GRPC_SLICE_START_PTR(input);
+       in != GRPC_SLICE_END_PTR(input); ++in) {
     nbits += grpc_chttp2_huffsyms[*in].length;
   }
-
-  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
-    }
-  }
-
-  if (temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out++ =
-        static_cast<uint8_t>(static_cast<uint8_t>(temp << (8u - temp_length)) |
-                             static_cast<uint8_t>(0xffu >> temp_length));
+  const size_t output_length = nbits / 8 + (nbits % 8 != 0);
+
+  grpc_slice output = GRPC_SLICE_MALLOC(output_length + 8);
+  huff_writer out(GRPC_SLICE_START_PTR(output));
+  for (const uint8_t* in = GRPC_SLICE_START_PTR(input);
+       in != GRPC_SLICE_END_PTR(input); ++in) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    out.Add(sym.bits, sym.length);
+    // Codes are at most 30 bits long: flushing at 32 pending bits keeps room
+    // for the next one.
+    if (out.pending_bits() >= 32) out.Flush();
   }
+  uint8_t* end = out.Finish();
 
-  CHECK(out == GRPC_SLICE_END_PTR(output));
-
+  CHECK(end == GRPC_SLICE_START_PTR(output) + output_length);
+  GRPC_SLICE_SET_LENGTH(output, output_length);
   return output;
 }
 
-struct huff_out {
-  uint32_t temp;
-  uint32_t temp_length;
-  uint8_t* out;
-};
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
-  }
-}
-
-static void enc_add2(huff_out* out, uint8_t a, uint8_t b, uint32_t* wire_size) {
-  *wire_size += 2;
-  b64_huff_sym sa = huff_alphabet[a];
-  b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
-  out->temp_length +=
-      static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
-  enc_flush_some(out);
-}
-
-static void enc_add1(huff_out* out, uint8_t a, uint32_t* wire_size) {
-  *wire_size += 1;
-  b64_huff_sym sa = huff_alphabet[a];
-  out->temp = (out->temp << sa.length) | sa.bits;
-  out->temp_length += sa.length;
-  enc_flush_some(out);
-}
-
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     const grpc_slice& input, uint32_t* wire_size) {
   size_t input_length = GRPC_SLICE_LENGTH(input);
@@ -174,26 +177,21 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   size_t output_syms = (input_triplets * 4) + tail_xtra[tail_case];
   size_t max_output_bits = 11 * output_syms;
   size_t max_output_length = (max_output_bits / 8) + (max_output_bits % 8 != 0);
-  grpc_slice output = GRPC_SLICE_MALLOC(max_output_length);
+  grpc_slice output = GRPC_SLICE_MALLOC(max_output_length + 8);
   const uint8_t* in = GRPC_SLICE_START_PTR(input);
   uint8_t* start_out = GRPC_SLICE_START_PTR(output);
-  huff_out out;
-  size_t i;
-
-  out.temp = 0;
-  out.temp_length = 0;
-  out.out = start_out;
-  *wire_size = 0;
-
-  // encode full triplets
-  for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f, wire_size);
+  huff_writer out(start_out);
+
+  // encode full triplets: each is two pairs of base64 symbols, at most 44
+  // bits in all
+  for (size_t i = 0; i < input_triplets; i++) {
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    const uint32_t first = huff_pairs.pairs[triplet >> 12];
+    const uint32_t second = huff_pairs.pairs[triplet & 0xfff];
+    out.Add(first >> 5, first & 0x1f);
+    out.Add(second >> 5, second & 0x1f);
+    out.Flush();
     in += 3;
   }
 
@@ -201,33 +199,27 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   switch (tail_case) {
     case 0:
       break;
-    case 1:
-      enc_add2(&out, in[0] >> 2, static_cast<uint8_t>((in[0] & 0x3) << 4),
-               wire_size);
+    case 1: {
+      const uint32_t pair = huff_pairs.pairs[static_cast<uint32_t>(in[0]) << 4];
+      out.Add(pair >> 5, pair & 0x1f);
       in += 1;
       break;
+    }
     case 2: {
-      const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-      const uint8_t high_to_low = in[1] >> 4;
-      enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-      enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2), wire_size);
+      const uint32_t pair =
+          huff_pairs.pairs[(static_cast<uint32_t>(in[0]) << 4) | (in[1] >> 4)];
+      const b64_huff_sym last = huff_alphabet[(in[1] & 0xf) << 2];
+      out.Add(pair >> 5, pair & 0x1f);
+      out.Add(last.bits, last.length);
       in += 2;
       break;
     }
   }
+  uint8_t* end = out.Finish();
 
-  if (out.temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out.out++ = static_cast<uint8_t>(
-        static_cast<uint8_t>(out.temp << (8u - out.temp_length)) |
-        static_cast<uint8_t>(0xffu >> out.temp_length));
-  }
-
-  CHECK(out.out <= GRPC_SLICE_END_PTR(output));
-  GRPC_SLICE_SET_LENGTH(output, out.out - start_out);
+  CHECK(end <= start_out + max_output_length);
+  GRPC_SLICE_SET_LENGTH(output, end - start_out);
+  *wire_size = static_cast<uint32_t>(output_syms);
 
   CHECK(in == GRPC_SLICE_END_PTR(input));
   return output;
@@ -48,6 +48,8 @@ TestOnlyTransportTargetWindowEstimatesMocker*
 namespace {
 
 constexpr const int64_t kMaxWindowUpdateSize = (1u << 31) - 1;
+// How long a stream's consumption rate is measured over before it is updated.
+constexpr Duration kStreamRateSampleInterval = Duration::Milliseconds(50);
 
 }  // namespace
 
@@ -133,6 +135,8 @@ absl::Status StreamFlowControl::IncomingUpdateContext::RecvData(
 
     tfc_upd_.UpdateAnnouncedWindowDelta(&sfc_->announced_window_delta_,
                                         -incoming_frame_size);
+    sfc_->rate_estimator_.AddIncomingBytes(incoming_frame_size,
+                                           Timestamp::Now());
     sfc_->min_progress_size_ -=
         std::min(sfc_->min_progress_size_, incoming_frame_size);
     return absl::OkStatus();
@@ -226,6 +230,32 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   }
 }
 
+double TransportFlowControl::StreamWindowScaleBasedOnMemoryPressure() const {
+  const double memory_pressure =
+      memory_owner_->GetPressureInfo().pressure_control_value;
+  // Streams keep their extra window while the transport shrinks the initial
+  // window towards the BDP, so that busy streams are not held back with the
+  // rest, and give it up past 50% memory pressure as the initial window drops
+  // to zero.
+  const double kFullScalePressure = 0.5;
+  const double kZeroScalePressure = 1.0;
+  if (memory_pressure < kFullScalePressure) return 1.0;
+  if (memory_pressure >= kZeroScalePressure) return 0.0;
+  return (kZeroScalePressure - memory_pressure) /
+         (kZeroScalePressure - kFullScalePressure);
+}
+
+int64_t TransportFlowControl::StreamWindowDeltaForRate(
+    double bytes_per_second) const {
+  const double window = 2.0 * bytes_per_second *
+                        bdp_estimator_.EstimateRtt().seconds() *
+                        stream_window_scale_;
+  if (window <= acked_init_window_) return 0;
+  return static_cast<int64_t>(
+      std::min(window - acked_init_window_,
+               static_cast<double>(kMaxWindowDelta)));
+}
+
 void TransportFlowControl::UpdateSetting(
     absl::string_view name, int64_t* desired_value, uint32_t new_desired_value,
     FlowControlAction* action,
@@ -308,6 +338,7 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
           &action,
           &FlowControlAction::set_preferred_rx_crypto_frame_size_update);
     }
+    stream_window_scale_ = StreamWindowScaleBasedOnMemoryPressure();
   }
   return UpdateAction(action);
 }
@@ -326,7 +357,9 @@ std::string TransportFlowControl::Stats::ToString() const {
                       announced_stream_total_over_incoming_window,
                       " bdp_accumulator: ", bdp_accumulator,
                       " bdp_estimate: ", bdp_estimate,
-                      " bdp_bw_est: ", bdp_bw_est);
+                      " bdp_bw_est: ", bdp_bw_est,
+                      " bdp_rtt_ms: ", bdp_rtt_ms,
+                      " stream_window_scale: ", stream_window_scale);
 }
 
 void StreamFlowControl::SentUpdate(uint32_t announce) {
@@ -347,7 +380,10 @@ uint32_t StreamFlowControl::DesiredAnnounceSize() const {
         return announced_window_delta_;
       }
     } else {
-      return std::min(min_progress_size_, kMaxWindowDelta);
+      // A reader is waiting: open the window far enough for the stream to
+      // keep consuming at the rate it has been.
+      return std::max(std::min(min_progress_size_, kMaxWindowDelta),
+                      bdp_window_delta());
     }
   }();
   return Clamp(desired_window_delta - announced_window_delta_, int64_t{0},
@@ -391,7 +427,26 @@ std::string StreamFlowControl::Stats::ToString() const {
   return absl::StrCat("min_progress_size: ", min_progress_size,
                       " remote_window_delta: ", remote_window_delta,
                       " announced_window_delta: ", announced_window_delta,
-                      pending_size.has_value() ? *pending_size : -1);
+                      pending_size.has_value() ? *pending_size : -1,
+                      " consumption_rate: ", consumption_rate,
+                      " bdp_window_delta: ", bdp_window_delta);
+}
+
+void StreamRateEstimator::AddIncomingBytes(int64_t num_bytes, Timestamp now) {
+  if (sample_start_ == Timestamp::InfPast()) {
+    // The first bytes mark the start of the first sample.
+    sample_start_ = now;
+    return;
+  }
+  sample_bytes_ += num_bytes;
+  const Duration elapsed = now - sample_start_;
+  if (elapsed < kStreamRateSampleInterval) return;
+  const double sample = sample_bytes_ / elapsed.seconds();
+  // Follow increases at once, so that a bulk stream's window grows quickly,
+  // and let decreases in gradually.
+  rate_ = sample > rate_ ? sample : rate_ + (sample - rate_) / 4;
+  sample_start_ = now;
+  sample_bytes_ = 0;
 }
 
 }  // namespace chttp2
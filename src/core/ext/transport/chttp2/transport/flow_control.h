@@ -273,6 +273,12 @@ class TransportFlowControl final {
 
   FlowControlAction SetAckedInitialWindow(uint32_t value);
 
+  // How far past the initial window to open the window of a stream whose
+  // reader consumes `bytes_per_second`: twice the stream's bandwidth delay
+  // product, shrinking to nothing as memory pressure rises. Zero until a BDP
+  // probe has measured the round trip.
+  int64_t StreamWindowDeltaForRate(double bytes_per_second) const;
+
   void set_target_initial_window_size(uint32_t value) {
     target_initial_window_size_ =
         std::min(value, Http2Settings::max_initial_window_size());
@@ -307,6 +313,8 @@ class TransportFlowControl final {
     int64_t bdp_accumulator;
     int64_t bdp_estimate;
     double bdp_bw_est;
+    int64_t bdp_rtt_ms;
+    double stream_window_scale;
 
     std::string ToString() const;
     channelz::PropertyList ChannelzProperties() const {
@@ -324,7 +332,9 @@ class TransportFlowControl final {
                announced_stream_total_over_incoming_window)
           .Set("bdp_accumulator", bdp_accumulator)
           .Set("bdp_estimate", bdp_estimate)
-          .Set("bdp_bw_est", bdp_bw_est);
+          .Set("bdp_bw_est", bdp_bw_est)
+          .Set("bdp_rtt_ms", bdp_rtt_ms)
+          .Set("stream_window_scale", stream_window_scale);
     }
   };
 
@@ -344,11 +354,14 @@ class TransportFlowControl final {
     stats.bdp_accumulator = bdp_estimator_.accumulator();
     stats.bdp_estimate = bdp_estimator_.EstimateBdp();
     stats.bdp_bw_est = bdp_estimator_.EstimateBandwidth();
+    stats.bdp_rtt_ms = bdp_estimator_.EstimateRtt().millis();
+    stats.stream_window_scale = stream_window_scale_;
     return stats;
   }
 
  private:
   double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp() const;
+  double StreamWindowScaleBasedOnMemoryPressure() const;
   static void UpdateSetting(absl::string_view name, int64_t* desired_value,
                             uint32_t new_desired_value,
                             FlowControlAction* action,
@@ -383,6 +396,24 @@ class TransportFlowControl final {
   int64_t announced_window_ = kDefaultWindow;
   uint32_t acked_init_window_ = kDefaultWindow;
   uint32_t sent_init_window_ = kDefaultWindow;
+  // Fraction of their bandwidth delay product that streams may open their
+  // windows by, refreshed by PeriodicUpdate().
+  double stream_window_scale_ = 0;
+};
+
+// Estimates the rate at which a stream's reader consumes bytes, from the data
+// received while it has been reading.
+class StreamRateEstimator {
+ public:
+  void AddIncomingBytes(int64_t num_bytes, Timestamp now);
+
+  // Bytes per second.
+  double rate() const { return rate_; }
+
+ private:
+  Timestamp sample_start_ = Timestamp::InfPast();
+  int64_t sample_bytes_ = 0;
+  double rate_ = 0;
 };
 
 // Implementation of flow control that abides to HTTP/2 spec and attempts
@@ -458,6 +489,12 @@ class StreamFlowControl final {
   int64_t remote_window_delta() const { return remote_window_delta_; }
   int64_t announced_window_delta() const { return announced_window_delta_; }
   int64_t min_progress_size() const { return min_progress_size_; }
+  double consumption_rate() const { return rate_estimator_.rate(); }
+  // The window delta the stream's consumption rate calls for while it has a
+  // reader.
+  int64_t bdp_window_delta() const {
+    return tfc_->StreamWindowDeltaForRate(rate_estimator_.rate());
+  }
 
   // A snapshot of the flow control stats to export.
   struct Stats {
@@ -465,6 +502,8 @@ class StreamFlowControl final {
     int64_t remote_window_delta;
     int64_t announced_window_delta;
     std::optional<int64_t> pending_size;
+    double consumption_rate;
+    int64_t bdp_window_delta;
 
     std::string ToString() const;
   };
@@ -475,6 +514,8 @@ class StreamFlowControl final {
     stats.remote_window_delta = remote_window_delta();
     stats.announced_window_delta = announced_window_delta();
     stats.pending_size = pending_size_;
+    stats.consumption_rate = consumption_rate();
+    stats.bdp_window_delta = bdp_window_delta();
     return stats;
   }
 
@@ -484,6 +525,7 @@ class StreamFlowControl final {
   int64_t remote_window_delta_ = 0;
   int64_t announced_window_delta_ = 0;
   std::optional<int64_t> pending_size_;
+  StreamRateEstimator rate_estimator_;
 
   FlowControlAction UpdateAction(FlowControlAction action);
 };
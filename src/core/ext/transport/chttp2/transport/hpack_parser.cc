@@ -40,10 +40,11 @@
 #include "absl/types/span.h"
 #include "src/core/call/metadata_info.h"
 #include "src/core/call/parsed_metadata.h"
-#include "src/core/ext/transport/chttp2/transport/decode_huff.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
+#include "src/core/ext/transport/chttp2/transport/huff_table_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/simd_base64.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_refcount.h"
@@ -351,9 +352,8 @@ absl::string_view HPackParser::String::string_view() const {
   GPR_UNREACHABLE_CODE(return absl::string_view());
 }
 
-template <typename Out>
 HpackParseStatus HPackParser::String::ParseHuff(Input* input, uint32_t length,
-                                                Out output) {
+                                                std::vector<uint8_t>* output) {
   // If there's insufficient bytes remaining, return now.
   if (input->remaining() < length) {
     input->UnexpectedEOF(/*min_progress_size=*/length);
@@ -362,7 +362,7 @@ HpackParseStatus HPackParser::String::ParseHuff(Input* input, uint32_t length,
   // Grab the byte range, and iterate through it.
   const uint8_t* p = input->cur_ptr();
   input->Advance(length);
-  return HuffDecoder<Out>(output, p, p + length).Run()
+  return HuffDecodeAppend(p, p + length, output)
              ? HpackParseStatus::kOk
              : HpackParseStatus::kParseHuffFailed;
 }
@@ -405,32 +405,11 @@ std::optional<std::vector<uint8_t>> HPackParser::String::Unbase64Loop(
   std::vector<uint8_t> out;
   out.reserve((3 * (end - cur) / 4) + 3);
 
-  // Decode 4 bytes at a time while we can
-  while (end - cur >= 4) {
-    uint32_t bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    uint32_t buffer = bits << 18;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits << 12;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits << 6;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits;
-    ++cur;
-
-    out.insert(out.end(), {static_cast<uint8_t>(buffer >> 16),
-                           static_cast<uint8_t>(buffer >> 8),
-                           static_cast<uint8_t>(buffer)});
-  }
+  // Decode all whole groups of 4 bytes at once
+  const size_t quads = (end - cur) / 4;
+  out.resize(quads * 3);
+  if (!Base64DecodeQuads(cur, quads, out.data())) return {};
+  cur += quads * 4;
   // Deal with the last 0, 1, 2, or 3 bytes.
   switch (end - cur) {
     case 0:
@@ -502,8 +481,7 @@ HPackParser::String::StringResult HPackParser::String::Parse(Input* input,
   if (is_huff) {
     // Huffman coded
     std::vector<uint8_t> output;
-    HpackParseStatus sts =
-        ParseHuff(input, length, [&output](uint8_t c) { output.push_back(c); });
+    HpackParseStatus sts = ParseHuff(input, length, &output);
     size_t wire_len = output.size();
     return StringResult{sts, wire_len, String(std::move(output))};
   }
@@ -525,45 +503,25 @@ HPackParser::String::StringResult HPackParser::String::ParseBinary(
   } else {
     // Huffman encoded...
     std::vector<uint8_t> decompressed;
-    // State here says either we don't know if it's base64 or binary, or we do
-    // and what is it.
-    enum class State { kUnsure, kBinary, kBase64 };
-    State state = State::kUnsure;
-    auto sts = ParseHuff(input, length, [&state, &decompressed](uint8_t c) {
-      if (state == State::kUnsure) {
-        // First byte... if it's zero it's binary
-        if (c == 0) {
-          // Save the type, and skip the zero
-          state = State::kBinary;
-          return;
-        } else {
-          // Flag base64, store this value
-          state = State::kBase64;
-        }
-      }
-      // Non-first byte, or base64 first byte
-      decompressed.push_back(c);
-    });
+    auto sts = ParseHuff(input, length, &decompressed);
     if (sts != HpackParseStatus::kOk) {
       return StringResult{sts, 0, String{}};
     }
-    switch (state) {
-      case State::kUnsure:
-        // No bytes, empty span
-        return StringResult{HpackParseStatus::kOk, 0,
-                            String(absl::Span<const uint8_t>())};
-      case State::kBinary:
-        // Binary, we're done
-        {
-          size_t wire_len = decompressed.size();
-          return StringResult{HpackParseStatus::kOk, wire_len,
-                              String(std::move(decompressed))};
-        }
-      case State::kBase64:
-        // Base64 - unpack it
-        return Unbase64(String(std::move(decompressed)));
+    if (decompressed.empty()) {
+      // No bytes, empty span
+      return StringResult{HpackParseStatus::kOk, 0,
+                          String(absl::Span<const uint8_t>())};
+    }
+    if (decompressed[0] == 0) {
+      // Binary: skip the leading zero, and we're done.  Take() would copy
+      // the bytes into a slice anyway, so copy all but the zero now.
+      size_t wire_len = decompressed.size() - 1;
+      return StringResult{HpackParseStatus::kOk, wire_len,
+                          String(Slice::FromCopiedBuffer(
+                              decompressed.data() + 1, wire_len))};
     }
-    GPR_UNREACHABLE_CODE(abort(););
+    // Base64 - unpack it
+    return Unbase64(String(std::move(decompressed)));
   }
 }
 
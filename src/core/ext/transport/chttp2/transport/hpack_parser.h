@@ -156,14 +156,14 @@ class HPackParser {
     void AppendBytes(const uint8_t* data, size_t length);
     explicit String(std::vector<uint8_t> v) : value_(std::move(v)) {}
     explicit String(absl::Span<const uint8_t> v) : value_(v) {}
+    explicit String(Slice s) : value_(std::move(s)) {}
     String(grpc_slice_refcount* r, const uint8_t* begin, const uint8_t* end)
         : value_(Slice::FromRefcountAndBytes(r, begin, end)) {}
 
-    // Parse some huffman encoded bytes, using output(uint8_t b) to emit each
-    // decoded byte.
-    template <typename Out>
+    // Parse some huffman encoded bytes, appending the decoded bytes to
+    // *output.
     static HpackParseStatus ParseHuff(Input* input, uint32_t length,
-                                      Out output);
+                                      std::vector<uint8_t>* output);
 
     // Parse some uncompressed string bytes.
     static StringResult ParseUncompressed(Input* input, uint32_t length,
@@ -0,0 +1,220 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/huff_table_decoder.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cstddef>
+
+#include "absl/log/check.h"
+#include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr int kLookupBits = 12;
+constexpr int kMaxCodeLength = 30;
+constexpr int kMinCodeLength = 5;
+constexpr uint16_t kEos = 256;
+
+// A lookup table entry packs the (up to two) symbols whose codes fit in the
+// kLookupBits bits that index it:
+//   bits 0-7: first symbol, bits 8-15: second symbol,
+//   bits 16-20: length of the first code, bits 21-25: total length of the
+//   codes, bits 26-27: number of symbols.
+// An entry with no symbols starts a code longer than kLookupBits.
+constexpr uint32_t MakeEntry(uint32_t sym0, uint32_t sym1, uint32_t len0,
+                             uint32_t total, uint32_t count) {
+  return sym0 | (sym1 << 8) | (len0 << 16) | (total << 21) | (count << 26);
+}
+uint32_t EntrySymbol0(uint32_t e) { return e & 0xff; }
+uint32_t EntrySymbol1(uint32_t e) { return (e >> 8) & 0xff; }
+uint32_t EntryLength0(uint32_t e) { return (e >> 16) & 0x1f; }
+uint32_t EntryTotalLength(uint32_t e) { return (e >> 21) & 0x1f; }
+uint32_t EntryCount(uint32_t e) { return e >> 26; }
+
+class DecodeTable {
+ public:
+  DecodeTable() {
+    // The HPACK code is canonical: the codes of each length are consecutive,
+    // and ordered by symbol. Recover the first code of each length, and the
+    // symbols in code order.
+    uint16_t order[GRPC_CHTTP2_NUM_HUFFSYMS];
+    for (uint16_t i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; ++i) order[i] = i;
+    std::stable_sort(order, order + GRPC_CHTTP2_NUM_HUFFSYMS,
+                     [](uint16_t a, uint16_t b) {
+                       return grpc_chttp2_huffsyms[a].length <
+                              grpc_chttp2_huffsyms[b].length;
+                     });
+    for (int i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; ++i) {
+      const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[order[i]];
+      if (count_[sym.length]++ == 0) {
+        first_code_[sym.length] = sym.bits;
+        offset_[sym.length] = i;
+      }
+      DCHECK_EQ(sym.bits, first_code_[sym.length] + (i - offset_[sym.length]));
+      symbols_[i] = order[i];
+    }
+    // One symbol per entry first, then pair up the short codes.
+    uint32_t single[1 << kLookupBits] = {};
+    for (uint16_t s = 0; s < GRPC_CHTTP2_NUM_HUFFSYMS; ++s) {
+      const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[s];
+      if (sym.length > kLookupBits) continue;
+      const int spare = kLookupBits - sym.length;
+      for (uint32_t rest = 0; rest < (1u << spare); ++rest) {
+        single[(sym.bits << spare) | rest] =
+            MakeEntry(s, 0, sym.length, sym.length, 1);
+      }
+    }
+    for (uint32_t i = 0; i < (1u << kLookupBits); ++i) {
+      const uint32_t first = single[i];
+      lookup_[i] = first;
+      if (EntryCount(first) == 0) continue;
+      const uint32_t len0 = EntryLength0(first);
+      const uint32_t second =
+          single[(i << len0) & ((1u << kLookupBits) - 1)];
+      if (EntryCount(second) == 0 ||
+          len0 + EntryLength0(second) > kLookupBits) {
+        continue;
+      }
+      lookup_[i] = MakeEntry(EntrySymbol0(first), EntrySymbol0(second), len0,
+                             len0 + EntryLength0(second), 2);
+    }
+  }
+
+  uint32_t Lookup(uint64_t bits) const {
+    return lookup_[bits >> (64 - kLookupBits)];
+  }
+
+  // Decodes a code longer than kLookupBits from the top of `bits`. Returns
+  // false if there is none, which cannot happen as the code is complete.
+  bool DecodeLong(uint64_t bits, uint16_t* symbol, int* length) const {
+    for (int len = kLookupBits + 1; len <= kMaxCodeLength; ++len) {
+      const uint32_t index =
+          static_cast<uint32_t>(bits >> (64 - len)) - first_code_[len];
+      if (index < count_[len]) {
+        *symbol = symbols_[offset_[len] + index];
+        *length = len;
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  uint32_t lookup_[1 << kLookupBits];
+  uint32_t first_code_[kMaxCodeLength + 1] = {};
+  uint32_t count_[kMaxCodeLength + 1] = {};
+  uint32_t offset_[kMaxCodeLength + 1] = {};
+  uint16_t symbols_[GRPC_CHTTP2_NUM_HUFFSYMS];
+};
+
+const DecodeTable& GetDecodeTable() {
+  static const DecodeTable* const table = new DecodeTable();
+  return *table;
+}
+
+uint64_t LoadBigEndian64(const uint8_t* p) {
+  return (uint64_t{p[0]} << 56) | (uint64_t{p[1]} << 48) |
+         (uint64_t{p[2]} << 40) | (uint64_t{p[3]} << 32) |
+         (uint64_t{p[4]} << 24) | (uint64_t{p[5]} << 16) |
+         (uint64_t{p[6]} << 8) | uint64_t{p[7]};
+}
+
+}  // namespace
+
+bool HuffDecodeAppend(const uint8_t* begin, const uint8_t* end,
+                      std::vector<uint8_t>* out) {
+  const DecodeTable& table = GetDecodeTable();
+  const size_t start = out->size();
+  // Every code is at least kMinCodeLength bits long. One spare byte lets a
+  // table step store both of its symbols unconditionally.
+  out->resize(start + (end - begin) * 8 / kMinCodeLength + 1);
+  uint8_t* const dst_begin = out->data() + start;
+  uint8_t* dst = dst_begin;
+  // The next `nbits` bits of input are held at the top of `bits`; the bits
+  // below them are zero, or the (correct) bits of input that follow.
+  uint64_t bits = 0;
+  int nbits = 0;
+  const uint8_t* p = begin;
+  auto finish = [out, start, dst_begin, &dst]() {
+    out->resize(start + (dst - dst_begin));
+    return true;
+  };
+  for (;;) {
+    if (end - p >= 8) {
+      bits |= LoadBigEndian64(p) >> nbits;
+      p += (63 - nbits) >> 3;
+      nbits |= 56;
+    } else {
+      while (nbits <= 56 && p != end) {
+        bits |= uint64_t{*p++} << (56 - nbits);
+        nbits += 8;
+      }
+      if (nbits < kMaxCodeLength) break;
+    }
+    // Any code fits in the buffered bits.
+    while (nbits >= kMaxCodeLength) {
+      const uint32_t entry = table.Lookup(bits);
+      if (GPR_LIKELY(EntryCount(entry) != 0)) {
+        dst[0] = EntrySymbol0(entry);
+        dst[1] = EntrySymbol1(entry);
+        dst += EntryCount(entry);
+        bits <<= EntryTotalLength(entry);
+        nbits -= EntryTotalLength(entry);
+        continue;
+      }
+      uint16_t symbol;
+      int length;
+      if (!table.DecodeLong(bits, &symbol, &length)) return false;
+      // As in HuffDecoder, an EOS code ends the string.
+      if (symbol == kEos) return finish();
+      *dst++ = static_cast<uint8_t>(symbol);
+      bits <<= length;
+      nbits -= length;
+    }
+  }
+  // The input is exhausted. Decode whatever codes remain whole, looking up
+  // with the unused bits set: a code that reaches into them is padding.
+  for (;;) {
+    const uint64_t padded = bits | (~uint64_t{0} >> nbits);
+    const uint32_t entry = table.Lookup(padded);
+    if (EntryCount(entry) != 0) {
+      const int length = EntryLength0(entry);
+      if (length > nbits) break;
+      *dst++ = EntrySymbol0(entry);
+      bits <<= length;
+      nbits -= length;
+      continue;
+    }
+    uint16_t symbol;
+    int length;
+    if (!table.DecodeLong(padded, &symbol, &length)) return false;
+    if (length > nbits) break;
+    if (symbol == kEos) return finish();
+    *dst++ = static_cast<uint8_t>(symbol);
+    bits <<= length;
+    nbits -= length;
+  }
+  // Padding must be all ones.
+  if (nbits > 0 && (bits >> (64 - nbits)) != (uint64_t{1} << nbits) - 1) {
+    return false;
+  }
+  return finish();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,39 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HUFF_TABLE_DECODER_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HUFF_TABLE_DECODER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace grpc_core {
+
+// Decodes the HPACK Huffman coded bytes [begin, end), appending the result to
+// *out. Returns false if the input is malformed, in which case the contents
+// of *out are unspecified.
+//
+// Accepts exactly the inputs HuffDecoder (decode_huff.h) accepts, and
+// produces the same output, but decodes from a 64 bit bit buffer through a
+// 12 bit lookup table that yields up to two symbols per step. The few codes
+// longer than 12 bits are decoded canonically. This is the decoder the HPACK
+// parser uses; HuffDecoder remains the reference it is tested against.
+bool HuffDecodeAppend(const uint8_t* begin, const uint8_t* end,
+                      std::vector<uint8_t>* out);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HUFF_TABLE_DECODER_H
@@ -0,0 +1,313 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/simd_base64.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <cstring>
+
+#include "absl/log/check.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GRPC_SIMD_BASE64_X86 1
+#include <immintrin.h>
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+constexpr char kAlphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Maps each character to its value, or to 0xff if it is not in the alphabet.
+struct InverseTable {
+  constexpr InverseTable() : values() {
+    for (int i = 0; i < 256; i++) values[i] = 0xff;
+    for (int i = 0; i < 64; i++) values[static_cast<uint8_t>(kAlphabet[i])] = i;
+  }
+  uint8_t values[256];
+};
+constexpr InverseTable kInverse;
+
+void EncodeScalar(const uint8_t* in, size_t triplets, uint8_t* out) {
+  for (size_t i = 0; i < triplets; i++) {
+    const uint32_t v = (static_cast<uint32_t>(in[0]) << 16) |
+                       (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    out[0] = kAlphabet[v >> 18];
+    out[1] = kAlphabet[(v >> 12) & 0x3f];
+    out[2] = kAlphabet[(v >> 6) & 0x3f];
+    out[3] = kAlphabet[v & 0x3f];
+    in += 3;
+    out += 4;
+  }
+}
+
+bool DecodeScalar(const uint8_t* in, size_t quads, uint8_t* out) {
+  // Invalid characters set the top bits of `invalid`; check once at the end.
+  uint32_t invalid = 0;
+  for (size_t i = 0; i < quads; i++) {
+    const uint32_t a = kInverse.values[in[0]];
+    const uint32_t b = kInverse.values[in[1]];
+    const uint32_t c = kInverse.values[in[2]];
+    const uint32_t d = kInverse.values[in[3]];
+    invalid |= a | b | c | d;
+    const uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+    out[0] = static_cast<uint8_t>(v >> 16);
+    out[1] = static_cast<uint8_t>(v >> 8);
+    out[2] = static_cast<uint8_t>(v);
+    in += 4;
+    out += 3;
+  }
+  return (invalid & 0xc0) == 0;
+}
+
+#ifdef GRPC_SIMD_BASE64_X86
+
+// The vector code follows W. Muła and D. Lemire, "Faster Base64 Encoding and
+// Decoding Using AVX2 Instructions" (2018). Each 128 bit lane is coded on its
+// own, so the AVX2 versions are the SSSE3 ones on two lanes at once.
+//
+// To encode, the 12 bytes at the start of a lane are spread over its 16
+// bytes, one 6 bit value per byte, and each value is offset to its character
+// by a lookup on the range it falls in.
+
+__attribute__((target("ssse3"))) void EncodeSsse3(const uint8_t* in,
+                                                  size_t triplets,
+                                                  uint8_t* out) {
+  const __m128i spread =
+      _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const __m128i offsets = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  // Each step reads 16 bytes and consumes 12 of them.
+  for (; triplets >= 6; triplets -= 4) {
+    __m128i v = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), spread);
+    v = _mm_or_si128(
+        _mm_mulhi_epu16(_mm_and_si128(v, _mm_set1_epi32(0x0fc0fc00)),
+                        _mm_set1_epi32(0x04000040)),
+        _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi32(0x003f03f0)),
+                        _mm_set1_epi32(0x01000010)));
+    __m128i range = _mm_subs_epu8(v, _mm_set1_epi8(51));
+    range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(
+                                                  _mm_set1_epi8(26), v),
+                                              _mm_set1_epi8(13)));
+    v = _mm_add_epi8(v, _mm_shuffle_epi8(offsets, range));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+    in += 12;
+    out += 16;
+  }
+  EncodeScalar(in, triplets, out);
+}
+
+__attribute__((target("avx2"))) void EncodeAvx2(const uint8_t* in,
+                                                size_t triplets, uint8_t* out) {
+  const __m256i spread = _mm256_setr_epi8(
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4,
+      7, 6, 8, 7, 10, 9, 11, 10);
+  const __m256i offsets = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  // Each step reads 28 bytes, as two overlapping 16 byte lanes, and consumes
+  // 24 of them.
+  for (; triplets >= 10; triplets -= 8) {
+    __m256i v = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 12)), 1);
+    v = _mm256_shuffle_epi8(v, spread);
+    v = _mm256_or_si256(
+        _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00)),
+                           _mm256_set1_epi32(0x04000040)),
+        _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0)),
+                           _mm256_set1_epi32(0x01000010)));
+    __m256i range = _mm256_subs_epu8(v, _mm256_set1_epi8(51));
+    range = _mm256_or_si256(
+        range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), v),
+                                _mm256_set1_epi8(13)));
+    v = _mm256_add_epi8(v, _mm256_shuffle_epi8(offsets, range));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+    in += 24;
+    out += 32;
+  }
+  EncodeSsse3(in, triplets, out);
+}
+
+// To decode, characters are classified by their nibbles: a character is in
+// the alphabet iff the lookups on its high and low nibbles share no bit. Its
+// value is then an offset away, which the high nibble determines except for
+// '/'. The 16 values of a lane are packed into its first 12 bytes.
+//
+// Invalid characters are accumulated and checked once, at the end.
+
+__attribute__((target("ssse3"))) bool DecodeSsse3(const uint8_t* in,
+                                                  size_t quads, uint8_t* out) {
+  const __m128i lo_classes =
+      _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                    0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+  const __m128i hi_classes =
+      _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10,
+                    0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m128i offsets =
+      _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i pack =
+      _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  __m128i invalid = _mm_setzero_si128();
+  for (; quads >= 4; quads -= 4) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    const __m128i hi = _mm_and_si128(_mm_srli_epi32(v, 4), _mm_set1_epi8(0x0f));
+    const __m128i lo = _mm_and_si128(v, _mm_set1_epi8(0x0f));
+    invalid = _mm_or_si128(invalid,
+                           _mm_and_si128(_mm_shuffle_epi8(lo_classes, lo),
+                                         _mm_shuffle_epi8(hi_classes, hi)));
+    const __m128i offset = _mm_shuffle_epi8(
+        offsets, _mm_add_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('/')), hi));
+    v = _mm_add_epi8(v, offset);
+    v = _mm_madd_epi16(_mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140)),
+                       _mm_set1_epi32(0x00011000));
+    v = _mm_shuffle_epi8(v, pack);
+    // Store exactly the 12 decoded bytes.
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), v);
+    const uint32_t last = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+    memcpy(out + 8, &last, 4);
+    in += 16;
+    out += 12;
+  }
+  if (_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) !=
+      0xffff) {
+    return false;
+  }
+  return DecodeScalar(in, quads, out);
+}
+
+__attribute__((target("avx2"))) bool DecodeAvx2(const uint8_t* in,
+                                                size_t quads, uint8_t* out) {
+  const __m256i lo_classes = _mm256_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a,
+      0x1b, 0x1b, 0x1b, 0x1a, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+  const __m256i hi_classes = _mm256_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m256i offsets = _mm256_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 4,
+      -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i pack = _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4,
+      10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  __m256i invalid = _mm256_setzero_si256();
+  for (; quads >= 8; quads -= 8) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+    const __m256i hi =
+        _mm256_and_si256(_mm256_srli_epi32(v, 4), _mm256_set1_epi8(0x0f));
+    const __m256i lo = _mm256_and_si256(v, _mm256_set1_epi8(0x0f));
+    invalid = _mm256_or_si256(
+        invalid, _mm256_and_si256(_mm256_shuffle_epi8(lo_classes, lo),
+                                  _mm256_shuffle_epi8(hi_classes, hi)));
+    const __m256i offset = _mm256_shuffle_epi8(
+        offsets,
+        _mm256_add_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('/')), hi));
+    v = _mm256_add_epi8(v, offset);
+    v = _mm256_madd_epi16(
+        _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140)),
+        _mm256_set1_epi32(0x00011000));
+    v = _mm256_shuffle_epi8(v, pack);
+    // Bring the 12 bytes of each lane together, and store exactly those 24.
+    v = _mm256_permutevar8x32_epi32(v,
+                                    _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     _mm256_castsi256_si128(v));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 16),
+                     _mm256_extracti128_si256(v, 1));
+    in += 32;
+    out += 24;
+  }
+  if (!_mm256_testz_si256(invalid, invalid)) return false;
+  return DecodeSsse3(in, quads, out);
+}
+
+#endif  // GRPC_SIMD_BASE64_X86
+
+struct Implementation {
+  void (*encode)(const uint8_t* in, size_t triplets, uint8_t* out);
+  bool (*decode)(const uint8_t* in, size_t quads, uint8_t* out);
+};
+
+Implementation GetImplementation(Base64Isa isa) {
+  switch (isa) {
+#ifdef GRPC_SIMD_BASE64_X86
+    case Base64Isa::kAvx2:
+      return {EncodeAvx2, DecodeAvx2};
+    case Base64Isa::kSsse3:
+      return {EncodeSsse3, DecodeSsse3};
+#endif
+    default:
+      return {EncodeScalar, DecodeScalar};
+  }
+}
+
+Base64Isa BestIsa() {
+#ifdef GRPC_SIMD_BASE64_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return Base64Isa::kAvx2;
+  if (__builtin_cpu_supports("ssse3")) return Base64Isa::kSsse3;
+#endif
+  return Base64Isa::kScalar;
+}
+
+const Implementation& Best() {
+  static const Implementation implementation = GetImplementation(BestIsa());
+  return implementation;
+}
+
+}  // namespace
+
+void Base64EncodeTriplets(const uint8_t* in, size_t triplets, uint8_t* out) {
+  Best().encode(in, triplets, out);
+}
+
+bool Base64DecodeQuads(const uint8_t* in, size_t quads, uint8_t* out) {
+  return Best().decode(in, quads, out);
+}
+
+bool Base64IsaSupported(Base64Isa isa) {
+  switch (isa) {
+    case Base64Isa::kScalar:
+      return true;
+    case Base64Isa::kSsse3:
+      return BestIsa() != Base64Isa::kScalar;
+    case Base64Isa::kAvx2:
+      return BestIsa() == Base64Isa::kAvx2;
+  }
+  return false;
+}
+
+void Base64EncodeTripletsForTesting(Base64Isa isa, const uint8_t* in,
+                                    size_t triplets, uint8_t* out) {
+  CHECK(Base64IsaSupported(isa));
+  GetImplementation(isa).encode(in, triplets, out);
+}
+
+bool Base64DecodeQuadsForTesting(Base64Isa isa, const uint8_t* in,
+                                 size_t quads, uint8_t* out) {
+  CHECK(Base64IsaSupported(isa));
+  return GetImplementation(isa).decode(in, quads, out);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,52 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_SIMD_BASE64_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_SIMD_BASE64_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace grpc_core {
+
+// The bulk of base64 coding for binary metadata: whole groups of three bytes
+// and four characters, in the standard alphabet and without padding. Callers
+// deal with the tails.
+//
+// On x86-64 builds with GCC or Clang the groups are coded 16 or 32 characters
+// at a time with SSSE3 or AVX2, chosen at runtime from what the CPU supports.
+// Elsewhere, and on older CPUs, a portable scalar loop is used.
+
+// Encodes the `triplets` groups of three bytes at `in` as 4 * `triplets`
+// characters at `out`.
+void Base64EncodeTriplets(const uint8_t* in, size_t triplets, uint8_t* out);
+
+// Decodes the `quads` groups of four characters at `in` to 3 * `quads` bytes
+// at `out`. Returns false if any character is outside the alphabet, in which
+// case the contents of `out` are unspecified.
+bool Base64DecodeQuads(const uint8_t* in, size_t quads, uint8_t* out);
+
+// The implementations behind the functions above, for tests and benchmarks.
+enum class Base64Isa { kScalar, kSsse3, kAvx2 };
+bool Base64IsaSupported(Base64Isa isa);
+void Base64EncodeTripletsForTesting(Base64Isa isa, const uint8_t* in,
+                                    size_t triplets, uint8_t* out);
+bool Base64DecodeQuadsForTesting(Base64Isa isa, const uint8_t* in,
+                                 size_t quads, uint8_t* out);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_SIMD_BASE64_H
@@ -31,6 +31,7 @@
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/surface/call_utils.h"
 #include "src/core/lib/surface/channel_create.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server.h"
@@ -42,6 +43,9 @@ namespace grpc_core {
 namespace {
 class InprocClientTransport;
 
+// Marks server calls whose callback completions may run inline.
+InlineCqCallbacks g_inline_cq_callbacks;
+
 class InprocServerTransport final : public ServerTransport {
  public:
   explicit InprocServerTransport(const ChannelArgs& args)
@@ -51,7 +55,9 @@ class InprocServerTransport final : public ServerTransport {
             args.GetObject<ResourceQuota>()
                 ->memory_quota()
                 ->CreateMemoryAllocator("inproc_server"),
-            1024)) {}
+            1024)),
+        inline_callbacks_(
+            args.GetBool(GRPC_ARG_INPROC_INLINE_CALLBACKS).value_or(false)) {}
 
   void SetCallDestination(
       RefCountedPtr<UnstartedCallDestination> unstarted_call_handler) override {
@@ -118,6 +124,9 @@ class InprocServerTransport final : public ServerTransport {
     auto arena = call_arena_allocator_->MakeArena();
     arena->SetContext<grpc_event_engine::experimental::EventEngine>(
         event_engine_.get());
+    if (inline_callbacks_) {
+      arena->SetContext<InlineCqCallbacks>(&g_inline_cq_callbacks);
+    }
     auto server_call = MakeCallPair(std::move(md), std::move(arena));
     unstarted_call_handler_->StartCall(std::move(server_call.handler));
     return std::move(server_call.initiator);
@@ -176,6 +185,7 @@ class InprocServerTransport final : public ServerTransport {
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
   const RefCountedPtr<CallArenaAllocator> call_arena_allocator_;
+  const bool inline_callbacks_;
 };
 
 class InprocClientTransport final : public ClientTransport {
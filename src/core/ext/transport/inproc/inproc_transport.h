@@ -21,6 +21,16 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/transport/transport.h"
 
+// If true on the server, callback-API handlers for calls arriving over the
+// promise based inproc transport run on the thread that delivers the call,
+// rather than hopping to the EventEngine. Every handler on the server must
+// then be non-blocking: a handler that blocks stalls its caller. This covers
+// streaming reactors too, whose reactions are already required not to block.
+// Completions run from the call's party, so a batch started from a callback
+// is queued on that party rather than completing on a deeper stack frame.
+#define GRPC_ARG_INPROC_INLINE_CALLBACKS \
+  "grpc.experimental.inproc.inline_callbacks"
+
 grpc_channel* grpc_inproc_channel_create(grpc_server* server,
                                          const grpc_channel_args* args,
                                          void* reserved);
@@ -0,0 +1,266 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_connection.h"
+
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <algorithm>
+#include <climits>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/strerror.h"
+
+#if defined(GRPC_LINUX_EVENTFD) && defined(GRPC_HAVE_UNIX_SOCKET)
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define GRPC_SHM_HANDOFF 1
+#endif
+
+namespace grpc_core {
+namespace shm {
+
+#ifdef GRPC_SHM_HANDOFF
+
+namespace {
+
+// The one message each side sends during the handoff, along with its fds.
+struct Hello {
+  uint32_t magic;
+  uint32_t version;
+};
+constexpr uint32_t kHelloMagic = 0x67736d68;  // "gshm"
+constexpr uint32_t kHelloVersion = 1;
+
+absl::Status ErrnoError(absl::string_view call) {
+  return absl::UnavailableError(absl::StrCat(call, ": ", StrError(errno)));
+}
+
+// How long a handoff may wait on its socket. A deadline of InfPast means the
+// handoff must not wait at all.
+struct HandoffWait {
+  Timestamp deadline;
+  // Aborts the wait when readable; -1 for none.
+  int cancel_fd;
+};
+
+// Waits for `events` on a non-blocking fd.
+absl::Status WaitFor(int fd, short events, HandoffWait wait) {
+  if (wait.deadline == Timestamp::InfPast()) {
+    return absl::UnavailableError("shm handoff would block");
+  }
+  while (true) {
+    const Duration timeout = wait.deadline - Timestamp::Now();
+    if (timeout <= Duration::Zero()) {
+      return absl::DeadlineExceededError("shm handoff timed out");
+    }
+    pollfd pfds[2] = {{fd, events, 0}, {wait.cancel_fd, POLLIN, 0}};
+    const int r = poll(pfds, wait.cancel_fd < 0 ? 1 : 2,
+                       std::min<int64_t>(timeout.millis(), INT_MAX));
+    if (r < 0) {
+      if (errno != EINTR) return ErrnoError("poll");
+      continue;
+    }
+    if (wait.cancel_fd >= 0 && pfds[1].revents != 0) {
+      return absl::CancelledError("shm handoff cancelled");
+    }
+    if (r > 0) return absl::OkStatus();
+  }
+}
+
+absl::Status SendHello(int socket, absl::Span<const int> fds,
+                       HandoffWait wait) {
+  Hello hello{kHelloMagic, kHelloVersion};
+  iovec iov{&hello, sizeof(hello)};
+  alignas(cmsghdr) char control[CMSG_SPACE(2 * sizeof(int))] = {};
+  msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = CMSG_SPACE(fds.size() * sizeof(int));
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(fds.size() * sizeof(int));
+  memcpy(CMSG_DATA(cmsg), fds.data(), fds.size() * sizeof(int));
+  while (true) {
+    const ssize_t r = sendmsg(socket, &msg, MSG_NOSIGNAL);
+    if (r == sizeof(hello)) return absl::OkStatus();
+    if (r >= 0) return absl::UnavailableError("short shm handoff write");
+    if (errno == EINTR) continue;
+    if (errno != EAGAIN) return ErrnoError("sendmsg");
+    auto status = WaitFor(socket, POLLOUT, wait);
+    if (!status.ok()) return status;
+  }
+}
+
+// Receives the peer's Hello and exactly `fds.size()` fds into `fds`.
+absl::Status ReceiveHello(int socket, absl::Span<int> fds,
+                          HandoffWait wait) {
+  Hello hello;
+  iovec iov{&hello, sizeof(hello)};
+  alignas(cmsghdr) char control[CMSG_SPACE(4 * sizeof(int))];
+  msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  ssize_t r;
+  while (true) {
+    r = recvmsg(socket, &msg, MSG_CMSG_CLOEXEC);
+    if (r >= 0) break;
+    if (errno == EINTR) continue;
+    if (errno != EAGAIN) return ErrnoError("recvmsg");
+    auto status = WaitFor(socket, POLLIN, wait);
+    if (!status.ok()) return status;
+  }
+  // Take ownership of whatever fds arrived before validating anything, so
+  // that none leak.
+  std::vector<int> received;
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+      continue;
+    }
+    const size_t n = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    for (size_t i = 0; i < n; ++i) {
+      int fd;
+      memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+      received.push_back(fd);
+    }
+  }
+  absl::Status status;
+  if (r != sizeof(hello) || (msg.msg_flags & (MSG_TRUNC | MSG_CTRUNC)) != 0) {
+    status = absl::UnavailableError("malformed shm handoff message");
+  } else if (hello.magic != kHelloMagic || hello.version != kHelloVersion) {
+    status = absl::UnavailableError("peer does not speak the shm handoff");
+  } else if (received.size() != fds.size()) {
+    status = absl::UnavailableError(
+        absl::StrCat("expected ", fds.size(), " fds in shm handoff, got ",
+                     received.size()));
+  }
+  if (!status.ok()) {
+    for (int fd : received) close(fd);
+    return status;
+  }
+  std::copy(received.begin(), received.end(), fds.begin());
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<ShmConnection>> ShmConnection::Connect(
+    const grpc_resolved_address& address, uint32_t ring_size,
+    Timestamp deadline, int cancel_fd) {
+  const HandoffWait wait{deadline, cancel_fd};
+  const int socket_fd =
+      ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (socket_fd < 0) return ErrnoError("socket");
+  // Unix sockets connect immediately or not at all.
+  if (connect(socket_fd, reinterpret_cast<const sockaddr*>(address.addr),
+              address.len) != 0) {
+    auto status = ErrnoError("connect");
+    close(socket_fd);
+    return status;
+  }
+  auto segment = ShmSegment::Create(ring_size);
+  if (!segment.ok()) {
+    close(socket_fd);
+    return segment.status();
+  }
+  auto local_doorbell = CreateDoorbell();
+  if (!local_doorbell.ok()) {
+    close(socket_fd);
+    return local_doorbell.status();
+  }
+  // From here on the connection owns every fd.
+  std::unique_ptr<ShmConnection> connection(
+      new ShmConnection(/*is_client=*/true, std::move(*segment),
+                        *local_doorbell, -1, socket_fd));
+  const int sent[] = {connection->segment_->fd(), *local_doorbell};
+  auto status = SendHello(socket_fd, sent, wait);
+  if (!status.ok()) return status;
+  int peer_doorbell;
+  status = ReceiveHello(socket_fd, absl::MakeSpan(&peer_doorbell, 1), wait);
+  if (!status.ok()) return status;
+  connection->peer_doorbell_ = peer_doorbell;
+  status = CheckPeerDoorbell(peer_doorbell);
+  if (!status.ok()) return status;
+  return connection;
+}
+
+absl::StatusOr<std::unique_ptr<ShmConnection>> ShmConnection::Accept(
+    int socket) {
+  const HandoffWait no_wait{Timestamp::InfPast(), -1};
+  int fds[2];
+  auto status = ReceiveHello(socket, absl::MakeSpan(fds), no_wait);
+  if (!status.ok()) {
+    close(socket);
+    return status;
+  }
+  const int peer_doorbell = fds[1];
+  status = CheckPeerDoorbell(peer_doorbell);
+  if (!status.ok()) {
+    close(fds[0]);
+    close(peer_doorbell);
+    close(socket);
+    return status;
+  }
+  auto segment = ShmSegment::Map(fds[0]);
+  auto local_doorbell = CreateDoorbell();
+  if (!segment.ok() || !local_doorbell.ok()) {
+    if (local_doorbell.ok()) close(*local_doorbell);
+    close(peer_doorbell);
+    close(socket);
+    return segment.ok() ? local_doorbell.status() : segment.status();
+  }
+  std::unique_ptr<ShmConnection> connection(
+      new ShmConnection(/*is_client=*/false, std::move(*segment),
+                        *local_doorbell, peer_doorbell, socket));
+  // A fresh socket has room for the answer, so this never needs to wait.
+  status = SendHello(socket, absl::MakeConstSpan(&*local_doorbell, 1),
+                     no_wait);
+  if (!status.ok()) return status;
+  return connection;
+}
+
+ShmConnection::~ShmConnection() {
+  if (local_doorbell_ >= 0) close(local_doorbell_);
+  if (peer_doorbell_ >= 0) close(peer_doorbell_);
+  close(socket_);
+}
+
+#else  // GRPC_SHM_HANDOFF
+
+absl::StatusOr<std::unique_ptr<ShmConnection>> ShmConnection::Connect(
+    const grpc_resolved_address&, uint32_t, Timestamp, int) {
+  return absl::UnimplementedError("shm transport requires Linux");
+}
+
+absl::StatusOr<std::unique_ptr<ShmConnection>> ShmConnection::Accept(
+    int) {
+  return absl::UnimplementedError("shm transport requires Linux");
+}
+
+ShmConnection::~ShmConnection() {}
+
+#endif  // GRPC_SHM_HANDOFF
+
+}  // namespace shm
+}  // namespace grpc_core
@@ -0,0 +1,88 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_CONNECTION_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_CONNECTION_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "src/core/ext/transport/shm/shm_ring.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace shm {
+
+// One end of a shared memory connection.
+//
+// The client connects to the server's Unix socket, creates the segment and
+// its doorbell, and passes both fds over the socket; the server answers with
+// its own doorbell. The socket then carries nothing more, but stays open so
+// that each side sees the other go away.
+class ShmConnection {
+ public:
+  // Blocks until the handoff completes, the deadline passes, or `cancel_fd`
+  // (if not -1) becomes readable.
+  static absl::StatusOr<std::unique_ptr<ShmConnection>> Connect(
+      const grpc_resolved_address& address, uint32_t ring_size,
+      Timestamp deadline, int cancel_fd = -1);
+  // Completes the handoff on a non-blocking socket accepted by the server,
+  // taking ownership of it. Never blocks: call it once the socket is
+  // readable, and it fails if the client's message is not all there.
+  static absl::StatusOr<std::unique_ptr<ShmConnection>> Accept(int socket);
+
+  ~ShmConnection();
+  ShmConnection(const ShmConnection&) = delete;
+  ShmConnection& operator=(const ShmConnection&) = delete;
+
+  bool is_client() const { return is_client_; }
+  ShmRing outgoing() const {
+    return is_client_ ? segment_->client_to_server()
+                      : segment_->server_to_client();
+  }
+  ShmRing incoming() const {
+    return is_client_ ? segment_->server_to_client()
+                      : segment_->client_to_server();
+  }
+  // Rung by the peer when there is something for this side to do.
+  int local_doorbell() const { return local_doorbell_; }
+  int peer_doorbell() const { return peer_doorbell_; }
+  int socket() const { return socket_; }
+
+ private:
+  ShmConnection(bool is_client, std::unique_ptr<ShmSegment> segment,
+                int local_doorbell, int peer_doorbell, int socket)
+      : is_client_(is_client),
+        segment_(std::move(segment)),
+        local_doorbell_(local_doorbell),
+        peer_doorbell_(peer_doorbell),
+        socket_(socket) {}
+
+  const bool is_client_;
+  const std::unique_ptr<ShmSegment> segment_;
+  const int local_doorbell_;
+  // Set once the peer's answer arrives.
+  int peer_doorbell_;
+  const int socket_;
+};
+
+}  // namespace shm
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_CONNECTION_H
@@ -0,0 +1,297 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_frame_transport.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/ext/transport/chaotic_good/tcp_frame_header.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/race.h"
+#include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/slice/slice.h"
+
+#ifdef GRPC_LINUX_EVENTFD
+#include <poll.h>
+#endif
+
+namespace grpc_core {
+namespace shm {
+
+using chaotic_good::FrameInterface;
+using chaotic_good::IncomingFrame;
+using chaotic_good::OutgoingFrame;
+using chaotic_good::TcpFrameHeader;
+
+ShmFrameTransport::ShmFrameTransport(
+    std::unique_ptr<ShmConnection> connection,
+    chaotic_good::TransportContextPtr ctx)
+    : ctx_(std::move(ctx)),
+      connection_(std::move(connection)),
+      outgoing_(connection_->outgoing()),
+      incoming_(connection_->incoming()) {
+  // Started here rather than in Start() so that Orphan() always has a
+  // thread to join.
+  waiter_ = Thread("shm-waiter", [this]() { WaiterLoop(); });
+  waiter_.Start();
+}
+
+ShmFrameTransport::~ShmFrameTransport() = default;
+
+RefCountedPtr<channelz::SocketNode> ShmFrameTransport::MakeSocketNode(
+    const ChannelArgs& args, absl::string_view path) {
+  std::string address = absl::StrCat("shm:", path);
+  return MakeRefCounted<channelz::SocketNode>(
+      address, address, absl::StrCat("shm ", address),
+      args.GetObjectRef<channelz::SocketNode::Security>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Writes
+
+Poll<absl::Status> ShmFrameTransport::PollWrite(SliceBuffer& buffer) {
+  bool wrote = false;
+  auto notify_reader = [this, &wrote]() {
+    if (wrote && outgoing_.WakeReader()) {
+      RingDoorbell(connection_->peer_doorbell());
+    }
+    wrote = false;
+  };
+  while (buffer.Length() > 0) {
+    if (shutdown_.load(std::memory_order_relaxed) ||
+        peer_gone_.load(std::memory_order_relaxed)) {
+      return absl::UnavailableError("shm peer went away");
+    }
+    Slice slice = buffer.TakeFirst();
+    auto n = outgoing_.Write(absl::MakeConstSpan(slice.data(), slice.size()));
+    if (!n.ok()) return n.status();
+    if (*n == slice.size()) {
+      wrote = true;
+      continue;
+    }
+    if (*n > 0) {
+      wrote = true;
+      buffer.Prepend(slice.Split(*n));
+      continue;
+    }
+    buffer.Prepend(std::move(slice));
+    // The ring is full: let the reader drain it, and sleep until it has.
+    notify_reader();
+    {
+      MutexLock lock(&mu_);
+      write_waker_ = GetContext<Activity>()->MakeOwningWaker();
+    }
+    if (!outgoing_.PrepareToWaitForSpace()) continue;
+    if (shutdown_.load() || peer_gone_.load()) {
+      return absl::UnavailableError("shm peer went away");
+    }
+    return Pending{};
+  }
+  notify_reader();
+  return absl::OkStatus();
+}
+
+auto ShmFrameTransport::WriteFrame(MpscQueued<OutgoingFrame> queued_frame) {
+  const auto& frame =
+      absl::ConvertVariantTo<FrameInterface&>(queued_frame->payload);
+  SliceBuffer output;
+  TcpFrameHeader{frame.MakeHeader(), 0}.Serialize(
+      output.AddTiny(TcpFrameHeader::kFrameHeaderSize));
+  frame.SerializePayload(output);
+  // Hold on to the queued frame until it is in the ring, so that the
+  // senders see backpressure from a full ring.
+  return [self = this, output = std::move(output),
+          queued_frame = std::move(queued_frame)]() mutable {
+    return self->PollWrite(output);
+  };
+}
+
+auto ShmFrameTransport::WriteLoop(MpscReceiver<OutgoingFrame> frames) {
+  return Loop([self = RefAsSubclass<ShmFrameTransport>(),
+               frames = std::move(frames)]() mutable {
+    return TrySeq(
+        frames.Next(),
+        [self = self.get()](MpscQueued<OutgoingFrame> outgoing_frame) {
+          return self->WriteFrame(std::move(outgoing_frame));
+        },
+        []() -> LoopCtl<absl::Status> { return Continue(); });
+  });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Reads
+
+Poll<absl::StatusOr<SliceBuffer>> ShmFrameTransport::PollRead(
+    size_t n, SliceBuffer& buffer) {
+  while (buffer.Length() < n) {
+    if (shutdown_.load(std::memory_order_relaxed)) {
+      return absl::UnavailableError("shm transport closed");
+    }
+    auto readable = incoming_.Readable();
+    if (!readable.ok()) return readable.status();
+    if (*readable == 0) {
+      if (incoming_.ReaderAtEnd() || peer_gone_.load()) {
+        return absl::UnavailableError("shm peer went away");
+      }
+      {
+        MutexLock lock(&mu_);
+        read_waker_ = GetContext<Activity>()->MakeOwningWaker();
+      }
+      if (!incoming_.PrepareToWaitForData()) continue;
+      if (shutdown_.load() || peer_gone_.load()) continue;
+      return Pending{};
+    }
+    const size_t want = std::min<uint64_t>(n - buffer.Length(), *readable);
+    MutableSlice chunk = MutableSlice::CreateUninitialized(want);
+    auto got = incoming_.Read(absl::MakeSpan(chunk.data(), want));
+    if (!got.ok()) return got.status();
+    buffer.Append(Slice(std::move(chunk)));
+    if (incoming_.WakeWriter()) RingDoorbell(connection_->peer_doorbell());
+  }
+  return std::move(buffer);
+}
+
+auto ShmFrameTransport::Read(size_t n) {
+  return [self = this, n, buffer = SliceBuffer()]() mutable {
+    return self->PollRead(n, buffer);
+  };
+}
+
+auto ShmFrameTransport::ReadFrame() {
+  return TrySeq(
+      Read(TcpFrameHeader::kFrameHeaderSize),
+      [](SliceBuffer header_bytes) -> absl::StatusOr<TcpFrameHeader> {
+        uint8_t buffer[TcpFrameHeader::kFrameHeaderSize];
+        header_bytes.CopyToBuffer(buffer);
+        auto frame_header = TcpFrameHeader::Parse(buffer);
+        if (frame_header.ok() && frame_header->payload_tag != 0) {
+          return absl::InternalError("shm frames carry their payload inline");
+        }
+        return frame_header;
+      },
+      [this](TcpFrameHeader frame_header) {
+        return Map(Read(frame_header.header.payload_length),
+                   [frame_header](absl::StatusOr<SliceBuffer> payload)
+                       -> absl::StatusOr<IncomingFrame> {
+                     if (!payload.ok()) return payload.status();
+                     return IncomingFrame(frame_header.header,
+                                          std::move(payload));
+                   });
+      });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Lifetime
+
+template <typename Promise>
+auto ShmFrameTransport::UntilClosed(Promise promise) {
+  return Race(Map(closed_.Wait(),
+                  [self = RefAsSubclass<ShmFrameTransport>()](Empty) {
+                    return absl::UnavailableError("Frame transport closed");
+                  }),
+              std::move(promise));
+}
+
+void ShmFrameTransport::Start(
+    Party* party, MpscReceiver<OutgoingFrame> frames,
+    RefCountedPtr<chaotic_good::FrameTransportSink> sink) {
+  auto write_party = Party::Make(party->arena()->Ref());
+  write_party->Spawn(
+      "shm-write",
+      [self = RefAsSubclass<ShmFrameTransport>(),
+       frames = std::move(frames)]() mutable {
+        return self->UntilClosed(self->WriteLoop(std::move(frames)));
+      },
+      [sink](absl::Status status) {
+        sink->OnFrameTransportClosed(std::move(status));
+      });
+  party->Spawn(
+      "shm-read",
+      [self = RefAsSubclass<ShmFrameTransport>(), sink = sink]() {
+        return self->UntilClosed(Loop([self = self.get(), sink = sink.get()]() {
+          return TrySeq(
+              self->ReadFrame(),
+              [sink](IncomingFrame incoming_frame) -> LoopCtl<absl::Status> {
+                sink->OnIncomingFrame(std::move(incoming_frame));
+                return Continue{};
+              });
+        }));
+      },
+      [sink, write_party = std::move(write_party)](absl::Status status) {
+        sink->OnFrameTransportClosed(std::move(status));
+      });
+}
+
+void ShmFrameTransport::WakeLoops() {
+  Waker read_waker;
+  Waker write_waker;
+  {
+    MutexLock lock(&mu_);
+    read_waker = std::move(read_waker_);
+    write_waker = std::move(write_waker_);
+  }
+  // Called off the parties' threads, so never run them inline.
+  read_waker.WakeupAsync();
+  write_waker.WakeupAsync();
+}
+
+void ShmFrameTransport::WaiterLoop() {
+#ifdef GRPC_LINUX_EVENTFD
+  while (!shutdown_.load()) {
+    pollfd fds[2] = {{connection_->local_doorbell(), POLLIN, 0},
+                     {connection_->socket(), POLLIN | POLLRDHUP, 0}};
+    const int r = poll(fds, 2, -1);
+    if (r < 0) {
+      if (errno == EINTR) continue;
+      LOG(ERROR) << "shm waiter poll failed: " << errno;
+      peer_gone_.store(true);
+      WakeLoops();
+      return;
+    }
+    if (fds[0].revents != 0) {
+      DrainDoorbell(connection_->local_doorbell());
+    }
+    // The peer never writes to the socket again, so any event on it means
+    // the peer has gone.
+    if (fds[1].revents != 0) {
+      peer_gone_.store(true);
+      WakeLoops();
+      return;
+    }
+    WakeLoops();
+  }
+#endif  // GRPC_LINUX_EVENTFD
+}
+
+void ShmFrameTransport::Orphan() {
+  shutdown_.store(true);
+  outgoing_.CloseWriter();
+  RingDoorbell(connection_->peer_doorbell());
+  RingDoorbell(connection_->local_doorbell());
+  waiter_.Join();
+  closed_.Set();
+  WakeLoops();
+  Unref();
+}
+
+}  // namespace shm
+}  // namespace grpc_core
@@ -0,0 +1,95 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_FRAME_TRANSPORT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_FRAME_TRANSPORT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <memory>
+
+#include "src/core/ext/transport/chaotic_good/frame_transport.h"
+#include "src/core/ext/transport/chaotic_good/transport_context.h"
+#include "src/core/ext/transport/shm/shm_connection.h"
+#include "src/core/ext/transport/shm/shm_ring.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/thd.h"
+
+namespace grpc_core {
+namespace shm {
+
+// Carries chaotic_good frames over the rings of a ShmConnection, so that the
+// chaotic_good client and server transports run unchanged on top of shared
+// memory. Frames use the chaotic_good control framing with every payload
+// inline: there are no data connections to spread them across.
+//
+// Reads and writes are plain copies into and out of the rings. A side only
+// makes a syscall to sleep when it has run out of work, and to ring the
+// peer's doorbell when the peer is asleep. A thread per transport waits on
+// this side's doorbell and on the handoff socket, and wakes the read and
+// write loops.
+class ShmFrameTransport final : public chaotic_good::FrameTransport {
+ public:
+  ShmFrameTransport(std::unique_ptr<ShmConnection> connection,
+                    chaotic_good::TransportContextPtr ctx);
+  ~ShmFrameTransport() override;
+
+  static RefCountedPtr<channelz::SocketNode> MakeSocketNode(
+      const ChannelArgs& args, absl::string_view path);
+
+  void Start(Party* party,
+             MpscReceiver<chaotic_good::OutgoingFrame> outgoing_frames,
+             RefCountedPtr<chaotic_good::FrameTransportSink> sink) override;
+  void Orphan() override;
+  chaotic_good::TransportContextPtr ctx() override { return ctx_; }
+
+ private:
+  auto WriteFrame(MpscQueued<chaotic_good::OutgoingFrame> queued_frame);
+  auto WriteLoop(MpscReceiver<chaotic_good::OutgoingFrame> frames);
+  // Resolves to StatusOr<SliceBuffer> holding the next n bytes.
+  auto Read(size_t n);
+  // Resolves to StatusOr<IncomingFrame>.
+  auto ReadFrame();
+  template <typename Promise>
+  auto UntilClosed(Promise promise);
+
+  // Copy as much as possible into or out of the rings, and return Pending
+  // with the current activity registered for wakeup when blocked.
+  Poll<absl::Status> PollWrite(SliceBuffer& buffer);
+  Poll<absl::StatusOr<SliceBuffer>> PollRead(size_t n, SliceBuffer& buffer);
+  void WaiterLoop();
+  void WakeLoops();
+
+  const chaotic_good::TransportContextPtr ctx_;
+  const std::unique_ptr<ShmConnection> connection_;
+  ShmRing outgoing_;
+  ShmRing incoming_;
+  InterActivityLatch<void> closed_;
+  std::atomic<bool> shutdown_{false};
+  std::atomic<bool> peer_gone_{false};
+  Mutex mu_;
+  Waker read_waker_ ABSL_GUARDED_BY(mu_);
+  Waker write_waker_ ABSL_GUARDED_BY(mu_);
+  Thread waiter_;
+};
+
+}  // namespace shm
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_FRAME_TRANSPORT_H
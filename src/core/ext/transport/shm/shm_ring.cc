@@ -0,0 +1,350 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_ring.h"
+
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/strerror.h"
+
+#ifdef GRPC_LINUX_EVENTFD
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace grpc_core {
+namespace shm {
+
+namespace {
+
+// Identifies a segment and the version of its layout.
+constexpr uint64_t kSegmentMagic = 0x67727063'73686d31;  // "grpcshm1"
+constexpr uint32_t kSegmentVersion = 1;
+
+struct SegmentHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t ring_size;
+};
+
+// The segment is the SegmentHeader, then the two RingHeaders, then (from the
+// second page) the data of the client to server ring followed by that of the
+// server to client ring.
+constexpr size_t kClientToServerHeaderOffset = 64;
+constexpr size_t kServerToClientHeaderOffset =
+    kClientToServerHeaderOffset + sizeof(RingHeader);
+constexpr size_t kDataOffset = 4096;
+static_assert(sizeof(SegmentHeader) <= kClientToServerHeaderOffset);
+static_assert(kServerToClientHeaderOffset + sizeof(RingHeader) <= kDataOffset);
+
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// ShmRing
+
+absl::StatusOr<uint64_t> ShmRing::Writable() const {
+  const uint64_t write_position =
+      header_->write_position.load(std::memory_order_relaxed);
+  const uint64_t read_position =
+      header_->read_position.load(std::memory_order_acquire);
+  if (read_position > write_position ||
+      write_position - read_position > capacity_) {
+    return absl::DataLossError("shm ring read position is corrupt");
+  }
+  return capacity_ - (write_position - read_position);
+}
+
+absl::StatusOr<size_t> ShmRing::Write(absl::Span<const uint8_t> data) {
+  auto writable = Writable();
+  if (!writable.ok()) return writable.status();
+  const size_t n = std::min<uint64_t>(*writable, data.size());
+  if (n == 0) return 0;
+  const uint64_t write_position =
+      header_->write_position.load(std::memory_order_relaxed);
+  CopyIn(write_position, data.data(), n);
+  // Sequentially consistent, to pair with PrepareToWaitForData().
+  header_->write_position.store(write_position + n);
+  return n;
+}
+
+void ShmRing::CloseWriter() { header_->writer_closed.store(1); }
+
+bool ShmRing::PrepareToWaitForSpace() {
+  header_->writer_waiting.store(1);
+  auto writable = Writable();
+  if (!writable.ok() || *writable > 0) {
+    header_->writer_waiting.store(0, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+bool ShmRing::WakeReader() {
+  return header_->reader_waiting.load() != 0 &&
+         header_->reader_waiting.exchange(0) != 0;
+}
+
+absl::StatusOr<uint64_t> ShmRing::Readable() const {
+  const uint64_t write_position =
+      header_->write_position.load(std::memory_order_acquire);
+  const uint64_t read_position =
+      header_->read_position.load(std::memory_order_relaxed);
+  if (read_position > write_position ||
+      write_position - read_position > capacity_) {
+    return absl::DataLossError("shm ring write position is corrupt");
+  }
+  return write_position - read_position;
+}
+
+absl::StatusOr<size_t> ShmRing::Read(absl::Span<uint8_t> out) {
+  auto readable = Readable();
+  if (!readable.ok()) return readable.status();
+  const size_t n = std::min<uint64_t>(*readable, out.size());
+  if (n == 0) return 0;
+  const uint64_t read_position =
+      header_->read_position.load(std::memory_order_relaxed);
+  CopyOut(read_position, out.data(), n);
+  // Sequentially consistent, to pair with PrepareToWaitForSpace().
+  header_->read_position.store(read_position + n);
+  return n;
+}
+
+bool ShmRing::ReaderAtEnd() const {
+  if (header_->writer_closed.load(std::memory_order_acquire) == 0) {
+    return false;
+  }
+  auto readable = Readable();
+  return readable.ok() && *readable == 0;
+}
+
+bool ShmRing::PrepareToWaitForData() {
+  header_->reader_waiting.store(1);
+  auto readable = Readable();
+  if (!readable.ok() || *readable > 0 || header_->writer_closed.load() != 0) {
+    header_->reader_waiting.store(0, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+bool ShmRing::WakeWriter() {
+  return header_->writer_waiting.load() != 0 &&
+         header_->writer_waiting.exchange(0) != 0;
+}
+
+void ShmRing::CopyIn(uint64_t position, const uint8_t* buffer, size_t n) {
+  const size_t offset = position & (capacity_ - 1);
+  const size_t first = std::min<size_t>(n, capacity_ - offset);
+  memcpy(data_ + offset, buffer, first);
+  memcpy(data_, buffer + first, n - first);
+}
+
+void ShmRing::CopyOut(uint64_t position, uint8_t* buffer, size_t n) const {
+  const size_t offset = position & (capacity_ - 1);
+  const size_t first = std::min<size_t>(n, capacity_ - offset);
+  memcpy(buffer, data_ + offset, first);
+  memcpy(buffer + first, data_, n - first);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// ShmSegment
+
+ShmRing ShmSegment::client_to_server() const {
+  return ShmRing(
+      reinterpret_cast<RingHeader*>(base_ + kClientToServerHeaderOffset),
+      base_ + kDataOffset, ring_size_);
+}
+
+ShmRing ShmSegment::server_to_client() const {
+  return ShmRing(
+      reinterpret_cast<RingHeader*>(base_ + kServerToClientHeaderOffset),
+      base_ + kDataOffset + ring_size_, ring_size_);
+}
+
+#ifdef GRPC_LINUX_EVENTFD
+
+namespace {
+
+size_t SegmentSize(uint32_t ring_size) {
+  return kDataOffset + 2 * static_cast<size_t>(ring_size);
+}
+
+bool ValidRingSize(uint32_t ring_size) {
+  return ring_size >= ShmSegment::kMinRingSize &&
+         ring_size <= ShmSegment::kMaxRingSize &&
+         (ring_size & (ring_size - 1)) == 0;
+}
+
+absl::Status ErrnoError(absl::string_view call) {
+  return absl::InternalError(absl::StrCat(call, ": ", StrError(errno)));
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<ShmSegment>> ShmSegment::Create(
+    uint32_t ring_size) {
+  if (!ValidRingSize(ring_size)) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("invalid shm ring size ", ring_size));
+  }
+  const int fd = memfd_create("grpc-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fd < 0) return ErrnoError("memfd_create");
+  const size_t size = SegmentSize(ring_size);
+  // The peer checks for these seals: without them we could shrink the file
+  // under its mapping.
+  if (ftruncate(fd, size) != 0 ||
+      fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+    auto status = ErrnoError("sizing shm segment");
+    close(fd);
+    return status;
+  }
+  void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) {
+    auto status = ErrnoError("mmap");
+    close(fd);
+    return status;
+  }
+  // The file starts zeroed, which is the initial state of both rings.
+  auto* header = static_cast<SegmentHeader*>(base);
+  header->magic = kSegmentMagic;
+  header->version = kSegmentVersion;
+  header->ring_size = ring_size;
+  return std::unique_ptr<ShmSegment>(
+      new ShmSegment(fd, static_cast<uint8_t*>(base), size, ring_size));
+}
+
+absl::StatusOr<std::unique_ptr<ShmSegment>> ShmSegment::Map(int fd) {
+  auto fail = [fd](absl::Status status) {
+    close(fd);
+    return status;
+  };
+  const int seals = fcntl(fd, F_GET_SEALS);
+  if (seals < 0) return fail(ErrnoError("reading shm segment seals"));
+  if ((seals & F_SEAL_SHRINK) == 0) {
+    return fail(absl::InvalidArgumentError("shm segment can be shrunk"));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) return fail(ErrnoError("fstat"));
+  const size_t size = st.st_size;
+  if (size < kDataOffset) {
+    return fail(absl::InvalidArgumentError("shm segment too small"));
+  }
+  void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) return fail(ErrnoError("mmap"));
+  // Copy the header once: the peer may still change it.
+  SegmentHeader header;
+  memcpy(&header, base, sizeof(header));
+  if (header.magic != kSegmentMagic || header.version != kSegmentVersion ||
+      !ValidRingSize(header.ring_size) ||
+      size != SegmentSize(header.ring_size)) {
+    munmap(base, size);
+    return fail(absl::InvalidArgumentError("unrecognized shm segment"));
+  }
+  return std::unique_ptr<ShmSegment>(
+      new ShmSegment(fd, static_cast<uint8_t*>(base), size, header.ring_size));
+}
+
+ShmSegment::~ShmSegment() {
+  munmap(base_, size_);
+  close(fd_);
+}
+
+absl::StatusOr<int> CreateDoorbell() {
+  const int fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (fd < 0) return ErrnoError("eventfd");
+  return fd;
+}
+
+absl::Status CheckPeerDoorbell(int fd) {
+  auto not_eventfd = []() {
+    return absl::InvalidArgumentError("shm peer doorbell is not an eventfd");
+  };
+  // Rule out the fds whose writes can block: pipes, sockets and devices.
+  struct stat st;
+  if (fstat(fd, &st) != 0) return ErrnoError("fstat");
+  if (S_ISFIFO(st.st_mode) || S_ISSOCK(st.st_mode) || S_ISCHR(st.st_mode) ||
+      S_ISBLK(st.st_mode) || S_ISDIR(st.st_mode)) {
+    return not_eventfd();
+  }
+  // Where /proc is mounted it names the kind of anonymous inode.
+  char target[64];
+  const ssize_t n = readlink(absl::StrCat("/proc/self/fd/", fd).c_str(),
+                             target, sizeof(target));
+  if (n >= 0 && absl::string_view(target, n) != "anon_inode:[eventfd]") {
+    return not_eventfd();
+  }
+  // The flags belong to the open file, which the peer shares, so a peer that
+  // made its eventfd blocking gets it made non-blocking here.
+  const int flags = fcntl(fd, F_GETFL);
+  if (flags < 0) return ErrnoError("reading shm doorbell flags");
+  if ((flags & O_NONBLOCK) == 0 &&
+      fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+    return ErrnoError("setting shm doorbell flags");
+  }
+  return absl::OkStatus();
+}
+
+void RingDoorbell(int fd) {
+  // The doorbell is non-blocking, so this never stalls the caller. EAGAIN
+  // means the count is saturated: the peer has a wakeup pending anyway.
+  const uint64_t one = 1;
+  ssize_t r;
+  do {
+    r = write(fd, &one, sizeof(one));
+  } while (r < 0 && errno == EINTR);
+}
+
+void DrainDoorbell(int fd) {
+  uint64_t count;
+  ssize_t r;
+  do {
+    r = read(fd, &count, sizeof(count));
+  } while (r < 0 && errno == EINTR);
+}
+
+#else  // GRPC_LINUX_EVENTFD
+
+absl::StatusOr<std::unique_ptr<ShmSegment>> ShmSegment::Create(uint32_t) {
+  return absl::UnimplementedError("shm transport requires Linux");
+}
+
+absl::StatusOr<std::unique_ptr<ShmSegment>> ShmSegment::Map(int) {
+  return absl::UnimplementedError("shm transport requires Linux");
+}
+
+ShmSegment::~ShmSegment() {}
+
+absl::StatusOr<int> CreateDoorbell() {
+  return absl::UnimplementedError("shm transport requires Linux");
+}
+
+absl::Status CheckPeerDoorbell(int) {
+  return absl::UnimplementedError("shm transport requires Linux");
+}
+
+void RingDoorbell(int) {}
+void DrainDoorbell(int) {}
+
+#endif  // GRPC_LINUX_EVENTFD
+
+}  // namespace shm
+}  // namespace grpc_core
@@ -0,0 +1,148 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_RING_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_RING_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/span.h"
+
+namespace grpc_core {
+namespace shm {
+
+// The shared state of one direction of a connection, at the start of the
+// segment both processes map. Positions count every byte ever written or
+// read, so the ring is empty when they are equal and full when they are
+// `capacity` apart. The two positions live on separate cache lines.
+struct RingHeader {
+  // Written by the producer.
+  alignas(64) std::atomic<uint64_t> write_position;
+  std::atomic<uint32_t> writer_closed;
+  std::atomic<uint32_t> writer_waiting;
+  // Written by the consumer.
+  alignas(64) std::atomic<uint64_t> read_position;
+  std::atomic<uint32_t> reader_waiting;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared memory rings need address-free 64-bit atomics");
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "shared memory rings need address-free 32-bit atomics");
+
+// A single-producer single-consumer byte stream over a RingHeader and its
+// data, which may be mapped by another process. Everything read from the
+// header is treated as untrusted: a peer that corrupts the positions gets an
+// error, never an out of bounds access.
+//
+// Neither side blocks. A side that finds nothing to do calls
+// PrepareToWaitFor*() and, if that returns true, sleeps until its doorbell
+// rings; the other side rings it when Wake*() says so after making progress.
+class ShmRing {
+ public:
+  ShmRing(RingHeader* header, uint8_t* data, uint64_t capacity)
+      : header_(header), data_(data), capacity_(capacity) {}
+
+  uint64_t capacity() const { return capacity_; }
+
+  // Producer side.
+  // Bytes that can be written without overwriting unread data.
+  absl::StatusOr<uint64_t> Writable() const;
+  // Copies as much of `data` as fits, returning the number of bytes copied.
+  absl::StatusOr<size_t> Write(absl::Span<const uint8_t> data);
+  // Tells the consumer there is nothing more to come.
+  void CloseWriter();
+  // Call with no space to write: returns false if space was freed meanwhile,
+  // true if the caller should wait for its doorbell.
+  bool PrepareToWaitForSpace();
+  // Call after writing: returns true if the consumer is asleep and its
+  // doorbell should be rung.
+  bool WakeReader();
+
+  // Consumer side.
+  // Bytes written but not yet read.
+  absl::StatusOr<uint64_t> Readable() const;
+  // Copies up to out.size() bytes out of the ring, returning how many.
+  absl::StatusOr<size_t> Read(absl::Span<uint8_t> out);
+  // True once the producer closed and every byte has been read.
+  bool ReaderAtEnd() const;
+  bool PrepareToWaitForData();
+  bool WakeWriter();
+
+ private:
+  // Copies n bytes between `buffer` and the ring, starting at `position`,
+  // wrapping around the end of the ring.
+  void CopyIn(uint64_t position, const uint8_t* buffer, size_t n);
+  void CopyOut(uint64_t position, uint8_t* buffer, size_t n) const;
+
+  RingHeader* const header_;
+  uint8_t* const data_;
+  const uint64_t capacity_;
+};
+
+// A memfd holding the two rings of a connection, mapped into this process.
+// The client creates it and hands the fd to the server, which maps the same
+// memory.
+class ShmSegment {
+ public:
+  // Ring sizes must be a power of two in [kMinRingSize, kMaxRingSize].
+  static constexpr uint32_t kMinRingSize = 4096;
+  static constexpr uint32_t kMaxRingSize = 1u << 30;
+
+  static absl::StatusOr<std::unique_ptr<ShmSegment>> Create(
+      uint32_t ring_size);
+  // Maps a segment received from a peer, taking ownership of `fd`. Fails
+  // unless the segment is sealed against resizing and its layout is sound.
+  static absl::StatusOr<std::unique_ptr<ShmSegment>> Map(int fd);
+
+  ~ShmSegment();
+  ShmSegment(const ShmSegment&) = delete;
+  ShmSegment& operator=(const ShmSegment&) = delete;
+
+  int fd() const { return fd_; }
+  uint32_t ring_size() const { return ring_size_; }
+
+  ShmRing client_to_server() const;
+  ShmRing server_to_client() const;
+
+ private:
+  ShmSegment(int fd, uint8_t* base, size_t size, uint32_t ring_size)
+      : fd_(fd), base_(base), size_(size), ring_size_(ring_size) {}
+
+  const int fd_;
+  uint8_t* const base_;
+  const size_t size_;
+  const uint32_t ring_size_;
+};
+
+// An eventfd that the peer rings to wake this side.
+absl::StatusOr<int> CreateDoorbell();
+// Checks that a doorbell received from the peer is an eventfd, and makes sure
+// that ringing it never blocks.
+absl::Status CheckPeerDoorbell(int fd);
+void RingDoorbell(int fd);
+// Resets a doorbell that has rung.
+void DrainDoorbell(int fd);
+
+}  // namespace shm
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_RING_H
@@ -0,0 +1,498 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_transport.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "src/core/client_channel/connector.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/ext/transport/chaotic_good/client_transport.h"
+#include "src/core/ext/transport/chaotic_good/message_chunker.h"
+#include "src/core/ext/transport/chaotic_good/server_transport.h"
+#include "src/core/ext/transport/chaotic_good/transport_context.h"
+#include "src/core/ext/transport/shm/shm_connection.h"
+#include "src/core/ext/transport/shm/shm_frame_transport.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/lib/iomgr/unix_sockets_posix.h"
+#include "src/core/lib/surface/channel_create.h"
+#include "src/core/resolver/resolver_factory.h"
+#include "src/core/resolver/resolver_registry.h"
+#include "src/core/transport/endpoint_transport.h"
+#include "src/core/transport/endpoint_transport_client_channel_factory.h"
+#include "src/core/util/crash.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/thd.h"
+#include "src/core/util/uri.h"
+
+#if defined(GRPC_LINUX_EVENTFD) && defined(GRPC_HAVE_UNIX_SOCKET)
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define GRPC_SHM_LISTENER 1
+#endif
+
+namespace grpc_core {
+namespace shm {
+
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+
+constexpr uint32_t kDefaultRingSize = 4 * 1024 * 1024;
+// The handoff is a single message each way between local processes.
+constexpr Duration kDefaultHandoffTimeout = Duration::Seconds(10);
+// Accepted sockets still waiting for the client's half of the handoff.
+constexpr size_t kMaxPendingHandoffs = 256;
+
+// Every frame goes whole into the ring, so messages are never chunked.
+chaotic_good::MessageChunker NoChunking() {
+  return chaotic_good::MessageChunker(0, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Client
+
+class ShmConnector final : public SubchannelConnector {
+ public:
+  ShmConnector() {
+    auto cancel_fd = CreateDoorbell();
+    if (cancel_fd.ok()) cancel_fd_ = *cancel_fd;
+  }
+
+  ~ShmConnector() override {
+#ifdef GRPC_SHM_LISTENER
+    if (cancel_fd_ >= 0) close(cancel_fd_);
+#endif
+  }
+
+  void Connect(const Args& args, Result* result,
+               grpc_closure* notify) override {
+    {
+      MutexLock lock(&mu_);
+      if (is_shutdown_) {
+        ExecCtx::Run(DEBUG_LOCATION, notify,
+                     absl::UnavailableError("shm connector shut down"));
+        return;
+      }
+    }
+    const uint32_t ring_size = args.channel_args.GetInt(GRPC_ARG_SHM_RING_SIZE)
+                                   .value_or(kDefaultRingSize);
+    const Timestamp deadline =
+        std::min(args.deadline, Timestamp::Now() + kDefaultHandoffTimeout);
+    // The handoff waits on the server, so it gets a thread of its own rather
+    // than holding an EventEngine thread. Shutdown() rings cancel_fd_ to cut
+    // it short.
+    Thread thread(
+        "shm-connect",
+        [self = RefAsSubclass<ShmConnector>(), address = *args.address,
+         deadline, channel_args = args.channel_args, ring_size, result,
+         notify]() {
+          self->HandoffAndNotify(address, deadline, channel_args, ring_size,
+                                 result, notify);
+        },
+        nullptr, Thread::Options().set_joinable(false));
+    thread.Start();
+  }
+
+  void Shutdown(grpc_error_handle) override {
+    MutexLock lock(&mu_);
+    is_shutdown_ = true;
+    if (cancel_fd_ >= 0) RingDoorbell(cancel_fd_);
+  }
+
+ private:
+  void HandoffAndNotify(const grpc_resolved_address& address,
+                        Timestamp deadline, const ChannelArgs& channel_args,
+                        uint32_t ring_size, Result* result,
+                        grpc_closure* notify) {
+    ExecCtx exec_ctx;
+    auto connection =
+        ShmConnection::Connect(address, ring_size, deadline, cancel_fd_);
+    if (!connection.ok()) {
+      ExecCtx::Run(DEBUG_LOCATION, notify, connection.status());
+      return;
+    }
+    {
+      MutexLock lock(&mu_);
+      if (is_shutdown_) {
+        ExecCtx::Run(DEBUG_LOCATION, notify,
+                     absl::UnavailableError("shm connector shut down"));
+        return;
+      }
+    }
+    const std::string uri =
+        grpc_sockaddr_to_uri(&address).value_or("unix:<<unknown>>");
+    auto socket_node = ShmFrameTransport::MakeSocketNode(
+        channel_args, absl::StripPrefix(uri, "unix:"));
+    auto frame_transport = MakeOrphanable<ShmFrameTransport>(
+        std::move(*connection), MakeRefCounted<chaotic_good::TransportContext>(
+                                    channel_args, std::move(socket_node)));
+    result->transport = new chaotic_good::ChaoticGoodClientTransport(
+        channel_args, std::move(frame_transport), NoChunking());
+    result->channel_args = channel_args;
+    ExecCtx::Run(DEBUG_LOCATION, notify, absl::OkStatus());
+  }
+
+  // Rung once by Shutdown(), after which every handoff fails straight away.
+  int cancel_fd_ = -1;
+  Mutex mu_;
+  bool is_shutdown_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+// Resolves `shm:/path` to the Unix socket that the server listens on.
+class ShmResolverFactory final : public ResolverFactory {
+ public:
+  absl::string_view scheme() const override { return "shm"; }
+
+  bool IsValidUri(const URI& uri) const override {
+    if (!uri.authority().empty() || uri.path().empty()) return false;
+    grpc_resolved_address address;
+    return UnixSockaddrPopulate(uri.path(), &address).ok();
+  }
+
+  OrphanablePtr<Resolver> CreateResolver(ResolverArgs args) const override {
+    auto* unix_factory =
+        CoreConfiguration::Get().resolver_registry().LookupResolverFactory(
+            "unix");
+    if (unix_factory == nullptr) return nullptr;
+    auto uri = URI::Create("unix", /*user_info=*/"", /*host_port=*/"",
+                           args.uri.path(), args.uri.query_parameter_pairs(),
+                           args.uri.fragment());
+    if (!uri.ok()) return nullptr;
+    args.uri = std::move(*uri);
+    return unix_factory->CreateResolver(std::move(args));
+  }
+
+  std::string GetDefaultAuthority(const URI& /*uri*/) const override {
+    return "localhost";
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Server
+
+#ifdef GRPC_SHM_LISTENER
+
+absl::Status ErrnoError(absl::string_view call) {
+  return absl::UnavailableError(absl::StrCat(call, ": ", StrError(errno)));
+}
+
+// Accepts on the Unix socket with a thread of its own, which also waits for
+// each client's half of the handoff without blocking on any one of them. Only
+// setting up the transport runs on the EventEngine.
+class ShmServerListener final : public Server::ListenerInterface {
+ public:
+  ShmServerListener(Server* server, const ChannelArgs& args, std::string path,
+                    const grpc_resolved_address& address, int listen_fd,
+                    int shutdown_fd)
+      : server_(server),
+        args_(args),
+        event_engine_(args.GetObjectRef<EventEngine>()),
+        handoff_timeout_(
+            args.GetDurationFromIntMillis(GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS)
+                .value_or(kDefaultHandoffTimeout)),
+        path_(std::move(path)),
+        address_(address),
+        listen_fd_(listen_fd),
+        shutdown_fd_(shutdown_fd) {}
+
+  ~ShmServerListener() override {
+    close(listen_fd_);
+    close(shutdown_fd_);
+    if (on_destroy_done_ != nullptr) {
+      event_engine_->Run([on_destroy_done = on_destroy_done_]() {
+        ExecCtx exec_ctx;
+        ExecCtx::Run(DEBUG_LOCATION, on_destroy_done, absl::OkStatus());
+      });
+    }
+  }
+
+  static absl::StatusOr<OrphanablePtr<ShmServerListener>> Bind(
+      Server* server, const ChannelArgs& args, absl::string_view path) {
+    grpc_resolved_address address;
+    auto status = UnixSockaddrPopulate(path, &address);
+    if (!status.ok()) return status;
+    const int listen_fd =
+        socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd < 0) return ErrnoError("socket");
+    // Clear out a socket left behind by an earlier server, but nothing else.
+    grpc_unlink_if_unix_domain_socket(&address);
+    if (bind(listen_fd, reinterpret_cast<const sockaddr*>(address.addr),
+             address.len) != 0 ||
+        listen(listen_fd, SOMAXCONN) != 0) {
+      status = ErrnoError(absl::StrCat("binding ", path));
+      close(listen_fd);
+      return status;
+    }
+    auto shutdown_fd = CreateDoorbell();
+    if (!shutdown_fd.ok()) {
+      close(listen_fd);
+      return shutdown_fd.status();
+    }
+    return MakeOrphanable<ShmServerListener>(server, args, std::string(path),
+                                             address, listen_fd, *shutdown_fd);
+  }
+
+  void Start() override {
+    MutexLock lock(&mu_);
+    if (shutdown_) return;
+    accept_thread_ =
+        Thread("shm-accept", [self = RefAsSubclass<ShmServerListener>()]() {
+          self->AcceptLoop();
+        });
+    accept_thread_.Start();
+    started_ = true;
+  }
+
+  channelz::ListenSocketNode* channelz_listen_socket_node() const override {
+    return nullptr;
+  }
+
+  void SetServerListenerState(RefCountedPtr<Server::ListenerState>) override {}
+
+  const grpc_resolved_address* resolved_address() const override {
+    // shm doesn't use the new ListenerState interface yet.
+    Crash("Unimplemented");
+    return nullptr;
+  }
+
+  void SetOnDestroyDone(grpc_closure* closure) override {
+    MutexLock lock(&mu_);
+    on_destroy_done_ = closure;
+  }
+
+  void Orphan() override {
+    bool started;
+    {
+      MutexLock lock(&mu_);
+      shutdown_ = true;
+      started = started_;
+    }
+    if (started) {
+      RingDoorbell(shutdown_fd_);
+      accept_thread_.Join();
+    }
+    grpc_unlink_if_unix_domain_socket(&address_);
+    Unref();
+  }
+
+ private:
+  // An accepted socket waiting for the client's half of the handoff.
+  struct PendingHandoff {
+    int fd;
+    Timestamp deadline;
+  };
+
+  void AcceptLoop() {
+    std::vector<PendingHandoff> pending;
+    std::vector<pollfd> fds;
+    while (true) {
+      fds.clear();
+      fds.push_back({shutdown_fd_, POLLIN, 0});
+      fds.push_back({listen_fd_, POLLIN, 0});
+      Timestamp next_deadline = Timestamp::InfFuture();
+      for (const PendingHandoff& handoff : pending) {
+        fds.push_back({handoff.fd, POLLIN, 0});
+        next_deadline = std::min(next_deadline, handoff.deadline);
+      }
+      int timeout_ms = -1;
+      if (next_deadline != Timestamp::InfFuture()) {
+        timeout_ms = std::clamp<int64_t>(
+            (next_deadline - Timestamp::Now()).millis(), 0, INT_MAX);
+      }
+      if (poll(fds.data(), fds.size(), timeout_ms) < 0) {
+        if (errno == EINTR) continue;
+        LOG(ERROR) << "shm listener poll failed: " << StrError(errno);
+        break;
+      }
+      if (fds[0].revents != 0) break;
+      // Hand off every socket whose client has spoken, and drop those that
+      // have run out of time.
+      const Timestamp now = Timestamp::Now();
+      std::vector<PendingHandoff> still_pending;
+      for (size_t i = 0; i < pending.size(); ++i) {
+        if (fds[i + 2].revents != 0) {
+          Handoff(pending[i].fd);
+        } else if (pending[i].deadline <= now) {
+          GRPC_CHANNELZ_LOG(server_->channelz_node())
+              << "shm handoff timed out";
+          close(pending[i].fd);
+        } else {
+          still_pending.push_back(pending[i]);
+        }
+      }
+      pending.swap(still_pending);
+      if (fds[1].revents != 0) AcceptPending(now, pending);
+    }
+    for (const PendingHandoff& handoff : pending) close(handoff.fd);
+  }
+
+  void AcceptPending(Timestamp now, std::vector<PendingHandoff>& pending) {
+    while (true) {
+      const int fd = accept4(listen_fd_, nullptr, nullptr,
+                             SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (fd < 0) {
+        if (errno == EINTR || errno == ECONNABORTED) continue;
+        if (errno != EAGAIN) {
+          LOG(ERROR) << "shm listener accept failed: " << StrError(errno);
+        }
+        return;
+      }
+      if (pending.size() >= kMaxPendingHandoffs) {
+        GRPC_CHANNELZ_LOG(server_->channelz_node())
+            << "too many pending shm handoffs";
+        close(fd);
+        continue;
+      }
+      pending.push_back({fd, now + handoff_timeout_});
+    }
+  }
+
+  // Runs on the accept thread once the client's half of the handoff has
+  // arrived; completing it never blocks.
+  void Handoff(int fd) {
+    auto connection = ShmConnection::Accept(fd);
+    if (!connection.ok()) {
+      GRPC_CHANNELZ_LOG(server_->channelz_node())
+          << "shm handoff failed: " << connection.status();
+      return;
+    }
+    event_engine_->Run([self = RefAsSubclass<ShmServerListener>(),
+                        connection = std::move(*connection)]() mutable {
+      ExecCtx exec_ctx;
+      self->SetupTransport(std::move(connection));
+    });
+  }
+
+  void SetupTransport(std::unique_ptr<ShmConnection> connection) {
+    {
+      MutexLock lock(&mu_);
+      if (shutdown_) return;
+    }
+    auto socket_node = ShmFrameTransport::MakeSocketNode(args_, path_);
+    auto frame_transport = MakeOrphanable<ShmFrameTransport>(
+        std::move(connection), MakeRefCounted<chaotic_good::TransportContext>(
+                                   args_, std::move(socket_node)));
+    auto status = server_->SetupTransport(
+        new chaotic_good::ChaoticGoodServerTransport(
+            args_, std::move(frame_transport), NoChunking()),
+        nullptr, args_);
+    if (!status.ok()) {
+      LOG(ERROR) << "shm transport setup failed: " << status;
+    }
+  }
+
+  Server* const server_;
+  const ChannelArgs args_;
+  const std::shared_ptr<EventEngine> event_engine_;
+  const Duration handoff_timeout_;
+  const std::string path_;
+  const grpc_resolved_address address_;
+  const int listen_fd_;
+  // Rung by Orphan() to stop the accept thread.
+  const int shutdown_fd_;
+  Thread accept_thread_;
+  Mutex mu_;
+  bool started_ ABSL_GUARDED_BY(mu_) = false;
+  bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  grpc_closure* on_destroy_done_ ABSL_GUARDED_BY(mu_) = nullptr;
+};
+
+#endif  // GRPC_SHM_LISTENER
+
+class ShmEndpointTransport final : public EndpointTransport {
+ public:
+  absl::StatusOr<grpc_channel*> ChannelCreate(
+      std::string target, const ChannelArgs& args) override {
+    return CreateShmChannel(std::move(target), args);
+  }
+
+  absl::StatusOr<int> AddPort(Server* server, std::string addr,
+                              const ChannelArgs& args) override {
+    return AddShmPort(server, std::move(addr), args);
+  }
+};
+
+const absl::string_view kScheme = []() {
+  // Side-effect: registers the transport and its resolver with the config
+  // system.
+  CoreConfiguration::RegisterPersistentBuilder(
+      [](CoreConfiguration::Builder* builder) {
+        builder->endpoint_transport_registry()->RegisterTransport(
+            "shm", std::make_unique<ShmEndpointTransport>());
+        builder->resolver_registry()->RegisterResolverFactory(
+            std::make_unique<ShmResolverFactory>());
+      });
+  return "shm";
+}();
+
+}  // namespace
+
+absl::string_view Scheme() { return kScheme; }
+
+absl::StatusOr<grpc_channel*> CreateShmChannel(std::string target,
+                                               const ChannelArgs& args) {
+  auto r = ChannelCreate(
+      target,
+      args.SetObject(EndpointTransportClientChannelFactory<ShmConnector>())
+          .Set(GRPC_ARG_USE_V3_STACK, true),
+      GRPC_CLIENT_CHANNEL, nullptr);
+  if (r.ok()) {
+    return r->release()->c_ptr();
+  } else {
+    return r.status();
+  }
+}
+
+absl::StatusOr<int> AddShmPort(Server* server, std::string addr,
+                               const ChannelArgs& args) {
+#ifdef GRPC_SHM_LISTENER
+  auto uri = URI::Parse(addr);
+  if (!uri.ok()) return uri.status();
+  if (uri->scheme() != "shm" || uri->path().empty()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("expected a shm:/path address, got '", addr, "'"));
+  }
+  auto listener = ShmServerListener::Bind(server, args, uri->path());
+  if (!listener.ok()) return listener.status();
+  server->AddListener(std::move(*listener));
+  // There is no port number: report success the way Unix sockets do.
+  return 1;
+#else
+  (void)server;
+  (void)args;
+  return absl::UnimplementedError(
+      absl::StrCat("shm transport requires Linux: ", addr));
+#endif
+}
+
+}  // namespace shm
+}  // namespace grpc_core
@@ -0,0 +1,58 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
+
+#include <grpc/grpc.h>
+#include <grpc/support/port_platform.h>
+
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/server/server.h"
+
+// Size in bytes of each direction's ring; a power of two between 4KiB and
+// 1GiB. Set on the client, which creates the segment.
+#define GRPC_ARG_SHM_RING_SIZE "grpc.experimental.shm.ring_size"
+
+namespace grpc_core {
+namespace shm {
+
+// A transport for a client and server on the same host. Targets and listening
+// addresses look like `shm:/path/to/socket`: the server listens on that Unix
+// socket, and each connection made through it is handed off to a pair of
+// shared memory rings.
+//
+// Linux only. Registered as the "shm" endpoint transport, which the `shm:`
+// scheme selects by default.
+
+// The name of the transport, which is also the target scheme. Referencing it
+// makes sure the transport gets linked in and registered.
+absl::string_view Scheme();
+
+// Creates a channel to a `shm:` target.
+absl::StatusOr<grpc_channel*> CreateShmChannel(std::string target,
+                                               const ChannelArgs& args);
+
+// Listens on a `shm:` address.
+absl::StatusOr<int> AddShmPort(Server* server, std::string addr,
+                               const ChannelArgs& args);
+
+}  // namespace shm
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
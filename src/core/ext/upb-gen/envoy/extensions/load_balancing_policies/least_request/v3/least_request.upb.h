@@ -0,0 +1,254 @@
+/* This file was generated by upb_generator from the input file:
+ *
+ *     envoy/extensions/load_balancing_policies/least_request/v3/least_request.proto
+ *
+ * Do not edit -- your changes will be discarded when the file is
+ * regenerated.
+ * NO CHECKED-IN PROTOBUF GENCODE */
+
+#ifndef ENVOY_EXTENSIONS_LOAD_BALANCING_POLICIES_LEAST_REQUEST_V3_LEAST_REQUEST_PROTO_UPB_H__UPB_H_
+#define ENVOY_EXTENSIONS_LOAD_BALANCING_POLICIES_LEAST_REQUEST_V3_LEAST_REQUEST_PROTO_UPB_H__UPB_H_
+
+#include "upb/generated_code_support.h"
+
+#include "envoy/extensions/load_balancing_policies/least_request/v3/least_request.upb_minitable.h"
+
+#include "envoy/config/core/v3/base.upb_minitable.h"
+#include "envoy/extensions/load_balancing_policies/common/v3/common.upb_minitable.h"
+#include "google/protobuf/wrappers.upb_minitable.h"
+#include "envoy/annotations/deprecation.upb_minitable.h"
+#include "udpa/annotations/status.upb_minitable.h"
+#include "validate/validate.upb_minitable.h"
+
+// Must be last.
+#include "upb/port/def.inc"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest { upb_Message UPB_PRIVATE(base); } envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest;
+struct envoy_config_core_v3_RuntimeDouble;
+struct envoy_extensions_load_balancing_policies_common_v3_LocalityLbConfig;
+struct envoy_extensions_load_balancing_policies_common_v3_SlowStartConfig;
+struct google_protobuf_BoolValue;
+struct google_protobuf_UInt32Value;
+
+typedef enum {
+  envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_N_CHOICES = 0,
+  envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_FULL_SCAN = 1
+} envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_SelectionMethod;
+
+
+
+/* envoy.extensions.load_balancing_policies.least_request.v3.LeastRequest */
+
+UPB_INLINE envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_new(upb_Arena* arena) {
+  return (envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest*)_upb_Message_New(&envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init, arena);
+}
+UPB_INLINE envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_parse(const char* buf, size_t size, upb_Arena* arena) {
+  envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* ret = envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_new(arena);
+  if (!ret) return NULL;
+  if (upb_Decode(buf, size, UPB_UPCAST(ret), &envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init, NULL, 0, arena) !=
+      kUpb_DecodeStatus_Ok) {
+    return NULL;
+  }
+  return ret;
+}
+UPB_INLINE envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_parse_ex(const char* buf, size_t size,
+                           const upb_ExtensionRegistry* extreg,
+                           int options, upb_Arena* arena) {
+  envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* ret = envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_new(arena);
+  if (!ret) return NULL;
+  if (upb_Decode(buf, size, UPB_UPCAST(ret), &envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init, extreg, options,
+                 arena) != kUpb_DecodeStatus_Ok) {
+    return NULL;
+  }
+  return ret;
+}
+UPB_INLINE char* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_serialize(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg, upb_Arena* arena, size_t* len) {
+  char* ptr;
+  (void)upb_Encode(UPB_UPCAST(msg), &envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init, 0, arena, &ptr, len);
+  return ptr;
+}
+UPB_INLINE char* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_serialize_ex(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg, int options,
+                                 upb_Arena* arena, size_t* len) {
+  char* ptr;
+  (void)upb_Encode(UPB_UPCAST(msg), &envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init, options, arena, &ptr, len);
+  return ptr;
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_clear_choice_count(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {1, 16, 64, 0, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  upb_Message_ClearBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE const struct google_protobuf_UInt32Value* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_choice_count(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const struct google_protobuf_UInt32Value* default_val = NULL;
+  const struct google_protobuf_UInt32Value* ret;
+  const upb_MiniTableField field = {1, 16, 64, 0, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&google__protobuf__UInt32Value_msg_init);
+  _upb_Message_GetNonExtensionField(UPB_UPCAST(msg), &field,
+                                    &default_val, &ret);
+  return ret;
+}
+UPB_INLINE bool envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_has_choice_count(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {1, 16, 64, 0, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  return upb_Message_HasBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_clear_active_request_bias(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {2, UPB_SIZE(20, 24), 65, 1, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  upb_Message_ClearBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE const struct envoy_config_core_v3_RuntimeDouble* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_active_request_bias(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const struct envoy_config_core_v3_RuntimeDouble* default_val = NULL;
+  const struct envoy_config_core_v3_RuntimeDouble* ret;
+  const upb_MiniTableField field = {2, UPB_SIZE(20, 24), 65, 1, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&envoy__config__core__v3__RuntimeDouble_msg_init);
+  _upb_Message_GetNonExtensionField(UPB_UPCAST(msg), &field,
+                                    &default_val, &ret);
+  return ret;
+}
+UPB_INLINE bool envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_has_active_request_bias(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {2, UPB_SIZE(20, 24), 65, 1, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  return upb_Message_HasBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_clear_slow_start_config(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {3, UPB_SIZE(24, 32), 66, 2, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  upb_Message_ClearBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE const struct envoy_extensions_load_balancing_policies_common_v3_SlowStartConfig* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_slow_start_config(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const struct envoy_extensions_load_balancing_policies_common_v3_SlowStartConfig* default_val = NULL;
+  const struct envoy_extensions_load_balancing_policies_common_v3_SlowStartConfig* ret;
+  const upb_MiniTableField field = {3, UPB_SIZE(24, 32), 66, 2, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&envoy__extensions__load_0balancing_0policies__common__v3__SlowStartConfig_msg_init);
+  _upb_Message_GetNonExtensionField(UPB_UPCAST(msg), &field,
+                                    &default_val, &ret);
+  return ret;
+}
+UPB_INLINE bool envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_has_slow_start_config(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {3, UPB_SIZE(24, 32), 66, 2, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  return upb_Message_HasBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_clear_locality_lb_config(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {4, UPB_SIZE(28, 40), 67, 3, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  upb_Message_ClearBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE const struct envoy_extensions_load_balancing_policies_common_v3_LocalityLbConfig* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_locality_lb_config(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const struct envoy_extensions_load_balancing_policies_common_v3_LocalityLbConfig* default_val = NULL;
+  const struct envoy_extensions_load_balancing_policies_common_v3_LocalityLbConfig* ret;
+  const upb_MiniTableField field = {4, UPB_SIZE(28, 40), 67, 3, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&envoy__extensions__load_0balancing_0policies__common__v3__LocalityLbConfig_msg_init);
+  _upb_Message_GetNonExtensionField(UPB_UPCAST(msg), &field,
+                                    &default_val, &ret);
+  return ret;
+}
+UPB_INLINE bool envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_has_locality_lb_config(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {4, UPB_SIZE(28, 40), 67, 3, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  return upb_Message_HasBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_clear_enable_full_scan(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {5, UPB_SIZE(32, 48), 68, 4, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  upb_Message_ClearBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE const struct google_protobuf_BoolValue* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_enable_full_scan(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const struct google_protobuf_BoolValue* default_val = NULL;
+  const struct google_protobuf_BoolValue* ret;
+  const upb_MiniTableField field = {5, UPB_SIZE(32, 48), 68, 4, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&google__protobuf__BoolValue_msg_init);
+  _upb_Message_GetNonExtensionField(UPB_UPCAST(msg), &field,
+                                    &default_val, &ret);
+  return ret;
+}
+UPB_INLINE bool envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_has_enable_full_scan(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {5, UPB_SIZE(32, 48), 68, 4, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  return upb_Message_HasBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_clear_selection_method(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  const upb_MiniTableField field = {6, 12, 0, kUpb_NoSub, 5, (int)kUpb_FieldMode_Scalar | (int)kUpb_LabelFlags_IsAlternate | ((int)kUpb_FieldRep_4Byte << kUpb_FieldRep_Shift)};
+  upb_Message_ClearBaseField(UPB_UPCAST(msg), &field);
+}
+UPB_INLINE int32_t envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_selection_method(const envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg) {
+  int32_t default_val = 0;
+  int32_t ret;
+  const upb_MiniTableField field = {6, 12, 0, kUpb_NoSub, 5, (int)kUpb_FieldMode_Scalar | (int)kUpb_LabelFlags_IsAlternate | ((int)kUpb_FieldRep_4Byte << kUpb_FieldRep_Shift)};
+  _upb_Message_GetNonExtensionField(UPB_UPCAST(msg), &field,
+                                    &default_val, &ret);
+  return ret;
+}
+
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_choice_count(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest *msg, struct google_protobuf_UInt32Value* value) {
+  const upb_MiniTableField field = {1, 16, 64, 0, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&google__protobuf__UInt32Value_msg_init);
+  upb_Message_SetBaseField((upb_Message *)msg, &field, &value);
+}
+UPB_INLINE struct google_protobuf_UInt32Value* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_mutable_choice_count(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg, upb_Arena* arena) {
+  struct google_protobuf_UInt32Value* sub = (struct google_protobuf_UInt32Value*)envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_choice_count(msg);
+  if (sub == NULL) {
+    sub = (struct google_protobuf_UInt32Value*)_upb_Message_New(&google__protobuf__UInt32Value_msg_init, arena);
+    if (sub) envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_choice_count(msg, sub);
+  }
+  return sub;
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_active_request_bias(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest *msg, struct envoy_config_core_v3_RuntimeDouble* value) {
+  const upb_MiniTableField field = {2, UPB_SIZE(20, 24), 65, 1, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&envoy__config__core__v3__RuntimeDouble_msg_init);
+  upb_Message_SetBaseField((upb_Message *)msg, &field, &value);
+}
+UPB_INLINE struct envoy_config_core_v3_RuntimeDouble* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_mutable_active_request_bias(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg, upb_Arena* arena) {
+  struct envoy_config_core_v3_RuntimeDouble* sub = (struct envoy_config_core_v3_RuntimeDouble*)envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_active_request_bias(msg);
+  if (sub == NULL) {
+    sub = (struct envoy_config_core_v3_RuntimeDouble*)_upb_Message_New(&envoy__config__core__v3__RuntimeDouble_msg_init, arena);
+    if (sub) envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_active_request_bias(msg, sub);
+  }
+  return sub;
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_slow_start_config(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest *msg, struct envoy_extensions_load_balancing_policies_common_v3_SlowStartConfig* value) {
+  const upb_MiniTableField field = {3, UPB_SIZE(24, 32), 66, 2, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&envoy__extensions__load_0balancing_0policies__common__v3__SlowStartConfig_msg_init);
+  upb_Message_SetBaseField((upb_Message *)msg, &field, &value);
+}
+UPB_INLINE struct envoy_extensions_load_balancing_policies_common_v3_SlowStartConfig* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_mutable_slow_start_config(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg, upb_Arena* arena) {
+  struct envoy_extensions_load_balancing_policies_common_v3_SlowStartConfig* sub = (struct envoy_extensions_load_balancing_policies_common_v3_SlowStartConfig*)envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_slow_start_config(msg);
+  if (sub == NULL) {
+    sub = (struct envoy_extensions_load_balancing_policies_common_v3_SlowStartConfig*)_upb_Message_New(&envoy__extensions__load_0balancing_0policies__common__v3__SlowStartConfig_msg_init, arena);
+    if (sub) envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_slow_start_config(msg, sub);
+  }
+  return sub;
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_locality_lb_config(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest *msg, struct envoy_extensions_load_balancing_policies_common_v3_LocalityLbConfig* value) {
+  const upb_MiniTableField field = {4, UPB_SIZE(28, 40), 67, 3, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&envoy__extensions__load_0balancing_0policies__common__v3__LocalityLbConfig_msg_init);
+  upb_Message_SetBaseField((upb_Message *)msg, &field, &value);
+}
+UPB_INLINE struct envoy_extensions_load_balancing_policies_common_v3_LocalityLbConfig* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_mutable_locality_lb_config(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg, upb_Arena* arena) {
+  struct envoy_extensions_load_balancing_policies_common_v3_LocalityLbConfig* sub = (struct envoy_extensions_load_balancing_policies_common_v3_LocalityLbConfig*)envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_locality_lb_config(msg);
+  if (sub == NULL) {
+    sub = (struct envoy_extensions_load_balancing_policies_common_v3_LocalityLbConfig*)_upb_Message_New(&envoy__extensions__load_0balancing_0policies__common__v3__LocalityLbConfig_msg_init, arena);
+    if (sub) envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_locality_lb_config(msg, sub);
+  }
+  return sub;
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_enable_full_scan(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest *msg, struct google_protobuf_BoolValue* value) {
+  const upb_MiniTableField field = {5, UPB_SIZE(32, 48), 68, 4, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)};
+  UPB_PRIVATE(_upb_MiniTable_StrongReference)(&google__protobuf__BoolValue_msg_init);
+  upb_Message_SetBaseField((upb_Message *)msg, &field, &value);
+}
+UPB_INLINE struct google_protobuf_BoolValue* envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_mutable_enable_full_scan(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest* msg, upb_Arena* arena) {
+  struct google_protobuf_BoolValue* sub = (struct google_protobuf_BoolValue*)envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_enable_full_scan(msg);
+  if (sub == NULL) {
+    sub = (struct google_protobuf_BoolValue*)_upb_Message_New(&google__protobuf__BoolValue_msg_init, arena);
+    if (sub) envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_enable_full_scan(msg, sub);
+  }
+  return sub;
+}
+UPB_INLINE void envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_set_selection_method(envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest *msg, int32_t value) {
+  const upb_MiniTableField field = {6, 12, 0, kUpb_NoSub, 5, (int)kUpb_FieldMode_Scalar | (int)kUpb_LabelFlags_IsAlternate | ((int)kUpb_FieldRep_4Byte << kUpb_FieldRep_Shift)};
+  upb_Message_SetBaseField((upb_Message *)msg, &field, &value);
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#include "upb/port/undef.inc"
+
+#endif  /* ENVOY_EXTENSIONS_LOAD_BALANCING_POLICIES_LEAST_REQUEST_V3_LEAST_REQUEST_PROTO_UPB_H__UPB_H_ */
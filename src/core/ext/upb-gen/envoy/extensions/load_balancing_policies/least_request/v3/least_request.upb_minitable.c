@@ -0,0 +1,74 @@
+/* This file was generated by upb_generator from the input file:
+ *
+ *     envoy/extensions/load_balancing_policies/least_request/v3/least_request.proto
+ *
+ * Do not edit -- your changes will be discarded when the file is
+ * regenerated.
+ * NO CHECKED-IN PROTOBUF GENCODE */
+
+#include <stddef.h>
+#include "upb/generated_code_support.h"
+#include "envoy/extensions/load_balancing_policies/least_request/v3/least_request.upb_minitable.h"
+#include "envoy/config/core/v3/base.upb_minitable.h"
+#include "envoy/extensions/load_balancing_policies/common/v3/common.upb_minitable.h"
+#include "google/protobuf/wrappers.upb_minitable.h"
+#include "envoy/annotations/deprecation.upb_minitable.h"
+#include "udpa/annotations/status.upb_minitable.h"
+#include "validate/validate.upb_minitable.h"
+
+// Must be last.
+#include "upb/port/def.inc"
+
+extern const struct upb_MiniTable UPB_PRIVATE(_kUpb_MiniTable_StaticallyTreeShaken);
+static const upb_MiniTableSubInternal envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest__submsgs[5] = {
+  {.UPB_PRIVATE(submsg) = &google__protobuf__UInt32Value_msg_init_ptr},
+  {.UPB_PRIVATE(submsg) = &envoy__config__core__v3__RuntimeDouble_msg_init_ptr},
+  {.UPB_PRIVATE(submsg) = &envoy__extensions__load_0balancing_0policies__common__v3__SlowStartConfig_msg_init_ptr},
+  {.UPB_PRIVATE(submsg) = &envoy__extensions__load_0balancing_0policies__common__v3__LocalityLbConfig_msg_init_ptr},
+  {.UPB_PRIVATE(submsg) = &google__protobuf__BoolValue_msg_init_ptr},
+};
+
+static const upb_MiniTableField envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest__fields[6] = {
+  {1, 16, 64, 0, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)},
+  {2, UPB_SIZE(20, 24), 65, 1, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)},
+  {3, UPB_SIZE(24, 32), 66, 2, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)},
+  {4, UPB_SIZE(28, 40), 67, 3, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)},
+  {5, UPB_SIZE(32, 48), 68, 4, 11, (int)kUpb_FieldMode_Scalar | ((int)UPB_SIZE(kUpb_FieldRep_4Byte, kUpb_FieldRep_8Byte) << kUpb_FieldRep_Shift)},
+  {6, 12, 0, kUpb_NoSub, 5, (int)kUpb_FieldMode_Scalar | (int)kUpb_LabelFlags_IsAlternate | ((int)kUpb_FieldRep_4Byte << kUpb_FieldRep_Shift)},
+};
+
+const upb_MiniTable envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init = {
+  &envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest__submsgs[0],
+  &envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest__fields[0],
+  UPB_SIZE(40, 56), 6, kUpb_ExtMode_NonExtendable, 6, UPB_FASTTABLE_MASK(56), 0,
+#ifdef UPB_TRACING_ENABLED
+  "envoy.extensions.load_balancing_policies.least_request.v3.LeastRequest",
+#endif
+  UPB_FASTTABLE_INIT({
+    {0x0000000000000000, &_upb_FastDecoder_DecodeGeneric},
+    {0x0000000000000000, &_upb_FastDecoder_DecodeGeneric},
+    {0x0000000000000000, &_upb_FastDecoder_DecodeGeneric},
+    {0x0000000000000000, &_upb_FastDecoder_DecodeGeneric},
+    {0x0000000000000000, &_upb_FastDecoder_DecodeGeneric},
+    {0x0000000000000000, &_upb_FastDecoder_DecodeGeneric},
+    {0x000c00003f000030, &upb_psv4_1bt},
+    {0x0000000000000000, &_upb_FastDecoder_DecodeGeneric},
+  })
+};
+
+const upb_MiniTable* envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init_ptr = &envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init;
+static const upb_MiniTable *messages_layout[1] = {
+  &envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init,
+};
+
+const upb_MiniTableFile envoy_extensions_load_balancing_policies_least_request_v3_least_request_proto_upb_file_layout = {
+  messages_layout,
+  NULL,
+  NULL,
+  1,
+  0,
+  0,
+};
+
+#include "upb/port/undef.inc"
+
@@ -0,0 +1,32 @@
+/* This file was generated by upb_generator from the input file:
+ *
+ *     envoy/extensions/load_balancing_policies/least_request/v3/least_request.proto
+ *
+ * Do not edit -- your changes will be discarded when the file is
+ * regenerated.
+ * NO CHECKED-IN PROTOBUF GENCODE */
+
+#ifndef ENVOY_EXTENSIONS_LOAD_BALANCING_POLICIES_LEAST_REQUEST_V3_LEAST_REQUEST_PROTO_UPB_H__UPB_MINITABLE_H_
+#define ENVOY_EXTENSIONS_LOAD_BALANCING_POLICIES_LEAST_REQUEST_V3_LEAST_REQUEST_PROTO_UPB_H__UPB_MINITABLE_H_
+
+#include "upb/generated_code_support.h"
+
+// Must be last.
+#include "upb/port/def.inc"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const upb_MiniTable envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init;
+extern const upb_MiniTable* envoy__extensions__load_0balancing_0policies__least_0request__v3__LeastRequest_msg_init_ptr;
+
+extern const upb_MiniTableFile envoy_extensions_load_balancing_policies_least_request_v3_least_request_proto_upb_file_layout;
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#include "upb/port/undef.inc"
+
+#endif  /* ENVOY_EXTENSIONS_LOAD_BALANCING_POLICIES_LEAST_REQUEST_V3_LEAST_REQUEST_PROTO_UPB_H__UPB_MINITABLE_H_ */
@@ -25,6 +25,7 @@
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
+#include <errno.h>
 #include <limits.h>
 #include <stdint.h>
 #include <string.h>
@@ -39,6 +40,7 @@
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "src/core/channelz/channelz.h"
@@ -48,11 +50,13 @@
 #include "src/core/handshaker/handshaker_registry.h"
 #include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
+#include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/iomgr/tcp_server.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -62,9 +66,24 @@
 #include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/strerror.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/unique_type_name.h"
 
+#ifdef GRPC_LINUX_KTLS
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif  // GRPC_LINUX_KTLS
+
 #define GRPC_INITIAL_HANDSHAKE_BUFFER_SIZE 256
 
 namespace grpc_core {
@@ -104,8 +123,13 @@ class SecurityHandshaker : public Handshaker {
       tsi_result result, void* user_data, const unsigned char* bytes_to_send,
       size_t bytes_to_send_size, tsi_handshaker_result* handshaker_result);
   void OnPeerCheckedFn(grpc_error_handle error);
+  void OnKernelTlsDataSentToPeerFnScheduler(grpc_error_handle error);
+  void OnKernelTlsDataSentToPeerFn(absl::Status error);
   size_t MoveReadBufferIntoHandshakeBuffer();
   grpc_error_handle CheckPeerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  bool PrepareKernelTlsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void InstallKernelTlsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void FinishHandshakeLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   // State set at creation time.
   tsi_handshaker* handshaker_;
@@ -127,6 +151,10 @@ class SecurityHandshaker : public Handshaker {
   size_t max_frame_size_ = 0;
   std::string tsi_handshake_error_;
   grpc_closure* on_peer_checked_ ABSL_GUARDED_BY(mu_) = nullptr;
+  // The transmit keys while records sealed before exporting them are sent.
+  tsi_ktls_crypto_info ktls_tx_ ABSL_GUARDED_BY(mu_) = {};
+  // Whether the kernel protects outgoing records.
+  bool kernel_tls_tx_ ABSL_GUARDED_BY(mu_) = false;
 };
 
 SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
@@ -141,6 +169,7 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
           std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))) {}
 
 SecurityHandshaker::~SecurityHandshaker() {
+  memset(&ktls_tx_, 0, sizeof(ktls_tx_));
   tsi_handshaker_destroy(handshaker_);
   tsi_handshaker_result_destroy(handshaker_result_);
   gpr_free(handshake_buffer_);
@@ -210,8 +239,176 @@ MakeChannelzSecurityFromAuthContext(grpc_auth_context* auth_context) {
   return security;
 }
 
+#ifdef GRPC_LINUX_KTLS
+template <typename CryptoInfo>
+bool SetKtlsCryptoInfo(int fd, int direction, uint16_t cipher_type,
+                       const tsi_ktls_crypto_info& info) {
+  CryptoInfo crypto_info = {};
+  static_assert(sizeof(crypto_info.iv) == sizeof(info.iv));
+  static_assert(sizeof(crypto_info.salt) == sizeof(info.salt));
+  static_assert(sizeof(crypto_info.rec_seq) == sizeof(info.rec_seq));
+  CHECK_EQ(info.key_size, sizeof(crypto_info.key));
+  crypto_info.info.version = info.version;
+  crypto_info.info.cipher_type = cipher_type;
+  memcpy(crypto_info.key, info.key, sizeof(crypto_info.key));
+  memcpy(crypto_info.iv, info.iv, sizeof(crypto_info.iv));
+  memcpy(crypto_info.salt, info.salt, sizeof(crypto_info.salt));
+  memcpy(crypto_info.rec_seq, info.rec_seq, sizeof(crypto_info.rec_seq));
+  const bool ok =
+      setsockopt(fd, SOL_TLS, direction, &crypto_info, sizeof(crypto_info)) ==
+      0;
+  const int saved_errno = errno;
+  memset(&crypto_info, 0, sizeof(crypto_info));
+  errno = saved_errno;
+  return ok;
+}
+
+// Installs the record layer state of one direction (TLS_TX or TLS_RX) of the
+// connection on the socket.
+bool SetKtlsCryptoInfo(int fd, int direction,
+                       const tsi_ktls_crypto_info& info) {
+  switch (info.cipher) {
+    case TSI_KTLS_CIPHER_AES_128_GCM:
+      return SetKtlsCryptoInfo<tls12_crypto_info_aes_gcm_128>(
+          fd, direction, TLS_CIPHER_AES_GCM_128, info);
+    case TSI_KTLS_CIPHER_AES_256_GCM:
+      return SetKtlsCryptoInfo<tls12_crypto_info_aes_gcm_256>(
+          fd, direction, TLS_CIPHER_AES_GCM_256, info);
+    case TSI_KTLS_CIPHER_NONE:
+      break;
+  }
+  errno = EINVAL;
+  return false;
+}
+
+// The frame protector of a connection whose outgoing records the kernel
+// protects. Incoming frames are still unprotected by the wrapped protector,
+// and outgoing bytes pass through unchanged.
+struct KtlsTxFrameProtector {
+  tsi_frame_protector base;
+  tsi_frame_protector* wrapped;
+};
+
+tsi_result KtlsTxProtect(tsi_frame_protector* /*self*/,
+                         const unsigned char* unprotected_bytes,
+                         size_t* unprotected_bytes_size,
+                         unsigned char* protected_output_frames,
+                         size_t* protected_output_frames_size) {
+  const size_t size =
+      std::min(*unprotected_bytes_size, *protected_output_frames_size);
+  memcpy(protected_output_frames, unprotected_bytes, size);
+  *unprotected_bytes_size = size;
+  *protected_output_frames_size = size;
+  return TSI_OK;
+}
+
+tsi_result KtlsTxProtectFlush(tsi_frame_protector* /*self*/,
+                              unsigned char* /*protected_output_frames*/,
+                              size_t* protected_output_frames_size,
+                              size_t* still_pending_size) {
+  *protected_output_frames_size = 0;
+  *still_pending_size = 0;
+  return TSI_OK;
+}
+
+tsi_result KtlsTxUnprotect(tsi_frame_protector* self,
+                           const unsigned char* protected_frames_bytes,
+                           size_t* protected_frames_bytes_size,
+                           unsigned char* unprotected_bytes,
+                           size_t* unprotected_bytes_size) {
+  return tsi_frame_protector_unprotect(
+      reinterpret_cast<KtlsTxFrameProtector*>(self)->wrapped,
+      protected_frames_bytes, protected_frames_bytes_size, unprotected_bytes,
+      unprotected_bytes_size);
+}
+
+void KtlsTxDestroy(tsi_frame_protector* self) {
+  auto* protector = reinterpret_cast<KtlsTxFrameProtector*>(self);
+  tsi_frame_protector_destroy(protector->wrapped);
+  delete protector;
+}
+
+const tsi_frame_protector_vtable kKtlsTxFrameProtectorVtable = {
+    KtlsTxProtect, KtlsTxProtectFlush, KtlsTxUnprotect, KtlsTxDestroy};
+
+tsi_frame_protector* MakeKtlsTxFrameProtector(tsi_frame_protector* wrapped) {
+  auto* protector = new KtlsTxFrameProtector;
+  protector->base.vtable = &kKtlsTxFrameProtectorVtable;
+  protector->wrapped = wrapped;
+  return &protector->base;
+}
+#endif  // GRPC_LINUX_KTLS
+
 }  // namespace
 
+// Only outgoing records are protected by the kernel. Incoming ones may be
+// alerts or post-handshake messages, such as TLS 1.3 session tickets and key
+// updates, which kernel TLS only passes up as control messages that the
+// endpoints do not ask for, so they stay with the frame protector.
+//
+// Returns true if the transmit keys were exported, in which case the records
+// the TSI result sealed before, now in outgoing_, must be sent before
+// InstallKernelTlsLocked() hands the keys to the kernel.
+bool SecurityHandshaker::PrepareKernelTlsLocked() {
+#ifdef GRPC_LINUX_KTLS
+  // Kernel TLS rejects MSG_ZEROCOPY sends.
+  if (!args_->args.GetBool(GRPC_ARG_TLS_KERNEL_OFFLOAD_ENABLED)
+           .value_or(false) ||
+      args_->args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(false)) {
+    return false;
+  }
+  // Only a normal frame protector can be left to unprotect on its own.
+  tsi_frame_protector_type frame_protector_type;
+  if (tsi_handshaker_result_get_frame_protector_type(
+          handshaker_result_, &frame_protector_type) != TSI_OK ||
+      frame_protector_type != TSI_FRAME_PROTECTOR_NORMAL) {
+    return false;
+  }
+  const int fd = grpc_endpoint_get_fd(args_->endpoint.get());
+  if (fd < 0) return false;
+  // Until keys are installed, the ULP leaves the socket's data alone, so a
+  // failure after this point still falls back to the frame protector.
+  if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    GRPC_TRACE_LOG(handshaker, INFO)
+        << "Security handshaker " << this
+        << ": kernel TLS unavailable: " << StrError(errno);
+    return false;
+  }
+  const unsigned char* bytes_to_send = nullptr;
+  size_t bytes_to_send_size = 0;
+  tsi_result result = tsi_handshaker_result_get_ktls_tx_crypto_info(
+      handshaker_result_, &ktls_tx_, &bytes_to_send, &bytes_to_send_size);
+  if (result != TSI_OK) {
+    GRPC_TRACE_LOG(handshaker, INFO)
+        << "Security handshaker " << this
+        << ": not offloading TLS to the kernel: "
+        << tsi_result_to_string(result);
+    return false;
+  }
+  outgoing_.Clear();
+  if (bytes_to_send_size > 0) {
+    outgoing_.Append(Slice::FromCopiedBuffer(
+        reinterpret_cast<const char*>(bytes_to_send), bytes_to_send_size));
+  }
+  return true;
+#else
+  return false;
+#endif  // GRPC_LINUX_KTLS
+}
+
+void SecurityHandshaker::InstallKernelTlsLocked() {
+#ifdef GRPC_LINUX_KTLS
+  const int fd = grpc_endpoint_get_fd(args_->endpoint.get());
+  kernel_tls_tx_ = fd >= 0 && SetKtlsCryptoInfo(fd, TLS_TX, ktls_tx_);
+  if (!kernel_tls_tx_) {
+    GRPC_TRACE_LOG(handshaker, INFO)
+        << "Security handshaker " << this
+        << ": kernel TLS rejected the transmit keys: " << StrError(errno);
+  }
+  memset(&ktls_tx_, 0, sizeof(ktls_tx_));
+#endif  // GRPC_LINUX_KTLS
+}
+
 void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
   MutexLock lock(&mu_);
   on_peer_checked_ = nullptr;
@@ -219,6 +416,53 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
     HandshakeFailedLocked(error);
     return;
   }
+  if (PrepareKernelTlsLocked()) {
+    if (outgoing_.Length() == 0) {
+      InstallKernelTlsLocked();
+    } else {
+      // The peer must get the records sealed by TSI ahead of any sealed by
+      // the kernel.
+      grpc_event_engine::experimental::EventEngine::Endpoint::WriteArgs
+          write_args;
+      write_args.set_max_frame_size(INT_MAX);
+      grpc_endpoint_write(
+          args_->endpoint.get(), outgoing_.c_slice_buffer(),
+          NewClosure([self = RefAsSubclass<SecurityHandshaker>()](
+                         absl::Status status) {
+            self->OnKernelTlsDataSentToPeerFnScheduler(std::move(status));
+          }),
+          std::move(write_args));
+      return;
+    }
+  }
+  FinishHandshakeLocked();
+}
+
+// This callback might be run inline while we are still holding on to the mutex,
+// so run OnKernelTlsDataSentToPeerFn asynchronously to avoid a deadlock.
+void SecurityHandshaker::OnKernelTlsDataSentToPeerFnScheduler(
+    grpc_error_handle error) {
+  args_->event_engine->Run([self = RefAsSubclass<SecurityHandshaker>(),
+                            error = std::move(error)]() mutable {
+    ExecCtx exec_ctx;
+    self->OnKernelTlsDataSentToPeerFn(std::move(error));
+    // Avoid destruction outside of an ExecCtx (since this is non-cancelable).
+    self.reset();
+  });
+}
+
+void SecurityHandshaker::OnKernelTlsDataSentToPeerFn(absl::Status error) {
+  MutexLock lock(&mu_);
+  if (!error.ok() || is_shutdown_) {
+    HandshakeFailedLocked(
+        GRPC_ERROR_CREATE_REFERENCING("Handshake write failed", &error, 1));
+    return;
+  }
+  InstallKernelTlsLocked();
+  FinishHandshakeLocked();
+}
+
+void SecurityHandshaker::FinishHandshakeLocked() {
   // Get unused bytes.
   const unsigned char* unused_bytes = nullptr;
   size_t unused_bytes_size = 0;
@@ -269,6 +513,9 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
                                            tsi_result_to_string(result), ")")));
         return;
       }
+#ifdef GRPC_LINUX_KTLS
+      if (kernel_tls_tx_) protector = MakeKtlsTxFrameProtector(protector);
+#endif  // GRPC_LINUX_KTLS
       break;
     case TSI_FRAME_PROTECTOR_NONE:
       break;
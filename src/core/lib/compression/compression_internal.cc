@@ -45,6 +45,10 @@ const char* CompressionAlgorithmAsString(grpc_compression_algorithm algorithm) {
       return "deflate";
     case GRPC_COMPRESS_GZIP:
       return "gzip";
+    case GRPC_COMPRESS_ZSTD:
+      return "zstd";
+    case GRPC_COMPRESS_LZ4:
+      return "lz4";
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
     default:
       return nullptr;
@@ -85,7 +89,7 @@ class CommaSeparatedLists {
  private:
   static constexpr size_t kNumLists = 1 << GRPC_COMPRESS_ALGORITHMS_COUNT;
   // Experimentally determined (tweak things until it runs).
-  static constexpr size_t kTextBufferSize = 86;
+  static constexpr size_t kTextBufferSize = 514;
   absl::string_view lists_[kNumLists];
   char text_buffer_[kTextBufferSize];
 };
@@ -101,6 +105,10 @@ std::optional<grpc_compression_algorithm> ParseCompressionAlgorithm(
     return GRPC_COMPRESS_DEFLATE;
   } else if (algorithm == "gzip") {
     return GRPC_COMPRESS_GZIP;
+  } else if (algorithm == "zstd") {
+    return GRPC_COMPRESS_ZSTD;
+  } else if (algorithm == "lz4") {
+    return GRPC_COMPRESS_LZ4;
   } else {
     return std::nullopt;
   }
@@ -168,7 +176,20 @@ CompressionAlgorithmSet CompressionAlgorithmSet::FromChannelArgs(
       (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
   return CompressionAlgorithmSet::FromUint32(
       args.GetInt(GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET)
-          .value_or(kEverything));
+          .value_or(kEverything) &
+      Supported().ToLegacyBitmask());
+}
+
+CompressionAlgorithmSet CompressionAlgorithmSet::Supported() {
+  CompressionAlgorithmSet set{GRPC_COMPRESS_NONE, GRPC_COMPRESS_DEFLATE,
+                              GRPC_COMPRESS_GZIP};
+#ifdef GRPC_HAVE_ZSTD
+  set.Set(GRPC_COMPRESS_ZSTD);
+#endif
+#ifdef GRPC_HAVE_LZ4
+  set.Set(GRPC_COMPRESS_LZ4);
+#endif
+  return set;
 }
 
 CompressionAlgorithmSet::CompressionAlgorithmSet() = default;
@@ -266,6 +287,9 @@ grpc_compression_options CompressionOptionsFromChannelArgs(
     compression_options.enabled_algorithms_bitset =
         *enabled_algorithms_bitset | 1 /* always support no compression */;
   }
+  // Messages in an algorithm this build leaves out could not be decompressed.
+  compression_options.enabled_algorithms_bitset &=
+      CompressionAlgorithmSet::Supported().ToLegacyBitmask();
   return compression_options;
 }
 
@@ -51,10 +51,14 @@ class CompressionAlgorithmSet {
   // Construct from a uint32_t bitmask - bit 0 => algorithm 0, bit 1 =>
   // algorithm 1, etc.
   static CompressionAlgorithmSet FromUint32(uint32_t value);
-  // Locate in channel args and construct from the found value.
+  // Locate in channel args and construct from the found value, leaving out
+  // algorithms this build does not support.
   static CompressionAlgorithmSet FromChannelArgs(const ChannelArgs& args);
   // Parse a string of comma-separated compression algorithms.
   static CompressionAlgorithmSet FromString(absl::string_view str);
+  // The algorithms this build can compress and decompress: zstd and lz4 are
+  // only there if gRPC was built with them (GRPC_HAVE_ZSTD, GRPC_HAVE_LZ4).
+  static CompressionAlgorithmSet Supported();
   // Construct an empty set.
   CompressionAlgorithmSet();
   // Construct from a std::initializer_list of grpc_compression_algorithm
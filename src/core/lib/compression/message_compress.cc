@@ -21,23 +21,62 @@
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
+#include <stdint.h>
 #include <string.h>
 #include <zconf.h>
 #include <zlib.h>
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/status/status.h"
 #include "src/core/lib/slice/slice.h"
 
-#define OUTPUT_BLOCK_SIZE 1024
+#ifdef GRPC_HAVE_ZSTD
+#include <zstd.h>
+
+#include <string>
+
+#include "absl/container/flat_hash_map.h"
+#include "src/core/util/sync.h"
+#endif
+
+#ifdef GRPC_HAVE_LZ4
+#include <lz4frame.h>
+#endif
 
+#define MIN_OUTPUT_BLOCK_SIZE 1024
+#define MAX_OUTPUT_BLOCK_SIZE (64 * 1024)
+
+// Output is written to blocks of first_block_size bytes, then of twice the
+// previous block's size, up to MAX_OUTPUT_BLOCK_SIZE. Sizing the first block
+// to the expected output keeps most messages to a single block and a single
+// call to flate per input slice.
+// Blocks are never allocated past max_output + 1 bytes of output in total, and
+// the work stops with GRPC_MSG_DECOMPRESS_TOO_LARGE as soon as the output
+// exceeds max_output. That can make blocks small enough to be inlined, so they
+// are always allocated as refcounted slices, whose length can be trimmed.
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush),
+                     size_t first_block_size, size_t max_output) {
   int r = Z_STREAM_END;  // Do not fail on an empty input.
+  int result = 0;
   int flush;
   size_t i;
-  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  size_t block_size = first_block_size;
+  // Bytes of output that may still be allocated, including one past the
+  // limit to detect exceeding it.
+  auto remaining = [zs, max_output]() -> size_t {
+    const size_t left =
+        max_output - std::min<size_t>(zs->total_out, max_output);
+    return left == SIZE_MAX ? left : left + 1;
+  };
+  grpc_slice outbuf =
+      grpc_slice_malloc_large(std::min(block_size, remaining()));
   const uInt uint_max = ~uInt{0};
 
   CHECK(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
@@ -52,7 +91,8 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
     do {
       if (zs->avail_out == 0) {
         grpc_slice_buffer_add_indexed(output, outbuf);
-        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        block_size = std::min<size_t>(block_size * 2, MAX_OUTPUT_BLOCK_SIZE);
+        outbuf = grpc_slice_malloc_large(std::min(block_size, remaining()));
         CHECK(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
         zs->avail_out = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
         zs->next_out = GRPC_SLICE_START_PTR(outbuf);
@@ -62,6 +102,11 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
         VLOG(2) << "zlib error (" << r << ")";
         goto error;
       }
+      if (zs->total_out > max_output) {
+        VLOG(2) << "zlib: output exceeds " << max_output << " bytes";
+        result = GRPC_MSG_DECOMPRESS_TOO_LARGE;
+        goto error;
+      }
     } while (zs->avail_out == 0);
     if (zs->avail_in) {
       VLOG(2) << "zlib: not all input consumed";
@@ -81,7 +126,7 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
 
 error:
   grpc_core::CSliceUnref(outbuf);
-  return 0;
+  return result;
 }
 
 static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
@@ -91,8 +136,15 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
+// The size of the first output block for input_length bytes of input, given
+// that the output is expected to be about `ratio` times the input.
+static size_t first_block_size(size_t input_length, size_t ratio) {
+  return std::clamp<size_t>(input_length * ratio, MIN_OUTPUT_BLOCK_SIZE,
+                            MAX_OUTPUT_BLOCK_SIZE);
+}
+
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                         int gzip) {
+                         int gzip, int level) {
   z_stream zs;
   int r;
   size_t i;
@@ -101,10 +153,15 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   memset(&zs, 0, sizeof(zs));
   zs.zalloc = zalloc_gpr;
   zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
+  r = deflateInit2(&zs, level, Z_DEFLATED, 15 | (gzip ? 16 : 0), 8,
+                   Z_DEFAULT_STRATEGY);
   CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
+  // Output that is no smaller than the input is discarded, so there is no
+  // point in producing any more of it.
+  r = zlib_body(&zs, input, output, deflate,
+                first_block_size(input->length, 1),
+                input->length > 0 ? input->length - 1 : 0) == 1 &&
+      output->length - length_before < input->length;
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
@@ -117,7 +174,7 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
 }
 
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                           int gzip) {
+                           int gzip, size_t max_output) {
   z_stream zs;
   int r;
   size_t i;
@@ -128,8 +185,9 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   zs.zfree = zfree_gpr;
   r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
   CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
-  if (!r) {
+  r = zlib_body(&zs, input, output, inflate,
+                first_block_size(input->length, 4), max_output);
+  if (r != 1) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
     }
@@ -140,6 +198,425 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   return r;
 }
 
+namespace {
+
+// Output blocks for the zstd and lz4 codecs, sized and limited as in
+// zlib_body. Unless Finish() is called, whatever was added to the output is
+// taken back out when this is destroyed.
+class OutputBlocks {
+ public:
+  OutputBlocks(grpc_slice_buffer* output, size_t first_block_size,
+               size_t max_output)
+      : output_(output),
+        count_before_(output->count),
+        length_before_(output->length),
+        max_output_(max_output),
+        block_size_(first_block_size),
+        block_(grpc_slice_malloc_large(std::min(block_size_, Remaining()))) {}
+
+  ~OutputBlocks() {
+    grpc_core::CSliceUnref(block_);
+    if (finished_) return;
+    for (size_t i = count_before_; i < output_->count; i++) {
+      grpc_core::CSliceUnref(output_->slices[i]);
+    }
+    output_->count = count_before_;
+    output_->length = length_before_;
+  }
+
+  OutputBlocks(const OutputBlocks&) = delete;
+  OutputBlocks& operator=(const OutputBlocks&) = delete;
+
+  // Makes room for at least min_size more bytes at data(), moving on to a new
+  // block if the current one has less.
+  void Reserve(size_t min_size) {
+    if (available() >= min_size) return;
+    AddBlock();
+    block_size_ = std::min<size_t>(block_size_ * 2, MAX_OUTPUT_BLOCK_SIZE);
+    block_ = grpc_slice_malloc_large(
+        std::max(min_size, std::min(block_size_, Remaining())));
+  }
+
+  uint8_t* data() { return GRPC_SLICE_START_PTR(block_) + used_; }
+  size_t available() const { return GRPC_SLICE_LENGTH(block_) - used_; }
+
+  // Accounts for size bytes written at data().
+  void Produced(size_t size) {
+    used_ += size;
+    total_ += size;
+  }
+
+  bool Exceeded() const { return total_ > max_output_; }
+
+  // Keeps the output.
+  void Finish() {
+    AddBlock();
+    finished_ = true;
+  }
+
+ private:
+  // Bytes of output that may still be allocated, including one past the
+  // limit to detect exceeding it.
+  size_t Remaining() const {
+    const size_t left = max_output_ - std::min(total_, max_output_);
+    return left == SIZE_MAX ? left : left + 1;
+  }
+
+  // Moves the used part of the current block to the output.
+  void AddBlock() {
+    if (used_ == 0) {
+      grpc_core::CSliceUnref(block_);
+    } else {
+      block_.data.refcounted.length = used_;
+      grpc_slice_buffer_add_indexed(output_, block_);
+    }
+    block_ = grpc_empty_slice();
+    used_ = 0;
+  }
+
+  grpc_slice_buffer* const output_;
+  const size_t count_before_;
+  const size_t length_before_;
+  const size_t max_output_;
+  size_t block_size_;
+  size_t total_ = 0;
+  grpc_slice block_;
+  size_t used_ = 0;
+  bool finished_ = false;
+};
+
+}  // namespace
+
+namespace grpc_core {
+
+#ifdef GRPC_HAVE_ZSTD
+
+struct ZstdDictionary::Digests {
+  ~Digests() {
+    ZSTD_freeDDict(ddict);
+    for (auto& level_and_cdict : cdicts) {
+      ZSTD_freeCDict(level_and_cdict.second);
+    }
+  }
+
+  // The dictionary digested for compression at 'level', made on first use.
+  const ZSTD_CDict* ForLevel(int level) {
+    MutexLock lock(&mu);
+    ZSTD_CDict*& cdict = cdicts[level];
+    if (cdict == nullptr) {
+      cdict = ZSTD_createCDict(content.data(), content.size(), level);
+    }
+    return cdict;
+  }
+
+  std::string content;
+  ZSTD_DDict* ddict = nullptr;
+  Mutex mu;
+  absl::flat_hash_map<int, ZSTD_CDict*> cdicts ABSL_GUARDED_BY(mu);
+};
+
+absl::StatusOr<RefCountedPtr<ZstdDictionary>> ZstdDictionary::Create(
+    absl::string_view content) {
+  auto digests = std::make_unique<Digests>();
+  digests->content = std::string(content);
+  digests->ddict = ZSTD_createDDict(content.data(), content.size());
+  if (digests->ddict == nullptr) {
+    return absl::InvalidArgumentError("not a usable zstd dictionary");
+  }
+  return RefCountedPtr<ZstdDictionary>(new ZstdDictionary(std::move(digests)));
+}
+
+#else  // GRPC_HAVE_ZSTD
+
+struct ZstdDictionary::Digests {};
+
+absl::StatusOr<RefCountedPtr<ZstdDictionary>> ZstdDictionary::Create(
+    absl::string_view /*content*/) {
+  return absl::UnimplementedError("gRPC was built without zstd");
+}
+
+#endif  // GRPC_HAVE_ZSTD
+
+ZstdDictionary::ZstdDictionary(std::unique_ptr<Digests> digests)
+    : digests_(std::move(digests)) {}
+
+ZstdDictionary::~ZstdDictionary() = default;
+
+}  // namespace grpc_core
+
+#ifdef GRPC_HAVE_ZSTD
+
+// Contexts are costly to set up, so each thread keeps one of each for reuse.
+struct ZstdContextDeleter {
+  void operator()(ZSTD_CCtx* cctx) const { ZSTD_freeCCtx(cctx); }
+  void operator()(ZSTD_DCtx* dctx) const { ZSTD_freeDCtx(dctx); }
+};
+
+static ZSTD_CCtx* thread_zstd_cctx() {
+  static thread_local std::unique_ptr<ZSTD_CCtx, ZstdContextDeleter> cctx(
+      ZSTD_createCCtx());
+  CHECK_NE(cctx, nullptr);
+  return cctx.get();
+}
+
+static ZSTD_DCtx* thread_zstd_dctx() {
+  static thread_local std::unique_ptr<ZSTD_DCtx, ZstdContextDeleter> dctx(
+      ZSTD_createDCtx());
+  CHECK_NE(dctx, nullptr);
+  return dctx.get();
+}
+
+static int zstd_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                         int level,
+                         const grpc_core::ZstdDictionary* dictionary) {
+  if (level < 1 || level > ZSTD_maxCLevel()) level = ZSTD_CLEVEL_DEFAULT;
+  ZSTD_CCtx* cctx = thread_zstd_cctx();
+  ZSTD_CCtx_reset(cctx, ZSTD_reset_session_and_parameters);
+  // A dictionary is digested for a given level, which then comes with it.
+  size_t r =
+      dictionary != nullptr
+          ? ZSTD_CCtx_refCDict(cctx, dictionary->digests().ForLevel(level))
+          : ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, level);
+  if (!ZSTD_isError(r)) r = ZSTD_CCtx_setPledgedSrcSize(cctx, input->length);
+  if (ZSTD_isError(r)) {
+    VLOG(2) << "zstd error: " << ZSTD_getErrorName(r);
+    return 0;
+  }
+  // Output that is no smaller than the input is discarded, so there is no
+  // point in producing any more of it.
+  OutputBlocks blocks(output, first_block_size(input->length, 1),
+                      input->length > 0 ? input->length - 1 : 0);
+  size_t i = 0;
+  do {
+    const bool last = i + 1 >= input->count;
+    ZSTD_inBuffer in = {nullptr, 0, 0};
+    if (i < input->count) {
+      in.src = GRPC_SLICE_START_PTR(input->slices[i]);
+      in.size = GRPC_SLICE_LENGTH(input->slices[i]);
+    }
+    do {
+      blocks.Reserve(1);
+      ZSTD_outBuffer out = {blocks.data(), blocks.available(), 0};
+      r = ZSTD_compressStream2(cctx, &out, &in,
+                               last ? ZSTD_e_end : ZSTD_e_continue);
+      blocks.Produced(out.pos);
+      if (ZSTD_isError(r)) {
+        VLOG(2) << "zstd error: " << ZSTD_getErrorName(r);
+        return 0;
+      }
+      if (blocks.Exceeded()) return 0;
+      // Until the end, r is a hint; at the end, the bytes left to flush.
+    } while (last ? r != 0 : in.pos < in.size);
+  } while (++i < input->count);
+  blocks.Finish();
+  return 1;
+}
+
+static int zstd_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                           size_t max_output,
+                           const grpc_core::ZstdDictionary* dictionary) {
+  ZSTD_DCtx* dctx = thread_zstd_dctx();
+  ZSTD_DCtx_reset(dctx, ZSTD_reset_session_and_parameters);
+  size_t r = 0;  // Do not fail on an empty input.
+  if (dictionary != nullptr) {
+    r = ZSTD_DCtx_refDDict(dctx, dictionary->digests().ddict);
+    if (ZSTD_isError(r)) {
+      VLOG(2) << "zstd error: " << ZSTD_getErrorName(r);
+      return 0;
+    }
+  }
+  OutputBlocks blocks(output, first_block_size(input->length, 4), max_output);
+  for (size_t i = 0; i < input->count; i++) {
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    ZSTD_outBuffer out;
+    // Keep going while the output fills up before the end of the frame:
+    // there may be more to flush.
+    do {
+      blocks.Reserve(1);
+      out = {blocks.data(), blocks.available(), 0};
+      r = ZSTD_decompressStream(dctx, &out, &in);
+      blocks.Produced(out.pos);
+      if (ZSTD_isError(r)) {
+        VLOG(2) << "zstd error: " << ZSTD_getErrorName(r);
+        return 0;
+      }
+      if (blocks.Exceeded()) {
+        VLOG(2) << "zstd: output exceeds " << max_output << " bytes";
+        return GRPC_MSG_DECOMPRESS_TOO_LARGE;
+      }
+    } while (in.pos < in.size || (r != 0 && out.pos == out.size));
+  }
+  // Otherwise, the frame is cut short.
+  if (r != 0) {
+    VLOG(2) << "zstd: Data error";
+    return 0;
+  }
+  blocks.Finish();
+  return 1;
+}
+
+#endif  // GRPC_HAVE_ZSTD
+
+#ifdef GRPC_HAVE_LZ4
+
+// Input is fed to lz4 in chunks of at most one (default sized) lz4 block.
+#define LZ4_INPUT_CHUNK_SIZE (64 * 1024)
+
+// Contexts are cheap to reuse, so each thread keeps one of each.
+struct Lz4ContextDeleter {
+  void operator()(LZ4F_cctx* cctx) const { LZ4F_freeCompressionContext(cctx); }
+  void operator()(LZ4F_dctx* dctx) const {
+    LZ4F_freeDecompressionContext(dctx);
+  }
+};
+
+static LZ4F_cctx* thread_lz4_cctx() {
+  static thread_local std::unique_ptr<LZ4F_cctx, Lz4ContextDeleter> cctx([] {
+    LZ4F_cctx* cctx = nullptr;
+    CHECK(!LZ4F_isError(LZ4F_createCompressionContext(&cctx, LZ4F_VERSION)));
+    return cctx;
+  }());
+  return cctx.get();
+}
+
+static LZ4F_dctx* thread_lz4_dctx() {
+  static thread_local std::unique_ptr<LZ4F_dctx, Lz4ContextDeleter> dctx([] {
+    LZ4F_dctx* dctx = nullptr;
+    CHECK(!LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION)));
+    return dctx;
+  }());
+  return dctx.get();
+}
+
+// The most output LZ4F_compressUpdate can produce from size bytes of input
+// when nothing is left buffered from earlier updates, as with autoFlush, and
+// with room for LZ4F_compressEnd. LZ4F_compressBound assumes a full buffered
+// block, which would size every output block for at least 64KiB.
+static size_t lz4_update_bound(size_t size) {
+  const size_t blocks = size / LZ4_INPUT_CHUNK_SIZE + 1;
+  // Each block takes a 4 byte header, and is stored raw rather than grow.
+  // The frame ends with a 4 byte mark and an optional 4 byte checksum.
+  return size + 4 * blocks + 8;
+}
+
+static int lz4_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                        int level) {
+  LZ4F_preferences_t prefs;
+  memset(&prefs, 0, sizeof(prefs));
+  prefs.frameInfo.contentSize = input->length;
+  prefs.autoFlush = 1;
+  prefs.compressionLevel =
+      level >= 0 && level <= LZ4F_compressionLevel_max() ? level : 0;
+  LZ4F_cctx* cctx = thread_lz4_cctx();
+  // Output that is no smaller than the input is discarded, so there is no
+  // point in producing any more of it.
+  OutputBlocks blocks(output, first_block_size(input->length, 1),
+                      input->length > 0 ? input->length - 1 : 0);
+  blocks.Reserve(LZ4F_HEADER_SIZE_MAX);
+  size_t r =
+      LZ4F_compressBegin(cctx, blocks.data(), blocks.available(), &prefs);
+  if (LZ4F_isError(r)) {
+    VLOG(2) << "lz4 error: " << LZ4F_getErrorName(r);
+    return 0;
+  }
+  blocks.Produced(r);
+  auto update = [&](const uint8_t* next, size_t size) {
+    if (blocks.Exceeded()) return false;
+    blocks.Reserve(lz4_update_bound(size));
+    r = LZ4F_compressUpdate(cctx, blocks.data(), blocks.available(), next,
+                            size, nullptr);
+    if (LZ4F_isError(r)) {
+      VLOG(2) << "lz4 error: " << LZ4F_getErrorName(r);
+      return false;
+    }
+    blocks.Produced(r);
+    return true;
+  };
+  // Every update is flushed as a block of its own, so small slices are
+  // gathered first rather than each costing a block header.
+  std::unique_ptr<uint8_t[]> staging;
+  size_t staged = 0;
+  for (size_t i = 0; i < input->count; i++) {
+    const uint8_t* next = GRPC_SLICE_START_PTR(input->slices[i]);
+    size_t left = GRPC_SLICE_LENGTH(input->slices[i]);
+    while (left > 0) {
+      if (staged == 0 && left >= LZ4_INPUT_CHUNK_SIZE) {
+        if (!update(next, LZ4_INPUT_CHUNK_SIZE)) return 0;
+        next += LZ4_INPUT_CHUNK_SIZE;
+        left -= LZ4_INPUT_CHUNK_SIZE;
+        continue;
+      }
+      if (staging == nullptr) {
+        staging = std::make_unique<uint8_t[]>(LZ4_INPUT_CHUNK_SIZE);
+      }
+      const size_t size = std::min<size_t>(left, LZ4_INPUT_CHUNK_SIZE - staged);
+      memcpy(staging.get() + staged, next, size);
+      staged += size;
+      next += size;
+      left -= size;
+      if (staged == LZ4_INPUT_CHUNK_SIZE) {
+        if (!update(staging.get(), staged)) return 0;
+        staged = 0;
+      }
+    }
+  }
+  if (staged > 0 && !update(staging.get(), staged)) return 0;
+  blocks.Reserve(lz4_update_bound(0));
+  r = LZ4F_compressEnd(cctx, blocks.data(), blocks.available(), nullptr);
+  if (LZ4F_isError(r)) {
+    VLOG(2) << "lz4 error: " << LZ4F_getErrorName(r);
+    return 0;
+  }
+  blocks.Produced(r);
+  if (blocks.Exceeded()) return 0;
+  blocks.Finish();
+  return 1;
+}
+
+static int lz4_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                          size_t max_output) {
+  LZ4F_dctx* dctx = thread_lz4_dctx();
+  LZ4F_resetDecompressionContext(dctx);
+  size_t r = 0;  // Do not fail on an empty input.
+  OutputBlocks blocks(output, first_block_size(input->length, 4), max_output);
+  for (size_t i = 0; i < input->count; i++) {
+    const uint8_t* next = GRPC_SLICE_START_PTR(input->slices[i]);
+    size_t left = GRPC_SLICE_LENGTH(input->slices[i]);
+    bool filled;
+    // Keep going while the output fills up before the end of the frame:
+    // there may be more to flush.
+    do {
+      blocks.Reserve(1);
+      size_t in_size = left;
+      size_t out_size = blocks.available();
+      r = LZ4F_decompress(dctx, blocks.data(), &out_size, next, &in_size,
+                          nullptr);
+      filled = out_size == blocks.available();
+      blocks.Produced(out_size);
+      if (LZ4F_isError(r)) {
+        VLOG(2) << "lz4 error: " << LZ4F_getErrorName(r);
+        return 0;
+      }
+      if (blocks.Exceeded()) {
+        VLOG(2) << "lz4: output exceeds " << max_output << " bytes";
+        return GRPC_MSG_DECOMPRESS_TOO_LARGE;
+      }
+      next += in_size;
+      left -= in_size;
+    } while (left > 0 || (r != 0 && filled));
+  }
+  // Otherwise, the frame is cut short.
+  if (r != 0) {
+    VLOG(2) << "lz4: Data error";
+    return 0;
+  }
+  blocks.Finish();
+  return 1;
+}
+
+#endif  // GRPC_HAVE_LZ4
+
 static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   size_t i;
   for (i = 0; i < input->count; i++) {
@@ -148,17 +625,38 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   return 1;
 }
 
-static int compress_inner(grpc_compression_algorithm algorithm,
-                          grpc_slice_buffer* input, grpc_slice_buffer* output) {
+static int compress_inner(grpc_compression_algorithm algorithm, int level,
+                          grpc_slice_buffer* input, grpc_slice_buffer* output,
+                          const grpc_core::ZstdDictionary* zstd_dictionary) {
+  if ((algorithm == GRPC_COMPRESS_DEFLATE ||
+       algorithm == GRPC_COMPRESS_GZIP) &&
+      (level < Z_BEST_SPEED || level > Z_BEST_COMPRESSION)) {
+    level = Z_DEFAULT_COMPRESSION;
+  }
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
       // the fallback path always needs to be send uncompressed: we simply
       // rely on that here
       return 0;
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_compress(input, output, 0);
+      return zlib_compress(input, output, 0, level);
     case GRPC_COMPRESS_GZIP:
-      return zlib_compress(input, output, 1);
+      return zlib_compress(input, output, 1, level);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_compress(input, output, level, zstd_dictionary);
+#else
+      (void)zstd_dictionary;
+      LOG(ERROR) << "zstd compression is not built in";
+      return 0;
+#endif
+    case GRPC_COMPRESS_LZ4:
+#ifdef GRPC_HAVE_LZ4
+      return lz4_compress(input, output, level);
+#else
+      LOG(ERROR) << "lz4 compression is not built in";
+      return 0;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -168,7 +666,15 @@ static int compress_inner(grpc_compression_algorithm algorithm,
 
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+  return grpc_msg_compress_with_level(
+      algorithm, GRPC_MSG_COMPRESS_DEFAULT_LEVEL, input, output);
+}
+
+int grpc_msg_compress_with_level(
+    grpc_compression_algorithm algorithm, int level, grpc_slice_buffer* input,
+    grpc_slice_buffer* output,
+    const grpc_core::ZstdDictionary* zstd_dictionary) {
+  if (!compress_inner(algorithm, level, input, output, zstd_dictionary)) {
     copy(input, output);
     return 0;
   }
@@ -177,13 +683,39 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
 
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  return grpc_msg_decompress_with_limit(algorithm, SIZE_MAX, input,
+                                        output) == 1;
+}
+
+int grpc_msg_decompress_with_limit(
+    grpc_compression_algorithm algorithm, size_t max_output_size,
+    grpc_slice_buffer* input, grpc_slice_buffer* output,
+    const grpc_core::ZstdDictionary* zstd_dictionary) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
+      if (input->length > max_output_size) {
+        return GRPC_MSG_DECOMPRESS_TOO_LARGE;
+      }
       return copy(input, output);
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_decompress(input, output, 0);
+      return zlib_decompress(input, output, 0, max_output_size);
     case GRPC_COMPRESS_GZIP:
-      return zlib_decompress(input, output, 1);
+      return zlib_decompress(input, output, 1, max_output_size);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_decompress(input, output, max_output_size, zstd_dictionary);
+#else
+      (void)zstd_dictionary;
+      LOG(ERROR) << "zstd compression is not built in";
+      return 0;
+#endif
+    case GRPC_COMPRESS_LZ4:
+#ifdef GRPC_HAVE_LZ4
+      return lz4_decompress(input, output, max_output_size);
+#else
+      LOG(ERROR) << "lz4 compression is not built in";
+      return 0;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
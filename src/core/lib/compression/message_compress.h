@@ -23,16 +23,78 @@
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 
+#include <memory>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+
+// A dictionary for GRPC_COMPRESS_ZSTD, digested once and then shared by all
+// the messages on a channel. A message compressed with a dictionary can only
+// be decompressed with the same one, so peers agree on it out of band.
+class ZstdDictionary final : public RefCounted<ZstdDictionary> {
+ public:
+  // Digests 'content': a dictionary as written by `zstd --train`, or raw
+  // sample content. Fails if gRPC was built without zstd.
+  static absl::StatusOr<RefCountedPtr<ZstdDictionary>> Create(
+      absl::string_view content);
+
+  ~ZstdDictionary() override;
+
+  // The digested forms, as used by message_compress.cc.
+  struct Digests;
+  Digests& digests() const { return *digests_; }
+
+ private:
+  explicit ZstdDictionary(std::unique_ptr<Digests> digests);
+
+  const std::unique_ptr<Digests> digests_;
+};
+
+}  // namespace grpc_core
+
 // compress 'input' to 'output' using 'algorithm'.
 // On success, appends compressed slices to output and returns 1.
 // On failure, appends uncompressed slices to output and returns 0.
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// The level each algorithm compresses at unless told otherwise.
+#define GRPC_MSG_COMPRESS_DEFAULT_LEVEL (-1)
+
+// As grpc_msg_compress, at the given level, which each algorithm reads as:
+// - deflate and gzip: the zlib level, from 1 (fastest) to 9 (smallest output).
+// - zstd: the zstd level, from 1 (fastest) to 22 (smallest output).
+// - lz4: 3 to 12 select LZ4 HC, which is slower but compresses better.
+// Other values select the algorithm's default. zstd compresses with
+// 'zstd_dictionary', if given.
+int grpc_msg_compress_with_level(
+    grpc_compression_algorithm algorithm, int level, grpc_slice_buffer* input,
+    grpc_slice_buffer* output,
+    const grpc_core::ZstdDictionary* zstd_dictionary = nullptr);
+
 // decompress 'input' to 'output' using 'algorithm'.
 // On success, appends slices to output and returns 1.
 // On failure, output is unchanged, and returns 0.
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// Returned by grpc_msg_decompress_with_limit when the output would be too
+// large.
+#define GRPC_MSG_DECOMPRESS_TOO_LARGE (-1)
+
+// As grpc_msg_decompress, but gives up with GRPC_MSG_DECOMPRESS_TOO_LARGE as
+// soon as the output would exceed max_output_size bytes. Inflation stops at
+// that point, and no more than max_output_size + 1 bytes of output are ever
+// allocated, so that oversized messages and decompression bombs cost no more
+// than the limit. zstd messages that were compressed with a dictionary need
+// 'zstd_dictionary' to be the same one.
+int grpc_msg_decompress_with_limit(
+    grpc_compression_algorithm algorithm, size_t max_output_size,
+    grpc_slice_buffer* input, grpc_slice_buffer* output,
+    const grpc_core::ZstdDictionary* zstd_dictionary = nullptr);
+
 #endif  // GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
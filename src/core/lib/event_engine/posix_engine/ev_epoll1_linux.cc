@@ -19,6 +19,7 @@
 #include <grpc/support/sync.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 
@@ -51,7 +52,12 @@
 #include "src/core/util/strerror.h"
 #include "src/core/util/sync.h"
 
-#define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
+// Bounds on the number of epoll events a single Work() call handles. The
+// actual batch size adapts between them to the observed backlog: handling
+// more events per call saves a thread pool round-trip per ready fd, while the
+// upper bound keeps one call from monopolizing the polling thread.
+#define MIN_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
+#define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 32
 
 namespace grpc_event_engine::experimental {
 
@@ -352,6 +358,20 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
   return was_kicked;
 }
 
+// Grows the batch size while events are left over after a Work() call, and
+// shrinks it once epoll_wait() returns fewer events than a batch would
+// handle, so a lightly loaded poller goes back to dispatching one event at a
+// time.
+void Epoll1Poller::AdaptEventsPerIteration() {
+  if (g_epoll_set_.cursor != g_epoll_set_.num_events) {
+    events_per_iteration_ = std::min(events_per_iteration_ * 2,
+                                     MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION);
+  } else if (g_epoll_set_.num_events < events_per_iteration_) {
+    events_per_iteration_ = std::max(g_epoll_set_.num_events,
+                                     MIN_EPOLL_EVENTS_HANDLED_PER_ITERATION);
+  }
+}
+
 //  Do epoll_wait and store the events in g_epoll_set.events field. This does
 //  not "process" any of the events yet; that is done in ProcessEpollEvents().
 //  See ProcessEpollEvents() function for more details. It returns the number
@@ -428,12 +448,12 @@ Poller::WorkResult Epoll1Poller::Work(
   {
     grpc_core::MutexLock lock(&mu_);
     // If was_kicked_ is true, collect all pending events in this iteration.
-    if (ProcessEpollEvents(
-            was_kicked_ ? INT_MAX : MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION,
-            pending_events)) {
+    if (ProcessEpollEvents(was_kicked_ ? INT_MAX : events_per_iteration_,
+                           pending_events)) {
       was_kicked_ = false;
       was_kicked_ext = true;
     }
+    AdaptEventsPerIteration();
     if (pending_events.empty()) {
       return Poller::WorkResult::kKicked;
     }
@@ -528,6 +548,10 @@ bool Epoll1Poller::ProcessEpollEvents(int /*max_epoll_events_to_handle*/,
   grpc_core::Crash("unimplemented");
 }
 
+void Epoll1Poller::AdaptEventsPerIteration() {
+  grpc_core::Crash("unimplemented");
+}
+
 int Epoll1Poller::DoEpollWait(EventEngine::Duration /*timeout*/) {
   grpc_core::Crash("unimplemented");
 }
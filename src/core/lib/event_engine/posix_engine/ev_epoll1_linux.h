@@ -83,6 +83,8 @@ class Epoll1Poller : public PosixEventPoller {
   // on file descriptors that became readable/writable.
   bool ProcessEpollEvents(int max_epoll_events_to_handle,
                           Events& pending_events);
+  // Adjusts events_per_iteration_ to the backlog left in g_epoll_set.
+  void AdaptEventsPerIteration() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   //  Do epoll_wait and store the events in g_epoll_set.events field. This does
   //  not "process" any of the events yet; that is done in ProcessEpollEvents().
@@ -113,6 +115,8 @@ class Epoll1Poller : public PosixEventPoller {
   // A singleton epoll set
   EpollSet g_epoll_set_;
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  // The number of epoll events handled per Work() call when not kicked.
+  int events_per_iteration_ ABSL_GUARDED_BY(mu_) = 1;
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
 #if GRPC_ENABLE_FORK_SUPPORT
   absl::flat_hash_set<EventHandle*> fork_handles_set_ ABSL_GUARDED_BY(mu_);
@@ -0,0 +1,1003 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+// The poller relies on multishot poll requests (Linux 5.13) and on timed
+// waits through IORING_ENTER_EXT_ARG (Linux 5.11). Headers older than that
+// compile the stub below; kernels older than that are detected at runtime.
+#if defined(GRPC_LINUX_IO_URING) && defined(__NR_io_uring_setup) && \
+    defined(__NR_io_uring_enter) && defined(IORING_POLL_ADD_MULTI) &&  \
+    defined(IORING_FEAT_EXT_ARG)
+#define GRPC_HAVE_IO_URING_POLLER 1
+#endif
+
+#ifdef GRPC_HAVE_IO_URING_POLLER
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Sizes of the submission and completion rings. The completion ring is sized
+// well above the submission ring because a single multishot poll can post
+// many completions. Overflow is still tolerated: the kernel buffers excess
+// completions (IORING_FEAT_NODROP) and polls terminated by it are re-armed.
+constexpr uint32_t kSubmissionRingEntries = 256;
+constexpr uint32_t kCompletionRingEntries = 4096;
+
+// A handle's requests carry a tag in user_data which packs the handle's
+// index in IoUringPoller::handles_, a generation, the kind of request and
+// track_err:
+//   bits 63..32: generation, never zero
+//   bits 31..3:  index
+//   bits 2..1:   request kind: the poll, a receive or a send
+//   bit 0:       track_err
+// The generation changes whenever the handle is orphaned and reused, so the
+// completions of an earlier registration, which the kernel may post after
+// the request was removed, no longer match and are dropped. As the
+// generation is never zero, tags never collide with these reserved values.
+constexpr uint64_t kIgnoredUserData = 0;
+constexpr uint64_t kWakeupUserData = 2;
+constexpr uint32_t kMaxHandles = uint32_t{1} << 29;
+
+constexpr uint64_t kPollRequest = 0;
+constexpr uint64_t kRecvRequest = 1 << 1;
+constexpr uint64_t kSendRequest = 2 << 1;
+constexpr uint64_t kRequestKindMask = 3 << 1;
+
+uint64_t MakeHandleUserData(uint32_t index, uint32_t generation,
+                            bool track_err) {
+  return (uint64_t{generation} << 32) | (uint64_t{index} << 3) |
+         (track_err ? 1 : 0);
+}
+
+uint32_t HandleIndex(uint64_t user_data) {
+  return static_cast<uint32_t>(user_data) >> 3;
+}
+
+constexpr uint32_t kHandlePollEvents = POLLIN | POLLPRI | POLLOUT;
+
+int IoUringSetup(uint32_t entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, uint32_t to_submit, uint32_t min_complete,
+                 uint32_t flags, const void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+}  // namespace
+
+// Owns an io_uring instance and the ring memory it shares with the kernel.
+// Producers must be serialized externally (IoUringPoller::sq_mu_); only one
+// thread may consume completions at a time.
+class IoUringRing {
+ public:
+  // Returns nullptr if io_uring is unavailable (old kernel, seccomp policy)
+  // or lacks one of the features the poller depends on.
+  static std::unique_ptr<IoUringRing> Create() {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = kCompletionRingEntries;
+    int fd = IoUringSetup(kSubmissionRingEntries, &params);
+    if (fd < 0) {
+      GRPC_TRACE_LOG(event_engine_poller, INFO)
+          << "io_uring_setup unavailable: " << grpc_core::StrError(errno);
+      return nullptr;
+    }
+    std::unique_ptr<IoUringRing> ring(new IoUringRing(fd));
+    if ((params.features & IORING_FEAT_EXT_ARG) == 0 ||
+        (params.features & IORING_FEAT_NODROP) == 0) {
+      GRPC_TRACE_LOG(event_engine_poller, INFO)
+          << "io_uring lacks required features: " << params.features;
+      return nullptr;
+    }
+    if (!ring->Map(params)) return nullptr;
+    return ring;
+  }
+
+  ~IoUringRing() {
+    if (sqes_ != nullptr) munmap(sqes_, sqes_size_);
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) munmap(sq_ring_, sq_ring_size_);
+    close(fd_);
+  }
+
+  int fd() const { return fd_; }
+
+  // Returns a zeroed submission queue entry, or nullptr if the submission
+  // ring is full. The entry becomes visible to the kernel on Commit().
+  struct io_uring_sqe* NextSqe() {
+    uint32_t head = __atomic_load_n(sq_khead_, __ATOMIC_ACQUIRE);
+    if (sq_tail_ - head >= sq_entries_) return nullptr;
+    uint32_t index = sq_tail_ & sq_mask_;
+    struct io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sq_array_[index] = index;
+    ++sq_tail_;
+    return sqe;
+  }
+
+  void Commit() { __atomic_store_n(sq_ktail_, sq_tail_, __ATOMIC_RELEASE); }
+
+  // Submits every committed entry. If wait_for_completion is set, also blocks
+  // until a completion is available or the timeout expires. Returns 0 or an
+  // errno value; ETIME signals an expired timeout.
+  int Enter(bool wait_for_completion, const struct __kernel_timespec* timeout) {
+    // The kernel clamps the submission count to the committed entries, so
+    // this never needs to read sq_tail_ (which is owned by the producers).
+    uint32_t flags = 0;
+    struct io_uring_getevents_arg arg;
+    const void* arg_ptr = nullptr;
+    size_t arg_size = 0;
+    if (wait_for_completion) {
+      flags |= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+      memset(&arg, 0, sizeof(arg));
+      arg.sigmask_sz = _NSIG / 8;
+      arg.ts = reinterpret_cast<uint64_t>(timeout);
+      arg_ptr = &arg;
+      arg_size = sizeof(arg);
+    }
+    if (IoUringEnter(fd_, sq_entries_, wait_for_completion ? 1 : 0, flags,
+                     arg_ptr, arg_size) < 0) {
+      return errno;
+    }
+    return 0;
+  }
+
+  // Returns true if committed entries have not been handed to the kernel yet.
+  bool HasUnsubmitted() const {
+    return __atomic_load_n(sq_ktail_, __ATOMIC_ACQUIRE) !=
+           __atomic_load_n(sq_khead_, __ATOMIC_ACQUIRE);
+  }
+
+  bool HasCompletions() const {
+    return *cq_khead_ != __atomic_load_n(cq_ktail_, __ATOMIC_ACQUIRE);
+  }
+
+  // Invokes f on every available completion and then releases them back to
+  // the kernel.
+  template <typename F>
+  void ReapCompletions(F f) {
+    uint32_t head = *cq_khead_;
+    uint32_t tail = __atomic_load_n(cq_ktail_, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head) {
+      f(cqes_[head & cq_mask_]);
+    }
+    __atomic_store_n(cq_khead_, head, __ATOMIC_RELEASE);
+  }
+
+ private:
+  explicit IoUringRing(int fd) : fd_(fd) {}
+
+  bool Map(const struct io_uring_params& params) {
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    sq_ring_ = MapRegion(sq_ring_size_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == nullptr) return false;
+    cq_ring_ =
+        single_mmap ? sq_ring_ : MapRegion(cq_ring_size_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == nullptr) return false;
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    sqes_ = static_cast<struct io_uring_sqe*>(
+        MapRegion(sqes_size_, IORING_OFF_SQES));
+    if (sqes_ == nullptr) return false;
+    char* sq = static_cast<char*>(sq_ring_);
+    sq_khead_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+    sq_ktail_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    sq_entries_ =
+        *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_entries);
+    sq_array_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    sq_tail_ = *sq_ktail_;
+    char* cq = static_cast<char*>(cq_ring_);
+    cq_khead_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    cq_ktail_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+    return true;
+  }
+
+  void* MapRegion(size_t size, off_t offset) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd_, offset);
+    if (ptr == MAP_FAILED) {
+      LOG(ERROR) << "io_uring mmap failed: " << grpc_core::StrError(errno);
+      return nullptr;
+    }
+    return ptr;
+  }
+
+  const int fd_;
+  void* sq_ring_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  void* cq_ring_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  struct io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+  uint32_t* sq_khead_ = nullptr;
+  uint32_t* sq_ktail_ = nullptr;
+  uint32_t sq_mask_ = 0;
+  uint32_t sq_entries_ = 0;
+  uint32_t* sq_array_ = nullptr;
+  uint32_t sq_tail_ = 0;
+  uint32_t* cq_khead_ = nullptr;
+  uint32_t* cq_ktail_ = nullptr;
+  uint32_t cq_mask_ = 0;
+  struct io_uring_cqe* cqes_ = nullptr;
+};
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(const FileDescriptor& fd, bool track_err, uint32_t index,
+                     IoUringPoller* poller)
+      : fd_(fd),
+        index_(index),
+        poller_(poller),
+        read_closure_(poller->GetScheduler()),
+        write_closure_(poller->GetScheduler()),
+        error_closure_(poller->GetScheduler()) {
+    ReInit(fd, track_err);
+  }
+  void ReInit(FileDescriptor fd, bool track_err) {
+    fd_ = fd;
+    if (++generation_ == 0) generation_ = 1;
+    user_data_.store(MakeHandleUserData(index_, generation_, track_err),
+                     std::memory_order_release);
+    read_closure_.InitEvent();
+    write_closure_.InitEvent();
+    error_closure_.InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+    grpc_core::MutexLock lock(&mu_);
+    registered_ = true;
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  // The tag of the handle's current poll request, or kIgnoredUserData once
+  // the handle is orphaned.
+  uint64_t user_data() const {
+    return user_data_.load(std::memory_order_acquire);
+  }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why these are atomics.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  // Re-arm the multishot poll tagged user_data after the kernel terminated
+  // it (for instance because the completion ring overflowed). No-op once the
+  // handle has been orphaned or reused, so that a recycled descriptor number
+  // is never polled on behalf of this handle.
+  void Rearm(uint64_t user_data);
+  FileDescriptor WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, FileDescriptor* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  bool SupportsAsyncIo() override { return true; }
+  void RecvMsg(struct msghdr* msg, int flags,
+               absl::AnyInvocable<void(int64_t)> on_done) override;
+  void SendMsg(const struct msghdr* msg, int flags,
+               absl::AnyInvocable<void(int64_t)> on_done) override;
+  // Hands the result of the receive or send tagged user_data to its caller.
+  void CompleteIo(uint64_t user_data, int64_t result);
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+  // Fails the I/O in flight without touching the ring, which the fork child
+  // still shares with its parent.
+  void AbandonIoInChild();
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  inline void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_.SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_.SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_.SetReady();
+    }
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  void HandleShutdownInternal(absl::Status why);
+  void SubmitIo(uint64_t kind, uint8_t opcode, const struct msghdr* msg,
+                int flags, absl::AnyInvocable<void(int64_t)> on_done);
+  // Cancels the receive and send in flight, if any.
+  void CancelIoLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Guards lockfree event teardown (see Epoll1EventHandle::ShutdownHandle),
+  // registered_ and the completion callbacks of the I/O in flight.
+  grpc_core::Mutex mu_;
+  FileDescriptor fd_;
+  const uint32_t index_;
+  uint32_t generation_ = 0;
+  std::atomic<uint64_t> user_data_{kIgnoredUserData};
+  bool registered_ ABSL_GUARDED_BY(mu_) = false;
+  absl::AnyInvocable<void(int64_t)> on_recv_done_ ABSL_GUARDED_BY(mu_);
+  absl::AnyInvocable<void(int64_t)> on_send_done_ ABSL_GUARDED_BY(mu_);
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  LockfreeEvent read_closure_;
+  LockfreeEvent write_closure_;
+  LockfreeEvent error_closure_;
+};
+
+namespace {
+
+// It is possible that the headers know about io_uring but the running kernel
+// doesn't, or that a sandbox forbids it. Create a ring and arm a multishot
+// poll on a wakeup fd to make sure every feature the poller uses works.
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::experimental::SupportsWakeupFd()) {
+    return false;
+  }
+  auto ring = IoUringRing::Create();
+  if (ring == nullptr) {
+    return false;
+  }
+  EventEnginePosixInterface posix_interface;
+  auto wakeup_fd = CreateWakeupFd(&posix_interface);
+  if (!wakeup_fd.ok()) {
+    return false;
+  }
+  auto fd = posix_interface.GetFd((*wakeup_fd)->ReadFd());
+  if (!fd.ok()) {
+    return false;
+  }
+  struct io_uring_sqe* sqe = ring->NextSqe();
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = *fd;
+  sqe->poll32_events = POLLIN;
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->user_data = kWakeupUserData;
+  ring->Commit();
+  if (!(*wakeup_fd)->Wakeup().ok()) {
+    return false;
+  }
+  struct __kernel_timespec timeout = {1, 0};
+  if (ring->Enter(/*wait_for_completion=*/true, &timeout) != 0) {
+    return false;
+  }
+  bool supported = false;
+  ring->ReapCompletions([&supported](const struct io_uring_cqe& cqe) {
+    // Kernels predating multishot polls reject the request with -EINVAL.
+    supported = cqe.res > 0 && (cqe.flags & IORING_CQE_F_MORE) != 0;
+  });
+  return supported;
+}
+
+}  // namespace
+
+void IoUringEventHandle::Rearm(uint64_t user_data) {
+  grpc_core::MutexLock lock(&mu_);
+  if (!registered_ || user_data != user_data_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  auto fd = poller_->posix_interface().GetFd(fd_);
+  if (!fd.ok()) {
+    LOG(ERROR) << "Rearm: failed to poll " << fd_ << ": " << fd.StrError();
+    return;
+  }
+  grpc_core::MutexLock sq_lock(&poller_->sq_mu_);
+  poller_->ArmPollLocked(user_data, *fd, kHandlePollEvents);
+}
+
+void IoUringEventHandle::RecvMsg(struct msghdr* msg, int flags,
+                                 absl::AnyInvocable<void(int64_t)> on_done) {
+  SubmitIo(kRecvRequest, IORING_OP_RECVMSG, msg, flags, std::move(on_done));
+}
+
+void IoUringEventHandle::SendMsg(const struct msghdr* msg, int flags,
+                                 absl::AnyInvocable<void(int64_t)> on_done) {
+  SubmitIo(kSendRequest, IORING_OP_SENDMSG, msg, flags, std::move(on_done));
+}
+
+void IoUringEventHandle::SubmitIo(uint64_t kind, uint8_t opcode,
+                                  const struct msghdr* msg, int flags,
+                                  absl::AnyInvocable<void(int64_t)> on_done) {
+  int64_t error = 0;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    auto& pending = kind == kRecvRequest ? on_recv_done_ : on_send_done_;
+    CHECK(pending == nullptr);
+    auto fd = poller_->posix_interface().GetFd(fd_);
+    if (read_closure_.IsShutdown()) {
+      error = -ECANCELED;
+    } else if (!fd.ok()) {
+      error = -fd.errno_value().value_or(EBADF);
+    } else {
+      pending = std::move(on_done);
+      grpc_core::MutexLock sq_lock(&poller_->sq_mu_);
+      poller_->SubmitMsgLocked(user_data_.load(std::memory_order_relaxed) |
+                                   kind,
+                               opcode, *fd, msg, flags);
+      return;
+    }
+  }
+  poller_->GetScheduler()->Run(
+      [on_done = std::move(on_done), error]() mutable { on_done(error); });
+}
+
+void IoUringEventHandle::CompleteIo(uint64_t user_data, int64_t result) {
+  absl::AnyInvocable<void(int64_t)> on_done;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    on_done = std::exchange((user_data & kRequestKindMask) == kRecvRequest
+                                ? on_recv_done_
+                                : on_send_done_,
+                            nullptr);
+  }
+  if (on_done == nullptr) return;
+  poller_->GetScheduler()->Run(
+      [on_done = std::move(on_done), result]() mutable { on_done(result); });
+}
+
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+void IoUringEventHandle::AbandonIoInChild() {
+  const uint64_t user_data = user_data_.load(std::memory_order_relaxed);
+  CompleteIo(user_data | kRecvRequest, -ECANCELED);
+  CompleteIo(user_data | kSendRequest, -ECANCELED);
+}
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringEventHandle::CancelIoLocked() {
+  const uint64_t user_data = user_data_.load(std::memory_order_relaxed);
+  if (on_recv_done_ == nullptr && on_send_done_ == nullptr) return;
+  grpc_core::MutexLock sq_lock(&poller_->sq_mu_);
+  if (on_recv_done_ != nullptr) {
+    poller_->CancelRequestLocked(user_data | kRecvRequest);
+  }
+  if (on_send_done_ != nullptr) {
+    poller_->CancelRequestLocked(user_data | kSendRequest);
+  }
+  poller_->FlushSubmissionsLocked();
+}
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      FileDescriptor* release_fd,
+                                      absl::string_view reason) {
+  if (!read_closure_.IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+  {
+    // The kernel holds a reference to the file for as long as the poll
+    // request is armed, so it has to be cancelled before the fd is closed or
+    // handed back to the caller.
+    grpc_core::MutexLock lock(&mu_);
+    CHECK(on_recv_done_ == nullptr && on_send_done_ == nullptr)
+        << "handle orphaned with socket I/O in flight";
+    registered_ = false;
+    grpc_core::MutexLock sq_lock(&poller_->sq_mu_);
+    poller_->RemovePollLocked(user_data_.load(std::memory_order_relaxed));
+    poller_->FlushSubmissionsLocked();
+    user_data_.store(kIgnoredUserData, std::memory_order_release);
+  }
+  auto& posix_interface = poller_->posix_interface();
+  if (release_fd != nullptr) {
+    *release_fd = fd_;
+  } else {
+    posix_interface.Shutdown(fd_, SHUT_RDWR);
+    posix_interface.Close(fd_);
+  }
+
+  {
+    // See Epoll1Poller::ShutdownHandle for explanation on why a mutex is
+    // required here.
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_.DestroyEvent();
+    write_closure_.DestroyEvent();
+    error_closure_.DestroyEvent();
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  {
+    grpc_core::MutexLock lock(&poller_->mu_);
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+    poller_->fork_handles_set_.erase(this);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+    poller_->free_io_uring_handles_list_.push_back(this);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(
+      &why, grpc_core::StatusIntProperty::kRpcStatus,
+      absl::IsCancelled(why) ? GRPC_STATUS_CANCELLED : GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_.SetShutdown(why)) {
+    write_closure_.SetShutdown(why);
+    error_closure_.SetShutdown(why);
+  }
+}
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+  ring_ = IoUringRing::Create();
+  CHECK(ring_ != nullptr);
+  wakeup_fd_ = CreateWakeupFd(&posix_interface()).value();
+  CHECK(wakeup_fd_ != nullptr);
+  GRPC_TRACE_LOG(event_engine_poller, INFO)
+      << "grpc io_uring fd: " << ring_->fd();
+  ArmWakeupFd();
+}
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+
+  {
+    grpc_core::MutexLock sq_lock(&sq_mu_);
+    ring_.reset();
+  }
+
+  while (!free_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    delete handle;
+  }
+  handles_.clear();
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+EventHandle* IoUringPoller::CreateHandle(FileDescriptor fd,
+                                         absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_io_uring_handles_list_.empty()) {
+      CHECK_LT(handles_.size(), kMaxHandles);
+      new_handle = new IoUringEventHandle(
+          fd, track_err, static_cast<uint32_t>(handles_.size()), this);
+      handles_.push_back(new_handle);
+    } else {
+      new_handle = reinterpret_cast<IoUringEventHandle*>(
+          free_io_uring_handles_list_.front());
+      free_io_uring_handles_list_.pop_front();
+      new_handle->ReInit(fd, track_err);
+    }
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+    fork_handles_set_.emplace(new_handle);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  }
+  auto raw_fd = posix_interface().GetFd(fd);
+  if (!raw_fd.ok()) {
+    LOG(ERROR) << "io_uring poll add failed: " << raw_fd.StrError();
+    return new_handle;
+  }
+  // The thread running Work() may be blocked in io_uring_enter(), so the new
+  // registration is submitted right away instead of waiting for the next
+  // iteration.
+  grpc_core::MutexLock lock(&sq_mu_);
+  ArmPollLocked(new_handle->user_data(), *raw_fd, kHandlePollEvents);
+  FlushSubmissionsLocked();
+  return new_handle;
+}
+
+void IoUringPoller::ArmPollLocked(uintptr_t user_data, int fd,
+                                  uint32_t events) {
+  struct io_uring_sqe* sqe = ring_->NextSqe();
+  while (sqe == nullptr) {
+    FlushSubmissionsLocked();
+    sqe = ring_->NextSqe();
+  }
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  // The kernel reads the 32 bit mask as two swapped 16 bit halves.
+  events = (events << 16) | (events >> 16);
+#endif
+  sqe->poll32_events = events;
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->user_data = user_data;
+  ring_->Commit();
+}
+
+void IoUringPoller::RemovePollLocked(uintptr_t user_data) {
+  struct io_uring_sqe* sqe = ring_->NextSqe();
+  while (sqe == nullptr) {
+    FlushSubmissionsLocked();
+    sqe = ring_->NextSqe();
+  }
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = user_data;
+  sqe->user_data = kIgnoredUserData;
+  ring_->Commit();
+}
+
+void IoUringPoller::SubmitMsgLocked(uint64_t user_data, uint8_t opcode,
+                                    int fd, const struct msghdr* msg,
+                                    int flags) {
+  struct io_uring_sqe* sqe = ring_->NextSqe();
+  while (sqe == nullptr) {
+    FlushSubmissionsLocked();
+    sqe = ring_->NextSqe();
+  }
+  sqe->opcode = opcode;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(msg);
+  sqe->len = 1;
+  sqe->msg_flags = static_cast<uint32_t>(flags);
+  sqe->user_data = user_data;
+  ring_->Commit();
+  // A thread blocked in io_uring_enter() has already taken its submissions,
+  // so only hand this one to the kernel now if somebody waits. Otherwise it
+  // goes out with the next Work() call, together with whatever else was
+  // queued meanwhile. The fence orders the commit before the load, pairing
+  // with the increment in SubmitAndWait().
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiters_.load(std::memory_order_seq_cst) > 0) {
+    FlushSubmissionsLocked();
+  }
+}
+
+void IoUringPoller::CancelRequestLocked(uint64_t user_data) {
+  struct io_uring_sqe* sqe = ring_->NextSqe();
+  while (sqe == nullptr) {
+    FlushSubmissionsLocked();
+    sqe = ring_->NextSqe();
+  }
+  sqe->opcode = IORING_OP_ASYNC_CANCEL;
+  sqe->fd = -1;
+  sqe->addr = user_data;
+  sqe->user_data = kIgnoredUserData;
+  ring_->Commit();
+}
+
+void IoUringPoller::FlushSubmissionsLocked() {
+  int err;
+  do {
+    err = ring_->Enter(/*wait_for_completion=*/false, nullptr);
+  } while (err == EINTR);
+  if (err != 0 && err != EAGAIN && err != EBUSY) {
+    LOG(ERROR) << "io_uring_enter failed to submit: "
+               << grpc_core::StrError(err);
+  }
+}
+
+void IoUringPoller::ArmWakeupFd() {
+  auto fd = posix_interface().GetFd(wakeup_fd_->ReadFd());
+  CHECK(fd.ok()) << fd.StrError();
+  grpc_core::MutexLock lock(&sq_mu_);
+  ArmPollLocked(kWakeupUserData, *fd, POLLIN);
+  FlushSubmissionsLocked();
+}
+
+// Submit every queued registration, re-arm and removal, and wait for
+// completions in the same io_uring_enter() call. Returns false if the timeout
+// expired before any completion was posted.
+bool IoUringPoller::SubmitAndWait(EventEngine::Duration timeout) {
+  if (timeout < EventEngine::Duration::zero()) {
+    timeout = EventEngine::Duration::zero();
+  }
+  auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+  struct __kernel_timespec ts;
+  ts.tv_sec = seconds.count();
+  ts.tv_nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   timeout - seconds)
+                   .count();
+  int err;
+  waiters_.fetch_add(1, std::memory_order_seq_cst);
+  do {
+    err = ring_->Enter(/*wait_for_completion=*/true, &ts);
+  } while (err == EINTR);
+  waiters_.fetch_sub(1, std::memory_order_relaxed);
+  if (err == ETIME) {
+    return ring_->HasCompletions();
+  }
+  // EBUSY means the completion ring overflowed: reap what is there, the
+  // kernel flushes the rest on the next wait.
+  if (err != 0 && err != EBUSY && err != EAGAIN) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(err).c_str()));
+  }
+  return true;
+}
+
+// Reap every completion posted since the last call. It returns true if there
+// was a Kick that forced invocation of this function. It also returns the
+// list of handles that became readable/writable.
+bool IoUringPoller::ProcessCompletions(Events& pending_events) {
+  bool was_kicked = false;
+  ring_->ReapCompletions([&](const struct io_uring_cqe& cqe) {
+    const bool more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+    if (cqe.user_data == kIgnoredUserData) return;
+    if (cqe.user_data == kWakeupUserData) {
+      if (cqe.res > 0) {
+        CHECK(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+      }
+      if (!more && cqe.res != -ECANCELED) ArmWakeupFd();
+      return;
+    }
+    const uint32_t index = HandleIndex(cqe.user_data);
+    if (index >= handles_.size()) return;
+    IoUringEventHandle* handle = handles_[index];
+    // Drop completions of a registration the handle no longer has: it was
+    // orphaned, and possibly reused for another descriptor, since.
+    if ((cqe.user_data & ~kRequestKindMask) != handle->user_data()) return;
+    if ((cqe.user_data & kRequestKindMask) != kPollRequest) {
+      handle->CompleteIo(cqe.user_data, cqe.res);
+      return;
+    }
+    // A removed poll reports -ECANCELED; nothing is waiting on it anymore.
+    if (cqe.res == -ECANCELED) return;
+    bool track_err = (cqe.user_data & uint64_t{1}) != 0;
+    uint32_t events = static_cast<uint32_t>(cqe.res);
+    if (cqe.res < 0) {
+      LOG(ERROR) << "io_uring poll failed: " << grpc_core::StrError(-cqe.res);
+      // Let the owner discover the failure through its next syscall.
+      events = POLLHUP;
+    }
+    bool cancel = (events & POLLHUP) != 0;
+    bool error = (events & POLLERR) != 0;
+    bool read_ev = (events & (POLLIN | POLLPRI)) != 0;
+    bool write_ev = (events & POLLOUT) != 0;
+    bool err_fallback = error && !track_err;
+    if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                  write_ev || cancel || err_fallback,
+                                  error && !err_fallback)) {
+      pending_events.push_back(handle);
+    }
+    if (!more && cqe.res >= 0) handle->Rearm(cqe.user_data);
+  });
+  return was_kicked;
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  // See Epoll1EventHandle::ShutdownHandle for explanation on why a mutex is
+  // required here.
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+  CancelIoLocked();
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_.IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_.NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_.NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_.NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_.SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_.SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_.SetReady(); }
+
+// Submits pending requests and waits for completions until timeout is reached
+// or there is a Kick(). Unlike epoll1, every completion reaped by this call is
+// processed in the same iteration: reaping is a memory read, so there is no
+// syscall to amortize by leaving events for the next Work() call.
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  if (!ring_->HasCompletions()) {
+    if (!SubmitAndWait(timeout)) {
+      return Poller::WorkResult::kDeadlineExceeded;
+    }
+  } else if (ring_->HasUnsubmitted()) {
+    grpc_core::MutexLock lock(&sq_mu_);
+    FlushSubmissionsLocked();
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (ProcessCompletions(pending_events)) {
+      was_kicked_ = false;
+      was_kicked_ext = true;
+    }
+    if (pending_events.empty()) {
+      // Completions which need no action (e.g. cancelled polls) are treated
+      // like an expired wait so that the engine simply polls again.
+      return was_kicked_ext ? Poller::WorkResult::kKicked
+                            : Poller::WorkResult::kDeadlineExceeded;
+    }
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::HandleForkInChild() {
+  if (grpc_core::IsEventEngineForkEnabled()) {
+    posix_interface().AdvanceGeneration();
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    for (EventHandle* handle : fork_handles_set_) {
+      static_cast<IoUringEventHandle*>(handle)->AbandonIoInChild();
+      handle->ShutdownHandle(absl::CancelledError("Closed on fork"));
+    }
+  }
+  // The ring is shared with the parent after fork; the child needs its own.
+  grpc_core::MutexLock lock(&sq_mu_);
+  ring_ = IoUringRing::Create();
+  CHECK(ring_ != nullptr);
+  GRPC_TRACE_LOG(event_engine_poller, INFO)
+      << "Post-fork grpc io_uring fd: " << ring_->fd();
+}
+
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::ResetKickState() {
+  // Wakeup fd is always recreated to ensure FD state is reset. Removing the
+  // old registration may fail in the fork child, where the ring is new.
+  {
+    grpc_core::MutexLock lock(&sq_mu_);
+    RemovePollLocked(kWakeupUserData);
+    FlushSubmissionsLocked();
+  }
+  wakeup_fd_ = *CreateWakeupFd(&posix_interface());
+  ArmWakeupFd();
+  grpc_core::MutexLock lock(&mu_);
+  was_kicked_ = false;
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler) {
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    return std::make_shared<IoUringPoller>(scheduler);
+  }
+  return nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#else  // defined(GRPC_HAVE_IO_URING_POLLER)
+
+namespace grpc_event_engine::experimental {
+
+class IoUringRing {};
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+
+IoUringPoller::IoUringPoller(Scheduler* /* engine */) {
+  grpc_core::Crash("unimplemented");
+}
+
+IoUringPoller::~IoUringPoller() { grpc_core::Crash("unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(FileDescriptor /*fd*/,
+                                         absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+#if GRPC_ENABLE_FORK_SUPPORT
+void IoUringPoller::HandleForkInChild() { grpc_core::Crash("unimplemented"); }
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::ResetKickState() { grpc_core::Crash("unimplemented"); }
+
+// If io_uring is not known to the build environment, return nullptr so that
+// the default poller falls back to epoll1.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // !defined(GRPC_HAVE_IO_URING_POLLER)
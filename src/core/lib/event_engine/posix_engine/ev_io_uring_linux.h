@@ -0,0 +1,144 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+class IoUringEventHandle;
+class IoUringRing;
+
+// Definition of an io_uring based poller.
+//
+// Every handle is registered with a single multishot IORING_OP_POLL_ADD
+// request. Registrations, re-arms and removals are queued on the submission
+// ring and handed to the kernel together with the wait for completions, so a
+// Work() iteration costs a single io_uring_enter() regardless of how many
+// file descriptors became ready. Completions are reaped directly from the
+// shared completion ring without further syscalls.
+//
+// Handles also perform socket I/O (EventHandle::RecvMsg/SendMsg) as
+// IORING_OP_RECVMSG/SENDMSG requests. The kernel runs them once the socket
+// is ready, and requests queued while no thread waits in Work() are
+// submitted together with its next wait.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  explicit IoUringPoller(Scheduler* scheduler);
+  EventHandle* CreateHandle(FileDescriptor fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+  void Close();
+
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+  void HandleForkInChild() override;
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  void ResetKickState() override;
+
+ private:
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+  friend class IoUringEventHandle;
+
+  // Queue a multishot poll request for fd, tagged with user_data.
+  void ArmPollLocked(uintptr_t user_data, int fd, uint32_t events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Queue the cancellation of a previously armed poll request.
+  void RemovePollLocked(uintptr_t user_data)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Queue a recvmsg/sendmsg request (opcode) on fd, tagged with user_data.
+  void SubmitMsgLocked(uint64_t user_data, uint8_t opcode, int fd,
+                       const struct msghdr* msg, int flags)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Queue the cancellation of the socket I/O request tagged user_data.
+  void CancelRequestLocked(uint64_t user_data)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Hand every queued submission to the kernel without waiting for
+  // completions.
+  void FlushSubmissionsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Submit queued requests and block until at least one completion is
+  // available or the timeout expires. Returns false on timeout.
+  bool SubmitAndWait(
+      grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Reap every available completion. It returns true if there was a Kick
+  // that forced invocation of this function. It also returns the list of
+  // handles that became readable/writable.
+  bool ProcessCompletions(Events& pending_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void ArmWakeupFd();
+
+  grpc_core::Mutex mu_;
+  // Serializes producers of the submission ring. Completions are only ever
+  // consumed by the thread running Work().
+  grpc_core::Mutex sq_mu_;
+  Scheduler* scheduler_;
+  std::unique_ptr<IoUringRing> ring_;
+  // Number of threads blocked in io_uring_enter() waiting for completions.
+  std::atomic<int> waiters_{0};
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  // Every handle created, indexed by the index in its poll requests' tags.
+  // Handles are only deleted by Close(), so completions can always be
+  // matched against the handle they name.
+  std::vector<IoUringEventHandle*> handles_ ABSL_GUARDED_BY(mu_);
+#if GRPC_ENABLE_FORK_SUPPORT
+  absl::flat_hash_set<EventHandle*> fork_handles_set_ ABSL_GUARDED_BY(mu_);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+  bool closed_;
+};
+
+// Return an instance of an io_uring based poller tied to the specified event
+// engine, or nullptr if the running kernel does not provide the io_uring
+// features this poller relies on.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
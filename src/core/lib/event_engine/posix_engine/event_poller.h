@@ -17,6 +17,7 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <cstdint>
 #include <string>
 
 #include "absl/functional/any_invocable.h"
@@ -25,6 +26,9 @@
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/util/crash.h"
+
+struct msghdr;
 
 namespace grpc_event_engine::experimental {
 
@@ -82,6 +86,25 @@ class EventHandle {
   virtual bool IsHandleShutdown() = 0;
   // Returns the poller which was used to create this handle.
   virtual PosixEventPoller* Poller() = 0;
+  // Returns true if the poller can perform socket I/O on behalf of the caller
+  // with RecvMsg and SendMsg, instead of the caller waiting for readiness
+  // with NotifyOnRead/NotifyOnWrite and then issuing the syscall itself.
+  virtual bool SupportsAsyncIo() { return false; }
+  // Starts a recvmsg()/sendmsg() on the underlying file descriptor which
+  // completes once the socket is ready. on_done is run by the poller's
+  // scheduler with the result of the syscall: the number of bytes
+  // transferred, or a negated errno value. msg and the buffers it describes
+  // must remain valid until then. At most one receive and one send may be in
+  // flight at a time. ShutdownHandle cancels them, and they complete with
+  // -ECANCELED.
+  virtual void RecvMsg(struct msghdr* /*msg*/, int /*flags*/,
+                       absl::AnyInvocable<void(int64_t)> /*on_done*/) {
+    grpc_core::Crash("RecvMsg is not supported by this poller");
+  }
+  virtual void SendMsg(const struct msghdr* /*msg*/, int /*flags*/,
+                       absl::AnyInvocable<void(int64_t)> /*on_done*/) {
+    grpc_core::Crash("SendMsg is not supported by this poller");
+  }
   virtual ~EventHandle() = default;
 };
 
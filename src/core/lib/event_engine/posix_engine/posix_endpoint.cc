@@ -17,6 +17,7 @@
 #include <grpc/event_engine/internal/slice_cast.h>
 #include <grpc/event_engine/slice.h>
 #include <grpc/event_engine/slice_buffer.h>
+#include <grpc/slice.h>
 #include <grpc/status.h>
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
@@ -61,6 +62,10 @@
 #include <sys/prctl.h>         // IWYU pragma: keep
 #include <sys/resource.h>      // IWYU pragma: keep
 #endif
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+#include <sys/mman.h>  // IWYU pragma: keep
+#include <unistd.h>    // IWYU pragma: keep
+#endif
 #include <netinet/in.h>  // IWYU pragma: keep
 
 #ifndef SOL_TCP
@@ -87,8 +92,21 @@
 #define MSG_ZEROCOPY 0x4000000
 #endif
 
+// TCP zero copy receive socket option. Defined here for the same reason as
+// MSG_ZEROCOPY above.
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+
 #define MAX_READ_IOVEC 64
 
+#ifdef GRPC_LINUX_ERRQUEUE
+#define READ_CMSG_SPACE \
+  (CMSG_SPACE(sizeof(scm_timestamping)) + CMSG_SPACE(sizeof(int)))
+#else
+#define READ_CMSG_SPACE 24  // CMSG_SPACE(sizeof(int))
+#endif  // GRPC_LINUX_ERRQUEUE
+
 namespace grpc_event_engine::experimental {
 
 namespace {
@@ -110,6 +128,32 @@ PosixErrorOr<int64_t> TcpSend(EventEnginePosixInterface* posix_interface,
   return send_result;
 }
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
+// The leading fields of the kernel's struct tcp_zerocopy_receive. Newer
+// kernels append fields to it but accept this prefix, and older library
+// headers do not declare it at all.
+struct TcpZerocopyReceive {
+  uint64_t address;
+  uint32_t length;
+  uint32_t recv_skip_hint;
+};
+
+// Upper bound on the size of a single mapping.
+constexpr size_t kMaxZerocopyReceiveBytes = 16 * 1024 * 1024;
+
+size_t PageSize() {
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  return page_size;
+}
+
+// Slice destroyer for mapped receive regions.
+void UnmapZerocopyRegion(void* region, size_t length) {
+  munmap(region, length);
+}
+
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
 #ifdef GRPC_LINUX_ERRQUEUE
 
 #define CAP_IS_SUPPORTED(cap) (prctl(PR_CAPBSET_READ, (cap), 0) > 0)
@@ -288,27 +332,37 @@ absl::Status PosixEndpointImpl::TcpAnnotateError(absl::Status src_error) const {
   return src_error;
 }
 
-// Returns true if data available to read or error other than EAGAIN.
-bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
-  GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("TcpDoRead");
+// The messages of the receive and send handed to the poller, which the
+// kernel accesses until the operation completes.
+struct PosixEndpointImpl::RingIo {
+  struct msghdr read_msg;
+  struct iovec read_iov[MAX_READ_IOVEC];
+  char read_cmsgbuf[READ_CMSG_SPACE];
+  struct msghdr write_msg;
+  struct iovec write_iov[MAX_WRITE_IOVEC];
+};
 
-  struct msghdr msg;
-  struct iovec iov[MAX_READ_IOVEC];
-  size_t total_read_bytes = 0;
+size_t PosixEndpointImpl::FillReadIovecs(struct iovec* iov) {
   size_t iov_len = std::min<size_t>(MAX_READ_IOVEC, incoming_buffer_->Count());
-#ifdef GRPC_LINUX_ERRQUEUE
-  constexpr size_t cmsg_alloc_space =
-      CMSG_SPACE(sizeof(scm_timestamping)) + CMSG_SPACE(sizeof(int));
-#else
-  constexpr size_t cmsg_alloc_space = 24;  // CMSG_SPACE(sizeof(int))
-#endif  // GRPC_LINUX_ERRQUEUE
-  char cmsgbuf[cmsg_alloc_space];
   for (size_t i = 0; i < iov_len; i++) {
     MutableSlice& slice =
         internal::SliceCast<MutableSlice>(incoming_buffer_->MutableSliceAt(i));
     iov[i].iov_base = slice.begin();
     iov[i].iov_len = slice.length();
   }
+  return iov_len;
+}
+
+// Returns true if data available to read or error other than EAGAIN.
+bool PosixEndpointImpl::TcpDoRead(absl::Status& status,
+                                  std::optional<int64_t> ring_result) {
+  GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("TcpDoRead");
+
+  struct msghdr msg;
+  struct iovec iov[MAX_READ_IOVEC];
+  size_t total_read_bytes = 0;
+  size_t iov_len = FillReadIovecs(iov);
+  char cmsgbuf[READ_CMSG_SPACE];
 
   CHECK_NE(incoming_buffer_->Length(), 0u);
   DCHECK_GT(min_progress_size_, 0);
@@ -319,28 +373,42 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     // always something to read until we get EAGAIN.
     inq_ = 1;
 
-    msg.msg_name = nullptr;
-    msg.msg_namelen = 0;
-    msg.msg_iov = iov;
-    msg.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
-    if (inq_capable_) {
-      msg.msg_control = cmsgbuf;
-      msg.msg_controllen = sizeof(cmsgbuf);
+    PosixErrorOr<int64_t> res;
+    if (ring_result.has_value()) {
+      // The poller already ran the first recvmsg, with the message
+      // SubmitRingRead built over the same slices.
+      msg = ring_io_->read_msg;
+      msg.msg_iov = iov;
+      if (*ring_result >= 0) {
+        res = *ring_result;
+      } else {
+        res = PosixError::Error(static_cast<int>(-*ring_result));
+      }
+      ring_result.reset();
     } else {
-      msg.msg_control = nullptr;
-      msg.msg_controllen = 0;
+      msg.msg_name = nullptr;
+      msg.msg_namelen = 0;
+      msg.msg_iov = iov;
+      msg.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
+      if (inq_capable_) {
+        msg.msg_control = cmsgbuf;
+        msg.msg_controllen = sizeof(cmsgbuf);
+      } else {
+        msg.msg_control = nullptr;
+        msg.msg_controllen = 0;
+      }
+      msg.msg_flags = 0;
+
+      grpc_core::global_stats().IncrementTcpReadOffer(
+          incoming_buffer_->Length());
+      grpc_core::global_stats().IncrementTcpReadOfferIovSize(
+          incoming_buffer_->Count());
+      EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+      do {
+        grpc_core::global_stats().IncrementSyscallRead();
+        res = posix_interface.RecvMsg(handle_->WrappedFd(), &msg, 0);
+      } while (res.IsPosixError(EINTR));
     }
-    msg.msg_flags = 0;
-
-    grpc_core::global_stats().IncrementTcpReadOffer(incoming_buffer_->Length());
-    grpc_core::global_stats().IncrementTcpReadOfferIovSize(
-        incoming_buffer_->Count());
-    PosixErrorOr<int64_t> res;
-    EventEnginePosixInterface& posix_interface = poller_->posix_interface();
-    do {
-      grpc_core::global_stats().IncrementSyscallRead();
-      res = posix_interface.RecvMsg(handle_->WrappedFd(), &msg, 0);
-    } while (res.IsPosixError(EINTR));
 
     if (res.IsPosixError(EAGAIN)) {
       // NB: After calling call_read_cb a parallel call of the read handler may
@@ -370,8 +438,10 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
       } else if (read_bytes == 0) {
         status = TcpAnnotateError(absl::InternalError("Socket closed"));
       } else {
+        // errno is not set for a recvmsg the poller ran.
+        const int error = res.errno_value().value_or(EIO);
         status = TcpAnnotateError(absl::InternalError(
-            absl::StrCat("recvmsg:", grpc_core::StrError(errno))));
+            absl::StrCat("recvmsg:", grpc_core::StrError(error))));
       }
       return true;
     }
@@ -465,9 +535,77 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   return true;
 }
 
+bool PosixEndpointImpl::TcpDoZerocopyRead() {
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  // last_read_buffer_ holds data staged by earlier rounds of this read when
+  // frame size tuning is on. Mapped slices can only be handed out first.
+  if (!rx_zerocopy_enabled_ || last_read_buffer_.Count() != 0) return false;
+  const double expected = std::max({static_cast<double>(min_progress_size_),
+                                    static_cast<double>(inq_), target_length_});
+  if (expected < static_cast<double>(rx_zerocopy_threshold_)) return false;
+  const size_t page_size = PageSize();
+  const size_t map_length = std::min(
+      (static_cast<size_t>(expected) + page_size - 1) / page_size * page_size,
+      kMaxZerocopyReceiveBytes);
+  EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+  auto fd = posix_interface.GetFd(handle_->WrappedFd());
+  if (!fd.ok()) return false;
+  void* region = mmap(nullptr, map_length, PROT_READ, MAP_SHARED, *fd, 0);
+  if (region == MAP_FAILED) {
+    VLOG(2) << "Disabling rx zero-copy, mmap failed: "
+            << grpc_core::StrError(errno);
+    rx_zerocopy_enabled_ = false;
+    return false;
+  }
+  TcpZerocopyReceive zc = {};
+  zc.address = reinterpret_cast<uintptr_t>(region);
+  zc.length = static_cast<uint32_t>(map_length);
+  socklen_t zc_len = sizeof(zc);
+  grpc_core::global_stats().IncrementSyscallRead();
+  PosixError result;
+  do {
+    result = posix_interface.GetSockOpt(handle_->WrappedFd(), IPPROTO_TCP,
+                                        TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (result.IsPosixError(EINTR));
+  if (!result.ok() || zc.length == 0) {
+    munmap(region, map_length);
+    if (result.IsPosixError(ENOPROTOOPT) || result.IsPosixError(EOPNOTSUPP) ||
+        result.IsPosixError(EINVAL)) {
+      VLOG(2) << "Disabling rx zero-copy, TCP_ZEROCOPY_RECEIVE failed: "
+              << result.StrError();
+      rx_zerocopy_enabled_ = false;
+    }
+    // Either less than a page is queued, or the socket is in a state that the
+    // regular read path knows how to report.
+    return false;
+  }
+  // The kernel maps whole pages only; give back the ones it did not fill.
+  if (zc.length < map_length) {
+    munmap(static_cast<char*>(region) + zc.length, map_length - zc.length);
+  }
+  grpc_core::global_stats().IncrementTcpReadSize(zc.length);
+  AddToEstimate(zc.length);
+  // Keep the spare read buffers for the next read, and deliver the mapped
+  // pages. They are not charged to the memory quota; until the slice is
+  // released they are accounted to the process' mapped memory instead.
+  incoming_buffer_->Swap(last_read_buffer_);
+  incoming_buffer_->Append(Slice(
+      grpc_slice_new_with_len(region, zc.length, UnmapZerocopyRegion)));
+  // The unaligned tail (recv_skip_hint bytes) and anything that arrived since
+  // is still queued, and the edge has not been consumed.
+  inq_ = 1;
+  min_progress_size_ = 1;
+  return true;
+#else
+  return false;
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+}
+
 void PosixEndpointImpl::PerformReclamation() {
   read_mu_.Lock();
-  if (incoming_buffer_ != nullptr) {
+  // The kernel may still be filling the buffers of a read handed to the
+  // poller.
+  if (incoming_buffer_ != nullptr && !ring_read_pending_) {
     incoming_buffer_->Clear();
   }
   has_posted_reclaimer_ = false;
@@ -567,10 +705,14 @@ void PosixEndpointImpl::MaybeMakeReadSlices() {
   }
 }
 
-bool PosixEndpointImpl::HandleReadLocked(absl::Status& status) {
+bool PosixEndpointImpl::HandleReadLocked(absl::Status& status,
+                                         std::optional<int64_t> ring_result) {
   if (status.ok() && memory_owner_.is_valid()) {
-    MaybeMakeReadSlices();
-    if (!TcpDoRead(status)) {
+    if (!ring_result.has_value()) {
+      if (TcpDoZerocopyRead()) return true;
+      MaybeMakeReadSlices();
+    }
+    if (!TcpDoRead(status, ring_result)) {
       UpdateRcvLowat();
       // We've consumed the edge, request a new one.
       return false;
@@ -586,27 +728,78 @@ bool PosixEndpointImpl::HandleReadLocked(absl::Status& status) {
 }
 
 void PosixEndpointImpl::HandleRead(absl::Status status) {
+  ContinueRead(std::move(status), std::nullopt);
+}
+
+void PosixEndpointImpl::HandleRingRead(int64_t result) {
+  if (result == -EAGAIN || result == -ECANCELED) {
+    {
+      grpc_core::MutexLock lock(&read_mu_);
+      ring_read_pending_ = false;
+    }
+    // Either ShutdownHandle cancelled the receive, or the socket was not
+    // ready after all. The readiness path reports the shutdown status, or
+    // waits for data and reads it.
+    handle_->NotifyOnRead(on_read_);
+    return;
+  }
+  ContinueRead(absl::OkStatus(), result);
+}
+
+void PosixEndpointImpl::ContinueRead(absl::Status status,
+                                     std::optional<int64_t> ring_result) {
   bool ret = false;
+  bool ring_read_submitted = false;
   absl::AnyInvocable<void(absl::Status)> cb = nullptr;
   grpc_core::EnsureRunInExecCtx([&, this]() mutable {
     grpc_core::MutexLock lock(&read_mu_);
-    ret = HandleReadLocked(status);
+    ring_read_pending_ = false;
+    ret = HandleReadLocked(status, ring_result);
     if (ret) {
       GRPC_TRACE_LOG(event_engine_endpoint, INFO)
           << "Endpoint[" << this << "]: Read complete";
       cb = std::move(read_cb_);
       read_cb_ = nullptr;
       incoming_buffer_ = nullptr;
+    } else if (UseRingRead()) {
+      SubmitRingRead();
+      ring_read_submitted = true;
     }
   });
   if (!ret) {
-    handle_->NotifyOnRead(on_read_);
+    if (!ring_read_submitted) handle_->NotifyOnRead(on_read_);
     return;
   }
   cb(status);
   Unref();
 }
 
+// Hands the next recvmsg to the poller. The kernel runs it once data arrives,
+// so the wakeup and the read cost no syscalls of their own.
+void PosixEndpointImpl::SubmitRingRead() {
+  MaybeMakeReadSlices();
+  RingIo& io = *ring_io_;
+  size_t iov_len = FillReadIovecs(io.read_iov);
+  io.read_msg.msg_name = nullptr;
+  io.read_msg.msg_namelen = 0;
+  io.read_msg.msg_iov = io.read_iov;
+  io.read_msg.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
+  if (inq_capable_) {
+    io.read_msg.msg_control = io.read_cmsgbuf;
+    io.read_msg.msg_controllen = sizeof(io.read_cmsgbuf);
+  } else {
+    io.read_msg.msg_control = nullptr;
+    io.read_msg.msg_controllen = 0;
+  }
+  io.read_msg.msg_flags = 0;
+  grpc_core::global_stats().IncrementTcpReadOffer(incoming_buffer_->Length());
+  grpc_core::global_stats().IncrementTcpReadOfferIovSize(
+      incoming_buffer_->Count());
+  ring_read_pending_ = true;
+  handle_->RecvMsg(&io.read_msg, 0,
+                   [this](int64_t result) { HandleRingRead(result); });
+}
+
 bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
                              SliceBuffer* buffer,
                              EventEngine::Endpoint::ReadArgs args) {
@@ -629,21 +822,40 @@ bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
     // Endpoint read called for the very first time. Register read callback
     // with the polling engine.
     is_first_read_ = false;
+    if (UseRingRead()) {
+      SubmitRingRead();
+      return false;
+    }
     lock.Release();
     handle_->NotifyOnRead(on_read_);
   } else if (inq_ == 0) {
     read_cb_ = std::move(on_read);
     UpdateRcvLowat();
+    if (UseRingRead()) {
+      SubmitRingRead();
+      return false;
+    }
     lock.Release();
     // Upper layer asked to read more but we know there is no pending data to
     // read from previous reads. So, wait for POLLIN.
     handle_->NotifyOnRead(on_read_);
   } else {
     absl::Status status;
+    if (TcpDoZerocopyRead()) {
+      incoming_buffer_ = nullptr;
+      Unref();
+      GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+          << "Endpoint[" << this << "]: Zero-copy read succeeded immediately";
+      return true;
+    }
     MaybeMakeReadSlices();
-    if (!TcpDoRead(status)) {
+    if (!TcpDoRead(status, std::nullopt)) {
       UpdateRcvLowat();
       read_cb_ = std::move(on_read);
+      if (UseRingRead()) {
+        SubmitRingRead();
+        return false;
+      }
       // We've consumed the edge, request a new one.
       lock.Release();
       handle_->NotifyOnRead(on_read_);
@@ -1172,7 +1384,11 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
                           : TcpFlush(status);
   if (!flush_result) {
     DCHECK(status.ok());
-    handle_->NotifyOnWrite(on_write_);
+    if (UseRingWrite()) {
+      SubmitRingWrite();
+    } else {
+      handle_->NotifyOnWrite(on_write_);
+    }
   } else {
     GRPC_TRACE_LOG(event_engine_endpoint, INFO)
         << "Endpoint[" << this << "]: Write complete: " << status;
@@ -1184,6 +1400,77 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
   }
 }
 
+// Hands the sendmsg of what is left of outgoing_buffer_ to the poller. The
+// kernel runs it once the socket has room again.
+void PosixEndpointImpl::SubmitRingWrite() {
+  RingIo& io = *ring_io_;
+  size_t sending_length = 0;
+  size_t iov_size = 0;
+  size_t byte_idx = outgoing_byte_idx_;
+  for (; iov_size != outgoing_buffer_->Count() && iov_size != MAX_WRITE_IOVEC;
+       ++iov_size) {
+    MutableSlice& slice = internal::SliceCast<MutableSlice>(
+        outgoing_buffer_->MutableSliceAt(iov_size));
+    io.write_iov[iov_size].iov_base = slice.begin() + byte_idx;
+    io.write_iov[iov_size].iov_len = slice.length() - byte_idx;
+    sending_length += io.write_iov[iov_size].iov_len;
+    byte_idx = 0;
+  }
+  io.write_msg.msg_name = nullptr;
+  io.write_msg.msg_namelen = 0;
+  io.write_msg.msg_iov = io.write_iov;
+  io.write_msg.msg_iovlen = static_cast<msg_iovlen_type>(iov_size);
+  io.write_msg.msg_control = nullptr;
+  io.write_msg.msg_controllen = 0;
+  io.write_msg.msg_flags = 0;
+  grpc_core::global_stats().IncrementTcpWriteSize(sending_length);
+  grpc_core::global_stats().IncrementTcpWriteIovSize(iov_size);
+  handle_->SendMsg(&io.write_msg, SENDMSG_FLAGS,
+                   [this](int64_t result) { HandleRingWrite(result); });
+}
+
+void PosixEndpointImpl::HandleRingWrite(int64_t result) {
+  if (result == -EAGAIN || result == -ENOBUFS || result == -ECANCELED) {
+    // Either ShutdownHandle cancelled the send, or the socket had no room
+    // after all. The readiness path reports the shutdown status, or waits
+    // for room and flushes.
+    handle_->NotifyOnWrite(on_write_);
+    return;
+  }
+  absl::Status status;
+  if (result < 0) {
+    status = TcpAnnotateError(PosixOSError(
+        PosixError::Error(static_cast<int>(-result)), "sendmsg"));
+    outgoing_buffer_->Clear();
+  } else {
+    bytes_counter_ += result;
+    // Drop what was sent; a short send leaves outgoing_byte_idx_ inside the
+    // first slice left.
+    size_t sent = static_cast<size_t>(result);
+    while (sent > 0) {
+      const size_t left =
+          outgoing_buffer_->RefSlice(0).length() - outgoing_byte_idx_;
+      if (sent < left) {
+        outgoing_byte_idx_ += sent;
+        break;
+      }
+      sent -= left;
+      outgoing_buffer_->TakeFirst();
+      outgoing_byte_idx_ = 0;
+    }
+    if (outgoing_buffer_->Count() != 0) {
+      SubmitRingWrite();
+      return;
+    }
+  }
+  GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+      << "Endpoint[" << this << "]: Write complete: " << status;
+  absl::AnyInvocable<void(absl::Status)> cb = std::move(write_cb_);
+  write_cb_ = nullptr;
+  cb(status);
+  Unref();
+}
+
 bool PosixEndpointImpl::Write(
     absl::AnyInvocable<void(absl::Status)> on_writable, SliceBuffer* data,
     EventEngine::Endpoint::WriteArgs args) {
@@ -1230,7 +1517,11 @@ bool PosixEndpointImpl::Write(
     Ref().release();
     write_cb_ = std::move(on_writable);
     current_zerocopy_send_ = zerocopy_send_record;
-    handle_->NotifyOnWrite(on_write_);
+    if (UseRingWrite()) {
+      SubmitRingWrite();
+    } else {
+      handle_->NotifyOnWrite(on_write_);
+    }
     return false;
   }
   if (!status.ok()) {
@@ -1352,6 +1643,14 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
 #else
   inq_capable_ = false;
 #endif  // GRPC_HAVE_TCP_INQ
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  rx_zerocopy_enabled_ = options.tcp_rx_zero_copy_enabled;
+  rx_zerocopy_threshold_ = std::max<size_t>(
+      options.tcp_rx_zerocopy_receive_bytes_threshold, PageSize());
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  if (handle_->SupportsAsyncIo()) {
+    ring_io_ = std::make_unique<RingIo>();
+  }
 
   on_read_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleRead(std::move(status)); });
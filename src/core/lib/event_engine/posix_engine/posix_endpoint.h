@@ -27,6 +27,7 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "absl/base/thread_annotations.h"
@@ -496,11 +497,40 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   void UpdateRcvLowat() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void HandleWrite(absl::Status status);
   void HandleError(absl::Status status);
-  void HandleRead(absl::Status status) ABSL_NO_THREAD_SAFETY_ANALYSIS;
-  bool HandleReadLocked(absl::Status& status)
+  void HandleRead(absl::Status status);
+  // Processes the result of a recvmsg the poller ran (see SubmitRingRead).
+  void HandleRingRead(int64_t result);
+  void ContinueRead(absl::Status status, std::optional<int64_t> ring_result)
+      ABSL_NO_THREAD_SAFETY_ANALYSIS;
+  // ring_result, if set, is the result of the first recvmsg, which the
+  // poller already ran.
+  bool HandleReadLocked(absl::Status& status,
+                        std::optional<int64_t> ring_result)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
-  bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Points iov at incoming_buffer_'s slices; returns the number used.
+  size_t FillReadIovecs(struct iovec* iov)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  bool TcpDoRead(absl::Status& status, std::optional<int64_t> ring_result)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Whether reads and writes are handed to the poller instead of waiting for
+  // readiness (see EventHandle::SupportsAsyncIo). Zero-copy and timestamped
+  // sends need the syscall's control messages, so they never are.
+  bool UseRingRead() const {
+    return ring_io_ != nullptr && !rx_zerocopy_enabled_;
+  }
+  bool UseRingWrite() const {
+    return ring_io_ != nullptr && current_zerocopy_send_ == nullptr &&
+           !outgoing_buffer_write_event_sink_.has_value();
+  }
+  void SubmitRingRead() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void SubmitRingWrite();
+  void HandleRingWrite(int64_t result);
+  // Tries to complete the current read by mapping the received pages with
+  // TCP_ZEROCOPY_RECEIVE instead of copying them. Returns true if
+  // incoming_buffer_ now holds the mapped (read-only) data; returns false if
+  // the caller should fall back to TcpDoRead.
+  bool TcpDoZerocopyRead() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
@@ -528,6 +558,12 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   grpc_core::Mutex read_mu_;
   bool is_first_read_ = true;
   bool has_posted_reclaimer_ ABSL_GUARDED_BY(read_mu_) = false;
+  // The messages of the receive and send handed to the poller. Only
+  // allocated if the handle supports it.
+  struct RingIo;
+  std::unique_ptr<RingIo> ring_io_;
+  // Set while the kernel may write into incoming_buffer_.
+  bool ring_read_pending_ ABSL_GUARDED_BY(read_mu_) = false;
   double target_length_;
   int min_read_chunk_size_;
   int max_read_chunk_size_;
@@ -543,6 +579,11 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int inq_ = 1;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
+  // Whether reads may use TCP_ZEROCOPY_RECEIVE. Cleared if the socket turns
+  // out not to support it.
+  bool rx_zerocopy_enabled_ = false;
+  // Reads expected to return fewer bytes than this are copied.
+  size_t rx_zerocopy_threshold_ = 0;
 
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
@@ -37,6 +37,7 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/ares_resolver.h"
 #include "src/core/lib/event_engine/poller.h"
@@ -58,6 +59,7 @@
 #ifdef GRPC_POSIX_SOCKET_TCP
 #include <errno.h>       // IWYU pragma: keep
 #include <pthread.h>     // IWYU pragma: keep
+#include <sched.h>       // IWYU pragma: keep
 #include <stdint.h>      // IWYU pragma: keep
 #include <sys/socket.h>  // IWYU pragma: keep
 #include <unistd.h>      // IWYU pragma: keep
@@ -201,6 +203,29 @@ void RegisterEventEngineForFork(
 
 #endif  // GRPC_ENABLE_FORK_SUPPORT && GRPC_POSIX_FORK_ALLOW_PTHREAD_ATFORK
 
+#if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+
+// Returns the ids of the CPUs this process may run on, in increasing order.
+// Under cpusets or taskset these need not be 0..n-1.
+std::vector<int> AllowedCpus() {
+  std::vector<int> cpus;
+#ifdef GPR_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+    }
+    if (!cpus.empty()) return cpus;
+  }
+#endif
+  const int cores = static_cast<int>(gpr_cpu_num_cores());
+  for (int cpu = 0; cpu < cores; ++cpu) cpus.push_back(cpu);
+  return cpus;
+}
+
+#endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+
 }  // namespace
 
 #ifdef GRPC_POSIX_SOCKET_TCP
@@ -508,6 +533,50 @@ void PosixEnginePollerManager::Run(absl::AnyInvocable<void()> cb) {
   }
 }
 
+#if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+
+PosixEventEngine::PollerShard::PollerShard(std::shared_ptr<ThreadPool> pool)
+    : executor(std::move(pool)), poller_manager(executor) {}
+
+void PosixEventEngine::CreatePollerShards() {
+  const int requested = grpc_core::ConfigVars::Get().PosixPollerShards();
+  const std::vector<int> allowed_cpus = AllowedCpus();
+  const int cores = static_cast<int>(allowed_cpus.size());
+  const int shard_count = std::min(requested, cores);
+  if (shard_count <= 1 || poller_manager_.Poller() == nullptr) return;
+  poller_shards_.reserve(shard_count);
+  for (int i = 0; i < shard_count; ++i) {
+    // Shard i owns allowed CPUs [i * cores / n, (i + 1) * cores / n).
+    std::vector<int> cpus(allowed_cpus.begin() + i * cores / shard_count,
+                          allowed_cpus.begin() + (i + 1) * cores / shard_count);
+    const size_t reserve_threads =
+        grpc_core::Clamp(cpus.size(), size_t{2}, size_t{16});
+    poller_shards_.push_back(std::make_unique<PollerShard>(
+        MakeThreadPool(reserve_threads, std::move(cpus))));
+    if (poller_shards_.back()->poller_manager.Poller() == nullptr) {
+      LOG(ERROR) << "Failed to create poller shard " << i
+                 << ", running with a single poller";
+      for (auto& shard : poller_shards_) shard->executor->Quiesce();
+      poller_shards_.clear();
+      return;
+    }
+  }
+  GRPC_TRACE_LOG(event_engine, INFO)
+      << "PosixEventEngine:" << this << " running " << shard_count
+      << " poller shards";
+}
+
+std::vector<PosixEventPoller*> PosixEventEngine::ShardPollers() const {
+  std::vector<PosixEventPoller*> pollers;
+  pollers.reserve(poller_shards_.size());
+  for (const auto& shard : poller_shards_) {
+    pollers.push_back(shard->poller_manager.Poller());
+  }
+  return pollers;
+}
+
+#endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+
 std::shared_ptr<PosixEventEngine> PosixEventEngine::MakePosixEventEngine() {
   // Can't use make_shared as ctor is private
   std::shared_ptr<PosixEventEngine> engine(new PosixEventEngine());
@@ -531,7 +600,8 @@ PosixEventEngine::PosixEventEngine(std::shared_ptr<PosixEventPoller> poller)
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
       poller_manager_(poller),
 #endif
-      timer_manager_(std::make_shared<TimerManager>(executor_)) {
+      timer_manager_(std::make_shared<TimerManager>(
+          executor_, grpc_core::ConfigVars::Get().PosixTimerWheel())) {
 }
 
 PosixEventEngine::PosixEventEngine()
@@ -539,10 +609,13 @@ PosixEventEngine::PosixEventEngine()
       executor_(MakeThreadPool(grpc_core::Clamp(gpr_cpu_num_cores(), 4u, 16u))),
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
       poller_manager_(executor_),
-      timer_manager_(std::make_shared<TimerManager>(executor_)) {
+      timer_manager_(std::make_shared<TimerManager>(
+          executor_, grpc_core::ConfigVars::Get().PosixTimerWheel())) {
+  CreatePollerShards();
   SchedulePoller();
 #else   // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
-      timer_manager_(std::make_shared<TimerManager>(executor_)) {
+      timer_manager_(std::make_shared<TimerManager>(
+          executor_, grpc_core::ConfigVars::Get().PosixTimerWheel())) {
 #endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
 }
 
@@ -580,6 +653,10 @@ PosixEventEngine::~PosixEventEngine() {
   }
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   polling_cycle_.reset();
+  for (auto& shard : poller_shards_) {
+    shard->polling_cycle.reset();
+    shard->executor->Quiesce();
+  }
 #endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   timer_manager_->Shutdown();
   executor_->Quiesce();
@@ -853,7 +930,7 @@ PosixEventEngine::CreateListener(
   return std::make_unique<PosixEngineListener>(
       std::move(posix_on_accept), std::move(on_shutdown), config,
       std::move(memory_allocator_factory), poller_manager_.Poller(),
-      shared_from_this());
+      ShardPollers(), shared_from_this());
 }
 
 absl::StatusOr<std::unique_ptr<EventEngine::Listener>>
@@ -865,7 +942,7 @@ PosixEventEngine::CreatePosixListener(
   return std::make_unique<PosixEngineListener>(
       std::move(on_accept), std::move(on_shutdown), config,
       std::move(memory_allocator_factory), poller_manager_.Poller(),
-      shared_from_this());
+      ShardPollers(), shared_from_this());
 }
 
 void PosixEventEngine::SchedulePoller() {
@@ -873,12 +950,19 @@ void PosixEventEngine::SchedulePoller() {
     grpc_core::MutexLock lock(&mu_);
     CHECK(!polling_cycle_.has_value());
     polling_cycle_.emplace(&poller_manager_);
+    for (auto& shard : poller_shards_) {
+      CHECK(!shard->polling_cycle.has_value());
+      shard->polling_cycle.emplace(&shard->poller_manager);
+    }
   }
 }
 
 void PosixEventEngine::ResetPollCycle() {
   grpc_core::MutexLock lock(&mu_);
   polling_cycle_.reset();
+  for (auto& shard : poller_shards_) {
+    shard->polling_cycle.reset();
+  }
 }
 
 #else  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
@@ -939,17 +1023,30 @@ PosixEventEngine::CreatePosixListener(
     GRPC_POSIX_FORK_ALLOW_PTHREAD_ATFORK
 
 void PosixEventEngine::AfterFork(OnForkRole on_fork_role) {
+#if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+  // Shard executors are not registered for fork on their own, so that they
+  // are only restarted once the engine is ready to poll on them again.
+  for (auto& shard : poller_shards_) {
+    shard->executor->PostFork();
+  }
+#endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   if (on_fork_role == OnForkRole::kChild) {
     if (grpc_core::IsEventEngineForkEnabled()) {
       AfterForkInChild();
     } else {
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
       poller_manager_.Poller()->HandleForkInChild();
+      for (auto& shard : poller_shards_) {
+        shard->poller_manager.Poller()->HandleForkInChild();
+      }
 #endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
     }
   }
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   poller_manager_.Poller()->ResetKickState();
+  for (auto& shard : poller_shards_) {
+    shard->poller_manager.Poller()->ResetKickState();
+  }
   SchedulePoller();
 #endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
 }
@@ -957,6 +1054,9 @@ void PosixEventEngine::AfterFork(OnForkRole on_fork_role) {
 void PosixEventEngine::BeforeFork() {
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   ResetPollCycle();
+  for (auto& shard : poller_shards_) {
+    shard->executor->PrepareFork();
+  }
 #endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
 }
 
@@ -972,6 +1072,9 @@ void PosixEventEngine::AfterForkInChild() {
 #endif
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   poller_manager_.Poller()->HandleForkInChild();
+  for (auto& shard : poller_shards_) {
+    shard->poller_manager.Poller()->HandleForkInChild();
+  }
 #endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
 #if GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_ARES_EV_DRIVER)
   for (const auto& cb : resolver_handles_) {
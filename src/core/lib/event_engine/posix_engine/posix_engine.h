@@ -281,6 +281,24 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport {
     grpc_core::CondVar cond_;
   };
 
+  // An extra poller for server connections, driven by its own thread pool
+  // whose threads are pinned to a slice of the machine's CPUs. See
+  // ConfigVars::PosixPollerShards.
+  struct PollerShard {
+    explicit PollerShard(std::shared_ptr<ThreadPool> executor);
+
+    std::shared_ptr<ThreadPool> executor;
+    PosixEnginePollerManager poller_manager;
+    // Guarded by the engine's mu_.
+    std::optional<PollingCycle> polling_cycle;
+  };
+
+  // Creates the poller shards requested by the config, if any.
+  void CreatePollerShards();
+  // Pollers that listeners should accept connections on, in addition to the
+  // engine's own poller. Empty when the engine is not sharded.
+  std::vector<PosixEventPoller*> ShardPollers() const;
+
   void SchedulePoller();
   void ResetPollCycle();
 
@@ -289,6 +307,9 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport {
   // Ensures there's ever only one of these.
   std::optional<PollingCycle> polling_cycle_ ABSL_GUARDED_BY(&mu_);
 
+  // Only set up at construction, never resized afterwards.
+  std::vector<std::unique_ptr<PollerShard>> poller_shards_;
+
 #endif  // defined(GRPC_POSIX_SOCKET_TCP) &&
         // !defined(GRPC_DO_NOT_INSTANTIATE_POSIX_POLLER)
 
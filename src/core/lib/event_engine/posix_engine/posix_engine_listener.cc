@@ -31,6 +31,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
@@ -57,8 +58,10 @@ PosixEngineListenerImpl::PosixEngineListenerImpl(
     const grpc_event_engine::experimental::EndpointConfig& config,
     std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
         memory_allocator_factory,
-    PosixEventPoller* poller, std::shared_ptr<EventEngine> engine)
+    PosixEventPoller* poller, std::vector<PosixEventPoller*> shard_pollers,
+    std::shared_ptr<EventEngine> engine)
     : poller_(poller),
+      shard_pollers_(std::move(shard_pollers)),
       options_(TcpOptionsFromEndpointConfig(config)),
       engine_(std::move(engine)),
       acceptors_(this),
@@ -74,19 +77,42 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
     return absl::FailedPreconditionError(
         "Listener is already started, ports can no longer be bound");
   }
-  EventEngine::ResolvedAddress res_addr = addr;
-  EventEngine::ResolvedAddress addr6_v4mapped;
-  int requested_port = ResolvedAddressGetPort(res_addr);
   CHECK(addr.size() <= EventEngine::ResolvedAddress::MAX_SIZE_BYTES);
   UnlinkIfUnixDomainSocket(addr);
+  // Update the callback. Any subsequent new sockets created and added to
+  // acceptors_ in this function will invoke the new callback.
+  acceptors_.UpdateOnAppendCallback(std::move(on_bind_new_fd));
+  const int family = addr.address()->sa_family;
+  if (shard_pollers_.empty() || !options_.allow_reuse_port ||
+      (family != AF_INET && family != AF_INET6)) {
+    return BindToPollerLocked(poller_, addr);
+  }
+  // The first shard picks the port (if it is a wildcard one), and every other
+  // shard joins the same SO_REUSEPORT group.
+  EventEngine::ResolvedAddress shard_addr = addr;
+  absl::StatusOr<int> port;
+  for (PosixEventPoller* poller : shard_pollers_) {
+    port = BindToPollerLocked(poller, shard_addr);
+    GRPC_RETURN_IF_ERROR(port.status());
+    ResolvedAddressSetPort(shard_addr, *port);
+  }
+  return port;
+}
 
-  EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+absl::StatusOr<int> PosixEngineListenerImpl::BindToPollerLocked(
+    PosixEventPoller* poller, const EventEngine::ResolvedAddress& addr) {
+  EventEngine::ResolvedAddress res_addr = addr;
+  EventEngine::ResolvedAddress addr6_v4mapped;
+  int requested_port = ResolvedAddressGetPort(res_addr);
+  EventEnginePosixInterface& posix_interface = poller->posix_interface();
+  acceptors_.UpdatePoller(poller);
 
   /// Check if this is a wildcard port, and if so, try to keep the port the same
   /// as some previously created listener socket.
   for (auto it = acceptors_.begin();
        requested_port == 0 && it != acceptors_.end(); it++) {
-    auto sockname_temp = posix_interface.LocalAddress((*it)->Fd());
+    auto sockname_temp =
+        (*it)->Poller()->posix_interface().LocalAddress((*it)->Fd());
     if (sockname_temp.ok()) {
       int used_port = ResolvedAddressGetPort(*sockname_temp);
       if (used_port > 0) {
@@ -97,9 +123,6 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
     }
   }
   auto used_port = MaybeGetWildcardPortFromAddress(res_addr);
-  // Update the callback. Any subsequent new sockets created and added to
-  // acceptors_ in this function will invoke the new callback.
-  acceptors_.UpdateOnAppendCallback(std::move(on_bind_new_fd));
   if (used_port.has_value()) {
     requested_port = *used_port;
     return ListenerContainerAddWildcardAddresses(&posix_interface, acceptors_,
@@ -231,9 +254,10 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
       Unref();
       return;
     }
+    // The connection stays on the poller that accepted it.
     auto endpoint = CreatePosixEndpoint(
-        /*handle=*/listener_->poller_->CreateHandle(
-            fd.value(), *peer_name, listener_->poller_->CanTrackErrors()),
+        /*handle=*/handle_->Poller()->CreateHandle(
+            fd.value(), *peer_name, handle_->Poller()->CanTrackErrors()),
         /*on_shutdown=*/nullptr, /*engine=*/listener_->engine_,
         // allocator=
         listener_->memory_allocator_factory_->CreateMemoryAllocator(
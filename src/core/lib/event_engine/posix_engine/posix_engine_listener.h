@@ -25,6 +25,7 @@
 #include <list>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
@@ -55,7 +56,8 @@ class PosixEngineListenerImpl
       const grpc_event_engine::experimental::EndpointConfig& config,
       std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
           memory_allocator_factory,
-      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine);
+      PosixEventPoller* poller, std::vector<PosixEventPoller*> shard_pollers,
+      std::shared_ptr<EventEngine> engine);
   // Binds an address to the listener. This creates a ListenerSocket
   // and sets its fields appropriately.
   absl::StatusOr<int> Bind(
@@ -80,15 +82,16 @@ class PosixEngineListenerImpl
    public:
     AsyncConnectionAcceptor(std::shared_ptr<EventEngine> engine,
                             std::shared_ptr<PosixEngineListenerImpl> listener,
+                            PosixEventPoller* poller,
                             ListenerSocketsContainer::ListenerSocket socket)
         : engine_(std::move(engine)),
           listener_(std::move(listener)),
           socket_(socket),
-          handle_(listener_->poller_->CreateHandle(
+          handle_(poller->CreateHandle(
               socket_.sock,
               *grpc_event_engine::experimental::
                   ResolvedAddressToNormalizedString(socket_.addr),
-              listener_->poller_->CanTrackErrors())),
+              poller->CanTrackErrors())),
           notify_on_accept_(PosixEngineClosure::ToPermanentClosure(
               [this](absl::Status status) { NotifyOnAccept(status); })) {};
     // Start listening for incoming connections on the socket.
@@ -106,6 +109,9 @@ class PosixEngineListenerImpl
     }
     ListenerSocketsContainer::ListenerSocket& Socket() { return socket_; }
     FileDescriptor Fd() { return handle_->WrappedFd(); }
+    // The poller this acceptor's socket, and every connection it accepts, is
+    // registered with.
+    PosixEventPoller* Poller() { return handle_->Poller(); }
     ~AsyncConnectionAcceptor() {
       auto address = handle_->Poller()->posix_interface().LocalAddress(
           handle_->WrappedFd());
@@ -138,9 +144,13 @@ class PosixEngineListenerImpl
       on_append_ = std::move(on_append);
     }
 
+    // Sets the poller that subsequently appended sockets are registered with.
+    // Find only matches sockets registered with this poller.
+    void UpdatePoller(PosixEventPoller* poller) { poller_ = poller; }
+
     void Append(ListenerSocket socket) override {
       acceptors_.push_back(new AsyncConnectionAcceptor(
-          listener_->engine_, listener_->shared_from_this(), socket));
+          listener_->engine_, listener_->shared_from_this(), poller_, socket));
       if (on_append_) {
         on_append_(socket.sock.fd());
       }
@@ -150,7 +160,8 @@ class PosixEngineListenerImpl
         const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
             addr) override {
       for (auto* acceptor : acceptors_) {
-        if (acceptor->Socket().addr.size() == addr.size() &&
+        if (acceptor->Poller() == poller_ &&
+            acceptor->Socket().addr.size() == addr.size() &&
             memcmp(acceptor->Socket().addr.address(), addr.address(),
                    addr.size()) == 0) {
           return acceptor->Socket();
@@ -172,13 +183,22 @@ class PosixEngineListenerImpl
     PosixListenerWithFdSupport::OnPosixBindNewFdCallback on_append_;
     std::list<AsyncConnectionAcceptor*> acceptors_;
     PosixEngineListenerImpl* listener_;
+    PosixEventPoller* poller_ = nullptr;
   };
   friend class ListenerAsyncAcceptors;
   friend class AsyncConnectionAcceptor;
+  // Creates the listening socket(s) for addr and registers them with poller.
+  absl::StatusOr<int> BindToPollerLocked(
+      PosixEventPoller* poller, const EventEngine::ResolvedAddress& addr)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   // The mutex ensures thread safety when multiple threads try to call Bind
   // and Start in parallel.
   grpc_core::Mutex mu_;
   PosixEventPoller* poller_;
+  // When not empty, TCP addresses are bound once per shard poller with
+  // SO_REUSEPORT instead of once on poller_, so the kernel spreads incoming
+  // connections across the shards.
+  std::vector<PosixEventPoller*> shard_pollers_;
   PosixTcpOptions options_;
   std::shared_ptr<EventEngine> engine_;
   // Linked list of sockets. One is created upon each successful bind
@@ -205,10 +225,12 @@ class PosixEngineListener : public PosixListenerWithFdSupport {
       const grpc_event_engine::experimental::EndpointConfig& config,
       std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
           memory_allocator_factory,
-      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine)
+      PosixEventPoller* poller, std::vector<PosixEventPoller*> shard_pollers,
+      std::shared_ptr<EventEngine> engine)
       : impl_(std::make_shared<PosixEngineListenerImpl>(
             std::move(on_accept), std::move(on_shutdown), config,
-            std::move(memory_allocator_factory), poller, std::move(engine))) {}
+            std::move(memory_allocator_factory), poller,
+            std::move(shard_pollers), std::move(engine))) {}
   ~PosixEngineListener() override { ShutdownListeningFds(); };
   absl::StatusOr<int> Bind(
       const grpc_event_engine::experimental::EventEngine::ResolvedAddress& addr)
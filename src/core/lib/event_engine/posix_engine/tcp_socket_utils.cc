@@ -96,6 +96,12 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_rx_zerocopy_receive_bytes_threshold = AdjustValue(
+      PosixTcpOptions::kDefaultReceiveBytesThreshold, 0, INT_MAX,
+      config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD));
+  options.tcp_rx_zero_copy_enabled =
+      (AdjustValue(PosixTcpOptions::kZerocpRxEnabledDefault, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) != 0);
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
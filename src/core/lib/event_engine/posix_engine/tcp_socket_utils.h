@@ -51,6 +51,8 @@ struct PosixTcpOptions {
   static constexpr int kMaxChunkSize = 32 * 1024 * 1024;
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;
+  static constexpr int kZerocpRxEnabledDefault = 0;
+  static constexpr int kDefaultReceiveBytesThreshold = 256 * 1024;
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
@@ -61,6 +63,8 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  int tcp_rx_zerocopy_receive_bytes_threshold = kDefaultReceiveBytesThreshold;
+  bool tcp_rx_zero_copy_enabled = kZerocpRxEnabledDefault;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
@@ -132,6 +136,9 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_rx_zerocopy_receive_bytes_threshold =
+        other.tcp_rx_zerocopy_receive_bytes_threshold;
+    tcp_rx_zero_copy_enabled = other.tcp_rx_zero_copy_enabled;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
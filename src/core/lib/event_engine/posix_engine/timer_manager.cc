@@ -29,6 +29,8 @@
 #include "absl/log/log.h"
 #include "absl/time/time.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 
 static thread_local bool g_timer_thread;
 
@@ -83,9 +85,14 @@ void TimerManager::MainLoop() {
 bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 
 TimerManager::TimerManager(
-    std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool)
+    std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool,
+    bool use_timer_wheel)
     : host_(this), thread_pool_(std::move(thread_pool)) {
-  timer_list_ = std::make_unique<TimerList>(&host_);
+  if (use_timer_wheel) {
+    timer_list_ = std::make_unique<TimerWheel>(&host_);
+  } else {
+    timer_list_ = std::make_unique<TimerList>(&host_);
+  }
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
 }
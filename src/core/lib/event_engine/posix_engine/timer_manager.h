@@ -42,8 +42,11 @@ namespace grpc_event_engine::experimental {
 // thread_pool.{h,cc}.
 class TimerManager final {
  public:
+  // If use_timer_wheel is true, timers are kept in a TimerWheel rather than
+  // in a TimerList.
   explicit TimerManager(
-      std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool);
+      std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool,
+      bool use_timer_wheel = false);
   ~TimerManager();
 
   grpc_core::Timestamp Now() { return host_.Now(); }
@@ -98,7 +101,7 @@ class TimerManager final {
   State state_ ABSL_GUARDED_BY(mu_) = State::kRunning;
   bool kicked_ ABSL_GUARDED_BY(mu_) = false;
   uint64_t wakeups_ ABSL_GUARDED_BY(mu_) = false;
-  std::unique_ptr<TimerList> timer_list_;
+  std::unique_ptr<TimerListInterface> timer_list_;
   std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool_;
   std::optional<grpc_core::Notification> main_loop_exit_signal_;
 };
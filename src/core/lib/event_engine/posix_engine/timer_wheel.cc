@@ -0,0 +1,246 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+
+#include "absl/numeric/bits.h"
+#include "src/core/util/time.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+constexpr int64_t kInfFutureMillis = std::numeric_limits<int64_t>::max();
+
+void ListJoin(Timer* head, Timer* timer) {
+  timer->next = head;
+  timer->prev = head->prev;
+  timer->next->prev = timer->prev->next = timer;
+}
+
+void ListRemove(Timer* timer) {
+  timer->next->prev = timer->prev;
+  timer->prev->next = timer->next;
+}
+
+bool ListEmpty(const Timer* head) { return head->next == head; }
+
+}  // namespace
+
+TimerWheel::Shard::Shard() {
+  for (Timer& head : slots) head.next = head.prev = &head;
+}
+
+void TimerWheel::Shard::Add(Timer* timer) {
+  size_t index = kExpiredSlot;
+  if (timer->deadline > now) {
+    // The timer goes in the lowest level where it shares the current rotation
+    // with `now`, i.e. above the highest bit in which the two differ.
+    const uint64_t deadline = static_cast<uint64_t>(timer->deadline);
+    const int level =
+        (absl::bit_width(deadline ^ static_cast<uint64_t>(now)) - 1) /
+        kLevelBits;
+    if (level >= kNumLevels) {
+      index = kOverflowSlot;
+    } else {
+      const size_t slot =
+          (deadline >> (level * kLevelBits)) & (kSlotsPerLevel - 1);
+      occupied[level] |= uint64_t{1} << slot;
+      index = level * kSlotsPerLevel + slot;
+    }
+  }
+  timer->heap_index = index;
+  ListJoin(&slots[index], timer);
+}
+
+void TimerWheel::Shard::Remove(Timer* timer) {
+  const size_t index = timer->heap_index;
+  ListRemove(timer);
+  if (index < kOverflowSlot && ListEmpty(&slots[index])) {
+    occupied[index / kSlotsPerLevel] &=
+        ~(uint64_t{1} << (index % kSlotsPerLevel));
+  }
+}
+
+int64_t TimerWheel::Shard::NextSlot(size_t* index) {
+  const uint64_t current = static_cast<uint64_t>(now);
+  // Occupied slots of a level always come after the slot `now` is in, and
+  // the first occupied slot of a lower level comes before any slot of a higher
+  // one, so the first occupied slot of the lowest non-empty level is next.
+  for (int level = 0; level < kNumLevels; ++level) {
+    if (occupied[level] == 0) continue;
+    const int slot = absl::countr_zero(occupied[level]);
+    const int shift = level * kLevelBits;
+    *index = level * kSlotsPerLevel + slot;
+    return static_cast<int64_t>(
+        (current >> (shift + kLevelBits) << (shift + kLevelBits)) |
+        (static_cast<uint64_t>(slot) << shift));
+  }
+  if (!ListEmpty(&slots[kOverflowSlot])) {
+    const int shift = kNumLevels * kLevelBits;
+    *index = kOverflowSlot;
+    return static_cast<int64_t>(((current >> shift) + 1) << shift);
+  }
+  return kInfFutureMillis;
+}
+
+grpc_core::Timestamp TimerWheel::Shard::NextEvent() {
+  if (!ListEmpty(&slots[kExpiredSlot])) {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now);
+  }
+  size_t index;
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+      NextSlot(&index));
+}
+
+void TimerWheel::Shard::Advance(
+    int64_t target, std::vector<experimental::EventEngine::Closure*>* out) {
+  for (;;) {
+    Timer* expired = &slots[kExpiredSlot];
+    for (Timer* timer = expired->next; timer != expired; timer = timer->next) {
+      timer->pending = false;
+      out->push_back(timer->closure);
+    }
+    expired->next = expired->prev = expired;
+    size_t index;
+    const int64_t at = NextSlot(&index);
+    if (at > target) break;
+    // Detach the slot and re-file its timers as of `at`: each lands in a
+    // lower level, or in the expired list if it is due.
+    now = at;
+    Timer* head = &slots[index];
+    Timer* timer = head->next;
+    head->prev->next = nullptr;
+    head->next = head->prev = head;
+    if (index < kOverflowSlot) {
+      occupied[index / kSlotsPerLevel] &=
+          ~(uint64_t{1} << (index % kSlotsPerLevel));
+    }
+    while (timer != nullptr) {
+      Timer* next = timer->next;
+      Add(timer);
+      timer = next;
+    }
+  }
+  now = std::max(now, target);
+}
+
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(kInfFutureMillis),
+      shards_(new Shard[num_shards_]) {
+  const int64_t now = host_->Now().milliseconds_after_process_epoch();
+  for (size_t i = 0; i < num_shards_; i++) {
+    Shard& shard = shards_[i];
+    shard.now = now;
+    shard.min_deadline = grpc_core::Timestamp::InfFuture();
+  }
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  grpc_core::Timestamp next_event;
+  bool is_first_timer;
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    grpc_core::Timestamp old_next_event = shard->NextEvent();
+    shard->Add(timer);
+    next_event = shard->NextEvent();
+    is_first_timer = next_event < old_next_event;
+  }
+
+  // As in TimerList, a TimerCheck may slip in between the two critical
+  // sections; at worst that makes the update below unnecessary.
+  if (is_first_timer) {
+    grpc_core::MutexLock lock(&mu_);
+    if (next_event < shard->min_deadline) {
+      shard->min_deadline = next_event;
+      if (next_event.milliseconds_after_process_epoch() <
+          static_cast<int64_t>(min_timer_.load(std::memory_order_relaxed))) {
+        min_timer_.store(next_event.milliseconds_after_process_epoch(),
+                         std::memory_order_relaxed);
+        host_->Kick();
+      }
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  grpc_core::MutexLock lock(&shard->mu);
+  if (timer->pending) {
+    timer->pending = false;
+    shard->Remove(timer);
+    return true;
+  }
+  return false;
+}
+
+std::vector<experimental::EventEngine::Closure*> TimerWheel::FindExpiredTimers(
+    grpc_core::Timestamp now, grpc_core::Timestamp* next) {
+  std::vector<experimental::EventEngine::Closure*> done;
+  grpc_core::MutexLock lock(&mu_);
+  grpc_core::Timestamp min_deadline = grpc_core::Timestamp::InfFuture();
+  for (size_t i = 0; i < num_shards_; i++) {
+    Shard& shard = shards_[i];
+    if (shard.min_deadline <= now) {
+      grpc_core::MutexLock shard_lock(&shard.mu);
+      shard.Advance(now.milliseconds_after_process_epoch(), &done);
+      shard.min_deadline = shard.NextEvent();
+    }
+    min_deadline = std::min(min_deadline, shard.min_deadline);
+  }
+  if (next != nullptr) *next = std::min(*next, min_deadline);
+  min_timer_.store(min_deadline.milliseconds_after_process_epoch(),
+                   std::memory_order_relaxed);
+  return done;
+}
+
+std::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  grpc_core::Timestamp now = host_->Now();
+  grpc_core::Timestamp min_timer =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+          min_timer_.load(std::memory_order_relaxed));
+  if (now < min_timer) {
+    if (next != nullptr) *next = std::min(*next, min_timer);
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+  if (!checker_mu_.TryLock()) return std::nullopt;
+  std::vector<experimental::EventEngine::Closure*> run =
+      FindExpiredTimers(now, next);
+  checker_mu_.Unlock();
+  return std::move(run);
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,117 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine::experimental {
+
+// A hierarchical timing wheel: O(1) insertion and cancellation, for processes
+// holding many timers (deadlines, keepalives) that are nearly always
+// cancelled before they fire.
+//
+// Timers are sharded by address as in TimerList. Each shard has kNumLevels
+// wheels of kSlotsPerLevel slots with a resolution of one millisecond; a slot
+// of level L spans 64^L milliseconds. A timer is filed in the lowest level
+// whose current rotation contains its deadline. When time reaches the start
+// of a slot, the slot's timers are re-filed relative to the new time, which
+// moves each of them down at least one level; all timers in a level 0 slot
+// are due in the same millisecond. Timers too far out for the top level wait
+// in an overflow list that is re-filed every 64^kNumLevels milliseconds.
+class TimerWheel final : public TimerListInterface {
+ public:
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+  std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr int kLevelBits = 6;
+  static constexpr size_t kSlotsPerLevel = size_t{1} << kLevelBits;
+  static constexpr int kNumLevels = 6;
+  // Indices into Shard::slots, stored in Timer::heap_index. Wheel slot s of
+  // level L is at L * kSlotsPerLevel + s; the two lists follow.
+  static constexpr size_t kOverflowSlot = kNumLevels * kSlotsPerLevel;
+  static constexpr size_t kExpiredSlot = kOverflowSlot + 1;
+  static constexpr size_t kNumSlots = kExpiredSlot + 1;
+
+  struct Shard {
+    Shard();
+
+    // Files a timer in the slot its deadline maps to from `now`.
+    void Add(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void Remove(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Returns the earliest time at which a slot must be re-filed, and the
+    // slot's index in *index, or InfFuture if the wheel is empty. Ignores the
+    // expired list.
+    int64_t NextSlot(size_t* index) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // The earliest time at which Advance() has something to do.
+    grpc_core::Timestamp NextEvent() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Moves the wheel forward to `target`, appending the closures of all
+    // timers due by then to *out.
+    void Advance(int64_t target,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // The time the wheel has been advanced to. Pending timers due at or
+    // before it are in the expired list; all others are in the wheel.
+    int64_t now ABSL_GUARDED_BY(mu);
+    // Bit s of occupied[L] is set iff slot s of level L is non-empty.
+    uint64_t occupied[kNumLevels] ABSL_GUARDED_BY(mu) = {};
+    // List heads for the wheel slots, the overflow list and the expired list.
+    Timer slots[kNumSlots] ABSL_GUARDED_BY(mu);
+    // NextEvent() as of the last check of, or earlier insertion into, this
+    // shard.
+    grpc_core::Timestamp min_deadline ABSL_GUARDED_BY(&TimerWheel::mu_);
+  };
+
+  std::vector<experimental::EventEngine::Closure*> FindExpiredTimers(
+      grpc_core::Timestamp now, grpc_core::Timestamp* next);
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  grpc_core::Mutex mu_;
+  // The earliest min_deadline across all shards.
+  std::atomic<uint64_t> min_timer_;
+  // Allow only one FindExpiredTimers at once (used as a TryLock, protects no
+  // fields but ensures limits on concurrency)
+  grpc_core::Mutex checker_mu_;
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
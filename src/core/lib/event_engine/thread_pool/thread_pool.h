@@ -18,6 +18,7 @@
 #include <stddef.h>
 
 #include <memory>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 
@@ -44,6 +45,11 @@ class ThreadPool {
 // Creates a default thread pool.
 std::shared_ptr<ThreadPool> MakeThreadPool(size_t reserve_threads);
 
+// Creates a default thread pool whose threads only run on the given CPUs.
+// Pinning is best effort, and only implemented on Linux.
+std::shared_ptr<ThreadPool> MakeThreadPool(size_t reserve_threads,
+                                           std::vector<int> cpus);
+
 }  // namespace grpc_event_engine::experimental
 
 #endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_THREAD_POOL_H
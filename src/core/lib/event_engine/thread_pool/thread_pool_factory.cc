@@ -15,6 +15,8 @@
 #include <stddef.h>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
@@ -26,4 +28,10 @@ std::shared_ptr<ThreadPool> MakeThreadPool(size_t reserve_threads) {
   return thread_pool;
 }
 
+std::shared_ptr<ThreadPool> MakeThreadPool(size_t reserve_threads,
+                                           std::vector<int> cpus) {
+  return std::make_shared<WorkStealingThreadPool>(reserve_threads,
+                                                  std::move(cpus));
+}
+
 }  // namespace grpc_event_engine::experimental
@@ -19,14 +19,18 @@
 
 #include <grpc/support/port_platform.h>
 #include <grpc/support/thd_id.h>
+#include <errno.h>
 #include <inttypes.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
@@ -37,11 +41,13 @@
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
 #include "src/core/util/examine_stack.h"
+#include "src/core/util/strerror.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
 
@@ -51,6 +57,10 @@
 #include <signal.h>
 #endif
 
+#ifdef GPR_LINUX
+#include <sched.h>
+#endif
+
 // IWYU pragma: no_include <ratio>
 
 // ## Thread Pool Fork-handling
@@ -162,14 +172,35 @@ void DumpSignalHandler(int /* sig */) {
   grpc_core::Thread::Kill(gpr_thd_currentid());
 }
 
+// Restricts the calling thread to the given CPUs. Failures are logged and
+// otherwise ignored: the thread still works, it just may run anywhere.
+void PinCurrentThread(const std::vector<int>& cpus) {
+  if (cpus.empty()) return;
+#ifdef GPR_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+  }
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    LOG_EVERY_N_SEC(ERROR, 60)
+        << "Failed to pin thread pool thread: " << grpc_core::StrError(errno);
+  }
+#else
+  VLOG(2) << "Thread pool CPU pinning is not supported on this platform";
+#endif
+}
+
 }  // namespace
 
 thread_local WorkQueue* g_local_queue = nullptr;
 
 // -------- WorkStealingThreadPool --------
 
-WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads)
-    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads)} {
+WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads,
+                                               std::vector<int> cpus)
+    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads,
+                                                         std::move(cpus))} {
   if (g_log_verbose_failures) {
     GRPC_TRACE_LOG(event_engine, INFO)
         << "WorkStealingThreadPool verbose failures are enabled";
@@ -194,20 +225,54 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
 void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+  for (size_t i = 0; i < kMaxQueues; ++i) {
+    WorkQueue* expected = nullptr;
+    if (slots_[i].queue.compare_exchange_strong(expected, queue,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+      size_t num_slots = num_slots_.load(std::memory_order_relaxed);
+      while (num_slots <= i &&
+             !num_slots_.compare_exchange_weak(num_slots, i + 1,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+      }
+      return;
+    }
+  }
+  GRPC_TRACE_LOG(event_engine, INFO)
+      << "WorkStealingThreadPool: theft registry full, queue " << queue
+      << " can only be drained by its owner";
 }
 
 void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.erase(queue);
+  const size_t num_slots = num_slots_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < num_slots; ++i) {
+    Slot& slot = slots_[i];
+    if (slot.queue.load(std::memory_order_relaxed) != queue) continue;
+    // Pairs with the thieves' increment-then-load in StealOne: either a
+    // thief sees nullptr, or this sees its count and waits for it to leave.
+    slot.queue.store(nullptr, std::memory_order_seq_cst);
+    while (slot.thieves.load(std::memory_order_seq_cst) != 0) {
+      std::this_thread::yield();
+    }
+    return;
+  }
 }
 
 EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
-  grpc_core::MutexLock lock(&mu_);
-  EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
-    closure = queue->PopMostRecent();
+  const size_t count = num_slots_.load(std::memory_order_acquire);
+  if (count == 0) return nullptr;
+  const size_t start = next_victim_.fetch_add(1, std::memory_order_relaxed);
+  for (size_t i = 0; i < count; ++i) {
+    Slot& slot = slots_[(start + i) % count];
+    if (slot.queue.load(std::memory_order_relaxed) == nullptr) continue;
+    slot.thieves.fetch_add(1, std::memory_order_seq_cst);
+    WorkQueue* queue = slot.queue.load(std::memory_order_seq_cst);
+    // Only the owning thread may pop the most recent closure of a local queue,
+    // thieves take the oldest one.
+    EventEngine::Closure* closure =
+        queue == nullptr ? nullptr : queue->PopOldest();
+    slot.thieves.fetch_sub(1, std::memory_order_release);
     if (closure != nullptr) return closure;
   }
   return nullptr;
@@ -224,8 +289,8 @@ void WorkStealingThreadPool::PostFork() { pool_->Postfork(); }
 // -------- WorkStealingThreadPool::WorkStealingThreadPoolImpl --------
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
-    size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    size_t reserve_threads, std::vector<int> cpus)
+    : reserve_threads_(reserve_threads), cpus_(std::move(cpus)), queue_(this) {}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -491,7 +556,8 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
-  g_local_queue = new BasicWorkQueue(pool_.get());
+  PinCurrentThread(pool_->cpus());
+  g_local_queue = new ChaseLevWorkQueue(pool_.get());
   pool_->theft_registry()->Enroll(g_local_queue);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
@@ -24,8 +24,10 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <array>
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
@@ -43,7 +45,9 @@ namespace grpc_event_engine::experimental {
 
 class WorkStealingThreadPool final : public ThreadPool {
  public:
-  explicit WorkStealingThreadPool(size_t reserve_threads);
+  // If cpus is not empty, every thread of the pool is pinned to those CPUs.
+  explicit WorkStealingThreadPool(size_t reserve_threads,
+                                  std::vector<int> cpus = {});
   // Asserts Quiesce was called.
   ~WorkStealingThreadPool() override;
   // Shut down the pool, and wait for all threads to exit.
@@ -80,19 +84,36 @@ class WorkStealingThreadPool final : public ThreadPool {
   // Every worker thread registers and unregisters its thread-local thread pool
   // here, and steals closures from other threads when work is otherwise
   // unavailable.
+  //
+  // Victims are kept in a fixed array of atomic slots, so thieves take no
+  // lock; the queues themselves are lock-free too.  A thief announces itself
+  // on a slot before reading its queue, and Unenroll waits for the slot's
+  // thieves to leave, so a queue may be destroyed once it is unenrolled.
   class TheftRegistry {
    public:
     // Allow any member of the registry to steal from the provided queue.
-    void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    // If every slot is taken, the queue is only drained by its owner.
+    void Enroll(WorkQueue* queue);
     // Disallow work stealing from the provided queue.
-    void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Unenroll(WorkQueue* queue);
     // Returns one closure from another thread, or nullptr if none are
     // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    EventEngine::Closure* StealOne();
 
    private:
-    grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    static constexpr size_t kMaxQueues = 256;
+
+    struct Slot {
+      std::atomic<WorkQueue*> queue{nullptr};
+      // Thieves currently looking at queue.
+      std::atomic<size_t> thieves{0};
+    } GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE);
+
+    std::array<Slot, kMaxQueues> slots_;
+    // One past the highest slot ever used, bounding the thieves' scan.
+    std::atomic<size_t> num_slots_{0};
+    // Rotates the first victim so thieves spread out over the queues.
+    std::atomic<size_t> next_victim_{0};
   };
 
   // An implementation of the ThreadPool
@@ -102,7 +123,7 @@ class WorkStealingThreadPool final : public ThreadPool {
   class WorkStealingThreadPoolImpl
       : public std::enable_shared_from_this<WorkStealingThreadPoolImpl> {
    public:
-    explicit WorkStealingThreadPoolImpl(size_t reserve_threads);
+    WorkStealingThreadPoolImpl(size_t reserve_threads, std::vector<int> cpus);
     // Start all threads.
     void Start();
     // Add a closure to a work queue, preferably a thread-local queue if
@@ -138,6 +159,7 @@ class WorkStealingThreadPool final : public ThreadPool {
     bool IsForking();
     bool IsQuiesced();
     size_t reserve_threads() { return reserve_threads_; }
+    const std::vector<int>& cpus() { return cpus_; }
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
     TheftRegistry* theft_registry() { return &theft_registry_; }
@@ -173,6 +195,7 @@ class WorkStealingThreadPool final : public ThreadPool {
     void DumpStacksAndCrash();
 
     const size_t reserve_threads_;
+    const std::vector<int> cpus_;
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
     TheftRegistry theft_registry_;
@@ -0,0 +1,134 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "src/core/lib/event_engine/common_closures.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+// Must be a power of two.
+constexpr int64_t kInitialCapacity = 64;
+}  // namespace
+
+// A fixed-size ring of closure pointers, indexed modulo its capacity.
+class ChaseLevWorkQueue::Buffer {
+ public:
+  explicit Buffer(int64_t capacity)
+      : mask_(capacity - 1),
+        slots_(new std::atomic<EventEngine::Closure*>[capacity]) {}
+
+  int64_t capacity() const { return mask_ + 1; }
+
+  EventEngine::Closure* Get(int64_t index) const {
+    return slots_[index & mask_].load(std::memory_order_relaxed);
+  }
+
+  void Put(int64_t index, EventEngine::Closure* closure) {
+    slots_[index & mask_].store(closure, std::memory_order_relaxed);
+  }
+
+ private:
+  const int64_t mask_;
+  std::unique_ptr<std::atomic<EventEngine::Closure*>[]> slots_;
+};
+
+ChaseLevWorkQueue::ChaseLevWorkQueue(void* owner) : owner_(owner) {
+  buffers_.push_back(std::make_unique<Buffer>(kInitialCapacity));
+  buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+}
+
+ChaseLevWorkQueue::~ChaseLevWorkQueue() = default;
+
+bool ChaseLevWorkQueue::Empty() const { return Size() == 0; }
+
+size_t ChaseLevWorkQueue::Size() const {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  int64_t top = top_.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopMostRecent() {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  // Reserve the bottom slot before looking at top, so a concurrent thief
+  // either sees the reservation or is seen by us.
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  int64_t top = top_.load(std::memory_order_seq_cst);
+  if (top > bottom) {
+    // Empty: undo the reservation.
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  EventEngine::Closure* closure = buffer->Get(bottom);
+  if (top == bottom) {
+    // Last element: race any thieves for it.
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      closure = nullptr;
+    }
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return closure;
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopOldest() {
+  int64_t top = top_.load(std::memory_order_seq_cst);
+  int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return nullptr;
+  // The acquire pairs with the release in Grow, so the slot read below sees
+  // the copied element if the buffer was just replaced.
+  Buffer* buffer = buffer_.load(std::memory_order_acquire);
+  EventEngine::Closure* closure = buffer->Get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    // Lost the race to the owner or another thief.
+    return nullptr;
+  }
+  return closure;
+}
+
+void ChaseLevWorkQueue::Add(EventEngine::Closure* closure) {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  int64_t top = top_.load(std::memory_order_acquire);
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  if (bottom - top > buffer->capacity() - 1) {
+    buffer = Grow(buffer, top, bottom);
+  }
+  buffer->Put(bottom, closure);
+  // Publishes both the slot and the closure's contents to thieves.
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+void ChaseLevWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  Add(SelfDeletingClosure::Create(std::move(invocable)));
+}
+
+ChaseLevWorkQueue::Buffer* ChaseLevWorkQueue::Grow(Buffer* buffer, int64_t top,
+                                                    int64_t bottom) {
+  auto grown = std::make_unique<Buffer>(buffer->capacity() * 2);
+  for (int64_t i = top; i < bottom; ++i) {
+    grown->Put(i, buffer->Get(i));
+  }
+  Buffer* result = grown.get();
+  buffers_.push_back(std::move(grown));
+  buffer_.store(result, std::memory_order_release);
+  return result;
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,82 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+
+namespace grpc_event_engine::experimental {
+
+// A lock-free work-stealing deque, after Chase & Lev, "Dynamic Circular
+// Work-Stealing Deque" (SPAA 2005), using the memory orderings of Lê et al.,
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+//
+// Unlike the generic WorkQueue contract, this queue has a single owner thread:
+// Add and PopMostRecent must only be called by the owner, while PopOldest
+// (stealing), Empty and Size may be called from any thread. Empty and Size are
+// snapshots and may be stale by the time they return.
+//
+// Implementation note: the owner pushes and pops at the bottom, thieves take
+// from the top. The ring buffer grows by doubling when full; retired buffers
+// are kept alive until the queue is destroyed since a concurrent thief may
+// still be reading from them.
+class ChaseLevWorkQueue : public WorkQueue {
+ public:
+  ChaseLevWorkQueue() : ChaseLevWorkQueue(nullptr) {}
+  explicit ChaseLevWorkQueue(void* owner);
+  ~ChaseLevWorkQueue() override;
+  // Returns whether the queue is empty
+  bool Empty() const override;
+  // Returns the size of the queue.
+  size_t Size() const override;
+  // Returns the most recent element from the queue, or nullptr if empty or the
+  // last element was stolen concurrently. Owner thread only.
+  EventEngine::Closure* PopMostRecent() override;
+  // Returns the oldest element from the queue, or nullptr if empty or another
+  // thread won the race for it. Safe to call from any thread.
+  EventEngine::Closure* PopOldest() override;
+  // Adds a closure to the queue. Owner thread only.
+  void Add(EventEngine::Closure* closure) override;
+  // Wraps an AnyInvocable and adds it to the the queue. Owner thread only.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  class Buffer;
+
+  // Replaces the current buffer with one twice as large holding the elements
+  // in [top, bottom). Returns the new buffer.
+  Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom);
+
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> top_{0};
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> bottom_{0};
+  std::atomic<Buffer*> buffer_;
+  // Every buffer ever allocated by this queue, the current one last. Only
+  // touched by the owner.
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+  const void* const owner_ = nullptr;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
@@ -85,6 +85,15 @@ static bool is(absl::string_view want, absl::string_view have) {
 }
 
 static void try_engine(absl::string_view engine) {
+  // io_uring only exists as an EventEngine poller. iomgr is still in charge of
+  // polling whenever the EventEngine client/listener experiments are off, so
+  // serve the request with the engine the io_uring poller itself falls back to
+  // instead of leaving "io_uring" unmatched.
+  if (engine == "io_uring") {
+    GRPC_TRACE_VLOG(polling_api, 2)
+        << "io_uring is EventEngine-only; iomgr polls with epoll1 instead";
+    engine = "epoll1";
+  }
   for (size_t i = 0; i < GPR_ARRAY_SIZE(g_vtables); i++) {
     if (g_vtables[i] != nullptr && is(engine, g_vtables[i]->name) &&
         g_vtables[i]->check_engine_available(engine == g_vtables[i]->name)) {
@@ -63,6 +63,16 @@
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
+// Linux has TCP_ZEROCOPY_RECEIVE support since 4.18. Whether it works for a
+// given socket is only known at runtime.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 18, 0)
+#define GRPC_LINUX_TCP_ZEROCOPY_RECEIVE 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 18, 0)
+// Kernel TLS with TLS 1.3 and AES-256-GCM support (and the <linux/tls.h>
+// definitions for them) arrived in 5.1.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 1, 0)
+#define GRPC_LINUX_KTLS 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(5, 1, 0)
 #endif  // LINUX_VERSION_CODE
 #if defined(LINUX_VERSION_CODE) && defined(__GLIBC_PREREQ)
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 9, 0) && __GLIBC_PREREQ(2, 18)
@@ -99,6 +109,13 @@
 #define GRPC_LINUX_EVENTFD 1
 #define GRPC_MSG_IOVLEN_TYPE int
 #endif
+// io_uring is probed at runtime since the kernel may be older than the
+// headers the library was built against.
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define GRPC_LINUX_IO_URING 1
+#endif
+#endif
 #ifndef GRPC_LINUX_EVENTFD
 #define GRPC_POSIX_NO_SPECIAL_WAKEUP_FD 1
 #endif
@@ -58,6 +58,207 @@ GRPC_MUST_USE_RESULT bool Party::RefIfNonZero() {
   return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Party::OverflowBlock
+
+// A block of participants held beyond the fixed slots of a growable party.
+// A participant has a bit in allocated_ while it holds a slot, and in
+// pending_ while it is waiting to be polled. Wakers for these participants
+// wake the block, with the participant's slot as the wakeup mask: the block
+// marks the participant pending and then wakes the party's overflow slot.
+class Party::OverflowBlock final : public Wakeable {
+ public:
+  static constexpr size_t kSlots = 64;
+
+  explicit OverflowBlock(Party* party) : party_(party) {}
+
+  OverflowBlock(const OverflowBlock&) = delete;
+  OverflowBlock& operator=(const OverflowBlock&) = delete;
+
+  // Claim a slot for participant and wake it. Returns false if the block is
+  // full. Thread safe.
+  bool TryAdd(Participant* participant) {
+    uint64_t allocated = allocated_.load(std::memory_order_relaxed);
+    uint64_t bit;
+    do {
+      if (allocated == ~uint64_t{0}) return false;
+      bit = LowestOneBit(~allocated);
+    } while (!allocated_.compare_exchange_weak(allocated, allocated | bit,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_relaxed));
+    const WakeupMask slot = absl::countr_zero(bit);
+    slots_[slot].store(participant, std::memory_order_release);
+    // As in AddParticipant: the ref is consumed by the wakeup.
+    party_->IncrementRefCount();
+    Wakeup(slot);
+    return true;
+  }
+
+  void SetPending(WakeupMask slot) {
+    pending_.fetch_or(uint64_t{1} << slot, std::memory_order_acq_rel);
+  }
+  void SetAllPending() {
+    pending_.fetch_or(allocated_.load(std::memory_order_acquire),
+                      std::memory_order_acq_rel);
+  }
+  uint64_t TakePending() {
+    return pending_.exchange(0, std::memory_order_acq_rel);
+  }
+
+  Participant* participant(size_t slot) {
+    return slots_[slot].load(std::memory_order_acquire);
+  }
+
+  // Free the slot of a completed participant. Party must be locked.
+  void Remove(size_t slot) {
+    slots_[slot].store(nullptr, std::memory_order_relaxed);
+    allocated_.fetch_and(~(uint64_t{1} << slot), std::memory_order_release);
+  }
+
+  // Destroy the remaining participants. Party must be locked.
+  void DestroyParticipants() {
+    for (auto& slot : slots_) {
+      if (auto* p = slot.exchange(nullptr, std::memory_order_acquire)) {
+        p->Destroy();
+      }
+    }
+    allocated_.store(0, std::memory_order_relaxed);
+  }
+
+  void AppendParticipants(channelz::PropertyTable& table) {
+    for (auto& slot : slots_) {
+      if (auto* p = slot.load(std::memory_order_acquire)) {
+        table.AppendRow(p->ChannelzProperties());
+      }
+    }
+  }
+
+  std::atomic<OverflowBlock*>& next() { return next_; }
+
+  // Wakeable implementation: as for the party, but for one participant.
+  void Wakeup(WakeupMask slot) override {
+    SetPending(slot);
+    party_->Wakeup(kOverflowWakeupMask);
+  }
+  void WakeupAsync(WakeupMask slot) override {
+    SetPending(slot);
+    party_->WakeupAsync(kOverflowWakeupMask);
+  }
+  void Drop(WakeupMask) override { party_->Unref(); }
+  std::string ActivityDebugTag(WakeupMask) const override {
+    return party_->DebugTag();
+  }
+
+ private:
+  Party* const party_;
+  std::atomic<uint64_t> allocated_{0};
+  std::atomic<uint64_t> pending_{0};
+  std::atomic<Participant*> slots_[kSlots] = {};
+  std::atomic<OverflowBlock*> next_{nullptr};
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Party::OverflowParticipants
+
+// Occupies the overflow slot of a growable party. Holds the chain of
+// OverflowBlocks, and when the slot is woken polls the participants that are
+// pending. Never completes: it lives as long as the party.
+class Party::OverflowParticipants final : public Participant {
+ public:
+  explicit OverflowParticipants(Party* party) : party_(party), first_(party) {}
+
+  // Add a participant to the first block with a free slot, growing the chain
+  // if every block is full. Thread safe.
+  void Add(Participant* participant) {
+    OverflowBlock* block = &first_;
+    while (!block->TryAdd(participant)) {
+      OverflowBlock* next = block->next().load(std::memory_order_acquire);
+      if (next == nullptr) {
+        auto* fresh = new OverflowBlock(party_);
+        if (block->next().compare_exchange_strong(next, fresh,
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_acquire)) {
+          next = fresh;
+        } else {
+          delete fresh;
+        }
+      }
+      block = next;
+    }
+  }
+
+  // Mark every participant pending: used when a wakeup names the overflow
+  // slot rather than a participant within it.
+  void SetAllPending() {
+    for (OverflowBlock* block = &first_; block != nullptr;
+         block = block->next().load(std::memory_order_acquire)) {
+      block->SetAllPending();
+    }
+  }
+
+  Waker MakeOwningWaker() {
+    DCHECK_NE(polling_block_, nullptr);
+    return Waker(polling_block_, polling_slot_);
+  }
+
+  Waker MakeNonOwningWaker(Party* party) {
+    DCHECK_NE(polling_block_, nullptr);
+    return Waker(polling_block_->participant(polling_slot_)
+                     ->MakeNonOwningWakeable(party, polling_block_),
+                 polling_slot_);
+  }
+
+  bool PollParticipantPromise() override {
+    GRPC_LATENT_SEE_SCOPE("Party::OverflowParticipants::Poll");
+    for (OverflowBlock* block = &first_; block != nullptr;
+         block = block->next().load(std::memory_order_acquire)) {
+      uint64_t pending = block->TakePending();
+      while (pending != 0) {
+        const uint64_t bit = LowestOneBit(pending);
+        const WakeupMask slot = absl::countr_zero(bit);
+        pending ^= bit;
+        auto* participant = block->participant(slot);
+        // As with the fixed slots, wakeups can outlive their participant.
+        if (participant == nullptr) continue;
+        polling_block_ = block;
+        polling_slot_ = slot;
+        if (participant->PollParticipantPromise()) block->Remove(slot);
+      }
+    }
+    polling_block_ = nullptr;
+    return false;
+  }
+
+  void Destroy() override {
+    first_.DestroyParticipants();
+    OverflowBlock* block = first_.next().load(std::memory_order_acquire);
+    while (block != nullptr) {
+      block->DestroyParticipants();
+      OverflowBlock* next = block->next().load(std::memory_order_acquire);
+      delete block;
+      block = next;
+    }
+    Destruct(this);
+  }
+
+  channelz::PropertyList ChannelzProperties() override {
+    channelz::PropertyTable participants;
+    for (OverflowBlock* block = &first_; block != nullptr;
+         block = block->next().load(std::memory_order_acquire)) {
+      block->AppendParticipants(participants);
+    }
+    return channelz::PropertyList().Set("overflow_participants",
+                                        std::move(participants));
+  }
+
+ private:
+  Party* const party_;
+  OverflowBlock first_;
+  // The participant being polled, if any.
+  OverflowBlock* polling_block_ = nullptr;
+  WakeupMask polling_slot_ = 0;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // Party::Handle
 
@@ -65,7 +266,7 @@ GRPC_MUST_USE_RESULT bool Party::RefIfNonZero() {
 // Handle can persist while Party goes away.
 class Party::Handle final : public Wakeable {
  public:
-  explicit Handle(Party* party) : party_(party) {}
+  Handle(Party* party, OverflowBlock* block) : block_(block), party_(party) {}
 
   // Ref the Handle (not the activity).
   void Ref() { refs_.fetch_add(1, std::memory_order_relaxed); }
@@ -89,6 +290,12 @@ class Party::Handle final : public Wakeable {
     Party* party = party_;
     if (party != nullptr && party->RefIfNonZero()) {
       mu_.Unlock();
+      // The participant is held in an overflow block: the wakeup mask is its
+      // slot in the block.
+      if (block_ != nullptr) {
+        block_->SetPending(wakeup_mask);
+        wakeup_mask = kOverflowWakeupMask;
+      }
       // Activity still exists and we have a reference: wake it up, which will
       // drop the ref.
       (party->*wakeup_method)(wakeup_mask);
@@ -129,6 +336,8 @@ class Party::Handle final : public Wakeable {
   // Two initial refs: one for the waiter that caused instantiation, one for the
   // party.
   std::atomic<size_t> refs_{2};
+  // Lives as long as the party.
+  OverflowBlock* const block_;
   mutable Mutex mu_;
   Party* party_ ABSL_GUARDED_BY(mu_);
 };
@@ -136,9 +345,10 @@ class Party::Handle final : public Wakeable {
 ///////////////////////////////////////////////////////////////////////////////
 // Party::Participant
 
-Wakeable* Party::Participant::MakeNonOwningWakeable(Party* party) {
+Wakeable* Party::Participant::MakeNonOwningWakeable(Party* party,
+                                                    OverflowBlock* block) {
   if (handle_ == nullptr) {
-    handle_ = new Handle(party);
+    handle_ = new Handle(party, block);
     return handle_;
   }
   handle_->Ref();
@@ -261,11 +471,17 @@ std::string Party::ActivityDebugTag(WakeupMask wakeup_mask) const {
 Waker Party::MakeOwningWaker() {
   DCHECK(currently_polling_ != kNotPolling);
   IncrementRefCount();
+  if (growable_ && currently_polling_ == kOverflowSlot) {
+    return overflow()->MakeOwningWaker();
+  }
   return Waker(this, 1u << currently_polling_);
 }
 
 Waker Party::MakeNonOwningWaker() {
   DCHECK(currently_polling_ != kNotPolling);
+  if (growable_ && currently_polling_ == kOverflowSlot) {
+    return overflow()->MakeNonOwningWaker(this);
+  }
   return Waker(participants_[currently_polling_]
                    .load(std::memory_order_relaxed)
                    ->MakeNonOwningWakeable(this),
@@ -274,6 +490,11 @@ Waker Party::MakeNonOwningWaker() {
 
 void Party::ForceImmediateRepoll(WakeupMask mask) {
   DCHECK(is_current());
+  // The mask does not say which overflow participant to repoll, so repoll
+  // them all: spurious polls are harmless.
+  if (growable_ && (mask & kOverflowWakeupMask) != 0) {
+    overflow()->SetAllPending();
+  }
   wakeup_mask_ |= mask;
 }
 
@@ -518,6 +739,10 @@ size_t Party::AddParticipant(Participant* participant) {
 void Party::MaybeAsyncAddParticipant(Participant* participant) {
   const size_t slot = AddParticipant(participant);
   if (slot != std::numeric_limits<size_t>::max()) return;
+  if (growable_) {
+    overflow()->Add(participant);
+    return;
+  }
   // We need to delay the addition of participants.
   IncrementRefCount();
   VLOG_EVERY_N_SEC(2, 10) << "Delaying addition of participant to party "
@@ -530,6 +755,25 @@ void Party::MaybeAsyncAddParticipant(Participant* participant) {
       });
 }
 
+void Party::EnableOverflow() {
+  DCHECK(!growable_);
+  auto* const overflow = arena_->New<OverflowParticipants>(this);
+  // Nothing else can have been spawned yet, so the slot is free.
+  const uint64_t prev_state = state_.fetch_or(
+      uint64_t{kOverflowWakeupMask} << kAllocatedShift,
+      std::memory_order_acq_rel);
+  CHECK_EQ(prev_state & (uint64_t{kOverflowWakeupMask} << kAllocatedShift),
+           0u);
+  participants_[kOverflowSlot].store(overflow, std::memory_order_release);
+  growable_ = true;
+}
+
+Party::OverflowParticipants* Party::overflow() const {
+  DCHECK(growable_);
+  return static_cast<OverflowParticipants*>(
+      participants_[kOverflowSlot].load(std::memory_order_relaxed));
+}
+
 void Party::WakeupAsync(WakeupMask wakeup_mask) {
   // Or in the wakeup bit for the participant, AND the locked bit.
   uint64_t prev_state = state_.load(std::memory_order_relaxed);
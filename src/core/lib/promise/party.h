@@ -160,6 +160,9 @@ class Party : public Activity, private Wakeable {
  private:
   // Non-owning wakeup handle.
   class Handle;
+  // Participants beyond the fixed slots of a growable party.
+  class OverflowBlock;
+  class OverflowParticipants;
 
   // One promise participant in the party.
   class Participant {
@@ -174,8 +177,10 @@ class Party : public Activity, private Wakeable {
     // Return a description of this participant.
     virtual channelz::PropertyList ChannelzProperties() = 0;
 
-    // Return a Handle instance for this participant.
-    Wakeable* MakeNonOwningWakeable(Party* party);
+    // Return a Handle instance for this participant. Participants held in an
+    // OverflowBlock are woken through that block.
+    Wakeable* MakeNonOwningWakeable(Party* party,
+                                    OverflowBlock* block = nullptr);
 
    protected:
     ~Participant();
@@ -194,6 +199,18 @@ class Party : public Activity, private Wakeable {
     return RefCountedPtr<Party>(arena_ptr->New<Party>(std::move(arena)));
   }
 
+  // As Make(), but the party can hold any number of participants. The last
+  // participant slot is given over to a lock-free chain of blocks, each
+  // holding up to 64 participants with their own wakeup bits, so spawning
+  // onto a party with every slot taken does not wait for a slot to free up.
+  // Useful for parties expected to run many promises at once (eg. streaming
+  // calls with many interceptors and per-message promises).
+  static RefCountedPtr<Party> MakeGrowable(RefCountedPtr<Arena> arena) {
+    auto party = Make(std::move(arena));
+    party->EnableOverflow();
+    return party;
+  }
+
   // When calling into a Party from outside the promises system we often would
   // like to perform more than one action.
   // This class tries to acquire the party lock just once - if it succeeds then
@@ -335,8 +352,9 @@ class Party : public Activity, private Wakeable {
   // promise is created - so the promise should not retain any of these.
   // This function is thread safe. We can Spawn different promises onto the
   // same party from different threads.
-  // A party can hold upto 16 unresolved promises at a time. However, this
-  // number might change in the future.
+  // A party can hold upto 16 unresolved promises at a time, or any number if
+  // it was made with MakeGrowable(). However, this number might change in the
+  // future.
   template <typename Factory, typename OnComplete>
   void Spawn(absl::string_view name, Factory promise_factory,
              OnComplete on_complete);
@@ -605,6 +623,9 @@ class Party : public Activity, private Wakeable {
 
   // Shift to get from a participant mask to an allocated mask.
   static constexpr size_t kAllocatedShift = 16;
+  // Slot holding the OverflowParticipants of a growable party.
+  static constexpr size_t kOverflowSlot = party_detail::kMaxParticipants - 1;
+  static constexpr WakeupMask kOverflowWakeupMask = 1u << kOverflowSlot;
   // How far to shift to get the refcount
   static constexpr size_t kRefShift = 40;
   // One ref count
@@ -677,6 +698,9 @@ class Party : public Activity, private Wakeable {
   // Add a participant (backs Spawn, after type erasure to ParticipantFactory).
   size_t AddParticipant(Participant* participant);
   void MaybeAsyncAddParticipant(Participant* participant);
+  // Give the last participant slot to an OverflowParticipants.
+  void EnableOverflow();
+  OverflowParticipants* overflow() const;
 
   static uint64_t NextAllocationMask(uint64_t current_allocation_mask);
 
@@ -697,6 +721,8 @@ class Party : public Activity, private Wakeable {
   std::atomic<uint64_t> state_{kOneRef};
   uint8_t currently_polling_ = kNotPolling;
   WakeupMask wakeup_mask_ = 0;
+  // True if made with MakeGrowable().
+  bool growable_ = false;
   // All current participants, using a tagged format.
   // If the lower bit is unset, then this is a Participant*.
   // If the lower bit is set, then this is a ParticipantFactory*.
@@ -123,6 +123,15 @@ class ArenaFactory : public RefCounted<ArenaFactory> {
   virtual RefCountedPtr<Arena> MakeArena() = 0;
   virtual void FinalizeArena(Arena* arena) = 0;
 
+  // Allocate storage for an arena whose initial zone (including the arena
+  // itself) is *size bytes, and reserve it from allocator(). Factories that
+  // recycle storage may return a larger block, updating *size to match.
+  virtual void* AllocateArenaStorage(size_t& size);
+  // Return storage from AllocateArenaStorage() once its arena is destroyed,
+  // along with the `reserved` bytes the arena held: its storage, and any
+  // further zones it allocated.
+  virtual void FreeArenaStorage(void* storage, size_t size, size_t reserved);
+
   MemoryAllocator& allocator() { return allocator_; }
 
  protected:
@@ -348,7 +357,7 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
   explicit Arena(size_t initial_size,
                  RefCountedPtr<ArenaFactory> arena_factory);
 
-  ~Arena();
+  ~Arena() = default;
 
   void* AllocZone(size_t size);
   void Destroy() const;
@@ -18,6 +18,8 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <utility>
+
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -65,6 +67,31 @@ EvaluateArgs::PerChannelArgs::Address ParseEndpointUri(
 
 }  // namespace
 
+EvaluateArgs::PerChannelArgs::ConnectionCache::PrincipalResults
+EvaluateArgs::PerChannelArgs::ConnectionCache::GetPrincipalResults(
+    uint64_t engine_id) {
+  MutexLock lock(&mu_);
+  for (const auto& entry : entries_) {
+    if (entry.first == engine_id) return entry.second;
+  }
+  return nullptr;
+}
+
+void EvaluateArgs::PerChannelArgs::ConnectionCache::SetPrincipalResults(
+    uint64_t engine_id, PrincipalResults results) {
+  MutexLock lock(&mu_);
+  for (auto& entry : entries_) {
+    if (entry.first == engine_id) {
+      entry.second = std::move(results);
+      return;
+    }
+  }
+  // Engines are replaced when policies are updated, so evicting the oldest
+  // entry drops results for stale engines first.
+  entries_[next_entry_] = {engine_id, std::move(results)};
+  next_entry_ = (next_entry_ + 1) % kMaxEngines;
+}
+
 EvaluateArgs::PerChannelArgs::PerChannelArgs(grpc_auth_context* auth_context,
                                              const ChannelArgs& args) {
   if (auth_context != nullptr) {
@@ -130,6 +157,16 @@ std::optional<absl::string_view> EvaluateArgs::GetHeaderValue(
   return metadata_->GetStringValue(key, concatenated_value);
 }
 
+std::optional<absl::string_view> EvaluateArgs::GetMemoizedHeaderValue(
+    absl::string_view key) const {
+  auto it = header_values_.find(key);
+  if (it == header_values_.end()) {
+    it = header_values_.emplace(std::string(key), HeaderValue()).first;
+    it->second.value = GetHeaderValue(key, &it->second.concatenated);
+  }
+  return it->second.value;
+}
+
 grpc_resolved_address EvaluateArgs::GetLocalAddress() const {
   if (channel_args_ == nullptr) {
     return {};
@@ -214,4 +251,12 @@ absl::string_view EvaluateArgs::GetSubject() const {
   return channel_args_->subject;
 }
 
+EvaluateArgs::PerChannelArgs::ConnectionCache*
+EvaluateArgs::GetConnectionCache() const {
+  if (channel_args_ == nullptr) {
+    return nullptr;
+  }
+  return channel_args_->connection_cache.get();
+}
+
 }  // namespace grpc_core
@@ -17,15 +17,22 @@
 
 #include <grpc/grpc_security.h>
 #include <grpc/support/port_platform.h>
+#include <stdint.h>
 
+#include <functional>
+#include <map>
+#include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -42,6 +49,26 @@ class EvaluateArgs final {
       int port = 0;
     };
 
+    // Results that depend only on the connection, computed by authorization
+    // engines on first use and shared by every call on the connection. Keyed
+    // by engine ID; only a few engines are remembered at a time.
+    class ConnectionCache {
+     public:
+      using PrincipalResults = std::shared_ptr<const std::vector<bool>>;
+
+      // Returns null if nothing is cached for the engine.
+      PrincipalResults GetPrincipalResults(uint64_t engine_id);
+      void SetPrincipalResults(uint64_t engine_id, PrincipalResults results);
+
+     private:
+      static constexpr size_t kMaxEngines = 8;
+
+      Mutex mu_;
+      std::pair<uint64_t, PrincipalResults> entries_[kMaxEngines]
+          ABSL_GUARDED_BY(mu_);
+      size_t next_entry_ ABSL_GUARDED_BY(mu_) = 0;
+    };
+
     PerChannelArgs(grpc_auth_context* auth_context, const ChannelArgs& args);
 
     absl::string_view transport_security_type;
@@ -52,11 +79,20 @@ class EvaluateArgs final {
     absl::string_view subject;
     Address local_address;
     Address peer_address;
+    // Held by pointer so that PerChannelArgs stays movable.
+    std::unique_ptr<ConnectionCache> connection_cache =
+        std::make_unique<ConnectionCache>();
   };
 
   EvaluateArgs(grpc_metadata_batch* metadata, PerChannelArgs* channel_args)
       : metadata_(metadata), channel_args_(channel_args) {}
 
+  // Header values are memoized by address, so this may not be copied.
+  EvaluateArgs(const EvaluateArgs&) = delete;
+  EvaluateArgs& operator=(const EvaluateArgs&) = delete;
+  EvaluateArgs(EvaluateArgs&&) = default;
+  EvaluateArgs& operator=(EvaluateArgs&&) = default;
+
   absl::string_view GetPath() const;
   absl::string_view GetAuthority() const;
   absl::string_view GetMethod() const;
@@ -69,6 +105,11 @@ class EvaluateArgs final {
   // string_view of that string.
   std::optional<absl::string_view> GetHeaderValue(
       absl::string_view key, std::string* concatenated_value) const;
+  // Same as above, but remembers the value so that later lookups of the same
+  // key (e.g. by other policies' header matchers) do not search the metadata
+  // again. The returned view is valid for the lifetime of this object.
+  std::optional<absl::string_view> GetMemoizedHeaderValue(
+      absl::string_view key) const;
 
   grpc_resolved_address GetLocalAddress() const;
   absl::string_view GetLocalAddressString() const;
@@ -82,10 +123,21 @@ class EvaluateArgs final {
   std::vector<absl::string_view> GetDnsSans() const;
   absl::string_view GetCommonName() const;
   absl::string_view GetSubject() const;
+  // Returns null if there are no per-channel args.
+  PerChannelArgs::ConnectionCache* GetConnectionCache() const;
 
  private:
+  struct HeaderValue {
+    std::optional<absl::string_view> value;
+    // Backs value when the key has more than one value.
+    std::string concatenated;
+  };
+
   grpc_metadata_batch* metadata_;
   PerChannelArgs* channel_args_;
+  // Typically holds a handful of keys. Map nodes never move, so views into
+  // `concatenated` stay valid.
+  mutable std::map<std::string, HeaderValue, std::less<>> header_values_;
 };
 
 }  // namespace grpc_core
@@ -17,10 +17,16 @@
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
+#include "absl/types/span.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/lib/security/authorization/authorization_engine.h"
 
@@ -32,6 +38,12 @@ using experimental::AuditLoggerRegistry;
 namespace {
 
 using Decision = AuthorizationEngine::Decision;
+using ConnectionCache = EvaluateArgs::PerChannelArgs::ConnectionCache;
+
+uint64_t NextEngineId() {
+  static std::atomic<uint64_t> next_id{1};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
 
 bool ShouldLog(const Decision& decision,
                const Rbac::AuditCondition& condition) {
@@ -42,18 +54,85 @@ bool ShouldLog(const Decision& decision,
           condition == Rbac::AuditCondition::kOnDeny);
 }
 
+// Returns whether the permission requires a case-sensitive exact path.
+bool IsExactPath(const Rbac::Permission& permission) {
+  // An empty path never matches, so it cannot be looked up.
+  return permission.type == Rbac::Permission::RuleType::kPath &&
+         permission.string_matcher.type() == StringMatcher::Type::kExact &&
+         permission.string_matcher.case_sensitive() &&
+         !permission.string_matcher.string_matcher().empty();
+}
+
+// If the permission can only match one of a set of exact paths, appends them
+// to paths, replaces the rule requiring them with kAny, and returns true.
+// Otherwise leaves both unchanged and returns false.
+bool ExtractExactPaths(Rbac::Permission* permission,
+                       std::vector<std::string>* paths) {
+  switch (permission->type) {
+    case Rbac::Permission::RuleType::kPath:
+      if (!IsExactPath(*permission)) return false;
+      paths->push_back(permission->string_matcher.string_matcher());
+      break;
+    case Rbac::Permission::RuleType::kOr:
+      if (permission->permissions.empty() ||
+          !std::all_of(permission->permissions.begin(),
+                       permission->permissions.end(),
+                       [](const auto& rule) { return IsExactPath(*rule); })) {
+        return false;
+      }
+      for (const auto& rule : permission->permissions) {
+        paths->push_back(rule->string_matcher.string_matcher());
+      }
+      break;
+    case Rbac::Permission::RuleType::kAnd:
+      for (auto& rule : permission->permissions) {
+        if (ExtractExactPaths(rule.get(), paths)) return true;
+      }
+      return false;
+    default:
+      return false;
+  }
+  *permission = Rbac::Permission::MakeAnyPermission();
+  return true;
+}
+
+// Returns whether the principal can be evaluated once per connection.
+bool DependsOnlyOnConnection(const Rbac::Principal& principal) {
+  switch (principal.type) {
+    case Rbac::Principal::RuleType::kAnd:
+    case Rbac::Principal::RuleType::kOr:
+    case Rbac::Principal::RuleType::kNot:
+      return std::all_of(
+          principal.principals.begin(), principal.principals.end(),
+          [](const auto& rule) { return DependsOnlyOnConnection(*rule); });
+    case Rbac::Principal::RuleType::kAny:
+    case Rbac::Principal::RuleType::kPrincipalName:
+    case Rbac::Principal::RuleType::kSourceIp:
+    case Rbac::Principal::RuleType::kDirectRemoteIp:
+    case Rbac::Principal::RuleType::kRemoteIp:
+    case Rbac::Principal::RuleType::kMetadata:
+      return true;
+    case Rbac::Principal::RuleType::kHeader:
+    case Rbac::Principal::RuleType::kPath:
+      return false;
+  }
+  return false;
+}
+
 }  // namespace
 
+GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac::Action action)
+    : id_(NextEngineId()),
+      action_(action),
+      audit_condition_(Rbac::AuditCondition::kNone) {}
+
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
-    : name_(std::move(policy.name)),
+    : id_(NextEngineId()),
+      name_(std::move(policy.name)),
       action_(policy.action),
       audit_condition_(policy.audit_condition) {
   for (auto& sub_policy : policy.policies) {
-    Policy policy;
-    policy.name = sub_policy.first;
-    policy.matcher = std::make_unique<PolicyAuthorizationMatcher>(
-        std::move(sub_policy.second));
-    policies_.push_back(std::move(policy));
+    AddPolicy(sub_policy.first, std::move(sub_policy.second));
   }
   for (auto& logger_config : policy.logger_configs) {
     auto logger =
@@ -65,32 +144,141 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     GrpcAuthorizationEngine&& other) noexcept
-    : name_(std::move(other.name_)),
+    : id_(other.id_),
+      name_(std::move(other.name_)),
       action_(other.action_),
       policies_(std::move(other.policies_)),
+      branches_by_path_(std::move(other.branches_by_path_)),
+      pathless_branches_(std::move(other.pathless_branches_)),
+      num_connection_principals_(other.num_connection_principals_),
       audit_condition_(other.audit_condition_),
       audit_loggers_(std::move(other.audit_loggers_)) {}
 
 GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
     GrpcAuthorizationEngine&& other) noexcept {
+  id_ = other.id_;
   name_ = std::move(other.name_);
   action_ = other.action_;
   policies_ = std::move(other.policies_);
+  branches_by_path_ = std::move(other.branches_by_path_);
+  pathless_branches_ = std::move(other.pathless_branches_);
+  num_connection_principals_ = other.num_connection_principals_;
   audit_condition_ = other.audit_condition_;
   audit_loggers_ = std::move(other.audit_loggers_);
   return *this;
 }
 
+void GrpcAuthorizationEngine::AddPolicy(std::string name,
+                                        Rbac::Policy policy) {
+  const uint32_t policy_index = policies_.size();
+  Policy compiled;
+  compiled.name = std::move(name);
+  std::vector<Rbac::Permission> branches;
+  if (policy.permissions.type == Rbac::Permission::RuleType::kOr &&
+      !policy.permissions.permissions.empty()) {
+    for (auto& branch : policy.permissions.permissions) {
+      branches.push_back(std::move(*branch));
+    }
+  } else {
+    branches.push_back(std::move(policy.permissions));
+  }
+  for (auto& branch : branches) {
+    const BranchRef ref = {policy_index,
+                           static_cast<uint32_t>(compiled.branches.size())};
+    std::vector<std::string> paths;
+    if (ExtractExactPaths(&branch, &paths)) {
+      for (auto& path : paths) {
+        auto& refs = branches_by_path_[std::move(path)];
+        // The same path may be listed more than once.
+        if (refs.empty() || refs.back().policy != ref.policy ||
+            refs.back().branch != ref.branch) {
+          refs.push_back(ref);
+        }
+      }
+    } else {
+      pathless_branches_.push_back(ref);
+    }
+    compiled.branches.push_back(
+        AuthorizationMatcher::Create(std::move(branch)));
+  }
+  if (DependsOnlyOnConnection(policy.principals)) {
+    compiled.connection_principals_index = num_connection_principals_++;
+  }
+  compiled.principals =
+      AuthorizationMatcher::Create(std::move(policy.principals));
+  policies_.push_back(std::move(compiled));
+}
+
+std::optional<size_t> GrpcAuthorizationEngine::FindMatchingPolicy(
+    const EvaluateArgs& args) const {
+  absl::Span<const BranchRef> by_path;
+  auto it = branches_by_path_.find(args.GetPath());
+  if (it != branches_by_path_.end()) by_path = it->second;
+  absl::Span<const BranchRef> pathless = pathless_branches_;
+  ConnectionCache::PrincipalResults connection_results;
+  // Once a branch of a policy matches, the policy's principals decide it and
+  // its remaining branches are skipped.
+  size_t decided_policy = policies_.size();
+  size_t i = 0;
+  size_t j = 0;
+  // Visit both lists in policy order, so the first match is the same as when
+  // evaluating every policy in turn.
+  while (i < by_path.size() || j < pathless.size()) {
+    const BranchRef& ref =
+        j == pathless.size() ||
+                (i < by_path.size() && by_path[i].policy < pathless[j].policy)
+            ? by_path[i++]
+            : pathless[j++];
+    if (ref.policy == decided_policy) continue;
+    const Policy& policy = policies_[ref.policy];
+    if (!policy.branches[ref.branch]->Matches(args)) continue;
+    if (PrincipalsMatch(policy, args, &connection_results)) return ref.policy;
+    decided_policy = ref.policy;
+  }
+  return std::nullopt;
+}
+
+bool GrpcAuthorizationEngine::PrincipalsMatch(
+    const Policy& policy, const EvaluateArgs& args,
+    ConnectionCache::PrincipalResults* connection_results) const {
+  if (!policy.connection_principals_index.has_value() ||
+      args.GetConnectionCache() == nullptr) {
+    return policy.principals->Matches(args);
+  }
+  if (*connection_results == nullptr) {
+    *connection_results = GetConnectionPrincipalResults(args);
+  }
+  return (**connection_results)[*policy.connection_principals_index];
+}
+
+ConnectionCache::PrincipalResults
+GrpcAuthorizationEngine::GetConnectionPrincipalResults(
+    const EvaluateArgs& args) const {
+  ConnectionCache* cache = args.GetConnectionCache();
+  ConnectionCache::PrincipalResults results =
+      cache->GetPrincipalResults(id_);
+  if (results != nullptr) return results;
+  auto computed =
+      std::make_shared<std::vector<bool>>(num_connection_principals_);
+  for (const Policy& policy : policies_) {
+    if (policy.connection_principals_index.has_value()) {
+      (*computed)[*policy.connection_principals_index] =
+          policy.principals->Matches(args);
+    }
+  }
+  // Another call on the connection may have raced to compute the same
+  // results; either copy is correct.
+  cache->SetPrincipalResults(id_, computed);
+  return computed;
+}
+
 AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
     const EvaluateArgs& args) const {
   Decision decision;
-  bool matches = false;
-  for (const auto& policy : policies_) {
-    if (policy.matcher->Matches(args)) {
-      matches = true;
-      decision.matching_policy_name = policy.name;
-      break;
-    }
+  std::optional<size_t> matching_policy = FindMatchingPolicy(args);
+  const bool matches = matching_policy.has_value();
+  if (matches) {
+    decision.matching_policy_name = policies_[*matching_policy].name;
   }
   decision.type = (matches == (action_ == Rbac::Action::kAllow))
                       ? Decision::Type::kAllow
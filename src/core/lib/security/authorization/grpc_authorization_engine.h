@@ -18,11 +18,14 @@
 #include <grpc/grpc_audit_logging.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "src/core/lib/security/authorization/authorization_engine.h"
 #include "src/core/lib/security/authorization/evaluate_args.h"
 #include "src/core/lib/security/authorization/matchers.h"
@@ -38,11 +41,17 @@ using experimental::AuditLogger;
 // engine type. This engine ignores condition field in RBAC config. It is the
 // caller's responsibility to provide RBAC policies that are compatible with
 // this engine.
+//
+// Policies are compiled when the engine is built. The branches of each
+// policy's permission that require an exact path are indexed by that path, so
+// a call only evaluates branches that can match its path. Principals that
+// depend only on the connection are evaluated once per connection and cached
+// in EvaluateArgs::PerChannelArgs. The first matching policy in name order
+// wins, as if every policy were evaluated in turn.
 class GrpcAuthorizationEngine : public AuthorizationEngine {
  public:
   // Builds GrpcAuthorizationEngine without any policies.
-  explicit GrpcAuthorizationEngine(Rbac::Action action)
-      : action_(action), audit_condition_(Rbac::AuditCondition::kNone) {}
+  explicit GrpcAuthorizationEngine(Rbac::Action action);
   // Builds GrpcAuthorizationEngine with allow/deny RBAC policy.
   explicit GrpcAuthorizationEngine(Rbac policy);
 
@@ -69,12 +78,40 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
  private:
   struct Policy {
     std::string name;
-    std::unique_ptr<AuthorizationMatcher> matcher;
+    // The branches of the permission's top-level OR, minus any exact path
+    // requirement that has been moved into branches_by_path_.
+    std::vector<std::unique_ptr<AuthorizationMatcher>> branches;
+    std::unique_ptr<AuthorizationMatcher> principals;
+    // Set if principals depend only on the connection, in which case this is
+    // the index of the result in the connection's cached results.
+    std::optional<size_t> connection_principals_index;
+  };
+
+  // A branch of a policy. Lists of these are sorted by policy.
+  struct BranchRef {
+    uint32_t policy;
+    uint32_t branch;
   };
 
+  void AddPolicy(std::string name, Rbac::Policy policy);
+  // Returns the index of the first policy matching the call, if any.
+  std::optional<size_t> FindMatchingPolicy(const EvaluateArgs& args) const;
+  bool PrincipalsMatch(
+      const Policy& policy, const EvaluateArgs& args,
+      EvaluateArgs::PerChannelArgs::ConnectionCache::PrincipalResults*
+          connection_results) const;
+  EvaluateArgs::PerChannelArgs::ConnectionCache::PrincipalResults
+  GetConnectionPrincipalResults(const EvaluateArgs& args) const;
+
+  // Identifies the engine in per-connection caches.
+  uint64_t id_;
   std::string name_;
   Rbac::Action action_;
   std::vector<Policy> policies_;
+  absl::flat_hash_map<std::string, std::vector<BranchRef>> branches_by_path_;
+  // Branches that may match any path.
+  std::vector<BranchRef> pathless_branches_;
+  size_t num_connection_principals_ = 0;
   Rbac::AuditCondition audit_condition_;
   std::vector<std::unique_ptr<AuditLogger>> audit_loggers_;
 };
@@ -145,9 +145,8 @@ bool NotAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
 }
 
 bool HeaderAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
-  std::string concatenated_value;
-  return matcher_.Match(
-      args.GetHeaderValue(matcher_.name(), &concatenated_value));
+  // Policies often check the same headers, so share lookups across matchers.
+  return matcher_.Match(args.GetMemoizedHeaderValue(matcher_.name()));
 }
 
 IpAuthorizationMatcher::IpAuthorizationMatcher(Type type, Rbac::CidrRange range)
@@ -56,6 +56,7 @@
 #include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
 #include "src/core/call/call_finalization.h"
+#include "src/core/call/deadline_coalescer.h"
 #include "src/core/call/metadata.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/call/status_util.h"
@@ -349,30 +350,51 @@ void Call::UpdateDeadline(Timestamp deadline) {
         StatusIntProperty::kRpcStatus, GRPC_STATUS_DEADLINE_EXCEEDED));
     return;
   }
-  auto* event_engine =
-      arena_->GetContext<grpc_event_engine::experimental::EventEngine>();
   if (deadline_ != Timestamp::InfFuture()) {
-    if (!event_engine->Cancel(deadline_task_)) return;
+    // A tighter deadline that rounds to the same slot changes nothing.
+    auto* coalescer = arena_->GetContext<DeadlineCoalescer>();
+    if (coalescer != nullptr &&
+        coalescer->RoundUp(deadline) == coalescer->RoundUp(deadline_)) {
+      deadline_ = deadline;
+      return;
+    }
+    if (!CancelDeadlineTimer()) return;
   } else {
     InternalRef("deadline");
   }
   deadline_ = deadline;
-  deadline_task_ = event_engine->RunAfter(deadline - Timestamp::Now(), this);
+  StartDeadlineTimer();
 }
 
 void Call::ResetDeadline() {
   {
     MutexLock lock(&deadline_mu_);
     if (deadline_ == Timestamp::InfFuture()) return;
-    if (!arena_->GetContext<grpc_event_engine::experimental::EventEngine>()
-             ->Cancel(deadline_task_)) {
-      return;
-    }
+    if (!CancelDeadlineTimer()) return;
     deadline_ = Timestamp::InfFuture();
   }
   InternalUnref("deadline[reset]");
 }
 
+void Call::StartDeadlineTimer() {
+  auto* event_engine =
+      arena_->GetContext<grpc_event_engine::experimental::EventEngine>();
+  auto* coalescer = arena_->GetContext<DeadlineCoalescer>();
+  if (coalescer != nullptr) {
+    coalescer->Add(&deadline_waiter_, deadline_, this, event_engine);
+    return;
+  }
+  global_stats().IncrementCallDeadlineTimersArmed();
+  deadline_task_ = event_engine->RunAfter(deadline_ - Timestamp::Now(), this);
+}
+
+bool Call::CancelDeadlineTimer() {
+  auto* coalescer = arena_->GetContext<DeadlineCoalescer>();
+  if (coalescer != nullptr) return coalescer->Remove(&deadline_waiter_);
+  return arena_->GetContext<grpc_event_engine::experimental::EventEngine>()
+      ->Cancel(deadline_task_);
+}
+
 void Call::Run() {
   ExecCtx exec_ctx;
   GRPC_TRACE_LOG(call, INFO)
@@ -32,6 +32,7 @@
 #include "absl/functional/function_ref.h"
 #include "absl/log/check.h"
 #include "absl/strings/string_view.h"
+#include "src/core/call/deadline_coalescer.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/debug/trace.h"
@@ -203,6 +204,12 @@ class Call : public CppImplOf<Call, grpc_call>,
       grpc_compression_algorithm algorithm) = 0;
 
  private:
+  // Arms or disarms the timer for deadline_, either directly on the
+  // EventEngine or through the channel's DeadlineCoalescer. Disarming returns
+  // false if the timer has already fired.
+  void StartDeadlineTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(deadline_mu_);
+  bool CancelDeadlineTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(deadline_mu_);
+
   const RefCountedPtr<Arena> arena_;
   std::atomic<ParentCall*> parent_call_{nullptr};
   ChildCall* child_ = nullptr;
@@ -225,6 +232,8 @@ class Call : public CppImplOf<Call, grpc_call>,
   Timestamp deadline_ ABSL_GUARDED_BY(deadline_mu_) = Timestamp::InfFuture();
   grpc_event_engine::experimental::EventEngine::TaskHandle ABSL_GUARDED_BY(
       deadline_mu_) deadline_task_;
+  // Used instead of deadline_task_ when the channel coalesces deadlines.
+  DeadlineCoalescer::Waiter deadline_waiter_ ABSL_GUARDED_BY(deadline_mu_);
   gpr_cycle_counter start_time_ = gpr_get_cycle_counter();
 };
 
@@ -131,15 +131,23 @@ Poll<Empty> WaitForCqEndOp::operator()() {
       auto not_started = std::move(*n);
       auto& started =
           state_.emplace<Started>(GetContext<Activity>()->MakeOwningWaker());
-      grpc_cq_end_op(
-          not_started.cq, not_started.tag, std::move(not_started.error),
-          [](void* p, grpc_cq_completion*) {
-            auto started = static_cast<Started*>(p);
-            auto wakeup = std::move(started->waker);
-            started->done.store(true, std::memory_order_release);
-            wakeup.Wakeup();
-          },
-          &started, &started.completion);
+      auto done = [](void* p, grpc_cq_completion*) {
+        auto started = static_cast<Started*>(p);
+        auto wakeup = std::move(started->waker);
+        started->done.store(true, std::memory_order_release);
+        wakeup.Wakeup();
+      };
+      Arena* arena = MaybeGetContext<Arena>();
+      if (arena != nullptr &&
+          arena->GetContext<InlineCqCallbacks>() != nullptr) {
+        grpc_cq_end_op_inline(not_started.cq, not_started.tag,
+                              std::move(not_started.error), done, &started,
+                              &started.completion);
+      } else {
+        grpc_cq_end_op(not_started.cq, not_started.tag,
+                       std::move(not_started.error), done, &started,
+                       &started.completion);
+      }
     }
   }
   auto& started = std::get<Started>(state_);
@@ -53,6 +53,7 @@
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/status_flag.h"
+#include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/util/crash.h"
 
@@ -284,6 +285,17 @@ class BatchOpIndex {
   std::array<uint8_t, 8> idxs_{255, 255, 255, 255, 255, 255, 255, 255};
 };
 
+// Present in a call's arena when that call's completions on a callback
+// completion queue may run on the thread that completes them, instead of
+// hopping to the EventEngine. Transports set it only when the application has
+// promised that its callbacks never block.
+struct InlineCqCallbacks {};
+
+template <>
+struct ArenaContextType<InlineCqCallbacks> {
+  static void Destroy(InlineCqCallbacks*) {}
+};
+
 // Defines a promise that calls grpc_cq_end_op() (on first poll) and then waits
 // for the callback supplied to grpc_cq_end_op() to be called, before resolving
 // to Empty{}
@@ -32,6 +32,7 @@
 #include "absl/strings/string_view.h"
 #include "src/core/call/call_arena_allocator.h"
 #include "src/core/call/call_destination.h"
+#include "src/core/call/deadline_coalescer.h"
 #include "src/core/channelz/channelz.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
@@ -130,6 +131,11 @@ class Channel : public UnstartedCallDestination,
     return call_arena_allocator_.get();
   }
 
+  // Null unless the channel coalesces call deadline timers.
+  DeadlineCoalescer* deadline_coalescer() const {
+    return deadline_coalescer_.get();
+  }
+
  protected:
   Channel(std::string target, const ChannelArgs& channel_args);
 
@@ -145,6 +151,7 @@ class Channel : public UnstartedCallDestination,
   std::map<std::pair<std::string, std::string>, RegisteredCall>
       registration_table_ ABSL_GUARDED_BY(mu_);
   const RefCountedPtr<CallArenaAllocator> call_arena_allocator_;
+  const RefCountedPtr<DeadlineCoalescer> deadline_coalescer_;
 };
 
 }  // namespace grpc_core
@@ -22,6 +22,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "absl/log/check.h"
+#include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
 #include "src/core/channelz/channelz.h"
@@ -120,9 +121,10 @@ absl::StatusOr<grpc_channel*> CreateClientEndpointChannel(
   }
   if (creds == nullptr) return absl::InternalError("No credentials provided");
   auto final_args = creds->update_arguments(args.SetObject(creds->Ref()));
+  // shm: targets can only be reached over the shared memory transport.
   std::vector<absl::string_view> transport_preferences = absl::StrSplit(
       final_args.GetString(GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS)
-          .value_or("h2"),
+          .value_or(absl::StartsWith(target, "shm:") ? "shm" : "h2"),
       ',');
   if (transport_preferences.size() != 1) {
     return absl::InternalError(absl::StrCat(
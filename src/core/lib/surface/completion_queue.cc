@@ -876,12 +876,12 @@ static void cq_end_op_for_pluck(
   }
 }
 
-// Complete an event on a completion queue of type GRPC_CQ_CALLBACK
-static void cq_end_op_for_callback(
+// Complete an event on a completion queue of type GRPC_CQ_CALLBACK, running
+// the callback on this thread if run_inline is set.
+static void cq_end_op_for_callback_impl(
     grpc_completion_queue* cq, void* tag, grpc_error_handle error,
     void (*done)(void* done_arg, grpc_cq_completion* storage), void* done_arg,
-    grpc_cq_completion* storage, bool internal) {
-  (void)internal;
+    grpc_cq_completion* storage, bool run_inline) {
   cq_callback_data* cqd = static_cast<cq_callback_data*> DATA_FROM_CQ(cq);
 
   if (GRPC_TRACE_FLAG_ENABLED(api) ||
@@ -907,6 +907,10 @@ static void cq_end_op_for_callback(
   }
 
   auto* functor = static_cast<grpc_completion_queue_functor*>(tag);
+  if (run_inline) {
+    (*functor->functor_run)(functor, error.ok());
+    return;
+  }
   cqd->event_engine->Run(
       [engine = cqd->event_engine, functor, ok = error.ok()]() {
         grpc_core::ExecCtx exec_ctx;
@@ -914,6 +918,16 @@ static void cq_end_op_for_callback(
       });
 }
 
+// Complete an event on a completion queue of type GRPC_CQ_CALLBACK
+static void cq_end_op_for_callback(
+    grpc_completion_queue* cq, void* tag, grpc_error_handle error,
+    void (*done)(void* done_arg, grpc_cq_completion* storage), void* done_arg,
+    grpc_cq_completion* storage, bool internal) {
+  (void)internal;
+  cq_end_op_for_callback_impl(cq, tag, std::move(error), done, done_arg,
+                              storage, /*run_inline=*/false);
+}
+
 void grpc_cq_end_op(grpc_completion_queue* cq, void* tag,
                     grpc_error_handle error,
                     void (*done)(void* done_arg, grpc_cq_completion* storage),
@@ -922,6 +936,18 @@ void grpc_cq_end_op(grpc_completion_queue* cq, void* tag,
   cq->vtable->end_op(cq, tag, error, done, done_arg, storage, internal);
 }
 
+void grpc_cq_end_op_inline(
+    grpc_completion_queue* cq, void* tag, grpc_error_handle error,
+    void (*done)(void* done_arg, grpc_cq_completion* storage), void* done_arg,
+    grpc_cq_completion* storage) {
+  if (cq->vtable->cq_completion_type != GRPC_CQ_CALLBACK) {
+    grpc_cq_end_op(cq, tag, std::move(error), done, done_arg, storage);
+    return;
+  }
+  cq_end_op_for_callback_impl(cq, tag, std::move(error), done, done_arg,
+                              storage, /*run_inline=*/true);
+}
+
 struct cq_is_finished_arg {
   gpr_atm last_seen_things_queued_ever;
   grpc_completion_queue* cq;
@@ -75,6 +75,15 @@ void grpc_cq_end_op(grpc_completion_queue* cq, void* tag,
                     void* done_arg, grpc_cq_completion* storage,
                     bool internal = false);
 
+// As grpc_cq_end_op(), but on a callback completion queue the callback runs on
+// the calling thread instead of being handed to the EventEngine. The caller
+// must have an ExecCtx, and must know that the callback does not block.
+// Other kinds of completion queue behave exactly as with grpc_cq_end_op().
+void grpc_cq_end_op_inline(
+    grpc_completion_queue* cq, void* tag, grpc_error_handle error,
+    void (*done)(void* done_arg, grpc_cq_completion* storage), void* done_arg,
+    grpc_cq_completion* storage);
+
 grpc_pollset* grpc_cq_pollset(grpc_completion_queue* cq);
 
 bool grpc_cq_can_listen(grpc_completion_queue* cq);
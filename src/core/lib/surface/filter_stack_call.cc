@@ -43,6 +43,7 @@
 #include "absl/strings/escaping.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "src/core/call/deadline_coalescer.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/channelz/channelz.h"
 #include "src/core/lib/channel/channel_stack.h"
@@ -109,6 +110,9 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
   RefCountedPtr<Arena> arena = channel->call_arena_allocator()->MakeArena();
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       args->channel->event_engine());
+  if (channel->deadline_coalescer() != nullptr) {
+    arena->SetContext<DeadlineCoalescer>(channel->deadline_coalescer());
+  }
   call = new (arena->Alloc(call_alloc_size)) FilterStackCall(arena, *args);
   DCHECK(FromC(call->c_ptr()) == call);
   DCHECK(FromCallStack(call->call_stack()) == call);
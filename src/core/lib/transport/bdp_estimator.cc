@@ -37,6 +37,7 @@ BdpEstimator::BdpEstimator(absl::string_view name)
       stable_estimate_count_(0),
       ping_state_(PingState::UNSCHEDULED),
       bw_est_(0),
+      min_rtt_(Duration::Zero()),
       name_(name) {}
 
 Timestamp BdpEstimator::CompletePing() {
@@ -51,6 +52,11 @@ Timestamp BdpEstimator::CompletePing() {
       << " est=" << estimate_ << " dt=" << dt << " bw=" << bw / 125000.0
       << "Mbs bw_est=" << bw_est_ / 125000.0 << "Mbs";
   CHECK(ping_state_ == PingState::STARTED);
+  if (dt > 0) {
+    const Duration rtt =
+        std::max(Duration::Epsilon(), Duration::FromSecondsAsDouble(dt));
+    if (min_rtt_ == Duration::Zero() || rtt < min_rtt_) min_rtt_ = rtt;
+  }
   if (accumulator_ > 2 * estimate_ / 3 && bw > bw_est_) {
     estimate_ = std::max(accumulator_, estimate_ * 2);
     bw_est_ = bw;
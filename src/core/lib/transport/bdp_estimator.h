@@ -40,6 +40,8 @@ class BdpEstimator {
 
   int64_t EstimateBdp() const { return estimate_; }
   double EstimateBandwidth() const { return bw_est_; }
+  // The shortest round trip seen by a ping, or zero before any completes.
+  Duration EstimateRtt() const { return min_rtt_; }
 
   void AddIncomingBytes(int64_t num_bytes) { accumulator_ += num_bytes; }
 
@@ -83,6 +85,7 @@ class BdpEstimator {
   int stable_estimate_count_;
   PingState ping_state_;
   double bw_est_;
+  Duration min_rtt_;
   absl::string_view name_;
 };
 
@@ -97,8 +97,9 @@ class MyEndpointList : public EndpointList {
   }
 };
 */
-// TODO(roth): Consider wrapping this in an LB policy subclass for petiole
-// policies to inherit from.
+// Policies that report READY if any endpoint is READY can instead derive
+// from EndpointListPolicy (endpoint_list_policy.h), which does this.
+// TODO(roth): Consider moving the other petiole policies to it.
 class EndpointList : public InternallyRefCounted<EndpointList> {
  public:
   // An individual endpoint.
@@ -0,0 +1,262 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/endpoint_list_policy.h"
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/resolver/endpoint_addresses.h"
+
+namespace grpc_core {
+
+//
+// EndpointListPolicy::CountingEndpointList::CountingEndpoint
+//
+
+void EndpointListPolicy::CountingEndpointList::CountingEndpoint::OnStateUpdate(
+    std::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state, const absl::Status& status) {
+  auto* endpoint_list = this->endpoint_list<CountingEndpointList>();
+  auto* policy = this->policy<EndpointListPolicy>();
+  if (GRPC_TRACE_FLAG_ENABLED_OBJ(*policy->tracer_)) {
+    LOG(INFO) << "[" << policy->log_prefix_ << " " << policy
+              << "] connectivity changed for child " << this
+              << ", endpoint_list " << endpoint_list << " (index " << Index()
+              << " of " << endpoint_list->size() << "): prev_state="
+              << (old_state.has_value() ? ConnectivityStateName(*old_state)
+                                        : "N/A")
+              << " new_state=" << ConnectivityStateName(new_state) << " ("
+              << status << ")";
+  }
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    if (GRPC_TRACE_FLAG_ENABLED_OBJ(*policy->tracer_)) {
+      LOG(INFO) << "[" << policy->log_prefix_ << " " << policy << "] child "
+                << this << " reported IDLE; requesting connection";
+    }
+    ExitIdleLocked();
+  }
+  // If state changed, update state counters.
+  if (!old_state.has_value() || *old_state != new_state) {
+    endpoint_list->UpdateStateCountersLocked(old_state, new_state);
+  }
+  // Update the policy state.
+  endpoint_list->MaybeUpdateAggregatedConnectivityStateLocked(status);
+}
+
+//
+// EndpointListPolicy::CountingEndpointList
+//
+
+void EndpointListPolicy::CountingEndpointList::UpdateStateCountersLocked(
+    std::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  // We treat IDLE the same as CONNECTING, since it will immediately
+  // transition into that state anyway.
+  if (old_state.has_value()) {
+    CHECK(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      CHECK_GT(num_ready_, 0u);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING ||
+               *old_state == GRPC_CHANNEL_IDLE) {
+      CHECK_GT(num_connecting_, 0u);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      CHECK_GT(num_transient_failure_, 0u);
+      --num_transient_failure_;
+    }
+  }
+  CHECK(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING ||
+             new_state == GRPC_CHANNEL_IDLE) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void EndpointListPolicy::CountingEndpointList::
+    MaybeUpdateAggregatedConnectivityStateLocked(absl::Status status_for_tf) {
+  auto* policy = this->policy<EndpointListPolicy>();
+  const bool trace = GRPC_TRACE_FLAG_ENABLED_OBJ(*policy->tracer_);
+  // If this is latest_pending_endpoint_list_, then swap it into
+  // endpoint_list_ in the following cases:
+  // - endpoint_list_ has no READY children.
+  // - This list has at least one READY child and we have seen the
+  //   initial connectivity state notification for all children.
+  // - All of the children in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (policy->latest_pending_endpoint_list_.get() == this &&
+      (policy->endpoint_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllEndpointsSeenInitialState()) ||
+       num_transient_failure_ == size())) {
+    if (trace) {
+      LOG(INFO) << "[" << policy->log_prefix_ << " " << policy
+                << "] swapping out child list " << policy->endpoint_list_.get()
+                << " (" << policy->endpoint_list_->CountersString()
+                << ") in favor of " << this << " (" << CountersString() << ")";
+    }
+    policy->endpoint_list_ = std::move(policy->latest_pending_endpoint_list_);
+  }
+  // Only set connectivity state if this is the current child list.
+  if (policy->endpoint_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY child is READY => policy is READY.
+  // 2) ANY child is CONNECTING => policy is CONNECTING.
+  // 3) ALL children are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    if (trace) {
+      LOG(INFO) << "[" << policy->log_prefix_ << " " << policy
+                << "] reporting READY with child list " << this;
+    }
+    policy->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_READY, absl::OkStatus(), CreateReadyPicker());
+  } else if (num_connecting_ > 0) {
+    if (trace) {
+      LOG(INFO) << "[" << policy->log_prefix_ << " " << policy
+                << "] reporting CONNECTING with child list " << this;
+    }
+    policy->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::OkStatus(),
+        MakeRefCounted<QueuePicker>(nullptr));
+  } else if (num_transient_failure_ == size()) {
+    if (trace) {
+      LOG(INFO) << "[" << policy->log_prefix_ << " " << policy
+                << "] reporting TRANSIENT_FAILURE with child list " << this
+                << ": " << status_for_tf;
+    }
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.message()));
+    }
+    ReportTransientFailure(last_failure_);
+  }
+}
+
+std::string EndpointListPolicy::CountingEndpointList::CountersString() const {
+  return absl::StrCat("num_children=", size(), " num_ready=", num_ready_,
+                      " num_connecting=", num_connecting_,
+                      " num_transient_failure=", num_transient_failure_);
+}
+
+//
+// EndpointListPolicy
+//
+
+EndpointListPolicy::EndpointListPolicy(Args args, TraceFlag* tracer,
+                                       const char* log_prefix)
+    : LoadBalancingPolicy(std::move(args)),
+      tracer_(tracer),
+      log_prefix_(log_prefix) {
+  if (GRPC_TRACE_FLAG_ENABLED_OBJ(*tracer_)) {
+    LOG(INFO) << "[" << log_prefix_ << " " << this << "] Created";
+  }
+}
+
+EndpointListPolicy::~EndpointListPolicy() {
+  if (GRPC_TRACE_FLAG_ENABLED_OBJ(*tracer_)) {
+    LOG(INFO) << "[" << log_prefix_ << " " << this << "] Destroying policy";
+  }
+  CHECK(endpoint_list_ == nullptr);
+  CHECK(latest_pending_endpoint_list_ == nullptr);
+}
+
+void EndpointListPolicy::ShutdownLocked() {
+  if (GRPC_TRACE_FLAG_ENABLED_OBJ(*tracer_)) {
+    LOG(INFO) << "[" << log_prefix_ << " " << this << "] Shutting down";
+  }
+  endpoint_list_.reset();
+  latest_pending_endpoint_list_.reset();
+}
+
+void EndpointListPolicy::ResetBackoffLocked() {
+  endpoint_list_->ResetBackoffLocked();
+  if (latest_pending_endpoint_list_ != nullptr) {
+    latest_pending_endpoint_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status EndpointListPolicy::UpdateEndpointListLocked(UpdateArgs args) {
+  const bool trace = GRPC_TRACE_FLAG_ENABLED_OBJ(*tracer_);
+  EndpointAddressesIterator* addresses = nullptr;
+  if (args.addresses.ok()) {
+    if (trace) {
+      LOG(INFO) << "[" << log_prefix_ << " " << this << "] received update";
+    }
+    addresses = args.addresses->get();
+  } else {
+    if (trace) {
+      LOG(INFO) << "[" << log_prefix_ << " " << this
+                << "] received update with address error: "
+                << args.addresses.status();
+    }
+    // If we already have a child list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (endpoint_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new child list, replacing the previous pending list, if any.
+  if (trace && latest_pending_endpoint_list_ != nullptr) {
+    LOG(INFO) << "[" << log_prefix_ << " " << this
+              << "] replacing previous pending child list "
+              << latest_pending_endpoint_list_.get();
+  }
+  std::vector<std::string> errors;
+  latest_pending_endpoint_list_ = CreateEndpointList(
+      addresses, args.args, std::move(args.resolution_note), &errors);
+  // If the new list is empty, immediately promote it to
+  // endpoint_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_endpoint_list_->size() == 0) {
+    if (trace && endpoint_list_ != nullptr) {
+      LOG(INFO) << "[" << log_prefix_ << " " << this
+                << "] replacing previous child list " << endpoint_list_.get();
+    }
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    absl::Status status = args.addresses.ok()
+                              ? absl::UnavailableError("empty address list")
+                              : args.addresses.status();
+    endpoint_list_->ReportTransientFailure(status);
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // endpoint_list_.
+  if (endpoint_list_ == nullptr) {
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  }
+  if (!errors.empty()) {
+    return absl::UnavailableError(absl::StrCat(
+        "errors from children: [", absl::StrJoin(errors, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,202 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_ENDPOINT_LIST_POLICY_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_ENDPOINT_LIST_POLICY_H
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// Per-endpoint state that must survive address updates, such as load
+// statistics: it is shared by the endpoint lists and pickers that contain
+// the endpoint, and looked up by the endpoint's addresses when a new list
+// is built.  T must derive from EndpointStateMap<T>::Entry.
+template <typename T>
+class EndpointStateMap final : public RefCounted<EndpointStateMap<T>> {
+ public:
+  class Entry : public RefCounted<T> {
+   public:
+    ~Entry() override {
+      if (map_ != nullptr) map_->Remove(*key_, this);
+    }
+
+   protected:
+    Entry() = default;
+
+   private:
+    friend class EndpointStateMap;
+
+    RefCountedPtr<EndpointStateMap> map_;
+    std::optional<EndpointAddressSet> key_;
+  };
+
+  // Returns the entry for the endpoint with the given addresses, creating
+  // it from args if there is none.
+  template <typename... Args>
+  RefCountedPtr<T> GetOrCreate(
+      const std::vector<grpc_resolved_address>& addresses, Args&&... args) {
+    EndpointAddressSet key(addresses);
+    MutexLock lock(&mu_);
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      auto entry = it->second->RefIfNonZero();
+      if (entry != nullptr) return entry;
+    }
+    auto entry = MakeRefCounted<T>(std::forward<Args>(args)...);
+    Entry* base = entry.get();
+    base->map_ = this->Ref();
+    base->key_.emplace(key);
+    map_[std::move(key)] = entry.get();
+    return entry;
+  }
+
+  // Forgets all entries, so that subsequent lookups create new ones.
+  // Existing entries remain valid for as long as they are referenced.
+  void Clear() {
+    MutexLock lock(&mu_);
+    map_.clear();
+  }
+
+ private:
+  void Remove(const EndpointAddressSet& key, const Entry* entry) {
+    MutexLock lock(&mu_);
+    auto it = map_.find(key);
+    if (it != map_.end() && it->second == entry) map_.erase(it);
+  }
+
+  Mutex mu_;
+  std::map<EndpointAddressSet, T*> map_ ABSL_GUARDED_BY(&mu_);
+};
+
+// A petiole LB policy that, like round_robin, reports READY if any of its
+// endpoints is READY.  When an update arrives, the new endpoint list is
+// kept pending until it is ready to replace the current one.  Subclasses
+// create the endpoint lists and the picker over the READY endpoints.
+class EndpointListPolicy : public LoadBalancingPolicy {
+ public:
+  void ResetBackoffLocked() override;
+
+ protected:
+  // An EndpointList that counts its endpoints in each connectivity state
+  // and reports the aggregated state for the policy.
+  class CountingEndpointList : public EndpointList {
+   public:
+    class CountingEndpoint : public Endpoint {
+     protected:
+      explicit CountingEndpoint(RefCountedPtr<EndpointList> endpoint_list)
+          : Endpoint(std::move(endpoint_list)) {}
+
+     private:
+      void OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                         grpc_connectivity_state new_state,
+                         const absl::Status& status) final;
+    };
+
+   protected:
+    CountingEndpointList(RefCountedPtr<EndpointListPolicy> policy,
+                         std::string resolution_note, const char* tracer)
+        : EndpointList(std::move(policy), std::move(resolution_note),
+                       tracer) {}
+
+   private:
+    // Returns a picker over the list's READY endpoints.  Called only when
+    // there is at least one.
+    virtual RefCountedPtr<SubchannelPicker> CreateReadyPicker() = 0;
+
+    LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
+        const final {
+      return policy<EndpointListPolicy>()->channel_control_helper();
+    }
+
+    // Updates the counters of children in each state when a
+    // child transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        std::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right child list is used and then updates
+    // the policy's connectivity state based on the child list's
+    // state counters.
+    void MaybeUpdateAggregatedConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+    std::string CountersString() const;
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  // tracer controls the policy's trace logging, in which log_prefix
+  // identifies the policy.
+  EndpointListPolicy(Args args, TraceFlag* tracer, const char* log_prefix);
+  ~EndpointListPolicy() override;
+
+  // Creates a pending endpoint list for args, promoting it right away if
+  // there is no current list or it is empty.  To be called from
+  // UpdateLocked() once the subclass has taken its config.
+  absl::Status UpdateEndpointListLocked(UpdateArgs args);
+
+  // Returns the current endpoint list.  Intended for trace logging.
+  const EndpointList* endpoint_list() const { return endpoint_list_.get(); }
+
+ private:
+  // Creates an endpoint list for an update.
+  virtual OrphanablePtr<CountingEndpointList> CreateEndpointList(
+      EndpointAddressesIterator* addresses, const ChannelArgs& args,
+      std::string resolution_note, std::vector<std::string>* errors) = 0;
+
+  void ShutdownLocked() override;
+
+  TraceFlag* tracer_;
+  const char* log_prefix_;
+
+  // Current child list.
+  OrphanablePtr<CountingEndpointList> endpoint_list_;
+  // Latest pending child list.
+  // When we get an updated address list, we create a new child list
+  // for it here, and we wait to swap it into endpoint_list_ until the new
+  // list becomes READY.
+  OrphanablePtr<CountingEndpointList> latest_pending_endpoint_list_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_ENDPOINT_LIST_POLICY_H
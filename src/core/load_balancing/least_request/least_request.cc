@@ -0,0 +1,407 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Least outstanding requests load balancing (see gRFC A48): each call
+// goes to the endpoint with the fewest calls in flight among choiceCount
+// READY endpoints picked at random.  With useEndpointWeights, an
+// endpoint's load is instead its calls in flight (plus the new call)
+// divided by its weight attribute, so heavier endpoints take more calls.
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/endpoint_list_policy.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/shared_bit_gen.h"
+#include "src/core/util/validation_errors.h"
+#include "src/core/util/work_serializer.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kLeastRequest = "least_request";
+
+// Larger choice counts are clamped to this, as in gRFC A48.
+constexpr uint32_t kMaxChoiceCount = 10;
+
+// Config for least_request policy.
+class LeastRequestConfig final : public LoadBalancingPolicy::Config {
+ public:
+  LeastRequestConfig() = default;
+
+  LeastRequestConfig(const LeastRequestConfig&) = delete;
+  LeastRequestConfig& operator=(const LeastRequestConfig&) = delete;
+
+  LeastRequestConfig(LeastRequestConfig&&) = delete;
+  LeastRequestConfig& operator=(LeastRequestConfig&&) = delete;
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  uint32_t choice_count() const { return choice_count_; }
+  bool use_endpoint_weights() const { return use_endpoint_weights_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<LeastRequestConfig>()
+            .OptionalField("choiceCount", &LeastRequestConfig::choice_count_)
+            .OptionalField("useEndpointWeights",
+                           &LeastRequestConfig::use_endpoint_weights_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (choice_count_ < 2) {
+      ValidationErrors::ScopedField field(errors, ".choiceCount");
+      errors->AddError("must be at least 2");
+    }
+    choice_count_ = std::min(choice_count_, kMaxChoiceCount);
+  }
+
+ private:
+  uint32_t choice_count_ = 2;
+  bool use_endpoint_weights_ = false;
+};
+
+// least_request LB policy
+class LeastRequest final : public EndpointListPolicy {
+ public:
+  explicit LeastRequest(Args args);
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+
+ private:
+  // The number of calls in flight to a given endpoint.  Kept in an
+  // EndpointStateMap, so that calls started before an address update are
+  // still counted after it.
+  class EndpointCalls final : public EndpointStateMap<EndpointCalls>::Entry {
+   public:
+    void CallStarted() {
+      calls_in_flight_.fetch_add(1, std::memory_order_relaxed);
+    }
+    void CallFinished() {
+      const uint64_t prev_calls =
+          calls_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+      DCHECK_GT(prev_calls, 0u);
+    }
+    uint64_t calls_in_flight() const {
+      return calls_in_flight_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic<uint64_t> calls_in_flight_{0};
+  };
+
+  class LeastRequestEndpointList final : public CountingEndpointList {
+   public:
+    class LeastRequestEndpoint final : public CountingEndpoint {
+     public:
+      LeastRequestEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                           const EndpointAddresses& addresses,
+                           const ChannelArgs& args,
+                           std::shared_ptr<WorkSerializer> work_serializer,
+                           std::vector<std::string>* errors)
+          : CountingEndpoint(std::move(endpoint_list)),
+            calls_(policy<LeastRequest>()->endpoint_calls_->GetOrCreate(
+                addresses.addresses())) {
+        // Weight should never be zero, but ignore it just in case, since
+        // that value would make the endpoint's load infinite.
+        auto weight_arg = addresses.args().GetInt(GRPC_ARG_ADDRESS_WEIGHT);
+        if (weight_arg.value_or(0) > 0) weight_ = *weight_arg;
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      RefCountedPtr<EndpointCalls> calls() const { return calls_; }
+      uint32_t weight() const { return weight_; }
+
+     private:
+      RefCountedPtr<EndpointCalls> calls_;
+      uint32_t weight_ = 1;
+    };
+
+    LeastRequestEndpointList(RefCountedPtr<LeastRequest> least_request,
+                             EndpointAddressesIterator* endpoints,
+                             const ChannelArgs& args,
+                             std::string resolution_note,
+                             std::vector<std::string>* errors)
+        : CountingEndpointList(std::move(least_request),
+                               std::move(resolution_note),
+                               GRPC_TRACE_FLAG_ENABLED(least_request_lb)
+                                   ? "LeastRequestEndpointList"
+                                   : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<LeastRequestEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<LeastRequest>()->work_serializer(), errors);
+           });
+    }
+
+   private:
+    RefCountedPtr<SubchannelPicker> CreateReadyPicker() override;
+  };
+
+  // Info stored about each READY endpoint.
+  struct EndpointInfo {
+    EndpointInfo(RefCountedPtr<SubchannelPicker> picker,
+                 RefCountedPtr<EndpointCalls> calls, uint32_t weight)
+        : picker(std::move(picker)), calls(std::move(calls)), weight(weight) {}
+
+    RefCountedPtr<SubchannelPicker> picker;
+    RefCountedPtr<EndpointCalls> calls;
+    uint32_t weight;
+  };
+
+  class Picker final : public SubchannelPicker {
+   public:
+    Picker(LeastRequest* parent, const LeastRequestConfig& config,
+           std::vector<EndpointInfo> endpoints);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // A call tracker that counts the endpoint's calls in flight.
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<EndpointCalls> calls,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : calls_(std::move(calls)),
+            child_tracker_(std::move(child_tracker)) {}
+
+      ~SubchannelCallTracker() override {
+#ifndef NDEBUG
+        DCHECK(!started_);
+#endif
+      }
+
+      void Start() override;
+
+      void Finish(FinishArgs args) override;
+
+     private:
+      RefCountedPtr<EndpointCalls> calls_;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+#ifndef NDEBUG
+      bool started_ = false;
+#endif
+    };
+
+    // Returns true if endpoints_[a] is less loaded than endpoints_[b].
+    bool LessLoaded(size_t a, size_t b) const;
+
+    // Using pointer value only, no ref held -- do not dereference!
+    LeastRequest* parent_;
+
+    const uint32_t choice_count_;
+    const bool use_endpoint_weights_;
+    std::vector<EndpointInfo> endpoints_;
+  };
+
+  OrphanablePtr<CountingEndpointList> CreateEndpointList(
+      EndpointAddressesIterator* addresses, const ChannelArgs& args,
+      std::string resolution_note, std::vector<std::string>* errors) override {
+    return MakeOrphanable<LeastRequestEndpointList>(
+        RefAsSubclass<LeastRequest>(DEBUG_LOCATION, "LeastRequestEndpointList"),
+        addresses, args, std::move(resolution_note), errors);
+  }
+
+  RefCountedPtr<LeastRequestConfig> config_;
+
+  const RefCountedPtr<EndpointStateMap<EndpointCalls>> endpoint_calls_ =
+      MakeRefCounted<EndpointStateMap<EndpointCalls>>();
+};
+
+//
+// LeastRequest::Picker::SubchannelCallTracker
+//
+
+void LeastRequest::Picker::SubchannelCallTracker::Start() {
+  if (child_tracker_ != nullptr) child_tracker_->Start();
+  calls_->CallStarted();
+#ifndef NDEBUG
+  started_ = true;
+#endif
+}
+
+void LeastRequest::Picker::SubchannelCallTracker::Finish(FinishArgs args) {
+  if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+  calls_->CallFinished();
+#ifndef NDEBUG
+  started_ = false;
+#endif
+}
+
+//
+// LeastRequest::Picker
+//
+
+LeastRequest::Picker::Picker(LeastRequest* parent,
+                             const LeastRequestConfig& config,
+                             std::vector<EndpointInfo> endpoints)
+    : parent_(parent),
+      choice_count_(config.choice_count()),
+      use_endpoint_weights_(config.use_endpoint_weights()),
+      endpoints_(std::move(endpoints)) {
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LEAST_REQUEST " << parent_ << " picker " << this
+      << "] created picker from endpoint_list="
+      << parent_->endpoint_list() << " with " << endpoints_.size()
+      << " READY children, choice_count=" << choice_count_
+      << " use_endpoint_weights=" << use_endpoint_weights_;
+}
+
+bool LeastRequest::Picker::LessLoaded(size_t a, size_t b) const {
+  const uint64_t calls_a = endpoints_[a].calls->calls_in_flight();
+  const uint64_t calls_b = endpoints_[b].calls->calls_in_flight();
+  if (!use_endpoint_weights_) return calls_a < calls_b;
+  // Compares (calls_a + 1) / weight_a with (calls_b + 1) / weight_b.
+  // Counting the call being picked breaks ties between idle endpoints in
+  // favor of the heavier one.
+  return (calls_a + 1) * endpoints_[b].weight <
+         (calls_b + 1) * endpoints_[a].weight;
+}
+
+LeastRequest::PickResult LeastRequest::Picker::Pick(PickArgs args) {
+  // Sample with replacement, so the cost of a pick depends only on
+  // choice_count_.  Ties go to the endpoint sampled first.
+  size_t index = 0;
+  if (endpoints_.size() > 1) {
+    SharedBitGen bitgen;
+    index = absl::Uniform<size_t>(bitgen, 0, endpoints_.size());
+    for (uint32_t i = 1; i < choice_count_; ++i) {
+      const size_t candidate =
+          absl::Uniform<size_t>(bitgen, 0, endpoints_.size());
+      if (LessLoaded(candidate, index)) index = candidate;
+    }
+  }
+  const EndpointInfo& endpoint = endpoints_[index];
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LEAST_REQUEST " << parent_ << " picker " << this
+      << "] using endpoint index " << index << " ("
+      << endpoint.calls->calls_in_flight() << " calls in flight, weight "
+      << endpoint.weight << "), picker=" << endpoint.picker.get();
+  PickResult result = endpoint.picker->Pick(args);
+  auto* complete = std::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    complete->subchannel_call_tracker =
+        std::make_unique<SubchannelCallTracker>(
+            endpoint.calls, std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
+//
+// LeastRequest
+//
+
+LeastRequest::LeastRequest(Args args)
+    : EndpointListPolicy(std::move(args), &least_request_lb_trace,
+                         "LEAST_REQUEST") {}
+
+absl::Status LeastRequest::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<LeastRequestConfig>();
+  return UpdateEndpointListLocked(std::move(args));
+}
+
+//
+// LeastRequest::LeastRequestEndpointList
+//
+
+RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
+LeastRequest::LeastRequestEndpointList::CreateReadyPicker() {
+  auto* least_request = policy<LeastRequest>();
+  std::vector<EndpointInfo> endpoints;
+  for (const auto& endpoint : this->endpoints()) {
+    auto state = endpoint->connectivity_state();
+    if (state.has_value() && *state == GRPC_CHANNEL_READY) {
+      auto* least_request_endpoint =
+          static_cast<LeastRequestEndpoint*>(endpoint.get());
+      endpoints.emplace_back(endpoint->picker(),
+                             least_request_endpoint->calls(),
+                             least_request_endpoint->weight());
+    }
+  }
+  CHECK(!endpoints.empty());
+  return MakeRefCounted<Picker>(least_request, *least_request->config_,
+                                std::move(endpoints));
+}
+
+//
+// factory
+//
+
+class LeastRequestFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<LeastRequest>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<LeastRequestConfig>>(
+        json, JsonArgs(), "errors validating least_request LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterLeastRequestLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<LeastRequestFactory>());
+}
+
+}  // namespace grpc_core
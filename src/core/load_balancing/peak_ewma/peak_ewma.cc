@@ -0,0 +1,376 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Latency-aware load balancing: each call goes to the cheaper of two READY
+// endpoints picked at random, where an endpoint's cost is the peak EWMA of
+// the latency of calls sent to it times its calls in flight (see
+// PeakEwmaLoad).  Latency is measured from the start to the end of the
+// subchannel call, so it includes the server's queueing time.  Failed calls
+// count like any other, so an endpoint that fails fast looks cheap; use
+// outlier_detection above this policy to eject such endpoints.
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/endpoint_list_policy.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/load_balancing/peak_ewma/peak_ewma_load.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/shared_bit_gen.h"
+#include "src/core/util/time.h"
+#include "src/core/util/validation_errors.h"
+#include "src/core/util/work_serializer.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kPeakEwma = "peak_ewma";
+
+// Nanoseconds on the monotonic clock, for call latencies.  Timestamp only
+// has millisecond resolution.
+int64_t NowNanos() {
+  const gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  return now.tv_sec * GPR_NS_PER_SEC + now.tv_nsec;
+}
+
+// Config for peak_ewma policy.
+class PeakEwmaConfig final : public LoadBalancingPolicy::Config {
+ public:
+  PeakEwmaConfig() = default;
+
+  PeakEwmaConfig(const PeakEwmaConfig&) = delete;
+  PeakEwmaConfig& operator=(const PeakEwmaConfig&) = delete;
+
+  PeakEwmaConfig(PeakEwmaConfig&&) = delete;
+  PeakEwmaConfig& operator=(PeakEwmaConfig&&) = delete;
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  Duration decay_time() const { return decay_time_; }
+  Duration default_latency() const { return default_latency_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<PeakEwmaConfig>()
+            .OptionalField("decayTime", &PeakEwmaConfig::decay_time_)
+            .OptionalField("defaultLatency", &PeakEwmaConfig::default_latency_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (decay_time_ <= Duration::Zero()) {
+      ValidationErrors::ScopedField field(errors, ".decayTime");
+      errors->AddError("must be greater than zero");
+    }
+    if (default_latency_ <= Duration::Zero()) {
+      ValidationErrors::ScopedField field(errors, ".defaultLatency");
+      errors->AddError("must be greater than zero");
+    }
+  }
+
+ private:
+  Duration decay_time_ = Duration::Seconds(10);
+  Duration default_latency_ = Duration::Milliseconds(30);
+};
+
+// peak_ewma LB policy
+class PeakEwma final : public EndpointListPolicy {
+ public:
+  explicit PeakEwma(Args args);
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+
+ private:
+  // The load on a given endpoint.  Kept in an EndpointStateMap, so that it
+  // survives address updates.
+  class EndpointLoad final : public EndpointStateMap<EndpointLoad>::Entry {
+   public:
+    explicit EndpointLoad(const PeakEwmaConfig& config)
+        : load_(config.decay_time().millis() * GPR_NS_PER_MS,
+                config.default_latency().millis() * GPR_NS_PER_MS,
+                NowNanos()) {}
+
+    PeakEwmaLoad& load() { return load_; }
+
+   private:
+    PeakEwmaLoad load_;
+  };
+
+  class PeakEwmaEndpointList final : public CountingEndpointList {
+   public:
+    class PeakEwmaEndpoint final : public CountingEndpoint {
+     public:
+      PeakEwmaEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                       const EndpointAddresses& addresses,
+                       const ChannelArgs& args,
+                       std::shared_ptr<WorkSerializer> work_serializer,
+                       std::vector<std::string>* errors)
+          : CountingEndpoint(std::move(endpoint_list)),
+            load_(policy<PeakEwma>()->endpoint_loads_->GetOrCreate(
+                addresses.addresses(), *policy<PeakEwma>()->config_)) {
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      RefCountedPtr<EndpointLoad> load() const { return load_; }
+
+     private:
+      RefCountedPtr<EndpointLoad> load_;
+    };
+
+    PeakEwmaEndpointList(RefCountedPtr<PeakEwma> peak_ewma,
+                         EndpointAddressesIterator* endpoints,
+                         const ChannelArgs& args, std::string resolution_note,
+                         std::vector<std::string>* errors)
+        : CountingEndpointList(std::move(peak_ewma),
+                               std::move(resolution_note),
+                               GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb)
+                                   ? "PeakEwmaEndpointList"
+                                   : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<PeakEwmaEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<PeakEwma>()->work_serializer(), errors);
+           });
+    }
+
+   private:
+    RefCountedPtr<SubchannelPicker> CreateReadyPicker() override;
+  };
+
+  // Info stored about each READY endpoint.
+  struct EndpointInfo {
+    EndpointInfo(RefCountedPtr<SubchannelPicker> picker,
+                 RefCountedPtr<EndpointLoad> load)
+        : picker(std::move(picker)), load(std::move(load)) {}
+
+    RefCountedPtr<SubchannelPicker> picker;
+    RefCountedPtr<EndpointLoad> load;
+  };
+
+  class Picker final : public SubchannelPicker {
+   public:
+    Picker(PeakEwma* parent, std::vector<EndpointInfo> endpoints);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // A call tracker that counts the endpoint's calls in flight and feeds
+    // call latencies into its estimate.
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<EndpointLoad> load,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : load_(std::move(load)), child_tracker_(std::move(child_tracker)) {}
+
+      ~SubchannelCallTracker() override {
+#ifndef NDEBUG
+        DCHECK(!started_);
+#endif
+      }
+
+      void Start() override;
+
+      void Finish(FinishArgs args) override;
+
+     private:
+      RefCountedPtr<EndpointLoad> load_;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+      int64_t start_time_ = 0;
+#ifndef NDEBUG
+      bool started_ = false;
+#endif
+    };
+
+    // Using pointer value only, no ref held -- do not dereference!
+    PeakEwma* parent_;
+
+    std::vector<EndpointInfo> endpoints_;
+  };
+
+  OrphanablePtr<CountingEndpointList> CreateEndpointList(
+      EndpointAddressesIterator* addresses, const ChannelArgs& args,
+      std::string resolution_note, std::vector<std::string>* errors) override {
+    return MakeOrphanable<PeakEwmaEndpointList>(
+        RefAsSubclass<PeakEwma>(DEBUG_LOCATION, "PeakEwmaEndpointList"),
+        addresses, args, std::move(resolution_note), errors);
+  }
+
+  RefCountedPtr<PeakEwmaConfig> config_;
+
+  const RefCountedPtr<EndpointStateMap<EndpointLoad>> endpoint_loads_ =
+      MakeRefCounted<EndpointStateMap<EndpointLoad>>();
+};
+
+//
+// PeakEwma::Picker::SubchannelCallTracker
+//
+
+void PeakEwma::Picker::SubchannelCallTracker::Start() {
+  if (child_tracker_ != nullptr) child_tracker_->Start();
+  load_->load().CallStarted();
+  start_time_ = NowNanos();
+#ifndef NDEBUG
+  started_ = true;
+#endif
+}
+
+void PeakEwma::Picker::SubchannelCallTracker::Finish(FinishArgs args) {
+  if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+  const int64_t now = NowNanos();
+  load_->load().CallFinished(now - start_time_, now);
+#ifndef NDEBUG
+  started_ = false;
+#endif
+}
+
+//
+// PeakEwma::Picker
+//
+
+PeakEwma::Picker::Picker(PeakEwma* parent, std::vector<EndpointInfo> endpoints)
+    : parent_(parent), endpoints_(std::move(endpoints)) {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PEAK_EWMA " << parent_ << " picker " << this
+      << "] created picker from endpoint_list="
+      << parent_->endpoint_list() << " with " << endpoints_.size()
+      << " READY children";
+}
+
+PeakEwma::PickResult PeakEwma::Picker::Pick(PickArgs args) {
+  const int64_t now = NowNanos();
+  const size_t index = PickLowerCostOfTwo(
+      endpoints_.size(), SharedBitGen(),
+      [&](size_t i) { return endpoints_[i].load->load().Cost(now); });
+  const EndpointInfo& endpoint = endpoints_[index];
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PEAK_EWMA " << parent_ << " picker " << this
+      << "] using endpoint index " << index << " (cost "
+      << endpoint.load->load().Cost(now)
+      << "), picker=" << endpoint.picker.get();
+  PickResult result = endpoint.picker->Pick(args);
+  auto* complete = std::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    complete->subchannel_call_tracker =
+        std::make_unique<SubchannelCallTracker>(
+            endpoint.load, std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
+//
+// PeakEwma
+//
+
+PeakEwma::PeakEwma(Args args)
+    : EndpointListPolicy(std::move(args), &peak_ewma_lb_trace, "PEAK_EWMA") {}
+
+absl::Status PeakEwma::UpdateLocked(UpdateArgs args) {
+  auto config = args.config.TakeAsSubclass<PeakEwmaConfig>();
+  // Loads are built with the config's parameters, so start over if they
+  // change.  Lists and pickers keep their existing loads until replaced.
+  if (config_ != nullptr &&
+      (config->decay_time() != config_->decay_time() ||
+       config->default_latency() != config_->default_latency())) {
+    endpoint_loads_->Clear();
+  }
+  config_ = std::move(config);
+  return UpdateEndpointListLocked(std::move(args));
+}
+
+//
+// PeakEwma::PeakEwmaEndpointList
+//
+
+RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
+PeakEwma::PeakEwmaEndpointList::CreateReadyPicker() {
+  std::vector<EndpointInfo> endpoints;
+  for (const auto& endpoint : this->endpoints()) {
+    auto state = endpoint->connectivity_state();
+    if (state.has_value() && *state == GRPC_CHANNEL_READY) {
+      endpoints.emplace_back(
+          endpoint->picker(),
+          static_cast<PeakEwmaEndpoint*>(endpoint.get())->load());
+    }
+  }
+  CHECK(!endpoints.empty());
+  return MakeRefCounted<Picker>(policy<PeakEwma>(), std::move(endpoints));
+}
+
+//
+// factory
+//
+
+class PeakEwmaFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<PeakEwma>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<PeakEwmaConfig>>(
+        json, JsonArgs(), "errors validating peak_ewma LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterPeakEwmaLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<PeakEwmaFactory>());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,88 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/peak_ewma/peak_ewma_load.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "absl/log/check.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Cost of each call in flight to an endpoint whose estimate is zero, in
+// nanoseconds: large enough that any endpoint with a real estimate wins.
+constexpr double kZeroEstimatePenalty = 1e15;
+
+// Returns the weight the old estimate keeps after elapsed time.
+double DecayFactor(int64_t elapsed, double decay_time) {
+  return std::exp(-static_cast<double>(std::max<int64_t>(elapsed, 0)) /
+                  decay_time);
+}
+
+}  // namespace
+
+PeakEwmaLoad::PeakEwmaLoad(int64_t decay_time, int64_t default_latency,
+                           int64_t now)
+    : decay_time_(decay_time),
+      latency_(static_cast<double>(default_latency)),
+      last_update_(now) {
+  CHECK_GT(decay_time, 0);
+  CHECK_GT(default_latency, 0);
+}
+
+void PeakEwmaLoad::CallFinished(int64_t latency, int64_t now) {
+  const uint64_t prev_calls =
+      calls_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  DCHECK_GT(prev_calls, 0u);
+  const double sample = static_cast<double>(std::max<int64_t>(latency, 0));
+  MutexLock lock(&mu_);
+  const double estimate = latency_.load(std::memory_order_relaxed);
+  if (sample > estimate) {
+    latency_.store(sample, std::memory_order_relaxed);
+  } else {
+    const double decay = DecayFactor(
+        now - last_update_.load(std::memory_order_relaxed), decay_time_);
+    latency_.store(estimate * decay + sample * (1 - decay),
+                   std::memory_order_relaxed);
+  }
+  const int64_t last_update = last_update_.load(std::memory_order_relaxed);
+  last_update_.store(std::max(now, last_update), std::memory_order_relaxed);
+}
+
+double PeakEwmaLoad::LatencyEstimate(int64_t now) const {
+  const double latency = latency_.load(std::memory_order_relaxed);
+  if (calls_in_flight_.load(std::memory_order_relaxed) > 0) return latency;
+  return latency *
+         DecayFactor(now - last_update_.load(std::memory_order_relaxed),
+                     decay_time_);
+}
+
+double PeakEwmaLoad::Cost(int64_t now) const {
+  const uint64_t calls_in_flight =
+      calls_in_flight_.load(std::memory_order_relaxed);
+  const double estimate = LatencyEstimate(now);
+  if (estimate == 0 && calls_in_flight > 0) {
+    return kZeroEstimatePenalty + static_cast<double>(calls_in_flight);
+  }
+  return estimate * static_cast<double>(calls_in_flight + 1);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,100 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_PEAK_EWMA_PEAK_EWMA_LOAD_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_PEAK_EWMA_PEAK_EWMA_LOAD_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/random/random.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// The load a client sees on one endpoint, for the peak_ewma LB policy.
+//
+// The cost of sending a call to the endpoint is its latency estimate times
+// the number of calls in flight to it, counting the new one.  The estimate is
+// a peak-sensitive exponentially weighted moving average of observed call
+// latencies: a sample above the estimate replaces it outright, so that the
+// policy backs off from an endpoint as soon as it slows down, while lower
+// samples pull it down gradually.  While the endpoint has no calls in
+// flight, the estimate decays towards zero, so that an endpoint that was slow
+// and stopped getting calls is eventually tried again.  While it does, the
+// estimate holds: an endpoint whose calls never finish gets no new samples,
+// and must not look cheaper for it.  If the estimate is still zero, each
+// call in flight costs a large fixed penalty instead.
+//
+// Times are in nanoseconds on a monotonic clock.  Thread-safe; Cost() and
+// the call counting are lock-free.
+class PeakEwmaLoad final {
+ public:
+  // decay_time is the time constant of the moving average; default_latency
+  // is the estimate before the first sample.  Both must be positive.
+  PeakEwmaLoad(int64_t decay_time, int64_t default_latency, int64_t now);
+
+  PeakEwmaLoad(const PeakEwmaLoad&) = delete;
+  PeakEwmaLoad& operator=(const PeakEwmaLoad&) = delete;
+
+  void CallStarted() {
+    calls_in_flight_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Records a call started with CallStarted() that took latency and
+  // finished at now.
+  void CallFinished(int64_t latency, int64_t now);
+
+  // Returns the latency estimate as of now.
+  double LatencyEstimate(int64_t now) const;
+
+  // Returns the cost of sending one more call as of now.
+  double Cost(int64_t now) const;
+
+  uint64_t calls_in_flight() const {
+    return calls_in_flight_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  const double decay_time_;
+  std::atomic<uint64_t> calls_in_flight_{0};
+  // Written together under mu_.  A concurrent Cost() may see one updated
+  // and not the other, which only skews the decay of a single pick.
+  Mutex mu_;
+  std::atomic<double> latency_;
+  std::atomic<int64_t> last_update_;
+};
+
+// Power of two choices: picks two distinct indexes in [0, n) at random and
+// returns the one with the lower cost(index), or the first on a tie.  n
+// must be non-zero.
+template <typename BitGen, typename CostFn>
+size_t PickLowerCostOfTwo(size_t n, BitGen&& bitgen, CostFn cost) {
+  if (n == 1) return 0;
+  const size_t first = absl::Uniform<size_t>(bitgen, 0, n);
+  size_t second = absl::Uniform<size_t>(bitgen, 0, n - 1);
+  if (second >= first) ++second;
+  return cost(second) < cost(first) ? second : first;
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_PEAK_EWMA_PEAK_EWMA_LOAD_H
@@ -24,16 +24,16 @@
 #include <stdlib.h>
 
 #include <algorithm>
-#include <cmath>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "absl/base/attributes.h"
-#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
@@ -57,6 +57,7 @@
 #include "src/core/load_balancing/lb_policy_factory.h"
 #include "src/core/load_balancing/lb_policy_registry.h"
 #include "src/core/load_balancing/pick_first/pick_first.h"
+#include "src/core/load_balancing/ring_hash/ring_hash_table.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
@@ -113,6 +114,11 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
   size_t min_ring_size() const { return min_ring_size_; }
   size_t max_ring_size() const { return max_ring_size_; }
   absl::string_view request_hash_header() const { return request_hash_header_; }
+  bool use_maglev() const { return lookup_table_ == kMaglevLookupTable; }
+  size_t maglev_table_size() const { return maglev_table_size_; }
+  // Percentage of the average load, weighted, that an endpoint may take
+  // before picks spill over to the next endpoint, or 0 for unbounded.
+  uint32_t hash_balance_factor() const { return hash_balance_factor_; }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
     static const auto* loader =
@@ -122,6 +128,11 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
             .OptionalField("requestHashHeader",
                            &RingHashLbConfig::request_hash_header_,
                            "request_hash_header")
+            .OptionalField("lookupTable", &RingHashLbConfig::lookup_table_)
+            .OptionalField("maglevTableSize",
+                           &RingHashLbConfig::maglev_table_size_)
+            .OptionalField("hashBalanceFactor",
+                           &RingHashLbConfig::hash_balance_factor_)
             .Finish();
     return loader;
   }
@@ -144,12 +155,47 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
     if (min_ring_size_ > max_ring_size_) {
       errors->AddError("maxRingSize cannot be smaller than minRingSize");
     }
+    {
+      ValidationErrors::ScopedField field(errors, ".lookupTable");
+      if (!errors->FieldHasErrors() && lookup_table_ != kRingLookupTable &&
+          lookup_table_ != kMaglevLookupTable) {
+        errors->AddError("must be \"ring\" or \"maglev\"");
+      }
+    }
+    {
+      ValidationErrors::ScopedField field(errors, ".maglevTableSize");
+      if (!errors->FieldHasErrors() &&
+          (maglev_table_size_ < 2 || maglev_table_size_ > 5000011 ||
+           !IsPrime(maglev_table_size_))) {
+        errors->AddError("must be a prime in the range [2, 5000011]");
+      }
+    }
+    {
+      ValidationErrors::ScopedField field(errors, ".hashBalanceFactor");
+      if (!errors->FieldHasErrors() && hash_balance_factor_ != 0 &&
+          hash_balance_factor_ < 100) {
+        errors->AddError("must be at least 100");
+      }
+    }
   }
 
  private:
+  static constexpr absl::string_view kRingLookupTable = "ring";
+  static constexpr absl::string_view kMaglevLookupTable = "maglev";
+
+  static bool IsPrime(uint64_t n) {
+    for (uint64_t i = 2; i * i <= n; ++i) {
+      if (n % i == 0) return false;
+    }
+    return true;
+  }
+
   uint64_t min_ring_size_ = 1024;
   uint64_t max_ring_size_ = 4096;
   std::string request_hash_header_;
+  std::string lookup_table_ = std::string(kRingLookupTable);
+  uint64_t maglev_table_size_ = 65537;
+  uint32_t hash_balance_factor_ = 0;
 };
 
 //
@@ -168,20 +214,32 @@ class RingHash final : public LoadBalancingPolicy {
   void ResetBackoffLocked() override;
 
  private:
-  // A ring computed based on a config and address list.
+  // A ring or Maglev table computed based on a config and address list.
+  // Endpoint indexes in the table are indexes into RingHash::endpoints_.
   class Ring final : public RefCounted<Ring> {
    public:
-    struct RingEntry {
-      uint64_t hash;
-      size_t endpoint_index;  // Index into RingHash::endpoints_.
-    };
-
     Ring(RingHash* ring_hash, RingHashLbConfig* config);
 
-    const std::vector<RingEntry>& ring() const { return ring_; }
+    const RingHashTable& table() const { return table_; }
+
+    uint32_t weight(size_t endpoint_index) const {
+      return weights_[endpoint_index];
+    }
+
+   private:
+    RingHashTable table_;
+    std::vector<uint32_t> weights_;
+  };
+
+  // Number of calls in flight, for bounded loads.
+  class CallCounter final : public RefCounted<CallCounter> {
+   public:
+    uint64_t Load() const { return calls_.load(std::memory_order_relaxed); }
+    void Increment() { calls_.fetch_add(1, std::memory_order_relaxed); }
+    void Decrement() { calls_.fetch_sub(1, std::memory_order_relaxed); }
 
    private:
-    std::vector<RingEntry> ring_;
+    std::atomic<uint64_t> calls_{0};
   };
 
   // State for a particular endpoint.  Delegates to a pick_first child policy.
@@ -207,9 +265,10 @@ class RingHash final : public LoadBalancingPolicy {
       RefCountedPtr<SubchannelPicker> picker;
       grpc_connectivity_state state;
       absl::Status status;
+      RefCountedPtr<CallCounter> call_counter;
     };
     EndpointInfo GetInfoForPicker() {
-      return {Ref(), picker_, connectivity_state_, status_};
+      return {Ref(), picker_, connectivity_state_, status_, call_counter_};
     }
 
     void ResetBackoffLocked();
@@ -239,6 +298,11 @@ class RingHash final : public LoadBalancingPolicy {
     grpc_connectivity_state connectivity_state_ = GRPC_CHANNEL_IDLE;
     absl::Status status_;
     RefCountedPtr<SubchannelPicker> picker_;
+
+    // Calls in flight to this endpoint.  Kept across updates, since calls
+    // picked by older pickers still count.
+    const RefCountedPtr<CallCounter> call_counter_ =
+        MakeRefCounted<CallCounter>();
   };
 
   class Picker final : public SubchannelPicker {
@@ -248,18 +312,23 @@ class RingHash final : public LoadBalancingPolicy {
           ring_(ring_hash_->ring_),
           endpoints_(ring_hash_->endpoints_.size()),
           resolution_note_(ring_hash_->resolution_note_),
-          request_hash_header_(ring_hash_->request_hash_header_) {
+          request_hash_header_(ring_hash_->request_hash_header_),
+          hash_balance_factor_(ring_hash_->hash_balance_factor_),
+          call_counter_(ring_hash_->call_counter_) {
       for (const auto& [_, endpoint] : ring_hash_->endpoint_map_) {
         endpoints_[endpoint->index()] = endpoint->GetInfoForPicker();
         if (endpoints_[endpoint->index()].state == GRPC_CHANNEL_CONNECTING) {
           has_endpoint_in_connecting_state_ = true;
         }
       }
+      if (hash_balance_factor_ != 0) ComputeReadyWeights();
     }
 
     PickResult Pick(PickArgs args) override;
 
    private:
+    class SubchannelCallTracker;
+
     // A fire-and-forget class that schedules endpoint connection attempts
     // on the control plane WorkSerializer.
     class EndpointConnectionAttempter final {
@@ -289,12 +358,37 @@ class RingHash final : public LoadBalancingPolicy {
       grpc_closure closure_;
     };
 
+    // Sets each READY endpoint's share of the weight of the READY
+    // endpoints.  The calls in flight are shared among the endpoints that
+    // can take them: measured against every endpoint, the READY ones would
+    // all count as overloaded whenever others are down.
+    void ComputeReadyWeights();
+
+    // Returns true if bounded loads are enabled and the endpoint already
+    // has its share of the calls in flight.
+    bool IsOverloaded(size_t endpoint_index) const;
+
+    // Calls visit(endpoint_index) for the endpoints in table order from
+    // position start, once each, until it returns false.  Stops once every
+    // endpoint in the table has been visited, rather than going round the
+    // whole table, which for Maglev is far larger than the endpoint count.
+    template <typename Visit>
+    void WalkTable(size_t start, Visit visit) const;
+
+    // Delegates to the endpoint's picker, tracking the call if needed.
+    PickResult PickEndpoint(const RingHashEndpoint::EndpointInfo& endpoint_info,
+                            PickArgs args);
+
     RefCountedPtr<RingHash> ring_hash_;
     RefCountedPtr<Ring> ring_;
     std::vector<RingHashEndpoint::EndpointInfo> endpoints_;
     bool has_endpoint_in_connecting_state_ = false;
     std::string resolution_note_;
     RefCountedStringValue request_hash_header_;
+    uint32_t hash_balance_factor_;
+    // Indexed like endpoints_; zero for endpoints that are not READY.
+    std::vector<double> ready_weights_;
+    RefCountedPtr<CallCounter> call_counter_;
   };
 
   ~RingHash() override;
@@ -311,8 +405,13 @@ class RingHash final : public LoadBalancingPolicy {
   EndpointAddressesList endpoints_;
   ChannelArgs args_;
   RefCountedStringValue request_hash_header_;
+  uint32_t hash_balance_factor_ = 0;
   RefCountedPtr<Ring> ring_;
 
+  // Calls in flight across all endpoints.
+  const RefCountedPtr<CallCounter> call_counter_ =
+      MakeRefCounted<CallCounter>();
+
   std::map<EndpointAddressSet, OrphanablePtr<RingHashEndpoint>> endpoint_map_;
   std::string resolution_note_;
 
@@ -326,10 +425,128 @@ class RingHash final : public LoadBalancingPolicy {
   bool shutdown_ = false;
 };
 
+//
+// RingHash::Picker::SubchannelCallTracker
+//
+
+class RingHash::Picker::SubchannelCallTracker final
+    : public LoadBalancingPolicy::SubchannelCallTrackerInterface {
+ public:
+  SubchannelCallTracker(
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          original_subchannel_call_tracker,
+      RefCountedPtr<CallCounter> endpoint_call_counter,
+      RefCountedPtr<CallCounter> call_counter)
+      : original_subchannel_call_tracker_(
+            std::move(original_subchannel_call_tracker)),
+        endpoint_call_counter_(std::move(endpoint_call_counter)),
+        call_counter_(std::move(call_counter)) {}
+
+  ~SubchannelCallTracker() override {
+#ifndef NDEBUG
+    DCHECK(!started_);
+#endif
+  }
+
+  void Start() override {
+    // Increment number of calls in flight.
+    endpoint_call_counter_->Increment();
+    call_counter_->Increment();
+    // Delegate if needed.
+    if (original_subchannel_call_tracker_ != nullptr) {
+      original_subchannel_call_tracker_->Start();
+    }
+#ifndef NDEBUG
+    started_ = true;
+#endif
+  }
+
+  void Finish(FinishArgs args) override {
+    // Delegate if needed.
+    if (original_subchannel_call_tracker_ != nullptr) {
+      original_subchannel_call_tracker_->Finish(args);
+    }
+    // Decrement number of calls in flight.
+    endpoint_call_counter_->Decrement();
+    call_counter_->Decrement();
+#ifndef NDEBUG
+    started_ = false;
+#endif
+  }
+
+ private:
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      original_subchannel_call_tracker_;
+  RefCountedPtr<CallCounter> endpoint_call_counter_;
+  RefCountedPtr<CallCounter> call_counter_;
+#ifndef NDEBUG
+  bool started_ = false;
+#endif
+};
+
 //
 // RingHash::Picker
 //
 
+void RingHash::Picker::ComputeReadyWeights() {
+  uint64_t ready_weight = 0;
+  for (size_t i = 0; i < endpoints_.size(); ++i) {
+    if (endpoints_[i].state == GRPC_CHANNEL_READY) {
+      ready_weight += ring_->weight(i);
+    }
+  }
+  ready_weights_.assign(endpoints_.size(), 0.0);
+  if (ready_weight == 0) return;
+  for (size_t i = 0; i < endpoints_.size(); ++i) {
+    if (endpoints_[i].state == GRPC_CHANNEL_READY) {
+      ready_weights_[i] = static_cast<double>(ring_->weight(i)) / ready_weight;
+    }
+  }
+}
+
+bool RingHash::Picker::IsOverloaded(size_t endpoint_index) const {
+  if (hash_balance_factor_ == 0) return false;
+  // As in xds_cluster_impl's circuit breaking, calls are only counted once
+  // started, so a burst of picks may briefly exceed the bound.
+  return RingHashEndpointOverloaded(
+      hash_balance_factor_, ready_weights_[endpoint_index],
+      endpoints_[endpoint_index].call_counter->Load(), call_counter_->Load());
+}
+
+template <typename Visit>
+void RingHash::Picker::WalkTable(size_t start, Visit visit) const {
+  const RingHashTable& table = ring_->table();
+  // Most picks stop at the first endpoint, so only then track the others.
+  const size_t first = table.endpoint_index(start);
+  if (!visit(first)) return;
+  std::vector<bool> visited(endpoints_.size());
+  visited[first] = true;
+  size_t num_visited = 1;
+  for (size_t i = 1; i < table.size() && num_visited < table.num_endpoints();
+       ++i) {
+    const size_t endpoint_index =
+        table.endpoint_index((start + i) % table.size());
+    if (visited[endpoint_index]) continue;
+    visited[endpoint_index] = true;
+    ++num_visited;
+    if (!visit(endpoint_index)) return;
+  }
+}
+
+RingHash::PickResult RingHash::Picker::PickEndpoint(
+    const RingHashEndpoint::EndpointInfo& endpoint_info, PickArgs args) {
+  PickResult result = endpoint_info.picker->Pick(args);
+  if (hash_balance_factor_ == 0) return result;
+  auto* complete_pick = std::get_if<PickResult::Complete>(&result.result);
+  if (complete_pick != nullptr) {
+    complete_pick->subchannel_call_tracker =
+        std::make_unique<SubchannelCallTracker>(
+            std::move(complete_pick->subchannel_call_tracker),
+            endpoint_info.call_counter, call_counter_);
+  }
+  return result;
+}
+
 RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   // Determine request hash.
   bool using_random_hash = false;
@@ -354,63 +571,64 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
       using_random_hash = true;
     }
   }
-  // Find the index in the ring to use for this RPC.
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and index. Do not change them!
-  const auto& ring = ring_->ring();
-  int64_t lowp = 0;
-  int64_t highp = ring.size();
-  int64_t index = 0;
-  while (true) {
-    index = (lowp + highp) / 2;
-    if (index == static_cast<int64_t>(ring.size())) {
-      index = 0;
-      break;
-    }
-    uint64_t midval = ring[index].hash;
-    uint64_t midval1 = index == 0 ? 0 : ring[index - 1].hash;
-    if (request_hash <= midval && request_hash > midval1) {
-      break;
-    }
-    if (midval < request_hash) {
-      lowp = index + 1;
-    } else {
-      highp = index - 1;
-    }
-    if (lowp > highp) {
-      index = 0;
-      break;
-    }
-  }
-  // Find the first endpoint we can use from the selected index.
+  // Find the position in the table to use for this RPC.
+  const RingHashTable& table = ring_->table();
+  const size_t start = table.Find(request_hash);
+  // Find the first endpoint we can use from the selected position.
   if (!using_random_hash) {
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    // With bounded loads, overloaded READY endpoints are passed over, and
+    // the first of them is used only if no other endpoint can take the
+    // call right away.
+    const RingHashEndpoint::EndpointInfo* picked_endpoint = nullptr;
+    const RingHashEndpoint::EndpointInfo* overloaded_endpoint = nullptr;
+    bool requested_connection = false;
+    bool queue = false;
+    WalkTable(start, [&](size_t endpoint_index) {
+      const auto& endpoint_info = endpoints_[endpoint_index];
       switch (endpoint_info.state) {
         case GRPC_CHANNEL_READY:
-          return endpoint_info.picker->Pick(args);
+          if (!IsOverloaded(endpoint_index)) {
+            picked_endpoint = &endpoint_info;
+            return false;
+          }
+          if (overloaded_endpoint == nullptr) {
+            overloaded_endpoint = &endpoint_info;
+          }
+          break;
         case GRPC_CHANNEL_IDLE:
-          new EndpointConnectionAttempter(
-              ring_hash_.Ref(DEBUG_LOCATION, "EndpointConnectionAttempter"),
-              endpoint_info.endpoint);
+          if (!requested_connection) {
+            new EndpointConnectionAttempter(
+                ring_hash_.Ref(DEBUG_LOCATION, "EndpointConnectionAttempter"),
+                endpoint_info.endpoint);
+            requested_connection = true;
+          }
           [[fallthrough]];
         case GRPC_CHANNEL_CONNECTING:
-          return PickResult::Queue();
+          if (overloaded_endpoint == nullptr) {
+            queue = true;
+            return false;
+          }
+          break;
         default:
           break;
       }
+      return true;
+    });
+    if (picked_endpoint != nullptr) return PickEndpoint(*picked_endpoint, args);
+    if (queue) return PickResult::Queue();
+    if (overloaded_endpoint != nullptr) {
+      return PickEndpoint(*overloaded_endpoint, args);
     }
   } else {
     // Using a random hash.  We will use the first READY endpoint we
     // find, triggering at most one endpoint to attempt connecting.
     bool requested_connection = has_endpoint_in_connecting_state_;
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    const RingHashEndpoint::EndpointInfo* ready_endpoint = nullptr;
+    WalkTable(start, [&](size_t endpoint_index) {
+      const auto& endpoint_info = endpoints_[endpoint_index];
       if (endpoint_info.state == GRPC_CHANNEL_READY) {
-        return endpoint_info.picker->Pick(args);
+        ready_endpoint = &endpoint_info;
+        return false;
       }
       if (!requested_connection && endpoint_info.state == GRPC_CHANNEL_IDLE) {
         new EndpointConnectionAttempter(
@@ -418,12 +636,14 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
             endpoint_info.endpoint);
         requested_connection = true;
       }
-    }
+      return true;
+    });
+    if (ready_endpoint != nullptr) return PickEndpoint(*ready_endpoint, args);
     if (requested_connection) return PickResult::Queue();
   }
   std::string message = absl::StrCat(
       "ring hash cannot find a connected endpoint; first failure: ",
-      endpoints_[ring[index].endpoint_index].status.message());
+      endpoints_[table.endpoint_index(start)].status.message());
   if (!resolution_note_.empty()) {
     absl::StrAppend(&message, " (", resolution_note_, ")");
   }
@@ -435,103 +655,44 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
 //
 
 RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
-  // Store the weights while finding the sum.
-  struct EndpointWeight {
-    std::string hash_key;  // By default, endpoint's first address.
-    // Default weight is 1 for the cases where a weight is not provided,
-    // each occurrence of the address will be counted a weight value of 1.
-    uint32_t weight = 1;
-    double normalized_weight;
-  };
-  std::vector<EndpointWeight> endpoint_weights;
-  size_t sum = 0;
   const EndpointAddressesList& endpoints = ring_hash->endpoints_;
-  endpoint_weights.reserve(endpoints.size());
+  std::vector<std::string> hash_keys;  // By default, endpoint's first address.
+  std::vector<RingHashTable::Endpoint> table_endpoints;
+  hash_keys.reserve(endpoints.size());
+  table_endpoints.reserve(endpoints.size());
+  weights_.reserve(endpoints.size());
   for (const auto& endpoint : endpoints) {
-    EndpointWeight endpoint_weight;
     auto hash_key =
         endpoint.args().GetString(GRPC_ARG_RING_HASH_ENDPOINT_HASH_KEY);
     if (hash_key.has_value()) {
-      endpoint_weight.hash_key = std::string(*hash_key);
+      hash_keys.emplace_back(*hash_key);
     } else {
-      endpoint_weight.hash_key =
-          grpc_sockaddr_to_string(&endpoint.addresses().front(), false).value();
+      hash_keys.push_back(
+          grpc_sockaddr_to_string(&endpoint.addresses().front(), false)
+              .value());
     }
+    // Default weight is 1 for the cases where a weight is not provided,
+    // each occurrence of the address will be counted a weight value of 1.
     // Weight should never be zero, but ignore it just in case, since
-    // that value would screw up the ring-building algorithm.
+    // that value would screw up the table-building algorithms.
+    uint32_t weight = 1;
     auto weight_arg = endpoint.args().GetInt(GRPC_ARG_ADDRESS_WEIGHT);
-    if (weight_arg.value_or(0) > 0) {
-      endpoint_weight.weight = *weight_arg;
-    }
-    sum += endpoint_weight.weight;
-    endpoint_weights.push_back(std::move(endpoint_weight));
-  }
-  // Calculating normalized weights and find min and max.
-  double min_normalized_weight = 1.0;
-  double max_normalized_weight = 0.0;
-  for (auto& endpoint_weight : endpoint_weights) {
-    endpoint_weight.normalized_weight =
-        static_cast<double>(endpoint_weight.weight) / sum;
-    min_normalized_weight =
-        std::min(endpoint_weight.normalized_weight, min_normalized_weight);
-    max_normalized_weight =
-        std::max(endpoint_weight.normalized_weight, max_normalized_weight);
-  }
-  // Scale up the number of hashes per host such that the least-weighted host
-  // gets a whole number of hashes on the ring. Other hosts might not end up
-  // with whole numbers, and that's fine (the ring-building algorithm below can
-  // handle this). This preserves the original implementation's behavior: when
-  // weights aren't provided, all hosts should get an equal number of hashes. In
-  // the case where this number exceeds the max_ring_size, it's scaled back down
-  // to fit.
+    if (weight_arg.value_or(0) > 0) weight = *weight_arg;
+    weights_.push_back(weight);
+    table_endpoints.push_back({hash_keys.back(), weight});
+  }
+  if (config->use_maglev()) {
+    table_ = RingHashTable::MakeMaglev(table_endpoints,
+                                       config->maglev_table_size());
+    return;
+  }
   const size_t ring_size_cap =
       ring_hash->args_.GetInt(GRPC_ARG_RING_HASH_LB_RING_SIZE_CAP)
           .value_or(kRingSizeCapDefault);
   const size_t min_ring_size = std::min(config->min_ring_size(), ring_size_cap);
   const size_t max_ring_size = std::min(config->max_ring_size(), ring_size_cap);
-  const double scale = std::min(
-      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
-      static_cast<double>(max_ring_size));
-  // Reserve memory for the entire ring up front.
-  const uint64_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
-  // Populate the hash ring by walking through the (host, weight) pairs in
-  // normalized_host_weights, and generating (scale * weight) hashes for each
-  // host. Since these aren't necessarily whole numbers, we maintain running
-  // sums -- current_hashes and target_hashes -- which allows us to populate the
-  // ring in a mostly stable way.
-  absl::InlinedVector<char, 196> hash_key_buffer;
-  double current_hashes = 0.0;
-  double target_hashes = 0.0;
-  uint64_t min_hashes_per_host = ring_size;
-  uint64_t max_hashes_per_host = 0;
-  for (size_t i = 0; i < endpoints.size(); ++i) {
-    const std::string& hash_key = endpoint_weights[i].hash_key;
-    hash_key_buffer.assign(hash_key.begin(), hash_key.end());
-    hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
-    target_hashes += scale * endpoint_weights[i].normalized_weight;
-    size_t count = 0;
-    while (current_hashes < target_hashes) {
-      const std::string count_str = absl::StrCat(count);
-      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
-      absl::string_view hash_key(hash_key_buffer.data(),
-                                 hash_key_buffer.size());
-      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, i});
-      ++count;
-      ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
-    }
-    min_hashes_per_host =
-        std::min(static_cast<uint64_t>(i), min_hashes_per_host);
-    max_hashes_per_host =
-        std::max(static_cast<uint64_t>(i), max_hashes_per_host);
-  }
-  std::sort(ring_.begin(), ring_.end(),
-            [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
-              return lhs.hash < rhs.hash;
-            });
+  table_ = RingHashTable::MakeRing(table_endpoints, min_ring_size,
+                                   max_ring_size);
 }
 
 //
@@ -732,6 +893,7 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
   // Save config.
   auto* config = DownCast<RingHashLbConfig*>(args.config.get());
   request_hash_header_ = RefCountedStringValue(config->request_hash_header());
+  hash_balance_factor_ = config->hash_balance_factor();
   // Build new ring.
   ring_ = MakeRefCounted<Ring>(this, config);
   // Update endpoint map.
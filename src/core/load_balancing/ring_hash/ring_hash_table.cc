@@ -0,0 +1,207 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/ring_hash/ring_hash_table.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "absl/container/inlined_vector.h"
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/util/xxhash_inline.h"
+
+namespace grpc_core {
+
+RingHashTable RingHashTable::MakeRing(absl::Span<const Endpoint> endpoints,
+                                      size_t min_ring_size,
+                                      size_t max_ring_size) {
+  RingHashTable table;
+  if (endpoints.empty()) return table;
+  uint64_t sum = 0;
+  for (const Endpoint& endpoint : endpoints) sum += endpoint.weight;
+  // Calculating normalized weights and find the min.
+  std::vector<double> normalized_weights;
+  normalized_weights.reserve(endpoints.size());
+  double min_normalized_weight = 1.0;
+  for (const Endpoint& endpoint : endpoints) {
+    const double normalized_weight =
+        static_cast<double>(endpoint.weight) / sum;
+    normalized_weights.push_back(normalized_weight);
+    min_normalized_weight = std::min(normalized_weight, min_normalized_weight);
+  }
+  // Scale up the number of hashes per host such that the least-weighted host
+  // gets a whole number of hashes on the ring. Other hosts might not end up
+  // with whole numbers, and that's fine (the ring-building algorithm below can
+  // handle this). This preserves the original implementation's behavior: when
+  // weights aren't provided, all hosts should get an equal number of hashes. In
+  // the case where this number exceeds the max_ring_size, it's scaled back down
+  // to fit.
+  const double scale = std::min(
+      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
+      static_cast<double>(max_ring_size));
+  // Reserve memory for the entire ring up front.
+  const uint64_t ring_size = std::ceil(scale);
+  std::vector<std::pair<uint64_t, uint32_t>> ring;
+  ring.reserve(ring_size);
+  // Populate the hash ring by walking through the (host, weight) pairs in
+  // normalized_host_weights, and generating (scale * weight) hashes for each
+  // host. Since these aren't necessarily whole numbers, we maintain running
+  // sums -- current_hashes and target_hashes -- which allows us to populate the
+  // ring in a mostly stable way.
+  absl::InlinedVector<char, 196> hash_key_buffer;
+  double current_hashes = 0.0;
+  double target_hashes = 0.0;
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    const absl::string_view hash_key = endpoints[i].hash_key;
+    hash_key_buffer.assign(hash_key.begin(), hash_key.end());
+    hash_key_buffer.emplace_back('_');
+    auto offset_start = hash_key_buffer.end();
+    target_hashes += scale * normalized_weights[i];
+    size_t count = 0;
+    while (current_hashes < target_hashes) {
+      const std::string count_str = absl::StrCat(count);
+      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
+      const uint64_t hash =
+          XXH64(hash_key_buffer.data(), hash_key_buffer.size(), 0);
+      ring.emplace_back(hash, i);
+      ++count;
+      ++current_hashes;
+      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
+    }
+  }
+  std::sort(ring.begin(), ring.end(),
+            [](const std::pair<uint64_t, uint32_t>& lhs,
+               const std::pair<uint64_t, uint32_t>& rhs) -> bool {
+              return lhs.first < rhs.first;
+            });
+  table.hashes_.reserve(ring.size());
+  table.endpoint_indices_.reserve(ring.size());
+  for (const auto& [hash, endpoint_index] : ring) {
+    table.hashes_.push_back(hash);
+    table.endpoint_indices_.push_back(endpoint_index);
+  }
+  table.CountEndpoints(endpoints.size());
+  return table;
+}
+
+RingHashTable RingHashTable::MakeMaglev(absl::Span<const Endpoint> endpoints,
+                                        size_t table_size) {
+  CHECK_GT(table_size, 1u);
+  RingHashTable table;
+  if (endpoints.empty()) return table;
+  // Each endpoint fills the first free slot of its own permutation of the
+  // positions, given by an offset and a skip derived from its hash key.
+  // Endpoints take turns in rounds; an endpoint whose weight is 1/n of the
+  // largest weight only takes a turn every n rounds.
+  struct Permutation {
+    uint64_t next;  // Next position to try.
+    uint64_t skip;
+    double weight;  // Relative to the largest weight.
+    double target;  // Round at which the endpoint takes its next turn.
+  };
+  uint32_t max_weight = 0;
+  for (const Endpoint& endpoint : endpoints) {
+    max_weight = std::max(endpoint.weight, max_weight);
+  }
+  std::vector<Permutation> permutations;
+  permutations.reserve(endpoints.size());
+  for (const Endpoint& endpoint : endpoints) {
+    const absl::string_view key = endpoint.hash_key;
+    permutations.push_back(
+        {XXH64(key.data(), key.size(), 0) % table_size,
+         XXH64(key.data(), key.size(), 1) % (table_size - 1) + 1,
+         static_cast<double>(endpoint.weight) / max_weight, 0.0});
+  }
+  constexpr uint32_t kEmpty = std::numeric_limits<uint32_t>::max();
+  table.endpoint_indices_.assign(table_size, kEmpty);
+  size_t filled = 0;
+  for (uint64_t round = 0; filled < table_size; ++round) {
+    for (size_t i = 0; i < permutations.size() && filled < table_size; ++i) {
+      Permutation& permutation = permutations[i];
+      if (round * permutation.weight < permutation.target) continue;
+      permutation.target += 1.0;
+      // Since table_size is prime, every skip is coprime with it, so this
+      // visits every position before repeating.
+      while (table.endpoint_indices_[permutation.next] != kEmpty) {
+        permutation.next = (permutation.next + permutation.skip) % table_size;
+      }
+      table.endpoint_indices_[permutation.next] = i;
+      permutation.next = (permutation.next + permutation.skip) % table_size;
+      ++filled;
+    }
+  }
+  table.CountEndpoints(endpoints.size());
+  return table;
+}
+
+void RingHashTable::CountEndpoints(size_t max_endpoints) {
+  std::vector<bool> present(max_endpoints);
+  for (uint32_t endpoint_index : endpoint_indices_) {
+    if (!present[endpoint_index]) {
+      present[endpoint_index] = true;
+      ++num_endpoints_;
+    }
+  }
+}
+
+size_t RingHashTable::Find(uint64_t hash) const {
+  if (hashes_.empty()) return hash % endpoint_indices_.size();
+  // Find the index in the ring to use for this RPC.
+  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
+  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
+  // for lowp, highp, and index. Do not change them!
+  int64_t lowp = 0;
+  int64_t highp = hashes_.size();
+  int64_t index = 0;
+  while (true) {
+    index = (lowp + highp) / 2;
+    if (index == static_cast<int64_t>(hashes_.size())) {
+      index = 0;
+      break;
+    }
+    uint64_t midval = hashes_[index];
+    uint64_t midval1 = index == 0 ? 0 : hashes_[index - 1];
+    if (hash <= midval && hash > midval1) {
+      break;
+    }
+    if (midval < hash) {
+      lowp = index + 1;
+    } else {
+      highp = index - 1;
+    }
+    if (lowp > highp) {
+      index = 0;
+      break;
+    }
+  }
+  return index;
+}
+
+bool RingHashEndpointOverloaded(uint32_t hash_balance_factor,
+                                double normalized_weight,
+                                uint64_t endpoint_calls, uint64_t total_calls) {
+  const double capacity = std::ceil(hash_balance_factor / 100.0 *
+                                    (total_calls + 1) * normalized_weight);
+  return endpoint_calls + 1 > capacity;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,96 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_RING_HASH_TABLE_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_RING_HASH_TABLE_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace grpc_core {
+
+// Maps request hashes to endpoints for the ring_hash LB policy.
+//
+// The table is a sequence of positions, each naming an endpoint.  A pick
+// starts at Find(hash); if that endpoint can't be used, it moves on to the
+// following positions, wrapping around at the end.  Immutable once built, so
+// it can be used for concurrent picks without locking.
+class RingHashTable final {
+ public:
+  struct Endpoint {
+    absl::string_view hash_key;
+    uint32_t weight;  // Must be non-zero.
+  };
+
+  // Builds a ketama-style ring: each endpoint is hashed onto the ring a
+  // number of times proportional to its weight, with the ring size chosen
+  // between min_ring_size and max_ring_size so that the least-weighted
+  // endpoint gets a whole number of entries.  Find() is O(log(size)).
+  static RingHashTable MakeRing(absl::Span<const Endpoint> endpoints,
+                                size_t min_ring_size, size_t max_ring_size);
+
+  // Builds a Maglev lookup table (Eisenbud et al., NSDI 2016) with
+  // table_size positions, each endpoint filling a share of them
+  // proportional to its weight.  table_size must be prime and should be
+  // much larger than the number of endpoints; when an endpoint is added or
+  // removed, few positions change owner.  Find() is O(1).
+  static RingHashTable MakeMaglev(absl::Span<const Endpoint> endpoints,
+                                  size_t table_size);
+
+  size_t size() const { return endpoint_indices_.size(); }
+
+  // Returns the number of distinct endpoints with at least one position.
+  size_t num_endpoints() const { return num_endpoints_; }
+
+  // Returns the position at which a pick for hash starts.  The table must
+  // not be empty.
+  size_t Find(uint64_t hash) const;
+
+  // Returns the index into the endpoints passed at construction of the
+  // endpoint at position.
+  size_t endpoint_index(size_t position) const {
+    return endpoint_indices_[position];
+  }
+
+ private:
+  // Sets num_endpoints_ once endpoint_indices_ is filled in.
+  void CountEndpoints(size_t max_endpoints);
+
+  // Sorted ring hashes, parallel to endpoint_indices_.  Empty for Maglev
+  // tables, which are indexed directly.
+  std::vector<uint64_t> hashes_;
+  std::vector<uint32_t> endpoint_indices_;
+  size_t num_endpoints_ = 0;
+};
+
+// Consistent hashing with bounded loads (Mirrokni et al., 2016): returns
+// true if an endpoint with endpoint_calls calls in flight out of total_calls
+// already has hash_balance_factor percent of its share of them, counting the
+// call being picked.  normalized_weight is the endpoint's share of the total
+// weight.
+bool RingHashEndpointOverloaded(uint32_t hash_balance_factor,
+                                double normalized_weight,
+                                uint64_t endpoint_calls, uint64_t total_calls);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_RING_HASH_TABLE_H
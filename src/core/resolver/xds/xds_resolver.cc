@@ -253,6 +253,7 @@ class XdsResolver final : public Resolver {
 
     std::map<absl::string_view, RefCountedPtr<ClusterRef>> clusters_;
     std::vector<RouteEntry> routes_;
+    XdsRouting::RouteIndex route_index_;
   };
 
   class XdsConfigSelector final : public ConfigSelector {
@@ -422,14 +423,15 @@ XdsResolver::RouteConfigData::Create(
       return status;
     }
   }
+  data->route_index_ = XdsRouting::RouteIndex(RouteListIterator(data.get()));
   return data;
 }
 
 XdsResolver::RouteConfigData::RouteEntry*
 XdsResolver::RouteConfigData::GetRouteForRequest(
     absl::string_view path, grpc_metadata_batch* initial_metadata) {
-  auto route_index = XdsRouting::GetRouteForRequest(RouteListIterator(this),
-                                                    path, initial_metadata);
+  auto route_index = route_index_.GetRouteForRequest(RouteListIterator(this),
+                                                     path, initial_metadata);
   if (!route_index.has_value()) {
     return nullptr;
   }
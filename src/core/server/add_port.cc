@@ -14,6 +14,7 @@
 
 #include <grpc/grpc.h>
 
+#include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
 #include "src/core/config/core_configuration.h"
@@ -59,8 +60,10 @@ int grpc_server_add_http2_port(grpc_server* server, const char* addr,
     }
     args = args.SetObject(creds->Ref()).SetObject(sc);
   }
+  // shm: addresses can only be served by the shared memory transport.
   std::vector<absl::string_view> transport_preferences = absl::StrSplit(
-      args.GetString(GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS).value_or("h2"),
+      args.GetString(GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS)
+          .value_or(absl::StartsWith(addr, "shm:") ? "shm" : "h2"),
       ',');
   if (transport_preferences.size() != 1) {
     LOG(ERROR) << "Failed to add port to server: "
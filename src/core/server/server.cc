@@ -44,6 +44,7 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "src/core/call/deadline_coalescer.h"
 #include "src/core/call/interception_chain.h"
 #include "src/core/call/server_call.h"
 #include "src/core/channelz/channel_trace.h"
@@ -1191,7 +1192,8 @@ Server::MakeCallDestination(const ChannelArgs& args,
 
 Server::Server(const ChannelArgs& args)
     : channelz::DataSource(CreateChannelzNode(args)),
-      channel_args_(args),
+      // Calls on all connections share the server's deadline timers.
+      channel_args_(DeadlineCoalescer::ShareFromChannelArgs(args)),
       channelz_node_(channelz::DataSource::channelz_node() == nullptr
                          ? nullptr
                          : channelz::DataSource::channelz_node()
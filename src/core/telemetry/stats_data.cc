@@ -401,6 +401,10 @@ const absl::string_view
         "cq_pluck_creates",
         "cq_next_creates",
         "cq_callback_creates",
+        "call_deadline_timers_armed",
+        "call_deadline_timers_shared",
+        "call_arena_storage_allocated",
+        "call_arena_storage_recycled",
         "wrr_updates",
         "work_serializer_items_enqueued",
         "work_serializer_items_dequeued",
@@ -438,6 +442,11 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "usage)",
     "Number of completion queues created for cq_callback (indicates callback "
     "api usage)",
+    "Number of EventEngine timers started to enforce call deadlines",
+    "Number of call deadlines that joined a timer already started for another "
+    "call",
+    "Number of call arenas whose storage was newly allocated",
+    "Number of call arenas that reused the storage of a finished call",
     "Number of wrr updates that have been received",
     "Number of items enqueued onto work serializers",
     "Number of items dequeued from work serializers",
@@ -529,6 +538,10 @@ GlobalStats::GlobalStats()
       cq_pluck_creates{0},
       cq_next_creates{0},
       cq_callback_creates{0},
+      call_deadline_timers_armed{0},
+      call_deadline_timers_shared{0},
+      call_arena_storage_allocated{0},
+      call_arena_storage_recycled{0},
       wrr_updates{0},
       work_serializer_items_enqueued{0},
       work_serializer_items_dequeued{0},
@@ -661,6 +674,14 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.cq_next_creates.load(std::memory_order_relaxed);
     result->cq_callback_creates +=
         data.cq_callback_creates.load(std::memory_order_relaxed);
+    result->call_deadline_timers_armed +=
+        data.call_deadline_timers_armed.load(std::memory_order_relaxed);
+    result->call_deadline_timers_shared +=
+        data.call_deadline_timers_shared.load(std::memory_order_relaxed);
+    result->call_arena_storage_allocated +=
+        data.call_arena_storage_allocated.load(std::memory_order_relaxed);
+    result->call_arena_storage_recycled +=
+        data.call_arena_storage_recycled.load(std::memory_order_relaxed);
     result->wrr_updates += data.wrr_updates.load(std::memory_order_relaxed);
     result->work_serializer_items_enqueued +=
         data.work_serializer_items_enqueued.load(std::memory_order_relaxed);
@@ -757,6 +778,14 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->cq_pluck_creates = cq_pluck_creates - other.cq_pluck_creates;
   result->cq_next_creates = cq_next_creates - other.cq_next_creates;
   result->cq_callback_creates = cq_callback_creates - other.cq_callback_creates;
+  result->call_deadline_timers_armed =
+      call_deadline_timers_armed - other.call_deadline_timers_armed;
+  result->call_deadline_timers_shared =
+      call_deadline_timers_shared - other.call_deadline_timers_shared;
+  result->call_arena_storage_allocated =
+      call_arena_storage_allocated - other.call_arena_storage_allocated;
+  result->call_arena_storage_recycled =
+      call_arena_storage_recycled - other.call_arena_storage_recycled;
   result->wrr_updates = wrr_updates - other.wrr_updates;
   result->work_serializer_items_enqueued =
       work_serializer_items_enqueued - other.work_serializer_items_enqueued;
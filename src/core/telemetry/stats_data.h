@@ -287,6 +287,10 @@ struct GlobalStats {
     kCqPluckCreates,
     kCqNextCreates,
     kCqCallbackCreates,
+    kCallDeadlineTimersArmed,
+    kCallDeadlineTimersShared,
+    kCallArenaStorageAllocated,
+    kCallArenaStorageRecycled,
     kWrrUpdates,
     kWorkSerializerItemsEnqueued,
     kWorkSerializerItemsDequeued,
@@ -357,6 +361,10 @@ struct GlobalStats {
       uint64_t cq_pluck_creates;
       uint64_t cq_next_creates;
       uint64_t cq_callback_creates;
+      uint64_t call_deadline_timers_armed;
+      uint64_t call_deadline_timers_shared;
+      uint64_t call_arena_storage_allocated;
+      uint64_t call_arena_storage_recycled;
       uint64_t wrr_updates;
       uint64_t work_serializer_items_enqueued;
       uint64_t work_serializer_items_dequeued;
@@ -462,6 +470,22 @@ class GlobalStatsCollector {
     data_.this_cpu().cq_callback_creates.fetch_add(1,
                                                    std::memory_order_relaxed);
   }
+  void IncrementCallDeadlineTimersArmed() {
+    data_.this_cpu().call_deadline_timers_armed.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCallDeadlineTimersShared() {
+    data_.this_cpu().call_deadline_timers_shared.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCallArenaStorageAllocated() {
+    data_.this_cpu().call_arena_storage_allocated.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCallArenaStorageRecycled() {
+    data_.this_cpu().call_arena_storage_recycled.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementWrrUpdates() {
     data_.this_cpu().wrr_updates.fetch_add(1, std::memory_order_relaxed);
   }
@@ -608,6 +632,10 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> cq_pluck_creates{0};
     std::atomic<uint64_t> cq_next_creates{0};
     std::atomic<uint64_t> cq_callback_creates{0};
+    std::atomic<uint64_t> call_deadline_timers_armed{0};
+    std::atomic<uint64_t> call_deadline_timers_shared{0};
+    std::atomic<uint64_t> call_arena_storage_allocated{0};
+    std::atomic<uint64_t> call_arena_storage_recycled{0};
     std::atomic<uint64_t> wrr_updates{0};
     std::atomic<uint64_t> work_serializer_items_enqueued{0};
     std::atomic<uint64_t> work_serializer_items_dequeued{0};
@@ -49,6 +49,12 @@
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+#if defined(OPENSSL_IS_BORINGSSL)
+#include <openssl/hkdf.h>
+#include <openssl/mem.h>
+#endif
+
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string>
@@ -151,6 +157,9 @@ struct tsi_ssl_handshaker_result {
   BIO* network_io;
   unsigned char* unused_bytes;
   size_t unused_bytes_size;
+  // Records sealed before the write keys were exported.
+  unsigned char* ktls_bytes_to_send;
+  size_t ktls_bytes_to_send_size;
 };
 struct tsi_ssl_frame_protector {
   tsi_frame_protector base;
@@ -1654,9 +1663,139 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   SSL_free(impl->ssl);
   BIO_free(impl->network_io);
   gpr_free(impl->unused_bytes);
+  gpr_free(impl->ktls_bytes_to_send);
   gpr_free(impl);
 }
 
+#if defined(OPENSSL_IS_BORINGSSL)
+
+static void ssl_ktls_write_sequence(uint64_t sequence, unsigned char* out) {
+  for (int i = 7; i >= 0; i--) {
+    out[i] = static_cast<unsigned char>(sequence & 0xff);
+    sequence >>= 8;
+  }
+}
+
+// HKDF-Expand-Label (RFC 8446, section 7.1) with an empty context.
+static bool ssl_ktls_hkdf_expand_label(const EVP_MD* digest,
+                                       const uint8_t* secret,
+                                       size_t secret_size,
+                                       absl::string_view label,
+                                       unsigned char* out, size_t out_size) {
+  constexpr absl::string_view kLabelPrefix = "tls13 ";
+  uint8_t info[4 + kLabelPrefix.size() + 8];
+  const size_t label_size = kLabelPrefix.size() + label.size();
+  if (label_size + 4 > sizeof(info)) return false;
+  size_t info_size = 0;
+  info[info_size++] = static_cast<uint8_t>(out_size >> 8);
+  info[info_size++] = static_cast<uint8_t>(out_size);
+  info[info_size++] = static_cast<uint8_t>(label_size);
+  memcpy(info + info_size, kLabelPrefix.data(), kLabelPrefix.size());
+  info_size += kLabelPrefix.size();
+  memcpy(info + info_size, label.data(), label.size());
+  info_size += label.size();
+  info[info_size++] = 0;
+  return HKDF_expand(out, out_size, digest, secret, secret_size, info,
+                     info_size) == 1;
+}
+
+// Derives the TLS 1.3 write key and nonce of one direction from its traffic
+// secret.
+static bool ssl_ktls_derive_tls13_keys(const EVP_MD* digest,
+                                       bssl::Span<const uint8_t> secret,
+                                       tsi_ktls_crypto_info* info) {
+  unsigned char iv[12];
+  if (!ssl_ktls_hkdf_expand_label(digest, secret.data(), secret.size(), "key",
+                                  info->key, info->key_size) ||
+      !ssl_ktls_hkdf_expand_label(digest, secret.data(), secret.size(), "iv",
+                                  iv, sizeof(iv))) {
+    return false;
+  }
+  memcpy(info->salt, iv, sizeof(info->salt));
+  memcpy(info->iv, iv + sizeof(info->salt), sizeof(info->iv));
+  return true;
+}
+
+static tsi_result ssl_handshaker_result_get_ktls_tx_crypto_info(
+    tsi_handshaker_result* self, tsi_ktls_crypto_info* tx,
+    const unsigned char** bytes_to_send, size_t* bytes_to_send_size) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(self);
+  SSL* ssl = impl->ssl;
+  // The SSL object moves to the frame protector once one is created.
+  if (ssl == nullptr || impl->ktls_bytes_to_send != nullptr) {
+    return TSI_FAILED_PRECONDITION;
+  }
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+  if (cipher == nullptr) return TSI_FAILED_PRECONDITION;
+  tsi_ktls_cipher ktls_cipher;
+  size_t key_size;
+  switch (SSL_CIPHER_get_cipher_nid(cipher)) {
+    case NID_aes_128_gcm:
+      ktls_cipher = TSI_KTLS_CIPHER_AES_128_GCM;
+      key_size = 16;
+      break;
+    case NID_aes_256_gcm:
+      ktls_cipher = TSI_KTLS_CIPHER_AES_256_GCM;
+      key_size = 32;
+      break;
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  const uint16_t version = static_cast<uint16_t>(SSL_version(ssl));
+  *tx = {};
+  tx->version = version;
+  tx->cipher = ktls_cipher;
+  tx->key_size = key_size;
+  // Records BoringSSL sealed already, e.g. a TLS 1.3 server's session
+  // tickets, are counted in the write sequence.
+  ssl_ktls_write_sequence(SSL_get_write_sequence(ssl), tx->rec_seq);
+  if (version == TLS1_2_VERSION) {
+    // For AEAD ciphers the key block holds no MAC keys: it is the client and
+    // server write keys followed by their 4 byte implicit nonces.
+    unsigned char key_block[2 * (32 + 4)];
+    const size_t key_block_size = 2 * (key_size + 4);
+    if (SSL_get_key_block_len(ssl) != key_block_size) return TSI_UNIMPLEMENTED;
+    if (!SSL_generate_key_block(ssl, key_block, key_block_size)) {
+      return TSI_INTERNAL_ERROR;
+    }
+    const size_t index = SSL_is_server(ssl) ? 1 : 0;
+    memcpy(tx->key, key_block + index * key_size, key_size);
+    memcpy(tx->salt, key_block + 2 * key_size + index * 4, 4);
+    OPENSSL_cleanse(key_block, sizeof(key_block));
+    // BoringSSL uses the sequence number as the explicit nonce.
+    memcpy(tx->iv, tx->rec_seq, sizeof(tx->iv));
+  } else if (version == TLS1_3_VERSION) {
+    bssl::Span<const uint8_t> read_secret;
+    bssl::Span<const uint8_t> write_secret;
+    const EVP_MD* digest = SSL_CIPHER_get_handshake_digest(cipher);
+    if (digest == nullptr ||
+        !bssl::SSL_get_traffic_secrets(ssl, &read_secret, &write_secret) ||
+        !ssl_ktls_derive_tls13_keys(digest, write_secret, tx)) {
+      OPENSSL_cleanse(tx, sizeof(*tx));
+      return TSI_INTERNAL_ERROR;
+    }
+  } else {
+    return TSI_UNIMPLEMENTED;
+  }
+  // Hand over what is left in the write buffer, which the frame protector
+  // would otherwise send ahead of its first record.
+  const int pending = std::max(BIO_pending(impl->network_io), 0);
+  impl->ktls_bytes_to_send_size = static_cast<size_t>(pending);
+  impl->ktls_bytes_to_send = static_cast<unsigned char*>(
+      gpr_malloc(std::max<size_t>(impl->ktls_bytes_to_send_size, 1)));
+  if (pending > 0 && BIO_read(impl->network_io, impl->ktls_bytes_to_send,
+                              pending) != pending) {
+    OPENSSL_cleanse(tx, sizeof(*tx));
+    return TSI_INTERNAL_ERROR;
+  }
+  *bytes_to_send = impl->ktls_bytes_to_send;
+  *bytes_to_send_size = impl->ktls_bytes_to_send_size;
+  return TSI_OK;
+}
+
+#endif  // defined(OPENSSL_IS_BORINGSSL)
+
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
     ssl_handshaker_result_get_frame_protector_type,
@@ -1664,6 +1803,11 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+#if defined(OPENSSL_IS_BORINGSSL)
+    ssl_handshaker_result_get_ktls_tx_crypto_info,
+#else
+    nullptr,  // get_ktls_tx_crypto_info
+#endif
 };
 
 static tsi_result ssl_handshaker_result_create(
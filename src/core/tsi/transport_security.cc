@@ -291,6 +291,20 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
   return self->vtable->get_unused_bytes(self, bytes, bytes_size);
 }
 
+tsi_result tsi_handshaker_result_get_ktls_tx_crypto_info(
+    tsi_handshaker_result* self, tsi_ktls_crypto_info* tx,
+    const unsigned char** bytes_to_send, size_t* bytes_to_send_size) {
+  if (self == nullptr || self->vtable == nullptr || tx == nullptr ||
+      bytes_to_send == nullptr || bytes_to_send_size == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->get_ktls_tx_crypto_info == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->get_ktls_tx_crypto_info(self, tx, bytes_to_send,
+                                               bytes_to_send_size);
+}
+
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self) {
   if (self == nullptr) return;
   self->vtable->destroy(self);
@@ -118,6 +118,12 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  // May be null if the result cannot hand its record layer over to the
+  // operating system.
+  tsi_result (*get_ktls_tx_crypto_info)(tsi_handshaker_result* self,
+                                        tsi_ktls_crypto_info* tx,
+                                        const unsigned char** bytes_to_send,
+                                        size_t* bytes_to_send_size);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
@@ -279,6 +279,43 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
     const tsi_handshaker_result* self, const unsigned char** bytes,
     size_t* bytes_size);
 
+// Ciphers whose record protection can be handed to the operating system.
+typedef enum {
+  TSI_KTLS_CIPHER_NONE,
+  TSI_KTLS_CIPHER_AES_128_GCM,
+  TSI_KTLS_CIPHER_AES_256_GCM,
+} tsi_ktls_cipher;
+
+// Record layer state of one direction of a TLS connection, in the form the
+// Linux kernel TLS (kTLS) socket options expect it.
+struct tsi_ktls_crypto_info {
+  // Wire version of the protocol, e.g. 0x0303 for TLS 1.2.
+  uint16_t version;
+  tsi_ktls_cipher cipher;
+  unsigned char key[32];
+  size_t key_size;
+  // Implicit (salt) and explicit parts of the AEAD nonce.
+  unsigned char salt[4];
+  unsigned char iv[8];
+  // Big-endian sequence number of the next record.
+  unsigned char rec_seq[8];
+};
+
+// This method exports the traffic key and sequence number of the sending
+// direction, so that outgoing records can be protected outside of TSI.
+// Records that the result protected already but that were not sent yet, such
+// as the session tickets of a TLS 1.3 server, are returned in bytes_to_send
+// and must be sent, unchanged, before any record protected with tx. The
+// result owns them. The receiving direction stays with TSI: incoming records
+// may carry alerts or post-handshake messages that only TSI can process, so a
+// frame protector created from the result must still unprotect them, while
+// its protect side is no longer used. It returns TSI_UNIMPLEMENTED if the
+// result (or its negotiated protocol version or cipher) does not support
+// this, and may be called at most once.
+tsi_result tsi_handshaker_result_get_ktls_tx_crypto_info(
+    tsi_handshaker_result* self, tsi_ktls_crypto_info* tx,
+    const unsigned char** bytes_to_send, size_t* bytes_to_send_size);
+
 // This method releases the tsi_handshaker_handshaker object. After this method
 // is called, no other method can be called on the object.
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self);
@@ -20,7 +20,6 @@
 #include <grpc/support/port_platform.h>
 #include <stdint.h>
 
-#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <functional>
@@ -28,7 +27,6 @@
 #include <thread>
 #include <utility>
 
-#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/lib/debug/trace.h"
@@ -53,6 +51,10 @@ namespace grpc_core {
 // implementations are not starved of threads by long running work
 // serializers. We implement EventEngine::Closure directly to avoid allocating
 // once per callback in the queue when scheduling.
+//
+// Callbacks are queued on an intrusive lock-free MPSC queue, so that Run()
+// never takes a lock: with many producers (eg. subchannel state updates
+// during endpoint churn) a mutex over the queue is heavily contended.
 class WorkSerializer::WorkSerializerImpl
     : public Orphanable,
       public grpc_event_engine::experimental::EventEngine::Closure {
@@ -71,8 +73,8 @@ class WorkSerializer::WorkSerializerImpl
   }
 #endif
  private:
-  // Wrapper to capture DebugLocation for the callback.
-  struct CallbackWrapper {
+  // Queue node holding a callback, and the DebugLocation it was run from.
+  struct CallbackWrapper final : public MultiProducerSingleConsumerQueue::Node {
     CallbackWrapper(absl::AnyInvocable<void()>&& cb, const DebugLocation& loc)
         : callback(std::forward<absl::AnyInvocable<void()>>(cb)),
           location(loc) {}
@@ -80,19 +82,21 @@ class WorkSerializer::WorkSerializerImpl
     // GPR_NO_UNIQUE_ADDRESS means this is 0 sized in release builds.
     GPR_NO_UNIQUE_ADDRESS DebugLocation location;
   };
-  using CallbackVector = absl::InlinedVector<CallbackWrapper, 1>;
 
-  // Refill processing_ from incoming_
-  // If processing_ is empty, also update running_ and return false.
-  // If additionally orphaned, will also delete this (therefore, it's not safe
-  // to touch any member variables if Refill returns false).
-  bool Refill();
+  // state_ packs the number of callbacks that have been scheduled but not yet
+  // completed (in the upper bits) with an orphaned flag (in the low bit).
+  // - The Run() call that takes the count from zero starts running the
+  //   WorkSerializer on EventEngine, and the callback that takes it back to
+  //   zero stops it.
+  // - Once orphaned with a zero count, the WorkSerializerImpl is deleted.
+  static constexpr uint64_t kOrphanedBit = 1;
+  static constexpr uint64_t kOneCallback = 2;
+  static uint64_t Callbacks(uint64_t state) { return state >> 1; }
 
-  // Perform the parts of Refill that need to acquire mu_
-  // Returns a tri-state indicating whether we were refilled successfully (=>
-  // keep running), or finished, and then if we were orphaned.
-  enum class RefillResult { kRefilled, kFinished, kFinishedAndOrphaned };
-  RefillResult RefillInner();
+  // Record the stats for a run that has just finished.
+  static void RecordRun(std::chrono::steady_clock::time_point start_time,
+                        std::chrono::steady_clock::duration time_running_items,
+                        uint64_t items_processed);
 
 #ifndef NDEBUG
   void SetCurrentThread() { running_work_serializer_ = this; }
@@ -105,38 +109,19 @@ class WorkSerializer::WorkSerializerImpl
   // Member variables are roughly sorted to keep processing cache lines
   // separated from incoming cache lines.
 
-  // Callbacks that are currently being processed.
-  // Only accessed by: a Run() call going from not-running to running, or a
-  // work item being executed in EventEngine -- ie this does not need a mutex
-  // because all access is serialized. Stored in reverse execution order so
-  // that callbacks can be `pop_back()`'d on completion to free up any
-  // resources they hold.
-  CallbackVector processing_;
   // EventEngine instance upon which we'll do our work.
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
-  std::chrono::steady_clock::time_point running_start_time_
-      ABSL_GUARDED_BY(mu_);
+  // Stats for the current run. Written by the Run() call that starts the
+  // run, and thereafter only by the work loop.
+  std::chrono::steady_clock::time_point running_start_time_;
   std::chrono::steady_clock::duration time_running_items_;
   uint64_t items_processed_during_run_;
-  // Flags containing run state:
-  // - running_ goes from false->true whenever the first callback is scheduled
-  //   on an idle WorkSerializer, and transitions back to false after the last
-  //   callback scheduled is completed and the WorkSerializer is again idle.
-  // - orphaned_ transitions to true once upon Orphan being called.
-  // When orphaned_ is true and running_ is false, the WorkSerializerImpl
-  // instance is deleted.
-  bool running_ ABSL_GUARDED_BY(mu_) = false;
-  bool orphaned_ ABSL_GUARDED_BY(mu_) = false;
-  Mutex mu_;
-  // Queued callbacks. New work items land here, and when processing_ is
-  // drained we move this entire queue into processing_ and work on draining
-  // it again. In low traffic scenarios this gives two mutex acquisitions per
-  // work item, but as load increases we get some natural batching and the
-  // rate of mutex acquisitions per work item tends towards 1.
-  CallbackVector incoming_ ABSL_GUARDED_BY(mu_);
-
   GPR_NO_UNIQUE_ADDRESS latent_see::Flow flow_;
+  std::atomic<uint64_t> state_{0};
+  // Queued callbacks. Pushed by any thread in Run(), popped only by the work
+  // loop.
+  MultiProducerSingleConsumerQueue queue_;
 
 #ifndef NDEBUG
   static thread_local WorkSerializerImpl* running_work_serializer_;
@@ -149,15 +134,11 @@ thread_local WorkSerializer::WorkSerializerImpl*
 #endif
 
 void WorkSerializer::WorkSerializerImpl::Orphan() {
-  ReleasableMutexLock lock(&mu_);
-  // If we're not running, then we can delete immediately.
-  if (!running_) {
-    lock.Release();
-    delete this;
-    return;
-  }
-  // Otherwise store a flag to delete when we're done.
-  orphaned_ = true;
+  const uint64_t prev_state =
+      state_.fetch_or(kOrphanedBit, std::memory_order_acq_rel);
+  // If we're not running, then we can delete immediately. Otherwise the last
+  // callback to complete will see the flag and delete us.
+  if (Callbacks(prev_state) == 0) delete this;
 }
 
 // Implementation of WorkSerializerImpl::Run
@@ -167,21 +148,21 @@ void WorkSerializer::WorkSerializerImpl::Run(
       << "WorkSerializer[" << this << "] Scheduling callback ["
       << location.file() << ":" << location.line() << "]";
   global_stats().IncrementWorkSerializerItemsEnqueued();
-  MutexLock lock(&mu_);
-  if (!running_) {
-    // If we were previously idle, insert this callback directly into the
-    // empty processing_ list and start running.
-    running_ = true;
+  const uint64_t prev_state =
+      state_.fetch_add(kOneCallback, std::memory_order_acq_rel);
+  DCHECK_EQ(prev_state & kOrphanedBit, 0u);
+  if (Callbacks(prev_state) == 0) {
+    // If we were previously idle, start running. The work loop cannot
+    // touch the stats for this run before it is scheduled below.
     running_start_time_ = std::chrono::steady_clock::now();
     items_processed_during_run_ = 0;
     time_running_items_ = std::chrono::steady_clock::duration();
-    CHECK(processing_.empty());
-    processing_.emplace_back(std::move(callback), location);
+    queue_.Push(new CallbackWrapper(std::move(callback), location));
     event_engine_->Run(this);
   } else {
-    // We are already running, so add this callback to the incoming_ list.
-    // The work loop will eventually get to it.
-    incoming_.emplace_back(std::move(callback), location);
+    // We are already running, so just queue the callback. The work loop will
+    // eventually get to it.
+    queue_.Push(new CallbackWrapper(std::move(callback), location));
   }
 }
 
@@ -191,20 +172,25 @@ void WorkSerializer::WorkSerializerImpl::Run() {
   flow_.End();
   // TODO(ctiller): remove these when we can deprecate ExecCtx
   ExecCtx exec_ctx;
-  // Grab the last element of processing_ - which is the next item in our
-  // queue since processing_ is stored in reverse order.
-  auto& cb = processing_.back();
+  auto* cb = static_cast<CallbackWrapper*>(queue_.Pop());
+  if (cb == nullptr) {
+    // A callback has been counted but its Run() call is still part way
+    // through pushing it: try again shortly.
+    flow_.Begin(GRPC_LATENT_SEE_METADATA("WorkSerializer::Link"));
+    event_engine_->Run(this);
+    return;
+  }
   GRPC_TRACE_LOG(work_serializer, INFO)
       << "WorkSerializer[" << this << "] Executing callback ["
-      << cb.location.file() << ":" << cb.location.line() << "]";
+      << cb->location.file() << ":" << cb->location.line() << "]";
   // Run the work item.
   const auto start = std::chrono::steady_clock::now();
   SetCurrentThread();
-  cb.callback();
-  // pop_back here destroys the callback - freeing any resources it might
-  // hold. We do so before clearing the current thread in case the callback
-  // destructor wants to check that it's in the WorkSerializer too.
-  processing_.pop_back();
+  cb->callback();
+  // Deleting the wrapper here destroys the callback - freeing any resources
+  // it might hold. We do so before clearing the current thread in case the
+  // callback destructor wants to check that it's in the WorkSerializer too.
+  delete cb;
   ClearCurrentThread();
   global_stats().IncrementWorkSerializerItemsDequeued();
   const auto work_time = std::chrono::steady_clock::now() - start;
@@ -212,65 +198,37 @@ void WorkSerializer::WorkSerializerImpl::Run() {
       std::chrono::duration_cast<std::chrono::milliseconds>(work_time).count());
   time_running_items_ += work_time;
   ++items_processed_during_run_;
-  // Check if we've drained the queue and if so refill it.
-  if (processing_.empty() && !Refill()) return;
-  // There's still work in processing_, so schedule ourselves again on
-  // EventEngine.
-  flow_.Begin(GRPC_LATENT_SEE_METADATA("WorkSerializer::Link"));
-  event_engine_->Run(this);
-}
-
-WorkSerializer::WorkSerializerImpl::RefillResult
-WorkSerializer::WorkSerializerImpl::RefillInner() {
-  // Recover any memory held by processing_, so that we don't grow forever.
-  // Do so before acquiring a lock so we don't cause inadvertent contention.
-  processing_.shrink_to_fit();
-  MutexLock lock(&mu_);
-  // Swap incoming_ into processing_ - effectively lets us release memory
-  // (outside the lock) once per iteration for the storage vectors.
-  processing_.swap(incoming_);
-  // If there were no items, then we've finished running.
-  if (processing_.empty()) {
-    running_ = false;
-    global_stats().IncrementWorkSerializerRunTimeMs(
-        std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::steady_clock::now() - running_start_time_)
-            .count());
-    global_stats().IncrementWorkSerializerWorkTimeMs(
-        std::chrono::duration_cast<std::chrono::milliseconds>(
-            time_running_items_)
-            .count());
-    global_stats().IncrementWorkSerializerItemsPerRun(
-        items_processed_during_run_);
+  // Once the count reaches zero the next Run() call may start a new run, so
+  // take what we need from this one first.
+  const auto running_start_time = running_start_time_;
+  const auto time_running_items = time_running_items_;
+  const uint64_t items_processed = items_processed_during_run_;
+  const uint64_t prev_state =
+      state_.fetch_sub(kOneCallback, std::memory_order_acq_rel);
+  if (Callbacks(prev_state) == 1) {
+    // That was the last callback: we've finished running.
+    RecordRun(running_start_time, time_running_items, items_processed);
     // And if we're also orphaned then it's time to delete this object.
-    if (orphaned_) {
-      return RefillResult::kFinishedAndOrphaned;
-    } else {
-      return RefillResult::kFinished;
-    }
+    if (prev_state & kOrphanedBit) delete this;
+    return;
   }
-  return RefillResult::kRefilled;
+  // There's still work queued, so schedule ourselves again on EventEngine.
+  flow_.Begin(GRPC_LATENT_SEE_METADATA("WorkSerializer::Link"));
+  event_engine_->Run(this);
 }
 
-bool WorkSerializer::WorkSerializerImpl::Refill() {
-  const auto result = RefillInner();
-  switch (result) {
-    case RefillResult::kRefilled:
-      // Reverse processing_ so that we can pop_back() items in the correct
-      // order. (note that this is mostly pointer swaps inside the
-      // std::function's, so should be relatively cheap even for longer
-      // lists). Do so here so we're outside of the RefillInner lock.
-      std::reverse(processing_.begin(), processing_.end());
-      return true;
-    case RefillResult::kFinished:
-      return false;
-    case RefillResult::kFinishedAndOrphaned:
-      // Orphaned and finished - finally delete this object.
-      // Here so that the mutex lock in RefillInner is released.
-      delete this;
-      return false;
-  }
-  GPR_UNREACHABLE_CODE(return false);
+void WorkSerializer::WorkSerializerImpl::RecordRun(
+    std::chrono::steady_clock::time_point start_time,
+    std::chrono::steady_clock::duration time_running_items,
+    uint64_t items_processed) {
+  global_stats().IncrementWorkSerializerRunTimeMs(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start_time)
+          .count());
+  global_stats().IncrementWorkSerializerWorkTimeMs(
+      std::chrono::duration_cast<std::chrono::milliseconds>(time_running_items)
+          .count());
+  global_stats().IncrementWorkSerializerItemsPerRun(items_processed);
 }
 
 //
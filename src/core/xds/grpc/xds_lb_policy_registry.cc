@@ -27,8 +27,10 @@
 #include <variant>
 
 #include "absl/strings/str_cat.h"
+#include "envoy/config/cluster/v3/cluster.upb.h"
 #include "envoy/config/core/v3/extension.upb.h"
 #include "envoy/extensions/load_balancing_policies/client_side_weighted_round_robin/v3/client_side_weighted_round_robin.upb.h"
+#include "envoy/extensions/load_balancing_policies/least_request/v3/least_request.upb.h"
 #include "envoy/extensions/load_balancing_policies/pick_first/v3/pick_first.upb.h"
 #include "envoy/extensions/load_balancing_policies/ring_hash/v3/ring_hash.upb.h"
 #include "envoy/extensions/load_balancing_policies/wrr_locality/v3/wrr_locality.upb.h"
@@ -249,6 +251,46 @@ class WrrLocalityLbPolicyConfigFactory final
   }
 };
 
+class LeastRequestLbPolicyConfigFactory final
+    : public XdsLbPolicyRegistry::ConfigFactory {
+ public:
+  Json::Object ConvertXdsLbPolicyConfig(
+      const XdsLbPolicyRegistry* /*registry*/,
+      const XdsResourceType::DecodeContext& context,
+      absl::string_view configuration, ValidationErrors* errors,
+      int /*recursion_depth*/) override {
+    const auto* resource =
+        envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_parse(
+            configuration.data(), configuration.size(), context.arena);
+    if (resource == nullptr) {
+      errors->AddError("can't decode LeastRequest LB policy config");
+      return {};
+    }
+    // Values above 10 are clamped by the LB policy.
+    uint32_t choice_count =
+        ParseUInt32Value(
+            envoy_extensions_load_balancing_policies_least_request_v3_LeastRequest_choice_count(
+                resource))
+            .value_or(2);
+    if (choice_count < 2) {
+      ValidationErrors::ScopedField field(errors, ".choice_count");
+      errors->AddError("must be at least 2");
+    }
+    return Json::Object{
+        {"least_request",
+         Json::FromObject({
+             {"choiceCount", Json::FromNumber(choice_count)},
+         })}};
+  }
+
+  absl::string_view type() override { return Type(); }
+
+  static absl::string_view Type() {
+    return "envoy.extensions.load_balancing_policies.least_request.v3."
+           "LeastRequest";
+  }
+};
+
 class PickFirstLbPolicyConfigFactory final
     : public XdsLbPolicyRegistry::ConfigFactory {
  public:
@@ -300,6 +342,9 @@ XdsLbPolicyRegistry::XdsLbPolicyRegistry() {
   policy_config_factories_.emplace(
       WrrLocalityLbPolicyConfigFactory::Type(),
       std::make_unique<WrrLocalityLbPolicyConfigFactory>());
+  policy_config_factories_.emplace(
+      LeastRequestLbPolicyConfigFactory::Type(),
+      std::make_unique<LeastRequestLbPolicyConfigFactory>());
   policy_config_factories_.emplace(
       PickFirstLbPolicyConfigFactory::Type(),
       std::make_unique<PickFirstLbPolicyConfigFactory>());
@@ -24,13 +24,17 @@
 
 #include <algorithm>
 #include <cctype>
+#include <functional>
 #include <utility>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/util/matchers.h"
 #include "src/core/xds/grpc/xds_http_filter.h"
@@ -134,6 +138,79 @@ std::optional<size_t> XdsRouting::FindVirtualHostForDomain(
   return target_index;
 }
 
+//
+// XdsRouting::VirtualHostIndex
+//
+
+void XdsRouting::VirtualHostIndex::WildcardTable::Add(std::string fixed_part,
+                                                     size_t vhost_index) {
+  auto pos = std::lower_bound(lengths.begin(), lengths.end(),
+                              fixed_part.size(), std::greater<>());
+  if (pos == lengths.end() || *pos != fixed_part.size()) {
+    lengths.insert(pos, fixed_part.size());
+  }
+  // If the same pattern appears more than once, the first wins.
+  patterns.emplace(std::move(fixed_part), vhost_index);
+}
+
+std::optional<size_t> XdsRouting::VirtualHostIndex::WildcardTable::Find(
+    absl::string_view host, bool suffix) const {
+  for (size_t length : lengths) {
+    // Asterisk must match at least one char.
+    if (length >= host.size()) continue;
+    auto it = patterns.find(suffix ? host.substr(host.size() - length)
+                                   : host.substr(0, length));
+    if (it != patterns.end()) return it->second;
+  }
+  return std::nullopt;
+}
+
+XdsRouting::VirtualHostIndex::VirtualHostIndex(
+    const VirtualHostListIterator& vhost_iterator) {
+  for (size_t i = 0; i < vhost_iterator.Size(); ++i) {
+    const auto& domains = vhost_iterator.GetDomainsForVirtualHost(i);
+    for (const std::string& domain_pattern : domains) {
+      const MatchType match_type = DomainPatternMatchType(domain_pattern);
+      // This should be caught by RouteConfigParse().
+      CHECK(match_type != INVALID_MATCH);
+      // Domain matching is case-insensitive.
+      std::string pattern = absl::AsciiStrToLower(domain_pattern);
+      switch (match_type) {
+        case EXACT_MATCH:
+          exact_.emplace(std::move(pattern), i);
+          break;
+        case SUFFIX_MATCH:
+          suffixes_.Add(pattern.substr(1), i);
+          break;
+        case PREFIX_MATCH:
+          pattern.pop_back();
+          prefixes_.Add(std::move(pattern), i);
+          break;
+        case UNIVERSE_MATCH:
+          if (!universe_.has_value()) universe_ = i;
+          break;
+        case INVALID_MATCH:
+          break;
+      }
+    }
+  }
+}
+
+std::optional<size_t> XdsRouting::VirtualHostIndex::Find(
+    absl::string_view domain) const {
+  // Same search order as FindVirtualHostForDomain(): exact, then suffix,
+  // then prefix, then universe, with the longest match winning in each
+  // group and the first virtual host winning ties.
+  const std::string host = absl::AsciiStrToLower(domain);
+  auto it = exact_.find(host);
+  if (it != exact_.end()) return it->second;
+  auto vhost_index = suffixes_.Find(host, /*suffix=*/true);
+  if (vhost_index.has_value()) return vhost_index;
+  vhost_index = prefixes_.Find(host, /*suffix=*/false);
+  if (vhost_index.has_value()) return vhost_index;
+  return universe_;
+}
+
 namespace {
 
 bool HeadersMatch(const std::vector<HeaderMatcher>& header_matchers,
@@ -154,6 +231,15 @@ bool UnderFraction(const uint32_t fraction_per_million) {
   return random_number < fraction_per_million;
 }
 
+// Evaluates everything but the path matcher.
+bool NonPathMatchersMatch(
+    const XdsRouteConfigResource::Route::Matchers& matchers,
+    grpc_metadata_batch* initial_metadata) {
+  return HeadersMatch(matchers.header_matchers, initial_metadata) &&
+         (!matchers.fraction_per_million.has_value() ||
+          UnderFraction(*matchers.fraction_per_million));
+}
+
 }  // namespace
 
 std::optional<size_t> XdsRouting::GetRouteForRequest(
@@ -163,15 +249,105 @@ std::optional<size_t> XdsRouting::GetRouteForRequest(
     const XdsRouteConfigResource::Route::Matchers& matchers =
         route_list_iterator.GetMatchersForRoute(i);
     if (matchers.path_matcher.Match(path) &&
-        HeadersMatch(matchers.header_matchers, initial_metadata) &&
-        (!matchers.fraction_per_million.has_value() ||
-         UnderFraction(*matchers.fraction_per_million))) {
+        NonPathMatchersMatch(matchers, initial_metadata)) {
       return i;
     }
   }
   return std::nullopt;
 }
 
+//
+// XdsRouting::RouteIndex
+//
+
+XdsRouting::RouteIndex::RouteIndex(
+    const RouteListIterator& route_list_iterator) {
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    const StringMatcher& path_matcher =
+        route_list_iterator.GetMatchersForRoute(i).path_matcher;
+    if (!path_matcher.case_sensitive()) {
+      unindexed_.push_back(i);
+      continue;
+    }
+    switch (path_matcher.type()) {
+      case StringMatcher::Type::kExact:
+        exact_[path_matcher.string_matcher()].push_back(i);
+        break;
+      case StringMatcher::Type::kPrefix: {
+        uint32_t node = 0;
+        for (char c : path_matcher.string_matcher()) {
+          uint32_t child = FindChild(node, c);
+          if (child == 0) {
+            child = trie_.size();
+            auto& children = trie_[node].children;
+            auto pos = std::find_if(children.begin(), children.end(),
+                                    [c](const std::pair<char, uint32_t>& p) {
+                                      return p.first > c;
+                                    });
+            children.insert(pos, {c, child});
+            trie_.emplace_back();
+          }
+          node = child;
+        }
+        trie_[node].routes.push_back(i);
+        break;
+      }
+      default:
+        unindexed_.push_back(i);
+        break;
+    }
+  }
+}
+
+uint32_t XdsRouting::RouteIndex::FindChild(uint32_t node, char c) const {
+  for (const auto& [child_char, child] : trie_[node].children) {
+    if (child_char == c) return child;
+    if (child_char > c) break;
+  }
+  return 0;
+}
+
+std::optional<size_t> XdsRouting::RouteIndex::GetRouteForRequest(
+    const RouteListIterator& route_list_iterator, absl::string_view path,
+    grpc_metadata_batch* initial_metadata) const {
+  // Each list holds candidates in list order. The indexed ones are already
+  // known to match the path.
+  absl::InlinedVector<absl::Span<const size_t>, 8> indexed;
+  auto it = exact_.find(path);
+  if (it != exact_.end()) indexed.push_back(it->second);
+  uint32_t node = 0;
+  for (size_t depth = 0;; ++depth) {
+    if (!trie_[node].routes.empty()) indexed.push_back(trie_[node].routes);
+    if (depth == path.size()) break;
+    node = FindChild(node, path[depth]);
+    if (node == 0) break;
+  }
+  absl::Span<const size_t> unindexed = unindexed_;
+  // Merge the lists, trying the candidates in list order.
+  while (true) {
+    absl::Span<const size_t>* next = nullptr;
+    for (absl::Span<const size_t>& candidates : indexed) {
+      if (!candidates.empty() &&
+          (next == nullptr || candidates.front() < next->front())) {
+        next = &candidates;
+      }
+    }
+    const bool check_path =
+        !unindexed.empty() &&
+        (next == nullptr || unindexed.front() < next->front());
+    if (check_path) next = &unindexed;
+    if (next == nullptr) return std::nullopt;
+    const size_t index = next->front();
+    next->remove_prefix(1);
+    const XdsRouteConfigResource::Route::Matchers& matchers =
+        route_list_iterator.GetMatchersForRoute(index);
+    if ((!check_path || matchers.path_matcher.Match(path)) &&
+        NonPathMatchersMatch(matchers, initial_metadata)) {
+      return index;
+    }
+  }
+}
+
 bool XdsRouting::IsValidDomainPattern(absl::string_view domain_pattern) {
   return DomainPatternMatchType(domain_pattern) != INVALID_MATCH;
 }
@@ -22,11 +22,14 @@
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 
+#include <cstdint>
 #include <map>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "src/core/call/metadata_batch.h"
@@ -59,12 +62,77 @@ class XdsRouting final {
         size_t index) const = 0;
   };
 
+  // Domain patterns of a virtual host list, classified, lower-cased and put
+  // in hash tables once, so that a lookup is a few probes rather than a pass
+  // over every pattern.
+  class VirtualHostIndex final {
+   public:
+    VirtualHostIndex() = default;
+    explicit VirtualHostIndex(const VirtualHostListIterator& vhost_iterator);
+
+    // Returns the index of the selected virtual host in the list.
+    std::optional<size_t> Find(absl::string_view domain) const;
+
+   private:
+    // Wildcard patterns of one kind, keyed by the pattern without its
+    // asterisk.
+    struct WildcardTable {
+      void Add(std::string fixed_part, size_t vhost_index);
+      // Returns the vhost of the longest pattern whose fixed part matches
+      // the start or end of host, leaving at least one char for the asterisk.
+      std::optional<size_t> Find(absl::string_view host, bool suffix) const;
+
+      absl::flat_hash_map<std::string, size_t> patterns;
+      // The distinct lengths of the fixed parts, longest first.
+      std::vector<size_t> lengths;
+    };
+
+    absl::flat_hash_map<std::string, size_t> exact_;
+    WildcardTable suffixes_;
+    WildcardTable prefixes_;
+    std::optional<size_t> universe_;
+  };
+
+  // An index over the path matchers of a route list, for repeated lookups.
+  // Case-sensitive exact paths go in a hash map and case-sensitive prefixes
+  // in a trie. Every other route is checked in order, as is any header or
+  // runtime fraction matcher on an indexed route, so that the first matching
+  // route still wins.
+  class RouteIndex final {
+   public:
+    RouteIndex() = default;
+    explicit RouteIndex(const RouteListIterator& route_list_iterator);
+
+    // Same as XdsRouting::GetRouteForRequest(). route_list_iterator must
+    // iterate over the routes the index was built from.
+    std::optional<size_t> GetRouteForRequest(
+        const RouteListIterator& route_list_iterator, absl::string_view path,
+        grpc_metadata_batch* initial_metadata) const;
+
+   private:
+    struct TrieNode {
+      // Sorted by character.
+      std::vector<std::pair<char, uint32_t>> children;
+      // Routes whose prefix ends at this node, in list order.
+      std::vector<size_t> routes;
+    };
+
+    uint32_t FindChild(uint32_t node, char c) const;
+
+    absl::flat_hash_map<std::string, std::vector<size_t>> exact_;
+    // Node 0 is the root, holding routes with an empty prefix.
+    std::vector<TrieNode> trie_{1};
+    // Routes that must have their path matcher evaluated, in list order.
+    std::vector<size_t> unindexed_;
+  };
+
   // Returns the index of the selected virtual host in the list.
   static std::optional<size_t> FindVirtualHostForDomain(
       const VirtualHostListIterator& vhost_iterator, absl::string_view domain);
 
   // Returns the index in route_list_iterator to use for a request with
   // the specified path and metadata, or nullopt if no route matches.
+  // Walks the whole list; use a RouteIndex where lookups repeat.
   static std::optional<size_t> GetRouteForRequest(
       const RouteListIterator& route_list_iterator, absl::string_view path,
       grpc_metadata_batch* initial_metadata);
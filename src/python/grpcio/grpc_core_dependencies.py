@@ -20,6 +20,7 @@ CORE_SOURCE_FILES = [
     'src/core/call/call_spine.cc',
     'src/core/call/call_state.cc',
     'src/core/call/client_call.cc',
+    'src/core/call/deadline_coalescer.cc',
     'src/core/call/interception_chain.cc',
     'src/core/call/message.cc',
     'src/core/call/metadata.cc',
@@ -130,6 +131,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/http/client/http_client_filter.cc',
     'src/core/ext/filters/http/client_authority_filter.cc',
     'src/core/ext/filters/http/http_filters_plugin.cc',
+    'src/core/ext/filters/http/message_compress/adaptive_compression_policy.cc',
     'src/core/ext/filters/http/message_compress/compression_filter.cc',
     'src/core/ext/filters/http/server/http_server_filter.cc',
     'src/core/ext/filters/message_size/message_size_filter.cc',
@@ -145,7 +147,6 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/bin_encoder.cc',
     'src/core/ext/transport/chttp2/transport/call_tracer_wrapper.cc',
     'src/core/ext/transport/chttp2/transport/chttp2_transport.cc',
-    'src/core/ext/transport/chttp2/transport/decode_huff.cc',
     'src/core/ext/transport/chttp2/transport/flow_control.cc',
     'src/core/ext/transport/chttp2/transport/frame.cc',
     'src/core/ext/transport/chttp2/transport/frame_data.cc',
@@ -165,6 +166,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/http2_settings_manager.cc',
     'src/core/ext/transport/chttp2/transport/http2_stats_collector.cc',
     'src/core/ext/transport/chttp2/transport/http2_transport.cc',
+    'src/core/ext/transport/chttp2/transport/huff_table_decoder.cc',
     'src/core/ext/transport/chttp2/transport/huffsyms.cc',
     'src/core/ext/transport/chttp2/transport/keepalive.cc',
     'src/core/ext/transport/chttp2/transport/parsing.cc',
@@ -172,6 +174,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/ping_callbacks.cc',
     'src/core/ext/transport/chttp2/transport/ping_promise.cc',
     'src/core/ext/transport/chttp2/transport/ping_rate_policy.cc',
+    'src/core/ext/transport/chttp2/transport/simd_base64.cc',
     'src/core/ext/transport/chttp2/transport/stream_lists.cc',
     'src/core/ext/transport/chttp2/transport/transport_common.cc',
     'src/core/ext/transport/chttp2/transport/varint.cc',
@@ -255,6 +258,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/upb-gen/envoy/extensions/http/stateful_session/cookie/v3/cookie.upb_minitable.c',
     'src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/client_side_weighted_round_robin/v3/client_side_weighted_round_robin.upb_minitable.c',
     'src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/common/v3/common.upb_minitable.c',
+    'src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/least_request/v3/least_request.upb_minitable.c',
     'src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/pick_first/v3/pick_first.upb_minitable.c',
     'src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/ring_hash/v3/ring_hash.upb_minitable.c',
     'src/core/ext/upb-gen/envoy/extensions/load_balancing_policies/wrr_locality/v3/wrr_locality.upb_minitable.c',
@@ -547,6 +551,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/endpoint_channel_arg_wrapper.cc',
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/file_descriptor_collection.cc',
@@ -565,6 +570,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+    'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
@@ -589,6 +595,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/windows/windows_engine.cc',
     'src/core/lib/event_engine/windows/windows_listener.cc',
     'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+    'src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc',
     'src/core/lib/experiments/config.cc',
     'src/core/lib/experiments/experiments.cc',
     'src/core/lib/iomgr/buffer_list.cc',
@@ -720,6 +727,7 @@ CORE_SOURCE_FILES = [
     'src/core/load_balancing/backend_metric_parser.cc',
     'src/core/load_balancing/child_policy_handler.cc',
     'src/core/load_balancing/endpoint_list.cc',
+    'src/core/load_balancing/endpoint_list_policy.cc',
     'src/core/load_balancing/grpclb/client_load_reporting_filter.cc',
     'src/core/load_balancing/grpclb/grpclb.cc',
     'src/core/load_balancing/grpclb/grpclb_balancer_addresses.cc',
@@ -728,11 +736,15 @@ CORE_SOURCE_FILES = [
     'src/core/load_balancing/health_check_client.cc',
     'src/core/load_balancing/lb_policy.cc',
     'src/core/load_balancing/lb_policy_registry.cc',
+    'src/core/load_balancing/least_request/least_request.cc',
     'src/core/load_balancing/oob_backend_metric.cc',
     'src/core/load_balancing/outlier_detection/outlier_detection.cc',
+    'src/core/load_balancing/peak_ewma/peak_ewma.cc',
+    'src/core/load_balancing/peak_ewma/peak_ewma_load.cc',
     'src/core/load_balancing/pick_first/pick_first.cc',
     'src/core/load_balancing/priority/priority.cc',
     'src/core/load_balancing/ring_hash/ring_hash.cc',
+    'src/core/load_balancing/ring_hash/ring_hash_table.cc',
     'src/core/load_balancing/rls/rls.cc',
     'src/core/load_balancing/round_robin/round_robin.cc',
     'src/core/load_balancing/weighted_round_robin/static_stride_scheduler.cc',
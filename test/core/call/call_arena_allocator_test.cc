@@ -35,6 +35,8 @@
 #include "gtest/gtest.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/thd.h"
 #include "test/core/test_util/test_config.h"
@@ -71,6 +73,38 @@ TEST(CallArenaAllocatorTest, SettlesWithAllocation) {
   LOG(INFO) << estimate;
 }
 
+TEST(CallArenaAllocatorTest, RecyclesStorageWithPool) {
+  auto quota = ResourceQuota::Default()->memory_quota();
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      quota->CreateMemoryAllocator("test-allocator"), 1024,
+      quota->CreateMemoryOwner());
+  auto stats_before = global_stats().Collect();
+  for (int i = 0; i < 1000; i++) {
+    allocator->MakeArena()->Alloc(100);
+  }
+  auto stats = global_stats().Collect()->Diff(*stats_before);
+  EXPECT_EQ(stats->call_arena_storage_allocated +
+                stats->call_arena_storage_recycled,
+            1000);
+  // Storage is only newly allocated while the pool warms up, and when the
+  // thread moves to a cpu with a different shard of the pool.
+  EXPECT_GT(stats->call_arena_storage_recycled, 900);
+}
+
+TEST(CallArenaAllocatorTest, NoRecyclingWithoutPool) {
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "test-allocator"),
+      1024);
+  auto stats_before = global_stats().Collect();
+  for (int i = 0; i < 100; i++) {
+    allocator->MakeArena()->Alloc(100);
+  }
+  auto stats = global_stats().Collect()->Diff(*stats_before);
+  EXPECT_EQ(stats->call_arena_storage_allocated, 100);
+  EXPECT_EQ(stats->call_arena_storage_recycled, 0);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char* argv[]) {
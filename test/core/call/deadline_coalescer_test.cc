@@ -0,0 +1,197 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/call/deadline_coalescer.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/util/time.h"
+#include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.h"
+#include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.pb.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::FuzzingEventEngine;
+
+class CountingClosure final : public EventEngine::Closure {
+ public:
+  void Run() override { ++runs_; }
+  int runs() const { return runs_; }
+
+ private:
+  int runs_ = 0;
+};
+
+class DeadlineCoalescerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    event_engine_ = std::make_shared<FuzzingEventEngine>(
+        FuzzingEventEngine::Options(), fuzzing_event_engine::Actions());
+    event_engine_->SetRunAfterDurationCallback(
+        [this](EventEngine::Duration) { ++timers_started_; });
+  }
+
+  void TearDown() override {
+    event_engine_->FuzzingDone();
+    event_engine_->TickUntilIdle();
+    event_engine_->UnsetGlobalHooks();
+  }
+
+  // Advances time to just before `t`, leaving a millisecond for rounding
+  // between Timestamp and the EventEngine clock.
+  void TickUntilJustBefore(Timestamp t) {
+    event_engine_->TickForDuration(
+        std::chrono::milliseconds((t - Timestamp::Now()).millis() - 2));
+  }
+
+  std::shared_ptr<FuzzingEventEngine> event_engine_;
+  int timers_started_ = 0;
+};
+
+TEST_F(DeadlineCoalescerTest, DisabledByDefault) {
+  EXPECT_EQ(DeadlineCoalescer::CreateFromChannelArgs(ChannelArgs()), nullptr);
+  EXPECT_EQ(DeadlineCoalescer::CreateFromChannelArgs(
+                ChannelArgs().Set(GRPC_ARG_CALL_DEADLINE_COALESCING_MS, 0)),
+            nullptr);
+  auto coalescer = DeadlineCoalescer::CreateFromChannelArgs(
+      ChannelArgs().Set(GRPC_ARG_CALL_DEADLINE_COALESCING_MS, 20));
+  ASSERT_NE(coalescer, nullptr);
+  EXPECT_EQ(coalescer->granularity(), Duration::Milliseconds(20));
+}
+
+TEST_F(DeadlineCoalescerTest, SharedThroughChannelArgs) {
+  EXPECT_EQ(DeadlineCoalescer::ShareFromChannelArgs(ChannelArgs()),
+            ChannelArgs());
+  const ChannelArgs args = DeadlineCoalescer::ShareFromChannelArgs(
+      ChannelArgs().Set(GRPC_ARG_CALL_DEADLINE_COALESCING_MS, 20));
+  auto coalescer = DeadlineCoalescer::CreateFromChannelArgs(args);
+  ASSERT_NE(coalescer, nullptr);
+  // Each connection's channel finds the same coalescer.
+  EXPECT_EQ(DeadlineCoalescer::CreateFromChannelArgs(args), coalescer);
+  EXPECT_EQ(DeadlineCoalescer::CreateFromChannelArgs(
+                args.Set(GRPC_ARG_DEFAULT_AUTHORITY, "foo")),
+            coalescer);
+}
+
+TEST_F(DeadlineCoalescerTest, RoundUp) {
+  DeadlineCoalescer coalescer(Duration::Milliseconds(100));
+  auto at = [](int64_t ms) {
+    return Timestamp::FromMillisecondsAfterProcessEpoch(ms);
+  };
+  EXPECT_EQ(coalescer.RoundUp(at(1000)), at(1000));
+  EXPECT_EQ(coalescer.RoundUp(at(1001)), at(1100));
+  EXPECT_EQ(coalescer.RoundUp(at(1099)), at(1100));
+  EXPECT_EQ(coalescer.RoundUp(Timestamp::InfFuture()), Timestamp::InfFuture());
+}
+
+// Deadlines in the same slot share one timer, which fires at the end of the
+// slot: never before any of the deadlines.
+TEST_F(DeadlineCoalescerTest, SharesTimerWithinSlot) {
+  auto coalescer = MakeRefCounted<DeadlineCoalescer>(Duration::Seconds(1));
+  const Timestamp slot =
+      coalescer->RoundUp(Timestamp::Now() + Duration::Seconds(2));
+  DeadlineCoalescer::Waiter waiters[3];
+  CountingClosure closures[3];
+  coalescer->Add(&waiters[0], slot - Duration::Milliseconds(999), &closures[0],
+                 event_engine_.get());
+  coalescer->Add(&waiters[1], slot - Duration::Milliseconds(500), &closures[1],
+                 event_engine_.get());
+  coalescer->Add(&waiters[2], slot, &closures[2], event_engine_.get());
+  EXPECT_EQ(timers_started_, 1);
+
+  TickUntilJustBefore(slot);
+  for (const auto& closure : closures) EXPECT_EQ(closure.runs(), 0);
+  event_engine_->TickForDuration(std::chrono::milliseconds(4));
+  for (const auto& closure : closures) EXPECT_EQ(closure.runs(), 1);
+  for (auto& waiter : waiters) EXPECT_FALSE(coalescer->Remove(&waiter));
+}
+
+TEST_F(DeadlineCoalescerTest, SeparateSlots) {
+  auto coalescer = MakeRefCounted<DeadlineCoalescer>(Duration::Seconds(1));
+  const Timestamp slot =
+      coalescer->RoundUp(Timestamp::Now() + Duration::Seconds(2));
+  DeadlineCoalescer::Waiter waiters[2];
+  CountingClosure closures[2];
+  coalescer->Add(&waiters[0], slot, &closures[0], event_engine_.get());
+  coalescer->Add(&waiters[1], slot + Duration::Milliseconds(1), &closures[1],
+                 event_engine_.get());
+  EXPECT_EQ(timers_started_, 2);
+
+  TickUntilJustBefore(slot + Duration::Milliseconds(1));
+  EXPECT_EQ(closures[0].runs(), 1);
+  EXPECT_EQ(closures[1].runs(), 0);
+  event_engine_->TickForDuration(std::chrono::seconds(1));
+  EXPECT_EQ(closures[1].runs(), 1);
+}
+
+// Removed waiters do not run; the timer stops once its slot is empty, and a
+// later deadline in the same slot starts a new one.
+TEST_F(DeadlineCoalescerTest, Remove) {
+  auto coalescer = MakeRefCounted<DeadlineCoalescer>(Duration::Seconds(1));
+  const Timestamp slot =
+      coalescer->RoundUp(Timestamp::Now() + Duration::Seconds(2));
+  DeadlineCoalescer::Waiter waiters[2];
+  CountingClosure closures[2];
+  coalescer->Add(&waiters[0], slot, &closures[0], event_engine_.get());
+  coalescer->Add(&waiters[1], slot, &closures[1], event_engine_.get());
+  EXPECT_TRUE(coalescer->Remove(&waiters[0]));
+  EXPECT_FALSE(coalescer->Remove(&waiters[0]));
+  EXPECT_TRUE(coalescer->Remove(&waiters[1]));
+  EXPECT_TRUE(event_engine_->IsIdle());
+
+  coalescer->Add(&waiters[0], slot, &closures[0], event_engine_.get());
+  EXPECT_EQ(timers_started_, 2);
+  event_engine_->TickForDuration(std::chrono::seconds(3));
+  EXPECT_EQ(closures[0].runs(), 1);
+  EXPECT_EQ(closures[1].runs(), 0);
+}
+
+TEST_F(DeadlineCoalescerTest, ConcurrentCalls) {
+  auto coalescer = MakeRefCounted<DeadlineCoalescer>(Duration::Seconds(1));
+  const Timestamp deadline = Timestamp::Now() + Duration::Seconds(2);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&]() {
+      DeadlineCoalescer::Waiter waiters[16];
+      CountingClosure closures[16];
+      for (int round = 0; round < 100; ++round) {
+        for (int j = 0; j < 16; ++j) {
+          coalescer->Add(&waiters[j], deadline, &closures[j],
+                         event_engine_.get());
+        }
+        for (auto& waiter : waiters) EXPECT_TRUE(coalescer->Remove(&waiter));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_TRUE(event_engine_->IsIdle());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
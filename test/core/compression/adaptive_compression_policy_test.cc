@@ -0,0 +1,180 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/http/message_compress/adaptive_compression_policy.h"
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+using Decision = AdaptiveCompressionPolicy::Decision;
+
+constexpr size_t kMessageSize = 10000;
+
+// What compressing a message at some level achieves.
+struct Outcome {
+  double ratio;
+  double ns_per_byte;
+};
+
+class AdaptiveCompressionPolicyTest : public ::testing::Test {
+ protected:
+  AdaptiveCompressionPolicy::Options MakeOptions(int level = 6) {
+    AdaptiveCompressionPolicy::Options options;
+    options.level = level;
+    options.ns_per_saved_byte = 100;
+    options.probe_interval = 10;
+    return options;
+  }
+
+  // Sends one message, compressing it as planned. Returns the plan.
+  AdaptiveCompressionPolicy::Plan Send(
+      AdaptiveCompressionPolicy& policy,
+      AdaptiveCompressionPolicy::MethodState* state, Outcome full,
+      Outcome light) {
+    auto plan = policy.PlanMessage(state);
+    const Outcome& outcome =
+        plan.decision == Decision::kCompressLighter ? light : full;
+    policy.RecordSample(state, plan, kMessageSize,
+                        kMessageSize * outcome.ratio,
+                        kMessageSize * outcome.ns_per_byte);
+    return plan;
+  }
+};
+
+TEST_F(AdaptiveCompressionPolicyTest, KeepsCompressingWhenItPays) {
+  AdaptiveCompressionPolicy policy(MakeOptions(), nullptr);
+  auto* state = policy.GetMethodState("/foo/Bar", true);
+  ASSERT_NE(state, nullptr);
+  for (int i = 0; i < 100; i++) {
+    auto plan = Send(policy, state, {0.3, 30}, {0.4, 10});
+    EXPECT_EQ(plan.decision, Decision::kCompress);
+    EXPECT_EQ(plan.level, 6);
+  }
+}
+
+TEST_F(AdaptiveCompressionPolicyTest, SkipsIncompressiblePayloads) {
+  AdaptiveCompressionPolicy policy(MakeOptions(), nullptr);
+  auto* state = policy.GetMethodState("/foo/Bar", true);
+  // The first message shows compressing normally does not pay, and the
+  // second that compressing lightly does not either.
+  Send(policy, state, {0.98, 30}, {0.99, 10});
+  EXPECT_EQ(policy.CurrentDecision(state), Decision::kCompressLighter);
+  Send(policy, state, {0.98, 30}, {0.99, 10});
+  EXPECT_EQ(policy.CurrentDecision(state), Decision::kSkip);
+  int skipped = 0;
+  for (int i = 0; i < 100; i++) {
+    if (Send(policy, state, {0.98, 30}, {0.99, 10}).decision ==
+        Decision::kSkip) {
+      skipped++;
+    }
+  }
+  // All but the probes.
+  EXPECT_EQ(skipped, 90);
+}
+
+TEST_F(AdaptiveCompressionPolicyTest, FallsBackToLighterLevel) {
+  AdaptiveCompressionPolicy policy(MakeOptions(), nullptr);
+  auto* state = policy.GetMethodState("/foo/Bar", true);
+  // Compressing normally costs 80ns to save 50 bytes' worth of 100ns; the
+  // fastest level costs 10ns to save 40.
+  Send(policy, state, {0.5, 80}, {0.6, 10});
+  EXPECT_EQ(policy.CurrentDecision(state), Decision::kCompressLighter);
+  for (int i = 0; i < 100; i++) {
+    auto plan = Send(policy, state, {0.5, 80}, {0.6, 10});
+    if (plan.decision == Decision::kCompressLighter) {
+      EXPECT_EQ(plan.level, 1);
+    } else {
+      // A probe, which finds compressing normally still does not pay.
+      EXPECT_EQ(plan.decision, Decision::kCompress);
+    }
+    EXPECT_EQ(policy.CurrentDecision(state), Decision::kCompressLighter);
+  }
+}
+
+TEST_F(AdaptiveCompressionPolicyTest, ProbesFindCompressiblePayloadsAgain) {
+  AdaptiveCompressionPolicy policy(MakeOptions(), nullptr);
+  auto* state = policy.GetMethodState("/foo/Bar", true);
+  for (int i = 0; i < 20; i++) Send(policy, state, {1.0, 30}, {1.0, 10});
+  ASSERT_EQ(policy.CurrentDecision(state), Decision::kSkip);
+  // The payloads become compressible: a probe at the fastest level notices,
+  // then one at the configured level.
+  for (int i = 0; i < 10; i++) Send(policy, state, {0.3, 30}, {0.4, 10});
+  EXPECT_EQ(policy.CurrentDecision(state), Decision::kCompressLighter);
+  for (int i = 0; i < 10; i++) Send(policy, state, {0.3, 30}, {0.4, 10});
+  EXPECT_EQ(policy.CurrentDecision(state), Decision::kCompress);
+}
+
+TEST_F(AdaptiveCompressionPolicyTest, NoLighterLevelThanFastest) {
+  AdaptiveCompressionPolicy policy(MakeOptions(/*level=*/1), nullptr);
+  auto* state = policy.GetMethodState("/foo/Bar", true);
+  Send(policy, state, {0.98, 10}, {0.98, 10});
+  EXPECT_EQ(policy.CurrentDecision(state), Decision::kSkip);
+  // Probes compress at the configured level.
+  for (int i = 0; i < 9; i++) {
+    EXPECT_EQ(Send(policy, state, {0.98, 10}, {0.98, 10}).decision,
+              Decision::kSkip);
+  }
+  auto plan = Send(policy, state, {0.98, 10}, {0.98, 10});
+  EXPECT_EQ(plan.decision, Decision::kCompress);
+  EXPECT_EQ(plan.level, 1);
+}
+
+TEST_F(AdaptiveCompressionPolicyTest, MethodsTrackedSeparately) {
+  auto options = MakeOptions();
+  options.max_methods = 2;
+  AdaptiveCompressionPolicy policy(options, nullptr);
+  auto* bar = policy.GetMethodState("/foo/Bar", true);
+  auto* baz = policy.GetMethodState("/foo/Baz", true);
+  ASSERT_NE(bar, nullptr);
+  ASSERT_NE(baz, nullptr);
+  EXPECT_NE(bar, baz);
+  EXPECT_EQ(policy.GetMethodState("/foo/Bar", true), bar);
+  // Beyond the limit, methods share the state of unregistered ones.
+  auto* qux = policy.GetMethodState("/foo/Qux", true);
+  ASSERT_NE(qux, nullptr);
+  EXPECT_NE(qux, bar);
+  EXPECT_NE(qux, baz);
+  EXPECT_EQ(policy.GetMethodState("/unknown/Method", false), qux);
+  for (int i = 0; i < 5; i++) Send(policy, bar, {1.0, 30}, {1.0, 10});
+  EXPECT_EQ(policy.CurrentDecision(bar), Decision::kSkip);
+  EXPECT_EQ(policy.CurrentDecision(baz), Decision::kCompress);
+}
+
+TEST_F(AdaptiveCompressionPolicyTest, UnregisteredMethodsShareOneState) {
+  AdaptiveCompressionPolicy policy(MakeOptions(), nullptr);
+  auto* other = policy.GetMethodState("/foo/Bar", false);
+  ASSERT_NE(other, nullptr);
+  // However many paths the peer makes up, they do not take up any of the
+  // registered methods' slots.
+  for (int i = 0; i < 2000; i++) {
+    EXPECT_EQ(policy.GetMethodState(absl::StrCat("/foo/", i), false), other);
+  }
+  auto* bar = policy.GetMethodState("/foo/Bar", true);
+  ASSERT_NE(bar, nullptr);
+  EXPECT_NE(bar, other);
+  for (int i = 0; i < 5; i++) Send(policy, other, {1.0, 30}, {1.0, 10});
+  EXPECT_EQ(policy.CurrentDecision(other), Decision::kSkip);
+  EXPECT_EQ(policy.CurrentDecision(bar), Decision::kCompress);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
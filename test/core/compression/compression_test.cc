@@ -30,11 +30,10 @@
 
 TEST(CompressionTest, CompressionAlgorithmParse) {
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd", "lz4"};
   const grpc_compression_algorithm valid_algorithms[] = {
-      GRPC_COMPRESS_NONE,
-      GRPC_COMPRESS_GZIP,
-      GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4,
   };
   const char* invalid_names[] = {"gzip2", "foo", "", "2gzip"};
 
@@ -64,11 +63,10 @@ TEST(CompressionTest, CompressionAlgorithmName) {
   int success;
   const char* name;
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd", "lz4"};
   const grpc_compression_algorithm valid_algorithms[] = {
-      GRPC_COMPRESS_NONE,
-      GRPC_COMPRESS_GZIP,
-      GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4,
   };
 
   VLOG(2) << "test_compression_algorithm_name";
@@ -25,9 +25,11 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
 
 #include "absl/log/log.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/slice_splitter.h"
@@ -159,6 +161,42 @@ TEST(MessageCompressTest, TinyDataCompress) {
   grpc_slice_buffer_destroy(&output);
 }
 
+TEST(MessageCompressTest, CompressionLevels) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+
+  // Out of range levels fall back to the default.
+  for (int level :
+       {GRPC_MSG_COMPRESS_DEFAULT_LEVEL, -1, 0, 1, 5, 9, 10, 22, 23}) {
+    for (auto algorithm : {GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_GZIP,
+                           GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4}) {
+      if (!grpc_core::CompressionAlgorithmSet::Supported().IsSet(algorithm)) {
+        continue;
+      }
+      grpc_core::ExecCtx exec_ctx;
+      ASSERT_EQ(1, grpc_msg_compress_with_level(algorithm, level, &input,
+                                                &compressed));
+      ASSERT_LT(compressed.length, input.length);
+      ASSERT_EQ(1, grpc_msg_decompress(algorithm, &compressed, &output));
+      grpc_slice merged = grpc_slice_merge(output.slices, output.count);
+      ASSERT_TRUE(grpc_slice_eq(input.slices[0], merged));
+      grpc_slice_unref(merged);
+      grpc_slice_buffer_reset_and_unref(&compressed);
+      grpc_slice_buffer_reset_and_unref(&output);
+    }
+  }
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
 TEST(MessageCompressTest, BadDecompressionDataCrc) {
   grpc_slice_buffer input;
   grpc_slice_buffer corrupted;
@@ -175,10 +213,11 @@ TEST(MessageCompressTest, BadDecompressionDataCrc) {
   // compress it
   grpc_msg_compress(GRPC_COMPRESS_GZIP, &input, &corrupted);
   // corrupt the output by smashing the CRC
-  ASSERT_GT(corrupted.count, 1);
-  ASSERT_GT(GRPC_SLICE_LENGTH(corrupted.slices[1]), 8);
-  idx = GRPC_SLICE_LENGTH(corrupted.slices[1]) - 8;
-  memcpy(GRPC_SLICE_START_PTR(corrupted.slices[1]) + idx, &bad, 4);
+  ASSERT_GT(corrupted.count, 0);
+  grpc_slice& last = corrupted.slices[corrupted.count - 1];
+  ASSERT_GT(GRPC_SLICE_LENGTH(last), 8);
+  idx = GRPC_SLICE_LENGTH(last) - 8;
+  memcpy(GRPC_SLICE_START_PTR(last) + idx, &bad, 4);
 
   // try (and fail) to decompress the corrupted compressed buffer
   ASSERT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_GZIP, &corrupted, &output));
@@ -251,6 +290,117 @@ TEST(MessageCompressTest, BadDecompressionDataStream) {
   grpc_slice_buffer_destroy(&output);
 }
 
+TEST(MessageCompressTest, DecompressWithLimit) {
+  grpc_core::ExecCtx exec_ctx;
+  for (auto algorithm :
+       {GRPC_COMPRESS_NONE, GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_GZIP,
+        GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4}) {
+    if (!grpc_core::CompressionAlgorithmSet::Supported().IsSet(algorithm)) {
+      continue;
+    }
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+    if (algorithm == GRPC_COMPRESS_NONE) {
+      grpc_slice_buffer_add(&compressed, create_test_value(ONE_MB_A));
+    } else {
+      ASSERT_TRUE(grpc_msg_compress(algorithm, &input, &compressed));
+    }
+
+    // One byte short of the message: nothing is appended to the output.
+    grpc_slice_buffer_add(&output, grpc_slice_from_copied_string("prefix"));
+    EXPECT_EQ(GRPC_MSG_DECOMPRESS_TOO_LARGE,
+              grpc_msg_decompress_with_limit(algorithm, input.length - 1,
+                                             &compressed, &output));
+    EXPECT_EQ(output.length, 6u);
+    grpc_slice_buffer_reset_and_unref(&output);
+
+    // Exactly the size of the message.
+    EXPECT_EQ(1, grpc_msg_decompress_with_limit(algorithm, input.length,
+                                                &compressed, &output));
+    grpc_slice merged = grpc_slice_merge(output.slices, output.count);
+    EXPECT_TRUE(grpc_slice_eq(input.slices[0], merged));
+    grpc_slice_unref(merged);
+
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+}
+
+TEST(MessageCompressTest, SmallMessageRoundTrip) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  // Small enough for the output to fit an inlined slice, yet still worth
+  // compressing.
+  grpc_slice_buffer_add(&input, repeated('a', 16));
+
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_EQ(1, grpc_msg_compress(GRPC_COMPRESS_DEFLATE, &input, &compressed));
+  ASSERT_EQ(1, grpc_msg_decompress_with_limit(
+                   GRPC_COMPRESS_DEFLATE, input.length, &compressed, &output));
+  grpc_slice merged = grpc_slice_merge(output.slices, output.count);
+  ASSERT_TRUE(grpc_slice_eq(input.slices[0], merged));
+  grpc_slice_unref(merged);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
+#ifdef GRPC_HAVE_ZSTD
+static constexpr char kJsonRecord[] =
+    "{\"user_id\": 12345, \"name\": \"some name here\", "
+    "\"tags\": [\"alpha\", \"beta\"]}";
+
+TEST(MessageCompressTest, ZstdDictionary) {
+  std::string content;
+  for (int i = 0; i < 200; i++) content += kJsonRecord;
+  auto dictionary = grpc_core::ZstdDictionary::Create(content);
+  ASSERT_TRUE(dictionary.ok()) << dictionary.status();
+
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  // A message this small only gets smaller with the dictionary's help.
+  grpc_slice_buffer_add(&input, grpc_slice_from_static_string(kJsonRecord));
+
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_EQ(0, grpc_msg_compress(GRPC_COMPRESS_ZSTD, &input, &compressed));
+  grpc_slice_buffer_reset_and_unref(&compressed);
+  ASSERT_EQ(1, grpc_msg_compress_with_level(
+                   GRPC_COMPRESS_ZSTD, GRPC_MSG_COMPRESS_DEFAULT_LEVEL,
+                   &input, &compressed, dictionary->get()));
+  ASSERT_EQ(1, grpc_msg_decompress_with_limit(GRPC_COMPRESS_ZSTD, SIZE_MAX,
+                                              &compressed, &output,
+                                              dictionary->get()));
+  grpc_slice merged = grpc_slice_merge(output.slices, output.count);
+  ASSERT_TRUE(grpc_slice_eq(input.slices[0], merged));
+  grpc_slice_unref(merged);
+  grpc_slice_buffer_reset_and_unref(&output);
+
+  // The peer must have been configured with the same dictionary.
+  ASSERT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_ZSTD, &compressed, &output));
+  ASSERT_EQ(output.length, 0u);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+#endif  // GRPC_HAVE_ZSTD
+
 TEST(MessageCompressTest, BadCompressionAlgorithm) {
   grpc_slice_buffer input;
   grpc_slice_buffer output;
@@ -312,6 +462,10 @@ int main(int argc, char** argv) {
                                                     GRPC_SLICE_SPLIT_IDENTITY,
                                                     GRPC_SLICE_SPLIT_ONE_BYTE};
   for (i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    if (!grpc_core::CompressionAlgorithmSet::Supported().IsSet(
+            static_cast<grpc_compression_algorithm>(i))) {
+      continue;
+    }
     for (j = 0; j < GPR_ARRAY_SIZE(uncompressed_split_modes); j++) {
       for (k = 0; k < GPR_ARRAY_SIZE(compressed_split_modes); k++) {
         for (m = 0; m < TEST_VALUE_COUNT; m++) {
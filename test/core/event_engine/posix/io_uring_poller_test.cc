@@ -0,0 +1,307 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/grpc.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/event_engine/posix/posix_engine_test_utils.h"
+
+// This test won't work except with posix sockets enabled
+#ifdef GRPC_POSIX_SOCKET_EV
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+using namespace std::chrono_literals;
+
+class IoUringPollerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    poller_ = MakeIoUringPoller(&scheduler_);
+    if (poller_ == nullptr) {
+      GTEST_SKIP() << "io_uring is not supported by this kernel";
+    }
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds_), 0);
+    for (int fd : fds_) {
+      ASSERT_EQ(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK), 0);
+    }
+  }
+
+  void TearDown() override {
+    if (poller_ != nullptr) poller_->Close();
+    if (fds_[1] >= 0) close(fds_[1]);
+  }
+
+  // Polls until *done is set or the poller reports nothing for a while.
+  void WorkUntil(const bool* done) {
+    for (int i = 0; i < 100 && !*done; ++i) {
+      poller_->Work(100ms, []() {});
+    }
+  }
+
+  TestScheduler scheduler_;
+  std::shared_ptr<IoUringPoller> poller_;
+  int fds_[2] = {-1, -1};
+};
+
+TEST_F(IoUringPollerTest, NotifiesOnReadAndWrite) {
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(fds_[0]), "test", false);
+  bool readable = false;
+  bool writable = false;
+  handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [&readable](absl::Status status) {
+        EXPECT_TRUE(status.ok());
+        readable = true;
+      }));
+  handle->NotifyOnWrite(PosixEngineClosure::TestOnlyToClosure(
+      [&writable](absl::Status status) {
+        EXPECT_TRUE(status.ok());
+        writable = true;
+      }));
+  // The socket is writable right away, but nothing has been sent yet.
+  WorkUntil(&writable);
+  EXPECT_TRUE(writable);
+  EXPECT_FALSE(readable);
+  ASSERT_EQ(write(fds_[1], "x", 1), 1);
+  WorkUntil(&readable);
+  EXPECT_TRUE(readable);
+  handle->OrphanHandle(nullptr, nullptr, "done");
+}
+
+TEST_F(IoUringPollerTest, RepeatedReadsAreReported) {
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(fds_[0]), "test", false);
+  for (int i = 0; i < 10; ++i) {
+    bool readable = false;
+    handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+        [&readable](absl::Status /*status*/) { readable = true; }));
+    ASSERT_EQ(write(fds_[1], "x", 1), 1);
+    WorkUntil(&readable);
+    ASSERT_TRUE(readable) << "iteration " << i;
+    char buf;
+    ASSERT_EQ(read(fds_[0], &buf, 1), 1);
+  }
+  handle->OrphanHandle(nullptr, nullptr, "done");
+}
+
+TEST_F(IoUringPollerTest, PeerCloseWakesReader) {
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(fds_[0]), "test", false);
+  bool readable = false;
+  handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [&readable](absl::Status /*status*/) { readable = true; }));
+  close(fds_[1]);
+  fds_[1] = -1;
+  WorkUntil(&readable);
+  EXPECT_TRUE(readable);
+  handle->OrphanHandle(nullptr, nullptr, "done");
+}
+
+TEST_F(IoUringPollerTest, ShutdownRunsPendingClosures) {
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(fds_[0]), "test", false);
+  absl::Status read_status;
+  handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [&read_status](absl::Status status) { read_status = status; }));
+  handle->ShutdownHandle(absl::CancelledError("shutdown"));
+  EXPECT_FALSE(read_status.ok());
+  EXPECT_TRUE(handle->IsHandleShutdown());
+  handle->OrphanHandle(nullptr, nullptr, "done");
+}
+
+TEST_F(IoUringPollerTest, OrphanReleasesFd) {
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(fds_[0]), "test", false);
+  FileDescriptor released;
+  handle->OrphanHandle(nullptr, &released, "release");
+  EXPECT_EQ(released.fd(), fds_[0]);
+  // The released descriptor must still be open and usable by its new owner.
+  EXPECT_NE(fcntl(released.fd(), F_GETFD), -1);
+  ASSERT_EQ(write(fds_[1], "x", 1), 1);
+  char buf;
+  EXPECT_EQ(read(released.fd(), &buf, 1), 1);
+  close(released.fd());
+}
+
+TEST_F(IoUringPollerTest, RecyclesHandles) {
+  for (int i = 0; i < 16; ++i) {
+    int pair[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+    EventHandle* handle = poller_->CreateHandle(
+        poller_->posix_interface().Adopt(pair[0]), "test", false);
+    bool readable = false;
+    handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+        [&readable](absl::Status /*status*/) { readable = true; }));
+    ASSERT_EQ(write(pair[1], "x", 1), 1);
+    WorkUntil(&readable);
+    ASSERT_TRUE(readable) << "iteration " << i;
+    handle->OrphanHandle(nullptr, nullptr, "done");
+    close(pair[1]);
+  }
+  close(fds_[0]);
+}
+
+TEST_F(IoUringPollerTest, StaleCompletionsDoNotReachAReusedHandle) {
+  // The first descriptor is readable before it is registered, so the kernel
+  // posts a completion as soon as the poll is armed.
+  ASSERT_EQ(write(fds_[1], "x", 1), 1);
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(fds_[0]), "test", false);
+  handle->OrphanHandle(nullptr, nullptr, "done");
+  // The orphaned handle is reused for a descriptor that never gets readable.
+  int pair[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+  EventHandle* reused = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(pair[0]), "test", false);
+  ASSERT_EQ(reused, handle);
+  bool readable = false;
+  reused->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [&readable](absl::Status /*status*/) { readable = true; }));
+  for (int i = 0; i < 5 && !readable; ++i) {
+    poller_->Work(100ms, []() {});
+  }
+  EXPECT_FALSE(readable);
+  reused->ShutdownHandle(absl::CancelledError("done"));
+  reused->OrphanHandle(nullptr, nullptr, "done");
+  close(pair[1]);
+}
+
+TEST_F(IoUringPollerTest, RecvMsgCompletesOnceDataArrives) {
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(fds_[0]), "test", false);
+  ASSERT_TRUE(handle->SupportsAsyncIo());
+  char buf[8] = {};
+  iovec iov = {buf, sizeof(buf)};
+  msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  bool done = false;
+  int64_t result = 0;
+  handle->RecvMsg(&msg, 0, [&done, &result](int64_t r) {
+    result = r;
+    done = true;
+  });
+  // Nothing has been sent yet, so the receive has to wait for the peer.
+  poller_->Work(10ms, []() {});
+  EXPECT_FALSE(done);
+  ASSERT_EQ(write(fds_[1], "abc", 3), 3);
+  WorkUntil(&done);
+  ASSERT_TRUE(done);
+  EXPECT_EQ(result, 3);
+  EXPECT_EQ(absl::string_view(buf, 3), "abc");
+  handle->OrphanHandle(nullptr, nullptr, "done");
+}
+
+TEST_F(IoUringPollerTest, SendMsgWritesToThePeer) {
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(fds_[0]), "test", false);
+  char data[] = "xyz";
+  iovec iov = {data, 3};
+  msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  bool done = false;
+  int64_t result = 0;
+  handle->SendMsg(&msg, MSG_NOSIGNAL, [&done, &result](int64_t r) {
+    result = r;
+    done = true;
+  });
+  WorkUntil(&done);
+  ASSERT_TRUE(done);
+  EXPECT_EQ(result, 3);
+  char buf[3];
+  ASSERT_EQ(read(fds_[1], buf, sizeof(buf)), 3);
+  EXPECT_EQ(absl::string_view(buf, 3), "xyz");
+  handle->OrphanHandle(nullptr, nullptr, "done");
+}
+
+TEST_F(IoUringPollerTest, ShutdownCancelsIoInFlight) {
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(fds_[0]), "test", false);
+  char buf[8];
+  iovec iov = {buf, sizeof(buf)};
+  msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  bool done = false;
+  int64_t result = 0;
+  handle->RecvMsg(&msg, 0, [&done, &result](int64_t r) {
+    result = r;
+    done = true;
+  });
+  poller_->Work(10ms, []() {});
+  ASSERT_FALSE(done);
+  handle->ShutdownHandle(absl::CancelledError("shutdown"));
+  WorkUntil(&done);
+  ASSERT_TRUE(done);
+  EXPECT_EQ(result, -ECANCELED);
+  // Once shut down, new requests fail right away.
+  done = false;
+  handle->RecvMsg(&msg, 0, [&done, &result](int64_t r) {
+    result = r;
+    done = true;
+  });
+  EXPECT_TRUE(done);
+  EXPECT_EQ(result, -ECANCELED);
+  handle->OrphanHandle(nullptr, nullptr, "done");
+}
+
+TEST_F(IoUringPollerTest, KickInterruptsWork) {
+  poller_->Kick();
+  EXPECT_EQ(poller_->Work(24h, []() {}), Poller::WorkResult::kKicked);
+  close(fds_[0]);
+}
+
+TEST_F(IoUringPollerTest, WorkTimesOut) {
+  EXPECT_EQ(poller_->Work(10ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  close(fds_[0]);
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
+
+#else  // GRPC_POSIX_SOCKET_EV
+
+int main(int argc, char** argv) { return 1; }
+
+#endif  // GRPC_POSIX_SOCKET_EV
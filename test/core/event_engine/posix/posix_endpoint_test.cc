@@ -101,6 +101,9 @@ std::list<Connection> CreateConnectedEndpoints(
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 1);
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD,
                     kMinMessageSize);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD,
+                    kMinMessageSize);
   }
   ChannelArgsEndpointConfig config(args);
   auto listener = oracle_ee->CreateListener(
@@ -0,0 +1,210 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/time.h"
+
+using testing::Mock;
+using testing::StrictMock;
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+class MockClosure : public experimental::EventEngine::Closure {
+ public:
+  MOCK_METHOD(void, Run, ());
+};
+
+class FakeHost : public TimerListHost {
+ public:
+  explicit FakeHost(int64_t now_ms)
+      : now_(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now_ms)) {
+  }
+
+  grpc_core::Timestamp Now() override { return now_; }
+  void Kick() override { ++kicks_; }
+
+  void AdvanceTo(int64_t now_ms) {
+    now_ = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now_ms);
+  }
+  int kicks() const { return kicks_; }
+
+ private:
+  grpc_core::Timestamp now_;
+  int kicks_ = 0;
+};
+
+grpc_core::Timestamp At(int64_t ms) {
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(ms);
+}
+
+// Runs whatever TimerCheck returns, and returns how many closures ran.
+size_t RunExpired(TimerWheel& wheel, grpc_core::Timestamp* next = nullptr) {
+  auto closures = wheel.TimerCheck(next);
+  EXPECT_TRUE(closures.has_value());
+  if (!closures.has_value()) return 0;
+  for (auto* closure : *closures) closure->Run();
+  return closures->size();
+}
+
+}  // namespace
+
+TEST(TimerWheelTest, Add) {
+  Timer timers[20];
+  StrictMock<MockClosure> closures[20];
+  FakeHost host(100);
+  TimerWheel wheel(&host);
+
+  // 10 ms timers, then 1010 ms timers.
+  for (int i = 0; i < 10; i++) {
+    wheel.TimerInit(&timers[i], At(110), &closures[i]);
+  }
+  for (int i = 10; i < 20; i++) {
+    wheel.TimerInit(&timers[i], At(1110), &closures[i]);
+  }
+  EXPECT_GT(host.kicks(), 0);
+
+  // Only the first batch is due.
+  host.AdvanceTo(600);
+  for (int i = 0; i < 10; i++) EXPECT_CALL(closures[i], Run());
+  EXPECT_EQ(RunExpired(wheel), 10u);
+  for (int i = 0; i < 10; i++) Mock::VerifyAndClearExpectations(&closures[i]);
+
+  host.AdvanceTo(700);
+  EXPECT_EQ(RunExpired(wheel), 0u);
+
+  host.AdvanceTo(1600);
+  for (int i = 10; i < 20; i++) EXPECT_CALL(closures[i], Run());
+  EXPECT_EQ(RunExpired(wheel), 10u);
+  for (int i = 10; i < 20; i++) Mock::VerifyAndClearExpectations(&closures[i]);
+
+  host.AdvanceTo(1700);
+  EXPECT_EQ(RunExpired(wheel), 0u);
+}
+
+// A timer filed in a high level is moved down as time passes, and fires at
+// its deadline, not at the start of any of the slots it passed through.
+TEST(TimerWheelTest, FiresAtDeadlineAcrossLevels) {
+  const int64_t kStart = 1000;
+  const int64_t kDeadline = kStart + 7 * 3600 * 1000 + 12345;
+  Timer timer;
+  StrictMock<MockClosure> closure;
+  FakeHost host(kStart);
+  TimerWheel wheel(&host);
+  wheel.TimerInit(&timer, At(kDeadline), &closure);
+
+  // Check at increasing intervals up to just before the deadline: each check
+  // may only cascade the timer.
+  int64_t now = kStart;
+  for (int64_t step = 1; now + step < kDeadline; step *= 3) {
+    now += step;
+    host.AdvanceTo(now);
+    grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+    EXPECT_EQ(RunExpired(wheel, &next), 0u);
+    EXPECT_LE(next, At(kDeadline));
+  }
+  host.AdvanceTo(kDeadline - 1);
+  EXPECT_EQ(RunExpired(wheel), 0u);
+
+  host.AdvanceTo(kDeadline);
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_CALL(closure, Run());
+  EXPECT_EQ(RunExpired(wheel, &next), 1u);
+  EXPECT_EQ(next, grpc_core::Timestamp::InfFuture());
+  EXPECT_FALSE(wheel.TimerCancel(&timer));
+}
+
+TEST(TimerWheelTest, Cancel) {
+  Timer timers[5];
+  StrictMock<MockClosure> closures[5];
+  FakeHost host(0);
+  TimerWheel wheel(&host);
+
+  wheel.TimerInit(&timers[0], At(100), &closures[0]);
+  wheel.TimerInit(&timers[1], At(3), &closures[1]);
+  wheel.TimerInit(&timers[2], At(100), &closures[2]);
+  wheel.TimerInit(&timers[3], At(3), &closures[3]);
+  wheel.TimerInit(&timers[4], At(1), &closures[4]);
+
+  host.AdvanceTo(2);
+  EXPECT_CALL(closures[4], Run());
+  EXPECT_EQ(RunExpired(wheel), 1u);
+  Mock::VerifyAndClearExpectations(&closures[4]);
+  EXPECT_FALSE(wheel.TimerCancel(&timers[4]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[0]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[3]));
+  EXPECT_FALSE(wheel.TimerCancel(&timers[3]));
+
+  // The cancelled timers do not run when their deadlines pass.
+  host.AdvanceTo(200);
+  EXPECT_CALL(closures[1], Run());
+  EXPECT_CALL(closures[2], Run());
+  EXPECT_EQ(RunExpired(wheel), 2u);
+}
+
+// A deadline at or before the current time runs at the next check.
+TEST(TimerWheelTest, PastDeadline) {
+  Timer timer;
+  StrictMock<MockClosure> closure;
+  FakeHost host(5000);
+  TimerWheel wheel(&host);
+  const int kicks = host.kicks();
+  wheel.TimerInit(&timer, At(10), &closure);
+  EXPECT_GT(host.kicks(), kicks);
+  EXPECT_CALL(closure, Run());
+  EXPECT_EQ(RunExpired(wheel), 1u);
+}
+
+// Deadlines beyond the range of the top level wait in the overflow list and
+// can still be cancelled.
+TEST(TimerWheelTest, LongRunningServiceCleanup) {
+  const int64_t k25DaysMs = int64_t{25} * 24 * 3600 * 1000;
+  Timer timers[3];
+  StrictMock<MockClosure> closures[3];
+  FakeHost host(k25DaysMs);
+  TimerWheel wheel(&host);
+
+  wheel.TimerInit(&timers[0], At(2 * k25DaysMs), &closures[0]);
+  wheel.TimerInit(&timers[1], At(k25DaysMs + 3), &closures[1]);
+  wheel.TimerInit(&timers[2], At(std::numeric_limits<int64_t>::max() - 1),
+                  &closures[2]);
+
+  host.AdvanceTo(k25DaysMs + 4);
+  EXPECT_CALL(closures[1], Run());
+  EXPECT_EQ(RunExpired(wheel), 1u);
+  EXPECT_TRUE(wheel.TimerCancel(&timers[0]));
+  EXPECT_FALSE(wheel.TimerCancel(&timers[1]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[2]));
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,290 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_registry.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class LeastRequestTest : public LoadBalancingPolicyTest {
+ protected:
+  LeastRequestTest() : LoadBalancingPolicyTest("least_request") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeLeastRequestConfig(
+      Json::Object fields = {}) {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"least_request", Json::FromObject(std::move(fields))}})}));
+  }
+
+  static absl::Status ParseLeastRequestConfig(Json::Object fields) {
+    return CoreConfiguration::Get()
+        .lb_policy_registry()
+        .ParseLoadBalancingConfig(Json::FromArray({Json::FromObject(
+            {{"least_request", Json::FromObject(std::move(fields))}})}))
+        .status();
+  }
+
+  // Brings up a connection to each address and returns the picker once
+  // they are all READY.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ConnectAll(
+      absl::Span<const absl::string_view> addresses) {
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr) << addresses[i];
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      if (i == 0) ExpectConnectingUpdate();
+    }
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      FindSubchannel(addresses[i])->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = i == 0 ? WaitForConnected() : ExpectState(GRPC_CHANNEL_READY);
+    }
+    return picker;
+  }
+
+  using CallTracker = LoadBalancingPolicy::SubchannelCallTrackerInterface;
+
+  // A call that has been picked and started but not yet finished.
+  struct Call {
+    std::string address;
+    std::unique_ptr<CallTracker> subchannel_call_tracker;
+  };
+
+  // Picks and starts num_calls calls, leaving them in flight.
+  std::vector<Call> StartCalls(LoadBalancingPolicy::SubchannelPicker* picker,
+                               size_t num_calls) {
+    std::vector<Call> calls;
+    for (size_t i = 0; i < num_calls; ++i) {
+      std::unique_ptr<CallTracker> subchannel_call_tracker;
+      auto address =
+          ExpectPickComplete(picker, {}, {}, &subchannel_call_tracker);
+      EXPECT_TRUE(address.has_value());
+      EXPECT_NE(subchannel_call_tracker, nullptr);
+      if (!address.has_value() || subchannel_call_tracker == nullptr) break;
+      subchannel_call_tracker->Start();
+      calls.push_back(
+          {std::move(*address), std::move(subchannel_call_tracker)});
+    }
+    return calls;
+  }
+
+  void FinishCalls(std::vector<Call> calls) {
+    for (Call& call : calls) {
+      FakeMetadata metadata({});
+      FakeBackendMetricAccessor backend_metric_accessor({});
+      CallTracker::FinishArgs args = {
+          call.address, absl::OkStatus(), &metadata, &backend_metric_accessor};
+      call.subchannel_call_tracker->Finish(args);
+    }
+  }
+
+  static std::map<std::string, size_t> CountByAddress(
+      const std::vector<Call>& calls) {
+    std::map<std::string, size_t> counts;
+    for (const Call& call : calls) ++counts[call.address];
+    return counts;
+  }
+};
+
+TEST_F(LeastRequestTest, Config) {
+  EXPECT_EQ(ParseLeastRequestConfig({}), absl::OkStatus());
+  EXPECT_EQ(ParseLeastRequestConfig({{"choiceCount", Json::FromNumber(3)},
+                                     {"useEndpointWeights",
+                                      Json::FromBool(true)}}),
+            absl::OkStatus());
+  // Values above 10 are clamped rather than rejected.
+  EXPECT_EQ(ParseLeastRequestConfig({{"choiceCount", Json::FromNumber(100)}}),
+            absl::OkStatus());
+  EXPECT_EQ(ParseLeastRequestConfig({{"choiceCount", Json::FromNumber(1)}}),
+            absl::InvalidArgumentError(
+                "errors validating least_request LB policy config: "
+                "[field:choiceCount error:must be at least 2]"));
+}
+
+TEST_F(LeastRequestTest, PicksAllEndpoints) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeLeastRequestConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto picks = GetCompletePicks(picker.get(), 100);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_EQ(std::set<std::string>(picks->begin(), picks->end()),
+            std::set<std::string>(kAddresses.begin(), kAddresses.end()));
+}
+
+TEST_F(LeastRequestTest, BalancesCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeLeastRequestConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Whenever a pick samples both endpoints, it goes to the one with fewer
+  // calls in flight, so the counts stay close.
+  auto calls = StartCalls(picker.get(), 40);
+  auto counts = CountByAddress(calls);
+  EXPECT_NEAR(counts[std::string(kAddresses[0])], 20, 6);
+  EXPECT_NEAR(counts[std::string(kAddresses[1])], 20, 6);
+  FinishCalls(std::move(calls));
+}
+
+TEST_F(LeastRequestTest, FinishedCallsAreNotCounted) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakeLeastRequestConfig(
+                                        {{"choiceCount",
+                                          Json::FromNumber(10)}})),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Finish the calls to one endpoint and keep the rest in flight.  The next
+  // calls go to the idle endpoint until it catches up, then alternate.
+  auto calls = StartCalls(picker.get(), 20);
+  std::vector<Call> finished_calls;
+  std::vector<Call> remaining_calls;
+  for (Call& call : calls) {
+    (call.address == kAddresses[0] ? finished_calls : remaining_calls)
+        .push_back(std::move(call));
+  }
+  EXPECT_NEAR(finished_calls.size(), 10, 3);
+  FinishCalls(std::move(finished_calls));
+  calls = StartCalls(picker.get(), 20);
+  auto counts = CountByAddress(calls);
+  EXPECT_NEAR(counts[std::string(kAddresses[0])],
+              remaining_calls.size() + (20 - remaining_calls.size()) / 2.0, 2);
+  FinishCalls(std::move(calls));
+  FinishCalls(std::move(remaining_calls));
+}
+
+TEST_F(LeastRequestTest, BalancesCallsInFlightByWeight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  const std::array<EndpointAddresses, 2> kEndpoints = {
+      MakeEndpointAddresses({kAddresses[0]},
+                            ChannelArgs().Set(GRPC_ARG_ADDRESS_WEIGHT, 3)),
+      MakeEndpointAddresses({kAddresses[1]},
+                            ChannelArgs().Set(GRPC_ARG_ADDRESS_WEIGHT, 1))};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kEndpoints,
+                                    MakeLeastRequestConfig(
+                                        {{"choiceCount", Json::FromNumber(10)},
+                                         {"useEndpointWeights",
+                                          Json::FromBool(true)}})),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto calls = StartCalls(picker.get(), 40);
+  auto counts = CountByAddress(calls);
+  EXPECT_NEAR(counts[std::string(kAddresses[0])], 30, 3);
+  EXPECT_NEAR(counts[std::string(kAddresses[1])], 10, 3);
+  FinishCalls(std::move(calls));
+}
+
+TEST_F(LeastRequestTest, WeightsIgnoredUnlessEnabled) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  const std::array<EndpointAddresses, 2> kEndpoints = {
+      MakeEndpointAddresses({kAddresses[0]},
+                            ChannelArgs().Set(GRPC_ARG_ADDRESS_WEIGHT, 3)),
+      MakeEndpointAddresses({kAddresses[1]},
+                            ChannelArgs().Set(GRPC_ARG_ADDRESS_WEIGHT, 1))};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kEndpoints,
+                                    MakeLeastRequestConfig(
+                                        {{"choiceCount",
+                                          Json::FromNumber(10)}})),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto calls = StartCalls(picker.get(), 40);
+  auto counts = CountByAddress(calls);
+  EXPECT_NEAR(counts[std::string(kAddresses[0])], 20, 3);
+  EXPECT_NEAR(counts[std::string(kAddresses[1])], 20, 3);
+  FinishCalls(std::move(calls));
+}
+
+TEST_F(LeastRequestTest, CallsInFlightSurviveAddressUpdate) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto config = MakeLeastRequestConfig({{"choiceCount", Json::FromNumber(10)}});
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(absl::MakeSpan(kAddresses).first(1),
+                                    config),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(absl::MakeSpan(kAddresses).first(1));
+  ASSERT_NE(picker, nullptr);
+  auto calls = StartCalls(picker.get(), 20);
+  // Add a second endpoint.  The first keeps its 20 calls in flight, so the
+  // next 20 calls all go to the new one, barring a pick that samples only
+  // the first endpoint ten times.
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, config), lb_policy()),
+            absl::OkStatus());
+  auto* subchannel = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = WaitForConnected();
+  while (!helper_->QueueEmpty()) picker = ExpectState(GRPC_CHANNEL_READY);
+  ASSERT_NE(picker, nullptr);
+  auto new_calls = StartCalls(picker.get(), 20);
+  auto counts = CountByAddress(new_calls);
+  EXPECT_GE(counts[std::string(kAddresses[1])], 18);
+  FinishCalls(std::move(new_calls));
+  FinishCalls(std::move(calls));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,164 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Call latencies under round robin and under peak_ewma's picks, against
+// simulated backends, and the cost of a peak_ewma pick.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <queue>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "src/core/load_balancing/peak_ewma/peak_ewma_load.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int64_t kMillis = 1000000;
+constexpr int64_t kDecayTime = 10000 * kMillis;
+constexpr int64_t kDefaultLatency = 30 * kMillis;
+
+std::vector<std::unique_ptr<PeakEwmaLoad>> MakeLoads(size_t num_endpoints) {
+  std::vector<std::unique_ptr<PeakEwmaLoad>> loads;
+  for (size_t i = 0; i < num_endpoints; ++i) {
+    loads.push_back(
+        std::make_unique<PeakEwmaLoad>(kDecayTime, kDefaultLatency, 0));
+  }
+  return loads;
+}
+
+void BM_PeakEwmaPick(benchmark::State& state) {
+  auto loads = MakeLoads(state.range(0));
+  absl::InsecureBitGen bitgen;
+  int64_t now = 0;
+  for (auto s : state) {
+    const size_t index = PickLowerCostOfTwo(
+        loads.size(), bitgen, [&](size_t i) { return loads[i]->Cost(now); });
+    loads[index]->CallStarted();
+    loads[index]->CallFinished(kMillis, now);
+    now += kMillis / 10;
+  }
+}
+BENCHMARK(BM_PeakEwmaPick)->RangeMultiplier(10)->Range(10, 1000);
+
+void BM_RoundRobinPick(benchmark::State& state) {
+  const size_t num_endpoints = state.range(0);
+  std::atomic<size_t> last_picked_index{0};
+  for (auto s : state) {
+    benchmark::DoNotOptimize(
+        last_picked_index.fetch_add(1, std::memory_order_relaxed) %
+        num_endpoints);
+  }
+}
+BENCHMARK(BM_RoundRobinPick)->RangeMultiplier(10)->Range(10, 1000);
+
+// Sends Poisson arrivals at half the backends' total capacity to a set of
+// backends, each serving one call at a time in arrival order with
+// exponentially distributed service times.  Some backends are slower than
+// the rest by slowdown.  Each iteration simulates kNumCalls calls and the
+// counters report latency percentiles in milliseconds over all of them.
+void BM_SimulatedBackends(benchmark::State& state) {
+  constexpr size_t kNumBackends = 10;
+  constexpr size_t kNumSlowBackends = 2;
+  constexpr size_t kNumCalls = 100000;
+  constexpr double kMeanServiceTime = 10.0 * kMillis;
+  constexpr double kUtilization = 0.5;
+  const bool peak_ewma = state.range(0) != 0;
+  const double slowdown = state.range(1);
+  std::vector<double> mean_service_times(kNumBackends, kMeanServiceTime);
+  for (size_t i = 0; i < kNumSlowBackends; ++i) {
+    mean_service_times[i] *= slowdown;
+  }
+  double capacity = 0;  // Calls per nanosecond.
+  for (double mean : mean_service_times) capacity += 1 / mean;
+  const double mean_interarrival_time = 1 / (kUtilization * capacity);
+  absl::InsecureBitGen bitgen;
+  std::vector<double> latencies;
+  for (auto s : state) {
+    struct Completion {
+      int64_t time;
+      int64_t latency;
+      size_t backend;
+      bool operator>(const Completion& other) const {
+        return time > other.time;
+      }
+    };
+    std::priority_queue<Completion, std::vector<Completion>,
+                        std::greater<Completion>>
+        completions;
+    auto loads = MakeLoads(kNumBackends);
+    std::vector<int64_t> busy_until(kNumBackends);
+    size_t next_index = absl::Uniform<size_t>(bitgen, 0, kNumBackends);
+    int64_t now = 0;
+    for (size_t call = 0; call < kNumCalls; ++call) {
+      now += absl::Exponential<double>(bitgen, 1 / mean_interarrival_time);
+      while (!completions.empty() && completions.top().time <= now) {
+        const Completion& completion = completions.top();
+        loads[completion.backend]->CallFinished(completion.latency,
+                                                completion.time);
+        completions.pop();
+      }
+      size_t backend;
+      if (peak_ewma) {
+        backend = PickLowerCostOfTwo(
+            kNumBackends, bitgen,
+            [&](size_t i) { return loads[i]->Cost(now); });
+      } else {
+        backend = next_index++ % kNumBackends;
+      }
+      const int64_t finish =
+          std::max(now, busy_until[backend]) +
+          absl::Exponential<double>(bitgen,
+                                    1 / mean_service_times[backend]);
+      busy_until[backend] = finish;
+      loads[backend]->CallStarted();
+      completions.push({finish, finish - now, backend});
+      latencies.push_back(static_cast<double>(finish - now) / kMillis);
+    }
+  }
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&](double p) {
+    if (latencies.empty()) return 0.0;
+    return latencies[std::min(latencies.size() - 1,
+                              static_cast<size_t>(p * latencies.size()))];
+  };
+  state.counters["p50_ms"] = percentile(0.5);
+  state.counters["p99_ms"] = percentile(0.99);
+  state.counters["p999_ms"] = percentile(0.999);
+}
+BENCHMARK(BM_SimulatedBackends)
+    ->ArgNames({"peak_ewma", "slowdown"})
+    ->ArgsProduct({{0, 1}, {1, 2, 3}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,152 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/peak_ewma/peak_ewma_load.h"
+
+#include <cmath>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int64_t kMillis = 1000000;
+constexpr int64_t kDecayTime = 10000 * kMillis;
+constexpr int64_t kDefaultLatency = 30 * kMillis;
+
+TEST(PeakEwmaLoadTest, DefaultLatencyBeforeFirstSample) {
+  PeakEwmaLoad load(kDecayTime, kDefaultLatency, 0);
+  EXPECT_DOUBLE_EQ(load.LatencyEstimate(0), kDefaultLatency);
+  EXPECT_DOUBLE_EQ(load.Cost(0), kDefaultLatency);
+}
+
+TEST(PeakEwmaLoadTest, CostCountsCallsInFlight) {
+  PeakEwmaLoad load(kDecayTime, kDefaultLatency, 0);
+  load.CallStarted();
+  load.CallStarted();
+  EXPECT_EQ(load.calls_in_flight(), 2);
+  EXPECT_DOUBLE_EQ(load.Cost(0), 3.0 * kDefaultLatency);
+  load.CallFinished(kDefaultLatency, 0);
+  EXPECT_EQ(load.calls_in_flight(), 1);
+  EXPECT_DOUBLE_EQ(load.Cost(0), 2.0 * kDefaultLatency);
+}
+
+TEST(PeakEwmaLoadTest, HigherSampleReplacesEstimate) {
+  PeakEwmaLoad load(kDecayTime, kDefaultLatency, 0);
+  load.CallStarted();
+  load.CallFinished(500 * kMillis, 0);
+  EXPECT_DOUBLE_EQ(load.LatencyEstimate(0), 500 * kMillis);
+}
+
+TEST(PeakEwmaLoadTest, LowerSampleMovesEstimateGradually) {
+  PeakEwmaLoad load(kDecayTime, kDefaultLatency, 0);
+  load.CallStarted();
+  load.CallFinished(500 * kMillis, 0);
+  // One decay time after the last sample, the old estimate keeps 1/e of
+  // its weight.
+  load.CallStarted();
+  load.CallFinished(100 * kMillis, kDecayTime);
+  const double decay = std::exp(-1.0);
+  EXPECT_NEAR(load.LatencyEstimate(kDecayTime),
+              500 * kMillis * decay + 100 * kMillis * (1 - decay), 1);
+  // A sample at the same time as the last one doesn't move the estimate.
+  const double estimate = load.LatencyEstimate(kDecayTime);
+  load.CallStarted();
+  load.CallFinished(1 * kMillis, kDecayTime);
+  EXPECT_DOUBLE_EQ(load.LatencyEstimate(kDecayTime), estimate);
+}
+
+TEST(PeakEwmaLoadTest, EstimateDecaysWhileIdle) {
+  PeakEwmaLoad load(kDecayTime, kDefaultLatency, 0);
+  load.CallStarted();
+  load.CallFinished(500 * kMillis, 0);
+  EXPECT_NEAR(load.LatencyEstimate(2 * kDecayTime),
+              500 * kMillis * std::exp(-2.0), 1);
+  // Time going backwards doesn't inflate the estimate.
+  EXPECT_DOUBLE_EQ(load.LatencyEstimate(-kDecayTime), 500 * kMillis);
+}
+
+TEST(PeakEwmaLoadTest, EstimateHoldsWhileCallsAreStuck) {
+  PeakEwmaLoad healthy(kDecayTime, kDefaultLatency, 0);
+  healthy.CallStarted();
+  healthy.CallFinished(100 * kMillis, 0);
+  // A backend whose calls never finish gets no samples after its first.
+  PeakEwmaLoad stuck(kDecayTime, kDefaultLatency, 0);
+  stuck.CallStarted();
+  stuck.CallFinished(50 * kMillis, 0);
+  for (int i = 0; i < 20; ++i) stuck.CallStarted();
+  // Long after, the stuck backend's estimate has not decayed, and its
+  // calls in flight make it cost more than the idle healthy backend.
+  const int64_t later = 10 * kDecayTime;
+  EXPECT_DOUBLE_EQ(stuck.LatencyEstimate(later), 50 * kMillis);
+  EXPECT_DOUBLE_EQ(stuck.Cost(later), 21.0 * 50 * kMillis);
+  EXPECT_GT(stuck.Cost(later), healthy.Cost(later));
+  // Once its calls finish, the estimate decays again.
+  for (int i = 0; i < 20; ++i) stuck.CallFinished(later, later);
+  EXPECT_LT(stuck.LatencyEstimate(later + 2 * kDecayTime), later);
+}
+
+TEST(PeakEwmaLoadTest, ZeroEstimatePenalizesCallsInFlight) {
+  PeakEwmaLoad load(kDecayTime, kDefaultLatency, 0);
+  load.CallStarted();
+  load.CallFinished(0, 0);
+  // Only zero-latency samples, so the estimate decays to exactly zero.
+  load.CallStarted();
+  load.CallFinished(0, 1000 * kDecayTime);
+  EXPECT_DOUBLE_EQ(load.Cost(1000 * kDecayTime), 0);
+  load.CallStarted();
+  PeakEwmaLoad busy(kDecayTime, kDefaultLatency, 0);
+  for (int i = 0; i < 100; ++i) busy.CallStarted();
+  EXPECT_GT(load.Cost(1000 * kDecayTime), busy.Cost(1000 * kDecayTime));
+}
+
+TEST(PickLowerCostOfTwoTest, SingleEndpoint) {
+  absl::BitGen bitgen;
+  EXPECT_EQ(PickLowerCostOfTwo(1, bitgen, [](size_t) { return 1.0; }), 0);
+}
+
+TEST(PickLowerCostOfTwoTest, NeverPicksTheMostExpensive) {
+  absl::BitGen bitgen;
+  const std::vector<double> costs = {1, 2, 3};
+  std::vector<int> picks(costs.size());
+  for (int i = 0; i < 3000; ++i) {
+    ++picks[PickLowerCostOfTwo(costs.size(), bitgen,
+                               [&](size_t index) { return costs[index]; })];
+  }
+  // The cheapest endpoint wins whenever it is one of the two choices.
+  EXPECT_NEAR(picks[0], 2000, 200);
+  EXPECT_NEAR(picks[1], 1000, 200);
+  EXPECT_EQ(picks[2], 0);
+}
+
+TEST(PickLowerCostOfTwoTest, TwoEndpointsAlwaysCompared) {
+  absl::BitGen bitgen;
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(PickLowerCostOfTwo(2, bitgen,
+                                 [](size_t index) { return index == 0; }),
+              1);
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
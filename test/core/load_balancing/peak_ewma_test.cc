@@ -0,0 +1,254 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <array>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_registry.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class PeakEwmaTest : public LoadBalancingPolicyTest {
+ protected:
+  PeakEwmaTest() : LoadBalancingPolicyTest("peak_ewma") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakePeakEwmaConfig(
+      Json::Object fields = {}) {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"peak_ewma", Json::FromObject(std::move(fields))}})}));
+  }
+
+  static absl::Status ParsePeakEwmaConfig(Json::Object fields) {
+    return CoreConfiguration::Get()
+        .lb_policy_registry()
+        .ParseLoadBalancingConfig(Json::FromArray({Json::FromObject(
+            {{"peak_ewma", Json::FromObject(std::move(fields))}})}))
+        .status();
+  }
+
+  // Brings up a connection to each address and returns the picker once
+  // they are all READY.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ConnectAll(
+      absl::Span<const absl::string_view> addresses) {
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr) << addresses[i];
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      if (i == 0) ExpectConnectingUpdate();
+    }
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      FindSubchannel(addresses[i])->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = i == 0 ? WaitForConnected() : ExpectState(GRPC_CHANNEL_READY);
+    }
+    return picker;
+  }
+
+  using CallTracker = LoadBalancingPolicy::SubchannelCallTrackerInterface;
+
+  // Picks, starts a call, and returns its address and call tracker.
+  std::pair<std::string, std::unique_ptr<CallTracker>> StartCall(
+      LoadBalancingPolicy::SubchannelPicker* picker) {
+    std::unique_ptr<CallTracker> subchannel_call_tracker;
+    auto address = ExpectPickComplete(picker, {}, {}, &subchannel_call_tracker);
+    EXPECT_TRUE(address.has_value());
+    EXPECT_NE(subchannel_call_tracker, nullptr);
+    if (subchannel_call_tracker != nullptr) subchannel_call_tracker->Start();
+    return {address.value_or(""), std::move(subchannel_call_tracker)};
+  }
+
+  void FinishCall(std::unique_ptr<CallTracker> subchannel_call_tracker,
+                  absl::string_view address) {
+    FakeMetadata metadata({});
+    FakeBackendMetricAccessor backend_metric_accessor({});
+    CallTracker::FinishArgs args = {
+        address, absl::OkStatus(), &metadata, &backend_metric_accessor};
+    subchannel_call_tracker->Finish(args);
+  }
+
+  // Makes the endpoint that the next pick goes to slow, by finishing a call
+  // to it after latency, and returns its address.
+  std::string MakeSlowEndpoint(LoadBalancingPolicy::SubchannelPicker* picker,
+                               Duration latency) {
+    auto [address, subchannel_call_tracker] = StartCall(picker);
+    IncrementTimeBy(latency);
+    FinishCall(std::move(subchannel_call_tracker), address);
+    return address;
+  }
+};
+
+TEST_F(PeakEwmaTest, Config) {
+  EXPECT_EQ(ParsePeakEwmaConfig({}), absl::OkStatus());
+  EXPECT_EQ(ParsePeakEwmaConfig({{"decayTime", Json::FromString("5s")},
+                                 {"defaultLatency", Json::FromString("0.1s")}}),
+            absl::OkStatus());
+  EXPECT_EQ(ParsePeakEwmaConfig({{"decayTime", Json::FromString("0s")}}),
+            absl::InvalidArgumentError(
+                "errors validating peak_ewma LB policy config: "
+                "[field:decayTime error:must be greater than zero]"));
+  EXPECT_EQ(ParsePeakEwmaConfig({{"defaultLatency", Json::FromString("0s")}}),
+            absl::InvalidArgumentError(
+                "errors validating peak_ewma LB policy config: "
+                "[field:defaultLatency error:must be greater than zero]"));
+}
+
+TEST_F(PeakEwmaTest, PicksAllEndpoints) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto picks = GetCompletePicks(picker.get(), 100);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_EQ(std::set<std::string>(picks->begin(), picks->end()),
+            std::set<std::string>(kAddresses.begin(), kAddresses.end()));
+}
+
+TEST_F(PeakEwmaTest, AvoidsEndpointWithCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // With two endpoints, every pick compares both.  While one has a call in
+  // flight, the other is cheaper.
+  auto [busy_address, subchannel_call_tracker] = StartCall(picker.get());
+  for (size_t i = 0; i < 10; ++i) {
+    auto address = ExpectPickComplete(picker.get());
+    EXPECT_NE(address, busy_address);
+  }
+  FinishCall(std::move(subchannel_call_tracker), busy_address);
+}
+
+TEST_F(PeakEwmaTest, AvoidsSlowEndpoint) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  std::string slow_address =
+      MakeSlowEndpoint(picker.get(), Duration::Seconds(1));
+  // One second of latency outweighs the other endpoint's default estimate
+  // even with a few calls in flight to it.
+  std::vector<std::unique_ptr<CallTracker>> subchannel_call_trackers;
+  for (size_t i = 0; i < 10; ++i) {
+    auto [address, subchannel_call_tracker] = StartCall(picker.get());
+    EXPECT_NE(address, slow_address);
+    subchannel_call_trackers.push_back(std::move(subchannel_call_tracker));
+  }
+  for (auto& subchannel_call_tracker : subchannel_call_trackers) {
+    auto address = slow_address == kAddresses[0] ? kAddresses[1]
+                                                 : kAddresses[0];
+    FinishCall(std::move(subchannel_call_tracker), address);
+  }
+}
+
+TEST_F(PeakEwmaTest, SlowEndpointRecoversAfterDecay) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakePeakEwmaConfig(
+                                        {{"decayTime",
+                                          Json::FromString("1s")}})),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  std::string slow_address =
+      MakeSlowEndpoint(picker.get(), Duration::Milliseconds(500));
+  // The other endpoint keeps serving calls in 100ms.  Meanwhile the slow
+  // endpoint's estimate decays, and after ln(5) decay times it is cheaper
+  // again.
+  size_t num_calls = 0;
+  for (; num_calls < 50; ++num_calls) {
+    auto [address, subchannel_call_tracker] = StartCall(picker.get());
+    IncrementTimeBy(Duration::Milliseconds(100));
+    FinishCall(std::move(subchannel_call_tracker), address);
+    if (address == slow_address) break;
+  }
+  EXPECT_GE(num_calls, 15);
+  EXPECT_LT(num_calls, 50);
+}
+
+TEST_F(PeakEwmaTest, LoadSurvivesAddressUpdate) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(absl::MakeSpan(kAddresses).first(2),
+                                    MakePeakEwmaConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(absl::MakeSpan(kAddresses).first(2));
+  ASSERT_NE(picker, nullptr);
+  std::string slow_address =
+      MakeSlowEndpoint(picker.get(), Duration::Seconds(1));
+  // Add a third endpoint.  The slow one keeps its estimate, so as the most
+  // expensive of the three it is never picked.
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto* subchannel = FindSubchannel(kAddresses[2]);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = WaitForConnected();
+  while (!helper_->QueueEmpty()) picker = ExpectState(GRPC_CHANNEL_READY);
+  ASSERT_NE(picker, nullptr);
+  auto picks = GetCompletePicks(picker.get(), 30);
+  ASSERT_TRUE(picks.has_value());
+  for (const std::string& address : *picks) {
+    EXPECT_NE(address, slow_address);
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
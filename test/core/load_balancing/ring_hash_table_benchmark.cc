@@ -0,0 +1,174 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Pick latency of the ring_hash lookup tables, and how evenly they spread
+// calls for skewed keys with and without bounded loads.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/load_balancing/ring_hash/ring_hash_table.h"
+#include "src/core/util/xxhash_inline.h"
+
+namespace grpc_core {
+namespace {
+
+class Endpoints {
+ public:
+  explicit Endpoints(size_t num_endpoints) {
+    for (size_t i = 0; i < num_endpoints; ++i) {
+      keys_.push_back(absl::StrCat("10.0.", i / 256, ".", i % 256, ":443"));
+    }
+    for (const std::string& key : keys_) endpoints_.push_back({key, 1});
+  }
+
+  const std::vector<RingHashTable::Endpoint>& get() const {
+    return endpoints_;
+  }
+
+ private:
+  std::vector<std::string> keys_;
+  std::vector<RingHashTable::Endpoint> endpoints_;
+};
+
+RingHashTable MakeTable(bool maglev, const Endpoints& endpoints) {
+  if (maglev) return RingHashTable::MakeMaglev(endpoints.get(), 65537);
+  return RingHashTable::MakeRing(endpoints.get(), 1024, 4096);
+}
+
+std::vector<uint64_t> RandomHashes() {
+  absl::BitGen bitgen;
+  std::vector<uint64_t> hashes(4096);
+  for (uint64_t& hash : hashes) hash = absl::Uniform<uint64_t>(bitgen);
+  return hashes;
+}
+
+void BM_RingFind(benchmark::State& state) {
+  const Endpoints endpoints(state.range(0));
+  const RingHashTable table = MakeTable(/*maglev=*/false, endpoints);
+  const std::vector<uint64_t> hashes = RandomHashes();
+  size_t i = 0;
+  for (auto s : state) {
+    const size_t position = table.Find(hashes[i++ % hashes.size()]);
+    benchmark::DoNotOptimize(table.endpoint_index(position));
+  }
+}
+BENCHMARK(BM_RingFind)->RangeMultiplier(10)->Range(10, 1000);
+
+void BM_MaglevFind(benchmark::State& state) {
+  const Endpoints endpoints(state.range(0));
+  const RingHashTable table = MakeTable(/*maglev=*/true, endpoints);
+  const std::vector<uint64_t> hashes = RandomHashes();
+  size_t i = 0;
+  for (auto s : state) {
+    const size_t position = table.Find(hashes[i++ % hashes.size()]);
+    benchmark::DoNotOptimize(table.endpoint_index(position));
+  }
+}
+BENCHMARK(BM_MaglevFind)->RangeMultiplier(10)->Range(10, 1000);
+
+void BM_MaglevBuild(benchmark::State& state) {
+  const Endpoints endpoints(state.range(0));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(MakeTable(/*maglev=*/true, endpoints));
+  }
+}
+BENCHMARK(BM_MaglevBuild)->RangeMultiplier(10)->Range(10, 1000);
+
+// Keeps a fixed number of calls in flight, each new call replacing the
+// oldest, with keys drawn from a Zipf distribution so that a few hot keys
+// carry much of the load.  Picks walk the table as the ring_hash picker does
+// when every endpoint is READY.  Reports the busiest endpoint's calls in
+// flight relative to the mean, and the fraction of picks that spilled past
+// the key's own endpoint.
+void BM_LoadDistribution(benchmark::State& state) {
+  constexpr size_t kNumEndpoints = 20;
+  constexpr size_t kCallsInFlight = 400;
+  constexpr uint32_t kNumKeys = 10000;
+  const bool maglev = state.range(0) != 0;
+  const uint32_t hash_balance_factor = state.range(1);
+  const Endpoints endpoints(kNumEndpoints);
+  const RingHashTable table = MakeTable(maglev, endpoints);
+  absl::BitGen bitgen;
+  std::vector<uint64_t> hashes(1 << 16);
+  for (uint64_t& hash : hashes) {
+    const std::string key =
+        absl::StrCat("key", absl::Zipf<uint32_t>(bitgen, kNumKeys - 1, 1.1));
+    hash = XXH64(key.data(), key.size(), 0);
+  }
+  std::vector<uint64_t> endpoint_calls(kNumEndpoints);
+  std::deque<size_t> calls;  // Endpoint of each call in flight, oldest first.
+  double max_over_mean = 0;
+  size_t samples = 0;
+  size_t spilled = 0;
+  size_t i = 0;
+  for (auto s : state) {
+    if (calls.size() == kCallsInFlight) {
+      --endpoint_calls[calls.front()];
+      calls.pop_front();
+    }
+    const size_t start = table.Find(hashes[i++ % hashes.size()]);
+    size_t endpoint_index = table.endpoint_index(start);
+    if (hash_balance_factor > 0) {
+      for (size_t j = 0; j < table.size(); ++j) {
+        const size_t index = table.endpoint_index((start + j) % table.size());
+        if (!RingHashEndpointOverloaded(hash_balance_factor,
+                                        1.0 / kNumEndpoints,
+                                        endpoint_calls[index], calls.size())) {
+          endpoint_index = index;
+          break;
+        }
+      }
+    }
+    if (endpoint_index != table.endpoint_index(start)) ++spilled;
+    ++endpoint_calls[endpoint_index];
+    calls.push_back(endpoint_index);
+    if (calls.size() == kCallsInFlight) {
+      max_over_mean +=
+          *std::max_element(endpoint_calls.begin(), endpoint_calls.end()) /
+          (static_cast<double>(kCallsInFlight) / kNumEndpoints);
+      ++samples;
+    }
+  }
+  state.counters["max_over_mean"] =
+      samples == 0 ? 0 : max_over_mean / samples;
+  state.counters["spilled"] =
+      i == 0 ? 0 : static_cast<double>(spilled) / i;
+}
+BENCHMARK(BM_LoadDistribution)
+    ->ArgNames({"maglev", "hash_balance_factor"})
+    ->ArgsProduct({{0, 1}, {0, 150, 125}});
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,175 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/ring_hash/ring_hash_table.h"
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/util/xxhash_inline.h"
+
+namespace grpc_core {
+namespace {
+
+using ::testing::ElementsAre;
+
+// Keeps the hash keys alive for the endpoints that refer to them.
+class Endpoints {
+ public:
+  explicit Endpoints(const std::vector<uint32_t>& weights) {
+    for (size_t i = 0; i < weights.size(); ++i) {
+      keys_.push_back(absl::StrCat("10.0.0.", i, ":443"));
+    }
+    for (size_t i = 0; i < weights.size(); ++i) {
+      endpoints_.push_back({keys_[i], weights[i]});
+    }
+  }
+
+  const std::vector<RingHashTable::Endpoint>& get() const {
+    return endpoints_;
+  }
+
+  // Returns the endpoints without the one at index.
+  std::vector<RingHashTable::Endpoint> Without(size_t index) const {
+    std::vector<RingHashTable::Endpoint> endpoints = endpoints_;
+    endpoints.erase(endpoints.begin() + index);
+    return endpoints;
+  }
+
+ private:
+  std::vector<std::string> keys_;
+  std::vector<RingHashTable::Endpoint> endpoints_;
+};
+
+std::vector<size_t> CountPositions(const RingHashTable& table,
+                                   size_t num_endpoints) {
+  std::vector<size_t> counts(num_endpoints);
+  for (size_t i = 0; i < table.size(); ++i) ++counts[table.endpoint_index(i)];
+  return counts;
+}
+
+TEST(RingHashTableTest, EmptyEndpoints) {
+  EXPECT_EQ(RingHashTable::MakeRing({}, 1024, 4096).size(), 0);
+  EXPECT_EQ(RingHashTable::MakeMaglev({}, 65537).size(), 0);
+}
+
+TEST(RingHashTableTest, RingSharesFollowWeights) {
+  Endpoints endpoints({1, 1, 2});
+  RingHashTable table = RingHashTable::MakeRing(endpoints.get(), 1024, 4096);
+  // The least-weighted endpoints get min_ring_size / 4 entries each.
+  EXPECT_EQ(table.size(), 1024);
+  EXPECT_THAT(CountPositions(table, 3), ElementsAre(256, 256, 512));
+}
+
+TEST(RingHashTableTest, RingSizeIsCappedByMaxRingSize) {
+  Endpoints endpoints({1, 1000});
+  RingHashTable table = RingHashTable::MakeRing(endpoints.get(), 1024, 2048);
+  EXPECT_LE(table.size(), 2048);
+  EXPECT_GT(table.size(), 1024);
+}
+
+TEST(RingHashTableTest, RingFindReturnsFirstEntryAtOrAfterHash) {
+  Endpoints endpoints({1, 1, 1});
+  RingHashTable table = RingHashTable::MakeRing(endpoints.get(), 3, 3);
+  ASSERT_EQ(table.size(), 3);
+  // Each entry's hash is that of "<hash key>_0".
+  std::vector<uint64_t> hashes;
+  for (const auto& endpoint : endpoints.get()) {
+    std::string key = absl::StrCat(endpoint.hash_key, "_0");
+    hashes.push_back(XXH64(key.data(), key.size(), 0));
+  }
+  for (size_t i = 0; i < table.size(); ++i) {
+    const uint64_t hash = hashes[table.endpoint_index(i)];
+    EXPECT_EQ(table.Find(hash), i);
+    EXPECT_EQ(table.Find(hash - 1), i);
+    EXPECT_EQ(table.Find(hash + 1), (i + 1) % table.size());
+  }
+}
+
+TEST(RingHashTableTest, MaglevFillsEveryPositionEvenly) {
+  Endpoints endpoints({1, 1, 1, 1, 1});
+  RingHashTable table = RingHashTable::MakeMaglev(endpoints.get(), 65537);
+  ASSERT_EQ(table.size(), 65537);
+  for (size_t count : CountPositions(table, 5)) {
+    EXPECT_GE(count, 65537 / 5);
+    EXPECT_LE(count, 65537 / 5 + 1);
+  }
+}
+
+TEST(RingHashTableTest, MaglevSharesFollowWeights) {
+  Endpoints endpoints({1, 2, 3});
+  RingHashTable table = RingHashTable::MakeMaglev(endpoints.get(), 60013);
+  std::vector<size_t> counts = CountPositions(table, 3);
+  for (size_t i = 0; i < counts.size(); ++i) {
+    EXPECT_NEAR(counts[i], 60013 * (i + 1) / 6, 3) << i;
+  }
+}
+
+TEST(RingHashTableTest, NumEndpointsCountsEndpointsInTheTable) {
+  Endpoints endpoints({1, 1, 2});
+  EXPECT_EQ(RingHashTable::MakeRing(endpoints.get(), 1024, 4096)
+                .num_endpoints(),
+            3);
+  EXPECT_EQ(RingHashTable::MakeMaglev(endpoints.get(), 13).num_endpoints(),
+            3);
+  // A ring too small for every endpoint counts only those it holds.
+  Endpoints many({1, 1, 1, 1, 1, 1, 1, 1});
+  RingHashTable table = RingHashTable::MakeRing(many.get(), 2, 2);
+  size_t present = 0;
+  for (size_t count : CountPositions(table, 8)) {
+    if (count > 0) ++present;
+  }
+  EXPECT_EQ(table.num_endpoints(), present);
+}
+
+TEST(RingHashTableTest, MaglevFindIsHashModuloSize) {
+  Endpoints endpoints({1, 1});
+  RingHashTable table = RingHashTable::MakeMaglev(endpoints.get(), 13);
+  EXPECT_EQ(table.Find(0), 0);
+  EXPECT_EQ(table.Find(12), 12);
+  EXPECT_EQ(table.Find(13), 0);
+  EXPECT_EQ(table.Find(uint64_t{1} << 63), (uint64_t{1} << 63) % 13);
+}
+
+TEST(RingHashTableTest, MaglevRemovingAnEndpointMovesFewPositions) {
+  constexpr size_t kNumEndpoints = 20;
+  constexpr size_t kRemoved = 7;
+  Endpoints endpoints(std::vector<uint32_t>(kNumEndpoints, 1));
+  RingHashTable before = RingHashTable::MakeMaglev(endpoints.get(), 65537);
+  RingHashTable after =
+      RingHashTable::MakeMaglev(endpoints.Without(kRemoved), 65537);
+  size_t moved = 0;
+  for (size_t i = 0; i < before.size(); ++i) {
+    size_t endpoint_index = before.endpoint_index(i);
+    if (endpoint_index == kRemoved) continue;
+    if (endpoint_index > kRemoved) --endpoint_index;
+    if (after.endpoint_index(i) != endpoint_index) ++moved;
+  }
+  // The removed endpoint's positions must move; Maglev moves only a small
+  // fraction of the others.
+  EXPECT_LT(moved, before.size() / 20);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -25,14 +25,18 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
+#include "absl/types/span.h"
 #include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
 #include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_registry.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -66,8 +70,56 @@ class RingHashTest : public LoadBalancingPolicyTest {
     if (!request_hash_header.empty()) {
       fields["requestHashHeader"] = Json::FromString(request_hash_header);
     }
+    return MakeRingHashConfigWithFields(std::move(fields));
+  }
+
+  static RefCountedPtr<LoadBalancingPolicy::Config>
+  MakeRingHashConfigWithFields(Json::Object fields) {
     return MakeConfig(Json::FromArray({Json::FromObject(
-        {{"ring_hash_experimental", Json::FromObject(fields)}})}));
+        {{"ring_hash_experimental", Json::FromObject(std::move(fields))}})}));
+  }
+
+  static absl::Status ParseRingHashConfig(Json::Object fields) {
+    return CoreConfiguration::Get()
+        .lb_policy_registry()
+        .ParseLoadBalancingConfig(Json::FromArray({Json::FromObject(
+            {{"ring_hash_experimental",
+              Json::FromObject(std::move(fields))}})}))
+        .status();
+  }
+
+  // Connects to each address in turn, using a pick for its hash to
+  // trigger the connection attempt.  Only valid for the ring lookup table,
+  // where the hash of an address's first entry picks that address.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ConnectAll(
+      absl::Span<const absl::string_view> addresses,
+      RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) {
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      ExpectPickQueued(picker.get(), {MakeHashAttribute(addresses[i])});
+      WaitForWorkSerializerToFlush();
+      WaitForWorkSerializerToFlush();
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr) << addresses[i];
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      picker = ExpectState(i == 0 ? GRPC_CHANNEL_CONNECTING
+                                  : GRPC_CHANNEL_READY);
+      subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = ExpectState(GRPC_CHANNEL_READY);
+    }
+    return picker;
+  }
+
+  void FinishCall(std::unique_ptr<
+                      LoadBalancingPolicy::SubchannelCallTrackerInterface>
+                      subchannel_call_tracker,
+                  absl::string_view address) {
+    FakeMetadata metadata({});
+    FakeBackendMetricAccessor backend_metric_accessor({});
+    LoadBalancingPolicy::SubchannelCallTrackerInterface::FinishArgs args = {
+        address, absl::OkStatus(), &metadata, &backend_metric_accessor};
+    subchannel_call_tracker->Finish(args);
   }
 
   RequestHashAttribute* MakeHashAttributeForString(absl::string_view key) {
@@ -449,6 +501,185 @@ TEST_F(RingHashTest, RequestHashHeaderNotPresent) {
   EXPECT_EQ(address, kAddresses[index]);
 }
 
+TEST_F(RingHashTest, LookupTableAndBoundedLoadsConfig) {
+  EXPECT_EQ(ParseRingHashConfig({{"lookupTable", Json::FromString("maglev")},
+                                 {"maglevTableSize", Json::FromNumber(13)},
+                                 {"hashBalanceFactor", Json::FromNumber(125)}}),
+            absl::OkStatus());
+  EXPECT_EQ(
+      ParseRingHashConfig({{"lookupTable", Json::FromString("rendezvous")}}),
+      absl::InvalidArgumentError(
+          "errors validating ring_hash LB policy config: "
+          "[field:lookupTable error:must be \"ring\" or \"maglev\"]"));
+  EXPECT_EQ(ParseRingHashConfig({{"maglevTableSize", Json::FromNumber(65536)}}),
+            absl::InvalidArgumentError(
+                "errors validating ring_hash LB policy config: "
+                "[field:maglevTableSize error:must be a prime in the range "
+                "[2, 5000011]]"));
+  EXPECT_EQ(ParseRingHashConfig({{"hashBalanceFactor", Json::FromNumber(99)}}),
+            absl::InvalidArgumentError(
+                "errors validating ring_hash LB policy config: "
+                "[field:hashBalanceFactor error:must be at least 100]"));
+}
+
+TEST_F(RingHashTest, BoundedLoadsSpillOverloadedEndpoint) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakeRingHashConfigWithFields(
+                                        {{"hashBalanceFactor",
+                                          Json::FromNumber(100)}})),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses, ExpectState(GRPC_CHANNEL_IDLE));
+  ASSERT_NE(picker, nullptr);
+  auto* address0_attribute = MakeHashAttribute(kAddresses[0]);
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      subchannel_call_tracker;
+  auto address = ExpectPickComplete(picker.get(), {address0_attribute}, {},
+                                    &subchannel_call_tracker);
+  EXPECT_EQ(address, kAddresses[0]);
+  ASSERT_NE(subchannel_call_tracker, nullptr);
+  subchannel_call_tracker->Start();
+  // With that call in flight, endpoint 0 has more than its third of the
+  // calls, so the next call for the same hash goes elsewhere.
+  address = ExpectPickComplete(picker.get(), {address0_attribute});
+  EXPECT_NE(address, kAddresses[0]);
+  // Once the call finishes, endpoint 0 takes calls again.
+  FinishCall(std::move(subchannel_call_tracker), kAddresses[0]);
+  address = ExpectPickComplete(picker.get(), {address0_attribute});
+  EXPECT_EQ(address, kAddresses[0]);
+}
+
+TEST_F(RingHashTest, BoundedLoadsFallBackToOverloadedEndpoint) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakeRingHashConfigWithFields(
+                                        {{"hashBalanceFactor",
+                                          Json::FromNumber(100)}})),
+                        lb_policy()),
+            absl::OkStatus());
+  // Only endpoint 0 is connected.
+  auto picker = ConnectAll({kAddresses[0]}, ExpectState(GRPC_CHANNEL_IDLE));
+  ASSERT_NE(picker, nullptr);
+  auto* address0_attribute = MakeHashAttribute(kAddresses[0]);
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      subchannel_call_tracker;
+  auto address = ExpectPickComplete(picker.get(), {address0_attribute}, {},
+                                    &subchannel_call_tracker);
+  EXPECT_EQ(address, kAddresses[0]);
+  ASSERT_NE(subchannel_call_tracker, nullptr);
+  subchannel_call_tracker->Start();
+  // Endpoint 0 is overloaded, but endpoint 1 is IDLE.  Rather than queue,
+  // the call goes to endpoint 0, and endpoint 1 starts connecting.
+  address = ExpectPickComplete(picker.get(), {address0_attribute});
+  EXPECT_EQ(address, kAddresses[0]);
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  auto* subchannel = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  FinishCall(std::move(subchannel_call_tracker), kAddresses[0]);
+}
+
+TEST_F(RingHashTest, BoundedLoadsAreSharedAmongReadyEndpoints) {
+  const std::array<absl::string_view, 4> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443",
+      "ipv4:127.0.0.1:444"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakeRingHashConfigWithFields(
+                                        {{"hashBalanceFactor",
+                                          Json::FromNumber(100)}})),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll({kAddresses[0], kAddresses[1]},
+                           ExpectState(GRPC_CHANNEL_IDLE));
+  ASSERT_NE(picker, nullptr);
+  // Endpoints 2 and 3 fail to connect.
+  for (size_t i = 2; i < kAddresses.size(); ++i) {
+    ExpectPickQueued(picker.get(), {MakeHashAttribute(kAddresses[i])});
+    WaitForWorkSerializerToFlush();
+    WaitForWorkSerializerToFlush();
+    auto* subchannel = FindSubchannel(kAddresses[i]);
+    ASSERT_NE(subchannel, nullptr);
+    EXPECT_TRUE(subchannel->ConnectionRequested());
+    subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+    picker = ExpectState(GRPC_CHANNEL_READY);
+    subchannel->SetConnectivityState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE,
+        absl::UnavailableError("connection attempt failed"));
+    ExpectReresolutionRequest();
+    picker = ExpectState(GRPC_CHANNEL_READY);
+  }
+  auto* address0_attribute = MakeHashAttribute(kAddresses[0]);
+  auto* address1_attribute = MakeHashAttribute(kAddresses[1]);
+  std::vector<std::unique_ptr<
+      LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+      trackers;
+  auto start_call = [&](RequestHashAttribute* attribute) {
+    std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+        subchannel_call_tracker;
+    auto address = ExpectPickComplete(picker.get(), {attribute}, {},
+                                      &subchannel_call_tracker);
+    EXPECT_NE(subchannel_call_tracker, nullptr);
+    if (subchannel_call_tracker != nullptr) {
+      subchannel_call_tracker->Start();
+      trackers.push_back(std::move(subchannel_call_tracker));
+    }
+    return address;
+  };
+  // Each of the two READY endpoints may take half of the calls in flight.
+  EXPECT_EQ(start_call(address1_attribute), kAddresses[1]);
+  EXPECT_EQ(start_call(address0_attribute), kAddresses[0]);
+  EXPECT_EQ(start_call(address0_attribute), kAddresses[0]);
+  // Endpoint 0 now has 2 of 3 calls, which is over half of 4, so the next
+  // call spills to endpoint 1 rather than deeming both endpoints
+  // overloaded by quarter shares that count the failed endpoints.
+  EXPECT_EQ(start_call(address0_attribute), kAddresses[1]);
+  for (size_t i = 0; i < trackers.size(); ++i) {
+    FinishCall(std::move(trackers[i]), kAddresses[0]);
+  }
+}
+
+TEST_F(RingHashTest, Maglev) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakeRingHashConfigWithFields(
+                                        {{"lookupTable",
+                                          Json::FromString("maglev")}})),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  auto* hash_attribute = MakeHashAttributeForString("foo");
+  ExpectPickQueued(picker.get(), {hash_attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  // Exactly one endpoint is asked to connect.
+  SubchannelState* subchannel = nullptr;
+  size_t index = 0;
+  for (size_t i = 0; i < kAddresses.size(); ++i) {
+    auto* s = FindSubchannel(kAddresses[i]);
+    if (s == nullptr) continue;
+    ASSERT_EQ(subchannel, nullptr) << "index " << i;
+    subchannel = s;
+    index = i;
+  }
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get(), {hash_attribute});
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  // The same hash keeps picking the same endpoint.
+  for (int i = 0; i < 3; ++i) {
+    auto address = ExpectPickComplete(picker.get(), {hash_attribute});
+    EXPECT_EQ(address, kAddresses[index]);
+  }
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -15,9 +15,15 @@
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
 
+#include <atomic>
+#include <utility>
+#include <vector>
+
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/promise/party.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 namespace {
@@ -62,6 +68,94 @@ void BM_WakeupParticipant(benchmark::State& state) {
 }
 BENCHMARK(BM_WakeupParticipant);
 
+RefCountedPtr<Party> MakeParty(bool growable) {
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  arena->SetContext(
+      grpc_event_engine::experimental::GetDefaultEventEngine().get());
+  return growable ? Party::MakeGrowable(std::move(arena))
+                  : Party::Make(std::move(arena));
+}
+
+// Spawn state.range(0) promises that stay pending until released, then
+// release them all. Beyond sixteen participants a fixed size party has to
+// wait for slots to free up.
+void BM_SpawnPendingParticipants(benchmark::State& state, bool growable) {
+  const int n = state.range(0);
+  for (auto _ : state) {
+    auto party = MakeParty(growable);
+    Mutex mu;
+    bool released = false;
+    std::vector<Waker> wakers;
+    std::atomic<int> completed{0};
+    Notification done;
+    for (int i = 0; i < n; i++) {
+      party->Spawn(
+          "participant",
+          [&]() -> Poll<StatusFlag> {
+            MutexLock lock(&mu);
+            if (released) return Success{};
+            wakers.push_back(GetContext<Activity>()->MakeOwningWaker());
+            return Pending{};
+          },
+          [&](StatusFlag) {
+            if (completed.fetch_add(1, std::memory_order_relaxed) + 1 == n) {
+              done.Notify();
+            }
+          });
+    }
+    std::vector<Waker> to_wake;
+    {
+      MutexLock lock(&mu);
+      released = true;
+      to_wake.swap(wakers);
+    }
+    for (auto& waker : to_wake) waker.Wakeup();
+    done.WaitForNotification();
+  }
+  state.SetItemsProcessed(n * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_SpawnPendingParticipants, fixed, false)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256);
+BENCHMARK_CAPTURE(BM_SpawnPendingParticipants, growable, true)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256);
+
+// Wake one of state.range(0) pending participants at a time.
+void BM_WakeupOneOfManyParticipants(benchmark::State& state, bool growable) {
+  const int n = state.range(0);
+  auto party = MakeParty(growable);
+  std::vector<Waker> wakers(n);
+  for (int i = 0; i < n; i++) {
+    party->Spawn(
+        "participant",
+        [i, &wakers]() -> Poll<StatusFlag> {
+          wakers[i] = GetContext<Activity>()->MakeOwningWaker();
+          return Pending{};
+        },
+        [](StatusFlag) {});
+  }
+  int next = 0;
+  for (auto _ : state) {
+    wakers[next].Wakeup();
+    if (++next == n) next = 0;
+  }
+  wakers.clear();
+}
+// A fixed size party cannot hold more than sixteen pending participants.
+BENCHMARK_CAPTURE(BM_WakeupOneOfManyParticipants, fixed, false)
+    ->Arg(8)
+    ->Arg(16);
+BENCHMARK_CAPTURE(BM_WakeupOneOfManyParticipants, growable, true)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256);
+
 }  // namespace
 }  // namespace grpc_core
 
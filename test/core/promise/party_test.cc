@@ -65,6 +65,13 @@ class PartyTest : public ::testing::Test {
     return Party::Make(std::move(arena));
   }
 
+  RefCountedPtr<Party> MakeGrowableParty() {
+    auto arena = SimpleArenaAllocator()->MakeArena();
+    arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+        event_engine_.get());
+    return Party::MakeGrowable(std::move(arena));
+  }
+
  private:
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_ =
       grpc_event_engine::experimental::GetDefaultEventEngine();
@@ -206,6 +213,77 @@ TEST_F(PartyTest, Test16SpawnedPendingPromises) {
   VLOG(2) << "Execution order : " << execution_order;
 }
 
+TEST_F(PartyTest, GrowablePartyHoldsManyPendingPromises) {
+  // As Test16SpawnedPendingPromises, but a growable party is not limited to
+  // sixteen: every promise is polled while all the others are still pending.
+  const int kNumPromises = 256;
+  std::string execution_order;
+  auto party = MakeGrowableParty();
+  for (int i = 1; i <= kNumPromises; ++i) {
+    party->Spawn(absl::StrCat("p", i), MakePendingPromise(execution_order, i),
+                 MakeOnDone(execution_order));
+  }
+  for (int i = 1; i <= kNumPromises; ++i) {
+    std::string current = absl::StrFormat("P%d", i);
+    EXPECT_TRUE(absl::StrContains(execution_order, current));
+  }
+  EXPECT_FALSE(absl::StrContains(execution_order, 'D'));
+}
+
+TEST_F(PartyTest, GrowablePartyWakesEachPromise) {
+  // Many pending promises on a growable party, each woken by its own waker:
+  // half owning and half non-owning. Each wakeup polls the promise it names.
+  const int kNumPromises = 100;
+  auto party = MakeGrowableParty();
+  std::vector<Waker> wakers(kNumPromises);
+  std::vector<int> polls(kNumPromises, 0);
+  std::atomic<int> completed{0};
+  Notification all_complete;
+  for (int i = 0; i < kNumPromises; ++i) {
+    party->Spawn(
+        absl::StrCat("p", i),
+        [i, &wakers, &polls]() -> Poll<int> {
+          if (++polls[i] == 2) return i;
+          wakers[i] = i % 2 == 0
+                          ? GetContext<Activity>()->MakeOwningWaker()
+                          : GetContext<Activity>()->MakeNonOwningWaker();
+          return Pending{};
+        },
+        [&completed, &all_complete](int) {
+          if (completed.fetch_add(1) + 1 == kNumPromises) all_complete.Notify();
+        });
+  }
+  EXPECT_EQ(completed.load(), 0);
+  for (int i = 0; i < kNumPromises; ++i) {
+    EXPECT_EQ(polls[i], 1);
+    wakers[i].Wakeup();
+    EXPECT_EQ(polls[i], 2);
+  }
+  all_complete.WaitForNotification();
+}
+
+TEST_F(PartyTest, GrowablePartyRepollsOverflowPromises) {
+  // Promises beyond the fixed participant slots can ask to be repolled.
+  const int kNumPromises = 40;
+  auto party = MakeGrowableParty();
+  std::atomic<int> completed{0};
+  Notification all_complete;
+  for (int i = 0; i < kNumPromises; ++i) {
+    party->Spawn(
+        absl::StrCat("p", i),
+        [polls = 0]() mutable -> Poll<int> {
+          if (++polls == 5) return polls;
+          GetContext<Activity>()->ForceImmediateRepoll();
+          return Pending{};
+        },
+        [&completed, &all_complete](int polls) {
+          EXPECT_EQ(polls, 5);
+          if (completed.fetch_add(1) + 1 == kNumPromises) all_complete.Notify();
+        });
+  }
+  all_complete.WaitForNotification();
+}
+
 TEST_F(PartyTest, SpawnWaitableAndRunTwoParties) {
   // Test to run two Promises on two parties named party1 and party2.
   // The Promise spawned on party1 will in turn spawn a Promise on party2.
@@ -16,6 +16,9 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <memory>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
@@ -75,6 +78,39 @@ TEST_F(EvaluateArgsTest, GetHeaderValueAliasesHost) {
   EXPECT_EQ(value.value(), "test.google.com");
 }
 
+TEST_F(EvaluateArgsTest, GetMemoizedHeaderValueConcatenatesValues) {
+  util_.AddPairToMetadata("key123", "value1");
+  util_.AddPairToMetadata("key123", "value2");
+  EvaluateArgs args = util_.MakeEvaluateArgs();
+  std::optional<absl::string_view> value =
+      args.GetMemoizedHeaderValue("key123");
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), "value1,value2");
+  // Later lookups return the same memoized value.
+  std::optional<absl::string_view> again =
+      args.GetMemoizedHeaderValue("key123");
+  ASSERT_TRUE(again.has_value());
+  EXPECT_EQ(again->data(), value->data());
+  EXPECT_EQ(args.GetMemoizedHeaderValue("missing"), std::nullopt);
+}
+
+TEST_F(EvaluateArgsTest, ConnectionCacheIsKeyedByEngine) {
+  EvaluateArgs args = util_.MakeEvaluateArgs();
+  auto* cache = args.GetConnectionCache();
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->GetPrincipalResults(1), nullptr);
+  auto results = std::make_shared<const std::vector<bool>>(2, true);
+  cache->SetPrincipalResults(1, results);
+  EXPECT_EQ(cache->GetPrincipalResults(1), results);
+  EXPECT_EQ(cache->GetPrincipalResults(2), nullptr);
+  // Enough other engines evict the oldest entry.
+  for (uint64_t id = 2; id < 10; ++id) {
+    cache->SetPrincipalResults(id, results);
+  }
+  EXPECT_EQ(cache->GetPrincipalResults(1), nullptr);
+  EXPECT_EQ(cache->GetPrincipalResults(9), results);
+}
+
 TEST_F(EvaluateArgsTest, TestLocalAddressAndPort) {
   util_.SetLocalEndpoint("ipv6:[2001:0db8:85a3:0000:0000:8a2e:0370:7334]:456");
   EvaluateArgs args = util_.MakeEvaluateArgs();
@@ -0,0 +1,154 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Compares evaluating every RBAC policy in turn with GrpcAuthorizationEngine's
+// compiled policies. Policies are shaped like those the authz policy
+// translator produces: a few methods each, a header check, and a principal
+// that depends only on the peer's identity.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc_security_constants.h>
+#include <stdlib.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/security/authorization/evaluate_args.h"
+#include "src/core/lib/security/authorization/grpc_authorization_engine.h"
+#include "src/core/lib/security/authorization/matchers.h"
+#include "src/core/lib/security/authorization/rbac_policy.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/transport/auth_context.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kMethodsPerPolicy = 4;
+
+std::map<std::string, Rbac::Policy> MakePolicies(int num_policies) {
+  std::map<std::string, Rbac::Policy> policies;
+  for (int i = 0; i < num_policies; ++i) {
+    std::vector<std::unique_ptr<Rbac::Permission>> paths;
+    for (int j = 0; j < kMethodsPerPolicy; ++j) {
+      paths.push_back(std::make_unique<Rbac::Permission>(
+          Rbac::Permission::MakePathPermission(
+              StringMatcher::Create(StringMatcher::Type::kExact,
+                                    absl::StrCat("/pkg.Service", i, "/M", j))
+                  .value())));
+    }
+    std::vector<std::unique_ptr<Rbac::Permission>> request;
+    request.push_back(std::make_unique<Rbac::Permission>(
+        Rbac::Permission::MakeOrPermission(std::move(paths))));
+    request.push_back(std::make_unique<Rbac::Permission>(
+        Rbac::Permission::MakeHeaderPermission(
+            HeaderMatcher::Create("x-tenant", HeaderMatcher::Type::kPrefix,
+                                  "tenant")
+                .value())));
+    policies[absl::StrFormat("policy%06d", i)] = Rbac::Policy(
+        Rbac::Permission::MakeAndPermission(std::move(request)),
+        Rbac::Principal::MakeAuthenticatedPrincipal(
+            StringMatcher::Create(StringMatcher::Type::kExact,
+                                  "spiffe://example.com/client")
+                .value()));
+  }
+  return policies;
+}
+
+// A connection from an authenticated peer, calling a method of the last
+// policy: the worst case for evaluating policies in turn.
+class Connection {
+ public:
+  explicit Connection(int num_policies)
+      : path_(absl::StrCat("/pkg.Service", num_policies - 1, "/M0")) {
+    auto on_error = [](absl::string_view, const Slice&) { abort(); };
+    metadata_.Append(":path", Slice::FromCopiedString(path_), on_error);
+    metadata_.Append("x-tenant", Slice::FromStaticString("tenant-a"),
+                     on_error);
+    auth_context_.add_cstring_property(
+        GRPC_TRANSPORT_SECURITY_TYPE_PROPERTY_NAME,
+        GRPC_TLS_TRANSPORT_SECURITY_TYPE);
+    auth_context_.add_cstring_property(GRPC_PEER_URI_PROPERTY_NAME,
+                                       "spiffe://example.com/client");
+    channel_args_ = std::make_unique<EvaluateArgs::PerChannelArgs>(
+        &auth_context_, ChannelArgs());
+  }
+
+  // Each call gets its own EvaluateArgs, sharing the per-channel args.
+  EvaluateArgs MakeCall() {
+    return EvaluateArgs(&metadata_, channel_args_.get());
+  }
+
+ private:
+  std::string path_;
+  grpc_metadata_batch metadata_;
+  grpc_auth_context auth_context_{nullptr};
+  std::unique_ptr<EvaluateArgs::PerChannelArgs> channel_args_;
+};
+
+void BM_EvaluateEachPolicy(benchmark::State& state) {
+  std::vector<std::unique_ptr<AuthorizationMatcher>> policies;
+  for (auto& policy : MakePolicies(state.range(0))) {
+    policies.push_back(
+        std::make_unique<PolicyAuthorizationMatcher>(std::move(policy.second)));
+  }
+  Connection connection(state.range(0));
+  for (auto s : state) {
+    EvaluateArgs args = connection.MakeCall();
+    bool matched = false;
+    for (const auto& policy : policies) {
+      if (policy->Matches(args)) {
+        matched = true;
+        break;
+      }
+    }
+    CHECK(matched);
+  }
+}
+BENCHMARK(BM_EvaluateEachPolicy)->RangeMultiplier(10)->Range(10, 10000);
+
+void BM_EvaluateCompiledPolicies(benchmark::State& state) {
+  GrpcAuthorizationEngine engine(Rbac("authz", Rbac::Action::kAllow,
+                                      MakePolicies(state.range(0))));
+  Connection connection(state.range(0));
+  for (auto s : state) {
+    auto decision = engine.Evaluate(connection.MakeCall());
+    CHECK(decision.type == AuthorizationEngine::Decision::Type::kAllow);
+  }
+}
+BENCHMARK(BM_EvaluateCompiledPolicies)->RangeMultiplier(10)->Range(10, 10000);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
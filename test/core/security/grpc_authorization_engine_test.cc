@@ -19,8 +19,13 @@
 #include <grpc/support/port_platform.h>
 
 #include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
+#include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/util/json/json.h"
@@ -55,6 +60,113 @@ class GrpcAuthorizationEngineTest : public ::testing::Test {
   EvaluateArgsTestUtil evaluate_args_util_;
 };
 
+std::unique_ptr<Rbac::Permission> Wrap(Rbac::Permission permission) {
+  return std::make_unique<Rbac::Permission>(std::move(permission));
+}
+
+std::unique_ptr<Rbac::Principal> Wrap(Rbac::Principal principal) {
+  return std::make_unique<Rbac::Principal>(std::move(principal));
+}
+
+Rbac::Permission ExactPath(absl::string_view path) {
+  return Rbac::Permission::MakePathPermission(
+      StringMatcher::Create(StringMatcher::Type::kExact, path).value());
+}
+
+HeaderMatcher ExactHeader(absl::string_view name, absl::string_view value) {
+  return HeaderMatcher::Create(name, HeaderMatcher::Type::kExact, value)
+      .value();
+}
+
+// Generates random policies over a few paths and headers. Two generators with
+// the same seed generate the same policies.
+class RandomPolicyGenerator {
+ public:
+  static constexpr absl::string_view kPaths[] = {"/a.S/M1", "/a.S/M2",
+                                                 "/b.S/M1", "/b.S/M2"};
+  static constexpr absl::string_view kHeaderValues[] = {"v1", "v2"};
+
+  explicit RandomPolicyGenerator(uint32_t seed) : rng_(seed) {}
+
+  std::map<std::string, Rbac::Policy> Policies() {
+    std::map<std::string, Rbac::Policy> policies;
+    const int num_policies = Uniform(1, 20);
+    for (int i = 0; i < num_policies; ++i) {
+      policies[absl::StrCat("policy", i)] =
+          Rbac::Policy(Permission(/*depth=*/0), Principal(/*depth=*/0));
+    }
+    return policies;
+  }
+
+  int Uniform(int min, int max) {
+    return std::uniform_int_distribution<int>(min, max)(rng_);
+  }
+
+ private:
+  Rbac::Permission Permission(int depth) {
+    switch (Uniform(0, depth < 2 ? 7 : 4)) {
+      case 0:
+        return Rbac::Permission::MakeAnyPermission();
+      case 1:
+        return Rbac::Permission::MakePathPermission(
+            StringMatcher::Create(StringMatcher::Type::kPrefix, "/a.")
+                .value());
+      case 2:
+        return Rbac::Permission::MakeHeaderPermission(
+            ExactHeader("x-k", kHeaderValues[Uniform(0, 1)]));
+      case 3:
+      case 4:
+        return ExactPath(kPaths[Uniform(0, 3)]);
+      case 5:
+        return Rbac::Permission::MakeNotPermission(Permission(depth + 1));
+      default: {
+        std::vector<std::unique_ptr<Rbac::Permission>> rules;
+        const int num_rules = Uniform(0, 3);
+        for (int i = 0; i < num_rules; ++i) {
+          rules.push_back(Wrap(Permission(depth + 1)));
+        }
+        return Uniform(0, 1) == 0
+                   ? Rbac::Permission::MakeAndPermission(std::move(rules))
+                   : Rbac::Permission::MakeOrPermission(std::move(rules));
+      }
+    }
+  }
+
+  Rbac::Principal Principal(int depth) {
+    switch (Uniform(0, depth < 2 ? 6 : 4)) {
+      case 0:
+        return Rbac::Principal::MakeAnyPrincipal();
+      case 1:
+        return Rbac::Principal::MakeAuthenticatedPrincipal(
+            StringMatcher::Create(StringMatcher::Type::kExact,
+                                  Uniform(0, 1) == 0 ? "" : "other")
+                .value());
+      case 2:
+        return Rbac::Principal::MakeHeaderPrincipal(
+            ExactHeader("x-k", kHeaderValues[Uniform(0, 1)]));
+      case 3:
+        return Rbac::Principal::MakePathPrincipal(
+            StringMatcher::Create(StringMatcher::Type::kExact,
+                                  kPaths[Uniform(0, 3)])
+                .value());
+      case 4:
+        return Rbac::Principal::MakeNotPrincipal(Principal(depth + 1));
+      default: {
+        std::vector<std::unique_ptr<Rbac::Principal>> ids;
+        const int num_ids = Uniform(0, 3);
+        for (int i = 0; i < num_ids; ++i) {
+          ids.push_back(Wrap(Principal(depth + 1)));
+        }
+        return Uniform(0, 1) == 0
+                   ? Rbac::Principal::MakeAndPrincipal(std::move(ids))
+                   : Rbac::Principal::MakeOrPrincipal(std::move(ids));
+      }
+    }
+  }
+
+  std::mt19937 rng_;
+};
+
 }  // namespace
 
 TEST_F(GrpcAuthorizationEngineTest, AllowEngineWithMatchingPolicy) {
@@ -341,6 +453,103 @@ TEST_F(GrpcAuthorizationEngineTest, MultipleAuditLoggerInvoked) {
               kPolicyName, kSpiffeId, kRpcMethod)));
 }
 
+TEST_F(GrpcAuthorizationEngineTest, PathIndexedPoliciesMatchInNameOrder) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["a"] = Rbac::Policy(ExactPath("/foo.Bar/Other"),
+                               Rbac::Principal::MakeAnyPrincipal());
+  std::vector<std::unique_ptr<Rbac::Permission>> paths;
+  paths.push_back(Wrap(ExactPath(kRpcMethod)));
+  paths.push_back(Wrap(ExactPath("/foo.Bar/Ping")));
+  std::vector<std::unique_ptr<Rbac::Permission>> rules;
+  rules.push_back(Wrap(Rbac::Permission::MakeOrPermission(std::move(paths))));
+  rules.push_back(Wrap(Rbac::Permission::MakeHeaderPermission(
+      ExactHeader("x-team", "red"))));
+  policies["b"] =
+      Rbac::Policy(Rbac::Permission::MakeAndPermission(std::move(rules)),
+                   Rbac::Principal::MakeAnyPrincipal());
+  policies["c"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kPrefix, "/foo.")
+              .value()),
+      Rbac::Principal::MakeNotPrincipal(Rbac::Principal::MakeAnyPrincipal()));
+  policies["d"] = Rbac::Policy(ExactPath(kRpcMethod),
+                               Rbac::Principal::MakeAnyPrincipal());
+  policies["e"] = Rbac::Policy(Rbac::Permission::MakeAnyPermission(),
+                               Rbac::Principal::MakeAnyPrincipal());
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "d");
+  evaluate_args_util_.AddPairToMetadata("x-team", "red");
+  decision = engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.matching_policy_name, "b");
+}
+
+TEST_F(GrpcAuthorizationEngineTest, ConnectionPrincipalsCachedPerEngine) {
+  evaluate_args_util_.AddPropertyToAuthContext(
+      GRPC_TRANSPORT_SECURITY_TYPE_PROPERTY_NAME, "ssl");
+  evaluate_args_util_.AddPropertyToAuthContext(GRPC_PEER_DNS_PROPERTY_NAME,
+                                               "foo.example.com");
+  auto make_engine = [](absl::string_view dns_name) {
+    std::map<std::string, Rbac::Policy> policies;
+    policies["policy"] = Rbac::Policy(
+        Rbac::Permission::MakeAnyPermission(),
+        Rbac::Principal::MakeAuthenticatedPrincipal(
+            StringMatcher::Create(StringMatcher::Type::kExact, dns_name)
+                .value()));
+    return GrpcAuthorizationEngine(
+        Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  };
+  GrpcAuthorizationEngine matching = make_engine("foo.example.com");
+  GrpcAuthorizationEngine not_matching = make_engine("bar.example.com");
+  // Both engines share the connection's cache.
+  EvaluateArgs args = evaluate_args_util_.MakeEvaluateArgs();
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(matching.Evaluate(args).type,
+              AuthorizationEngine::Decision::Type::kAllow);
+    EXPECT_EQ(not_matching.Evaluate(args).type,
+              AuthorizationEngine::Decision::Type::kDeny);
+  }
+}
+
+TEST_F(GrpcAuthorizationEngineTest, AgreesWithEvaluatingEachPolicy) {
+  for (uint32_t seed = 0; seed < 100; ++seed) {
+    RandomPolicyGenerator generator(seed);
+    GrpcAuthorizationEngine engine(
+        Rbac("authz", Rbac::Action::kAllow, generator.Policies()));
+    std::vector<std::pair<std::string, PolicyAuthorizationMatcher>> expected;
+    for (auto& policy : RandomPolicyGenerator(seed).Policies()) {
+      expected.emplace_back(
+          policy.first, PolicyAuthorizationMatcher(std::move(policy.second)));
+    }
+    for (int i = 0; i < 20; ++i) {
+      EvaluateArgsTestUtil util;
+      util.AddPropertyToAuthContext(GRPC_TRANSPORT_SECURITY_TYPE_PROPERTY_NAME,
+                                    "ssl");
+      util.AddPairToMetadata(
+          ":path",
+          RandomPolicyGenerator::kPaths[generator.Uniform(0, 3)].data());
+      const int header = generator.Uniform(0, 2);
+      if (header < 2) {
+        util.AddPairToMetadata(
+            "x-k", RandomPolicyGenerator::kHeaderValues[header].data());
+      }
+      EvaluateArgs args = util.MakeEvaluateArgs();
+      std::string expected_name;
+      for (const auto& policy : expected) {
+        if (policy.second.Matches(args)) {
+          expected_name = policy.first;
+          break;
+        }
+      }
+      EXPECT_EQ(engine.Evaluate(args).matching_policy_name, expected_name)
+          << "seed " << seed;
+    }
+  }
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
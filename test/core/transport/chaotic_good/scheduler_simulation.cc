@@ -0,0 +1,272 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test/core/transport/chaotic_good/scheduler_simulation.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/time/time.h"
+#include "src/core/ext/transport/chaotic_good/scheduler.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace testing {
+
+namespace {
+
+const Json* Member(const Json::Object& object, absl::string_view name) {
+  auto it = object.find(std::string(name));
+  if (it == object.end()) return nullptr;
+  return &it->second;
+}
+
+std::optional<double> NumberMember(const Json::Object& object,
+                                   absl::string_view name) {
+  const Json* json = Member(object, name);
+  if (json == nullptr || json->type() != Json::Type::kNumber) {
+    return std::nullopt;
+  }
+  double value;
+  if (!absl::SimpleAtod(json->string(), &value)) return std::nullopt;
+  return value;
+}
+
+// ztrace timestamps look like 2025-01-01T12:34:56.789Z.
+std::optional<absl::Time> TimestampMember(const Json::Object& object) {
+  const Json* json = Member(object, "timestamp");
+  if (json == nullptr || json->type() != Json::Type::kString) {
+    return std::nullopt;
+  }
+  absl::Time time;
+  std::string error;
+  if (!absl::ParseTime("%Y-%m-%d%ET%H:%M:%E*SZ", json->string(),
+                       absl::UTCTimeZone(), &time, &error)) {
+    return std::nullopt;
+  }
+  return time;
+}
+
+absl::StatusOr<std::vector<RecordedChannel>> ParseChannels(
+    const Json& json) {
+  if (json.type() != Json::Type::kArray) {
+    return absl::InvalidArgumentError("channels is not an array");
+  }
+  std::vector<RecordedChannel> channels;
+  for (const Json& channel : json.array()) {
+    if (channel.type() != Json::Type::kObject) {
+      return absl::InvalidArgumentError("channel is not an object");
+    }
+    const Json::Object& object = channel.object();
+    auto id = NumberMember(object, "id");
+    auto start_time = NumberMember(object, "start_time");
+    auto bytes_per_second = NumberMember(object, "bytes_per_second");
+    const Json* ready = Member(object, "ready");
+    if (!id.has_value() || !start_time.has_value() ||
+        !bytes_per_second.has_value() || ready == nullptr ||
+        ready->type() != Json::Type::kBoolean) {
+      return absl::InvalidArgumentError(
+          "channel needs id, ready, start_time and bytes_per_second");
+    }
+    channels.push_back(RecordedChannel{static_cast<uint32_t>(*id),
+                                       ready->boolean(), *start_time,
+                                       *bytes_per_second});
+  }
+  return channels;
+}
+
+// A message waiting to be placed.
+struct Pending {
+  double queued_time;
+  uint64_t bytes;
+};
+
+double Percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  const size_t i = std::min(sorted.size() - 1,
+                            static_cast<size_t>(p * sorted.size()));
+  return sorted[i];
+}
+
+}  // namespace
+
+absl::StatusOr<std::vector<RecordedStep>> ParseZTrace(absl::string_view json) {
+  auto parsed = JsonParse(json);
+  if (!parsed.ok()) return parsed.status();
+  const Json* entries = &*parsed;
+  if (entries->type() == Json::Type::kObject) {
+    entries = Member(entries->object(), "entries");
+    if (entries == nullptr) {
+      return absl::InvalidArgumentError("no entries in ztrace");
+    }
+  }
+  if (entries->type() != Json::Type::kArray) {
+    return absl::InvalidArgumentError("ztrace entries are not an array");
+  }
+  // The collector groups entries by type, so put them back in time order.
+  // Schedules sort before the writes recorded at the same instant.
+  struct Entry {
+    absl::Time time;
+    bool is_schedule;
+    const Json::Object* object;
+  };
+  std::vector<Entry> ordered;
+  for (const Json& entry : entries->array()) {
+    if (entry.type() != Json::Type::kObject) continue;
+    const Json::Object& object = entry.object();
+    const bool is_schedule = Member(object, "channels") != nullptr;
+    const Json* type = Member(object, "metadata_type");
+    const bool is_write = type != nullptr &&
+                          type->type() == Json::Type::kString &&
+                          type->string() == "WRITE_LARGE_HEADER";
+    if (!is_schedule && !is_write) continue;
+    auto time = TimestampMember(object);
+    if (!time.has_value()) {
+      return absl::InvalidArgumentError("ztrace entry without a timestamp");
+    }
+    ordered.push_back(Entry{*time, is_schedule, &object});
+  }
+  std::stable_sort(ordered.begin(), ordered.end(),
+                   [](const Entry& a, const Entry& b) {
+                     if (a.time != b.time) return a.time < b.time;
+                     return a.is_schedule && !b.is_schedule;
+                   });
+  std::vector<RecordedStep> steps;
+  std::optional<absl::Time> start;
+  for (const Entry& entry : ordered) {
+    if (entry.is_schedule) {
+      auto channels = ParseChannels(*Member(*entry.object, "channels"));
+      if (!channels.ok()) return channels.status();
+      if (!start.has_value()) start = entry.time;
+      steps.push_back(RecordedStep{absl::ToDoubleSeconds(entry.time - *start),
+                                   std::move(*channels),
+                                   {}});
+      continue;
+    }
+    // Writes from before the first schedule have no timings to replay.
+    if (steps.empty()) continue;
+    auto size = NumberMember(*entry.object, "payload_size");
+    if (!size.has_value()) {
+      return absl::InvalidArgumentError("large frame write without a size");
+    }
+    steps.back().message_sizes.push_back(static_cast<uint64_t>(*size));
+  }
+  return steps;
+}
+
+std::string SimulationResult::ToString() const {
+  return absl::StrFormat(
+      "delivered=%d undelivered=%d latency_ms{mean=%.3f p50=%.3f p99=%.3f "
+      "max=%.3f} completion_ms=%.3f",
+      messages_delivered, messages_undelivered, mean_latency * 1e3,
+      p50_latency * 1e3, p99_latency * 1e3, max_latency * 1e3,
+      completion_time * 1e3);
+}
+
+SimulationResult Simulate(absl::string_view scheduler_config,
+                          absl::Span<const RecordedStep> steps) {
+  auto scheduler = MakeScheduler(scheduler_config);
+  TcpZTraceCollector ztrace_collector;
+  // When each endpoint will have sent everything it has been given.
+  absl::flat_hash_map<uint32_t, double> busy_until;
+  std::deque<Pending> pending;
+  std::vector<double> latencies;
+  SimulationResult result;
+
+  // One scheduling pass at `now`, against the endpoint timings of `step`.
+  auto schedule = [&](double now, const RecordedStep& step) {
+    if (pending.empty()) return;
+    double outstanding_bytes = 0;
+    for (const Pending& p : pending) outstanding_bytes += p.bytes;
+    scheduler->NewStep(outstanding_bytes, pending.front().bytes);
+    bool any_ready = false;
+    for (const RecordedChannel& channel : step.channels) {
+      const double backlog = std::max(0.0, busy_until[channel.id] - now);
+      const bool ready = channel.ready && backlog == 0.0;
+      any_ready |= ready;
+      scheduler->AddChannel(channel.id, ready, backlog + channel.start_time,
+                            channel.bytes_per_second);
+    }
+    if (!any_ready) return;
+    scheduler->MakePlan(ztrace_collector);
+    while (!pending.empty()) {
+      const Pending message = pending.front();
+      auto id = scheduler->AllocateMessage(message.bytes);
+      if (!id.has_value()) break;
+      auto channel = std::find_if(
+          step.channels.begin(), step.channels.end(),
+          [id](const RecordedChannel& c) { return c.id == *id; });
+      CHECK(channel != step.channels.end());
+      double& busy = busy_until[*id];
+      busy = std::max(now, busy) + message.bytes / channel->bytes_per_second;
+      const double received = busy + channel->start_time;
+      latencies.push_back(received - message.queued_time);
+      result.completion_time = std::max(result.completion_time, received);
+      pending.pop_front();
+    }
+  };
+
+  for (size_t i = 0; i < steps.size(); ++i) {
+    const RecordedStep& step = steps[i];
+    for (uint64_t size : step.message_sizes) {
+      pending.push_back(Pending{step.time, size});
+    }
+    double now = step.time;
+    schedule(now, step);
+    // Until the next recorded step, schedule again as endpoints free up.
+    const double next_step_time = i + 1 < steps.size()
+                                      ? steps[i + 1].time
+                                      : std::numeric_limits<double>::max();
+    while (!pending.empty()) {
+      double next_free = std::numeric_limits<double>::max();
+      for (const RecordedChannel& channel : step.channels) {
+        const double busy = busy_until[channel.id];
+        if (busy > now) next_free = std::min(next_free, busy);
+      }
+      if (next_free >= next_step_time) break;
+      now = next_free;
+      schedule(now, step);
+    }
+  }
+
+  result.messages_delivered = latencies.size();
+  result.messages_undelivered = pending.size();
+  if (!latencies.empty()) {
+    std::sort(latencies.begin(), latencies.end());
+    double total = 0;
+    for (double latency : latencies) total += latency;
+    result.mean_latency = total / latencies.size();
+    result.p50_latency = Percentile(latencies, 0.5);
+    result.p99_latency = Percentile(latencies, 0.99);
+    result.max_latency = latencies.back();
+  }
+  return result;
+}
+
+}  // namespace testing
+}  // namespace chaotic_good
+}  // namespace grpc_core
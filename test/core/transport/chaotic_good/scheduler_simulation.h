@@ -0,0 +1,89 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_TEST_CORE_TRANSPORT_CHAOTIC_GOOD_SCHEDULER_SIMULATION_H
+#define GRPC_TEST_CORE_TRANSPORT_CHAOTIC_GOOD_SCHEDULER_SIMULATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace testing {
+
+// Offline comparison of data endpoint schedulers, by replaying the endpoint
+// timings of a recorded connection against each of them.
+
+// One data endpoint, as the scheduler saw it at a step of the recording.
+struct RecordedChannel {
+  uint32_t id;
+  bool ready;
+  // Seconds until a byte sent now would be received.
+  double start_time;
+  double bytes_per_second;
+};
+
+// One scheduling step of the recording, and the messages it placed.
+struct RecordedStep {
+  // Seconds since the start of the recording.
+  double time;
+  std::vector<RecordedChannel> channels;
+  std::vector<uint64_t> message_sizes;
+};
+
+// Extracts the scheduling steps from a chaotic_good ztrace dump: the JSON
+// object the collector produces (or just its "entries" array). Each schedule
+// entry becomes a step, and the large frame writes that follow it until the
+// next schedule become its messages.
+absl::StatusOr<std::vector<RecordedStep>> ParseZTrace(absl::string_view json);
+
+struct SimulationResult {
+  size_t messages_delivered = 0;
+  // Messages still queued when the recording ran out of ready endpoints.
+  size_t messages_undelivered = 0;
+  // Seconds from a message being queued to its last byte being received.
+  double mean_latency = 0;
+  double p50_latency = 0;
+  double p99_latency = 0;
+  double max_latency = 0;
+  // Seconds from the first step until the last message was received.
+  double completion_time = 0;
+
+  std::string ToString() const;
+};
+
+// Replays the recording against the scheduler MakeScheduler() builds from
+// scheduler_config.
+//
+// Messages are queued at the step that placed them in the recording. Each
+// endpoint keeps the recorded readiness, start time and rate of its latest
+// step, plus the backlog of what the simulated scheduler sent it: an endpoint
+// is only ready once its backlog is sent, and its start time grows by the
+// time left to send it. Between recorded steps the scheduler runs again
+// whenever an endpoint finishes its backlog, as the transport does when a
+// data endpoint asks for more frames.
+SimulationResult Simulate(absl::string_view scheduler_config,
+                          absl::Span<const RecordedStep> steps);
+
+}  // namespace testing
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_TEST_CORE_TRANSPORT_CHAOTIC_GOOD_SCHEDULER_SIMULATION_H
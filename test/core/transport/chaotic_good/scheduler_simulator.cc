@@ -0,0 +1,61 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replays the endpoint timings of a chaotic_good ztrace dump against a set of
+// schedulers and prints how each would have done, eg:
+//   scheduler_simulator --ztrace=trace.json --schedulers=spanrr,rand,edt
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/strings/str_split.h"
+#include "src/core/util/load_file.h"
+#include "test/core/transport/chaotic_good/scheduler_simulation.h"
+
+ABSL_FLAG(std::string, ztrace, "",
+          "File holding the JSON of a chaotic_good ztrace dump.");
+ABSL_FLAG(std::vector<std::string>, schedulers,
+          std::vector<std::string>({"spanrr", "rand", "edt"}),
+          "Comma separated scheduler configs to compare.");
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+  const std::string filename = absl::GetFlag(FLAGS_ztrace);
+  if (filename.empty()) {
+    std::cerr << "--ztrace is required\n";
+    return 1;
+  }
+  auto contents = grpc_core::LoadFile(filename, false);
+  if (!contents.ok()) {
+    std::cerr << contents.status() << "\n";
+    return 1;
+  }
+  auto steps = grpc_core::chaotic_good::testing::ParseZTrace(
+      contents->as_string_view());
+  if (!steps.ok()) {
+    std::cerr << steps.status() << "\n";
+    return 1;
+  }
+  std::cout << steps->size() << " scheduling steps\n";
+  for (const std::string& config : absl::GetFlag(FLAGS_schedulers)) {
+    std::cout << config << ": "
+              << grpc_core::chaotic_good::testing::Simulate(config, *steps)
+                     .ToString()
+              << "\n";
+  }
+  return 0;
+}
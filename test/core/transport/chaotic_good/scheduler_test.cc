@@ -0,0 +1,167 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/scheduler.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "test/core/transport/chaotic_good/scheduler_simulation.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace testing {
+namespace {
+
+constexpr uint64_t kMessageSize = 64 * 1024;
+
+// Three fast endpoints and one slow one, with a message every millisecond
+// and a burst of 32 every 20.
+std::vector<RecordedStep> OneSlowEndpoint() {
+  std::vector<RecordedStep> steps;
+  for (int i = 0; i < 200; i++) {
+    RecordedStep step;
+    step.time = i * 1e-3;
+    step.channels = {{0, true, 0.001, 100e6},
+                     {1, true, 0.001, 100e6},
+                     {2, true, 0.001, 100e6},
+                     {3, true, 0.050, 1e6}};
+    step.message_sizes.assign(i % 20 == 0 ? 32 : 1, kMessageSize);
+    steps.push_back(std::move(step));
+  }
+  return steps;
+}
+
+size_t TotalMessages(const std::vector<RecordedStep>& steps) {
+  size_t total = 0;
+  for (const auto& step : steps) total += step.message_sizes.size();
+  return total;
+}
+
+TEST(SchedulerTest, EveryMessageDelivered) {
+  const auto steps = OneSlowEndpoint();
+  for (absl::string_view config :
+       {"spanrr", "spanrr:end_of_burst=random_ready", "rand",
+        "rand:weight=ready_inverse_receive_time", "edt",
+        "edt:busy=best_ready:alpha=1"}) {
+    const SimulationResult result = Simulate(config, steps);
+    EXPECT_EQ(result.messages_delivered, TotalMessages(steps)) << config;
+    EXPECT_EQ(result.messages_undelivered, 0u) << config;
+    EXPECT_GT(result.p50_latency, 0) << config;
+  }
+}
+
+TEST(SchedulerTest, DeliveryTimeSchedulerAvoidsSlowEndpoint) {
+  const auto steps = OneSlowEndpoint();
+  const SimulationResult edt = Simulate("edt", steps);
+  const SimulationResult rand = Simulate("rand", steps);
+  // A message sent on the slow endpoint takes over 100ms to arrive.
+  EXPECT_LT(edt.max_latency, 0.05) << edt.ToString();
+  EXPECT_GT(rand.max_latency, 0.1) << rand.ToString();
+}
+
+TEST(SchedulerTest, DeliveryTimeSchedulerWaitsForBestEndpoint) {
+  TcpZTraceCollector ztrace_collector;
+  for (auto [config, expected] :
+       std::vector<std::pair<absl::string_view, std::optional<uint32_t>>>{
+           {"edt", std::nullopt}, {"edt:busy=best_ready", 0}}) {
+    auto scheduler = MakeScheduler(config);
+    scheduler->NewStep(kMessageSize, kMessageSize);
+    scheduler->AddChannel(0, true, 0.001, 1e6);
+    scheduler->AddChannel(1, false, 0.002, 100e6);
+    scheduler->MakePlan(ztrace_collector);
+    EXPECT_EQ(scheduler->AllocateMessage(kMessageSize), expected) << config;
+  }
+}
+
+TEST(SchedulerTest, DeliveryTimeSchedulerSmoothsRates) {
+  TcpZTraceCollector ztrace_collector;
+  auto scheduler = MakeScheduler("edt:alpha=0.5");
+  auto step = [&](double rate0) {
+    scheduler->NewStep(kMessageSize, kMessageSize);
+    scheduler->AddChannel(0, true, 0.001, rate0);
+    scheduler->AddChannel(1, true, 0.001, 50e6);
+    scheduler->MakePlan(ztrace_collector);
+    return scheduler->AllocateMessage(kMessageSize);
+  };
+  EXPECT_EQ(step(100e6), 0);
+  // One low measurement only halves the smoothed rate, which still beats the
+  // other endpoint; a second one does not.
+  EXPECT_EQ(step(10e6), 0);
+  EXPECT_EQ(step(10e6), 1);
+}
+
+TEST(SchedulerTest, Config) {
+  EXPECT_EQ(MakeScheduler("edt")->Config(), "edt:alpha=0.25:busy=wait");
+  EXPECT_EQ(MakeScheduler("edt:alpha=0.5:busy=best_ready")->Config(),
+            "edt:alpha=0.5:busy=best_ready");
+}
+
+TEST(SchedulerTest, ParseZTrace) {
+  // Entries grouped by type, as the collector dumps them.
+  auto steps = ParseZTrace(R"json({
+    "entries": [
+      {"timestamp": "2025-01-01T00:00:00.001Z",
+       "metadata_type": "WRITE_LARGE_HEADER", "payload_tag": 1,
+       "payload_size": 1000, "chosen_endpoint": 0},
+      {"timestamp": "2025-01-01T00:00:00.002Z",
+       "metadata_type": "WRITE_LARGE_HEADER", "payload_tag": 2,
+       "payload_size": 2000, "chosen_endpoint": 1},
+      {"timestamp": "2025-01-01T00:00:00.003Z",
+       "metadata_type": "WRITE_LARGE_HEADER", "payload_tag": 3,
+       "payload_size": 3000, "chosen_endpoint": 1},
+      {"timestamp": "2025-01-01T00:00:00.001Z",
+       "channels": [
+         {"id": 0, "ready": true, "start_time": 0.001,
+          "bytes_per_second": 1e6, "allowed_bytes": 0},
+         {"id": 1, "ready": false, "start_time": 0.002,
+          "bytes_per_second": 2e6, "allowed_bytes": 0}],
+       "outstanding_bytes": 1000, "min_tokens": 1000, "num_ready": 1,
+       "end_time_requested": 1, "end_time_adjusted": 1},
+      {"timestamp": "2025-01-01T00:00:00.0025Z",
+       "channels": [
+         {"id": 0, "ready": false, "start_time": 0.003,
+          "bytes_per_second": 1e6, "allowed_bytes": 0},
+         {"id": 1, "ready": true, "start_time": 0.001,
+          "bytes_per_second": 2e6, "allowed_bytes": 0}],
+       "outstanding_bytes": 3000, "min_tokens": 3000, "num_ready": 1,
+       "end_time_requested": 1, "end_time_adjusted": 1},
+      {"timestamp": "2025-01-01T00:00:00.004Z", "metadata_type": "ORPHAN"}
+    ],
+    "status": "OK"
+  })json");
+  ASSERT_TRUE(steps.ok()) << steps.status();
+  ASSERT_EQ(steps->size(), 2u);
+  EXPECT_DOUBLE_EQ((*steps)[0].time, 0);
+  EXPECT_EQ((*steps)[0].message_sizes, std::vector<uint64_t>({1000, 2000}));
+  ASSERT_EQ((*steps)[0].channels.size(), 2u);
+  EXPECT_EQ((*steps)[0].channels[1].id, 1u);
+  EXPECT_FALSE((*steps)[0].channels[1].ready);
+  EXPECT_DOUBLE_EQ((*steps)[0].channels[1].start_time, 0.002);
+  EXPECT_DOUBLE_EQ((*steps)[0].channels[1].bytes_per_second, 2e6);
+  EXPECT_NEAR((*steps)[1].time, 0.0015, 1e-9);
+  EXPECT_EQ((*steps)[1].message_sizes, std::vector<uint64_t>({3000}));
+  EXPECT_EQ(Simulate("edt", *steps).messages_delivered, 3u);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
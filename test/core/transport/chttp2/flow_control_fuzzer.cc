@@ -88,6 +88,7 @@ class FlowControlFuzzer {
   void Perform(const flow_control_fuzzer::Action& action);
   void AssertNoneStuck() const;
   void AssertAnnouncedOverInitialWindowSizeCorrect() const;
+  void AssertStreamWindowsBounded() const;
 
  private:
   struct StreamPayload {
@@ -472,6 +473,25 @@ void FlowControlFuzzer::AssertAnnouncedOverInitialWindowSizeCorrect() const {
         tfc_->announced_stream_total_over_incoming_window());
 }
 
+void FlowControlFuzzer::AssertStreamWindowsBounded() const {
+  const double scale = tfc_->stats().stream_window_scale;
+  CHECK_GE(scale, 0.0);
+  CHECK_LE(scale, 1.0);
+  for (const auto& id_stream : streams_) {
+    const auto& fc = id_stream.second.fc;
+    const int64_t bdp_window_delta = fc.bdp_window_delta();
+    CHECK_GE(fc.consumption_rate(), 0.0);
+    CHECK_GE(bdp_window_delta, 0);
+    CHECK_LE(bdp_window_delta, kMaxWindowDelta);
+    // Under memory pressure, or before a round trip has been measured,
+    // streams get no window beyond what their readers ask for.
+    if (scale == 0.0 ||
+        tfc_->bdp_estimator()->EstimateRtt() == Duration::Zero()) {
+      CHECK_EQ(bdp_window_delta, 0);
+    }
+  }
+}
+
 void Test(flow_control_fuzzer::Msg msg) {
   ApplyFuzzConfigVars(msg.config_vars());
   TestOnlyReloadExperimentsFromConfigVariables();
@@ -484,6 +504,7 @@ void Test(flow_control_fuzzer::Msg msg) {
     fuzzer.Perform(action);
     fuzzer.AssertNoneStuck();
     fuzzer.AssertAnnouncedOverInitialWindowSizeCorrect();
+    fuzzer.AssertStreamWindowsBounded();
   }
 }
 FUZZ_TEST(FlowControl, Test)
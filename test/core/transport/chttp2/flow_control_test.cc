@@ -263,6 +263,45 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   EXPECT_EQ(immediate_updates + queued_updates, 65535);
 }
 
+TEST_F(FlowControlTest, StreamWindowFollowsConsumptionRate) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  // Measure a 100ms round trip.
+  BdpEstimator* bdp = tfc.bdp_estimator();
+  bdp->SchedulePing();
+  bdp->StartPing();
+  AdvanceClockMillis(100);
+  bdp->CompletePing();
+  std::ignore = tfc.PeriodicUpdate();
+  StreamFlowControl bulk(&tfc);
+  StreamFlowControl idle(&tfc);
+  EXPECT_EQ(bulk.bdp_window_delta(), 0);
+  // The bulk stream's reader consumes 16KiB every 10ms. The idle stream
+  // receives a message nobody reads.
+  for (int i = 0; i < 20; i++) {
+    {
+      StreamFlowControl::IncomingUpdateContext sfc_upd(&bulk);
+      EXPECT_EQ(sfc_upd.RecvData(16384), absl::OkStatus());
+      sfc_upd.SetMinProgressSize(5);
+      std::ignore = sfc_upd.MakeAction();
+    }
+    if (i == 0) {
+      StreamFlowControl::IncomingUpdateContext sfc_upd(&idle);
+      EXPECT_EQ(sfc_upd.RecvData(16384), absl::OkStatus());
+      std::ignore = sfc_upd.MakeAction();
+    }
+    bulk.MaybeSendUpdate();
+    tfc.MaybeSendUpdate(true);
+    AdvanceClockMillis(10);
+    exec_ctx.InvalidateNow();
+  }
+  // 1.6MB/s over a 100ms round trip: the bulk stream's window is twice its
+  // 160KiB bandwidth delay product.
+  EXPECT_NEAR(bulk.consumption_rate(), 16384 * 100, 1);
+  EXPECT_NEAR(bulk.announced_window_delta(), 2 * 163840 - 65535, 1);
+  EXPECT_EQ(idle.DesiredAnnounceSize(), 0);
+}
+
 }  // namespace chttp2
 }  // namespace grpc_core
 
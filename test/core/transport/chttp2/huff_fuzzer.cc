@@ -29,6 +29,7 @@
 #include "gtest/gtest.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/huff_table_decoder.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 #include "src/core/util/dump_args.h"
 
@@ -117,5 +118,36 @@ void DifferentialOptimizedTest(std::vector<uint8_t> buffer) {
 }
 FUZZ_TEST(HuffTest, DifferentialOptimizedTest);
 
+std::optional<std::vector<uint8_t>> DecodeHuffTable(const uint8_t* begin,
+                                                    const uint8_t* end) {
+  std::vector<uint8_t> v;
+  if (!HuffDecodeAppend(begin, end, &v)) return std::nullopt;
+  return v;
+}
+
+void DifferentialTableTest(std::vector<uint8_t> buffer) {
+  auto fast = DecodeHuffFast(buffer.data(), buffer.data() + buffer.size());
+  auto table = DecodeHuffTable(buffer.data(), buffer.data() + buffer.size());
+  EXPECT_EQ(table, fast) << GRPC_DUMP_ARGS(ToString(buffer), ToString(fast),
+                                           ToString(table));
+}
+FUZZ_TEST(HuffTest, DifferentialTableTest);
+
+void TableDecoderRoundTrips(std::vector<uint8_t> buffer) {
+  grpc_slice uncompressed = grpc_slice_from_copied_buffer(
+      reinterpret_cast<const char*>(buffer.data()), buffer.size());
+  grpc_slice compressed = grpc_chttp2_huffman_compress(uncompressed);
+  // Decoding appends to what is already there.
+  std::vector<uint8_t> uncompressed_again = {1, 2, 3};
+  EXPECT_TRUE(HuffDecodeAppend(GRPC_SLICE_START_PTR(compressed),
+                               GRPC_SLICE_END_PTR(compressed),
+                               &uncompressed_again));
+  buffer.insert(buffer.begin(), {1, 2, 3});
+  EXPECT_EQ(buffer, uncompressed_again);
+  grpc_slice_unref(uncompressed);
+  grpc_slice_unref(compressed);
+}
+FUZZ_TEST(HuffTest, TableDecoderRoundTrips);
+
 }  // namespace
 }  // namespace grpc_core
@@ -0,0 +1,106 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/simd_base64.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "absl/strings/escaping.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr char kAlphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+class SimdBase64Test : public ::testing::TestWithParam<Base64Isa> {
+ protected:
+  void SetUp() override {
+    if (!Base64IsaSupported(GetParam())) {
+      GTEST_SKIP() << "not supported by this CPU";
+    }
+  }
+
+  std::vector<uint8_t> RandomBytes(size_t n) {
+    std::vector<uint8_t> v(n);
+    for (auto& b : v) b = rng_();
+    return v;
+  }
+
+  std::mt19937 rng_{0};
+};
+
+// Lengths around the vector widths, with a guard byte after the output to
+// catch overruns.
+TEST_P(SimdBase64Test, MatchesAbsl) {
+  for (size_t triplets = 0; triplets < 100; ++triplets) {
+    const std::vector<uint8_t> input = RandomBytes(triplets * 3);
+    const std::string expected = absl::Base64Escape(
+        absl::string_view(reinterpret_cast<const char*>(input.data()),
+                          input.size()));
+    ASSERT_EQ(expected.size(), triplets * 4);
+
+    std::vector<uint8_t> encoded(triplets * 4 + 1, 0xee);
+    Base64EncodeTripletsForTesting(GetParam(), input.data(), triplets,
+                                   encoded.data());
+    EXPECT_EQ(std::string(encoded.begin(), encoded.end() - 1), expected);
+    EXPECT_EQ(encoded.back(), 0xee);
+
+    std::vector<uint8_t> decoded(triplets * 3 + 1, 0xee);
+    EXPECT_TRUE(Base64DecodeQuadsForTesting(
+        GetParam(), encoded.data(), triplets, decoded.data()));
+    EXPECT_EQ(std::vector<uint8_t>(decoded.begin(), decoded.end() - 1), input);
+    EXPECT_EQ(decoded.back(), 0xee);
+  }
+}
+
+// Every byte value, at every position of a block, is rejected unless it is in
+// the alphabet.
+TEST_P(SimdBase64Test, RejectsInvalidCharacters) {
+  constexpr size_t kQuads = 19;
+  std::string valid;
+  for (size_t i = 0; i < kQuads * 4; ++i) valid += kAlphabet[rng_() % 64];
+  std::vector<uint8_t> output(kQuads * 3);
+  for (size_t pos = 0; pos < valid.size(); ++pos) {
+    for (int c = 0; c < 256; ++c) {
+      std::string input = valid;
+      input[pos] = static_cast<char>(c);
+      const bool in_alphabet =
+          c != 0 && std::string(kAlphabet).find(static_cast<char>(c)) !=
+                        std::string::npos;
+      EXPECT_EQ(Base64DecodeQuadsForTesting(
+                    GetParam(), reinterpret_cast<const uint8_t*>(input.data()),
+                    kQuads, output.data()),
+                in_alphabet)
+          << "pos=" << pos << " c=" << c;
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Isas, SimdBase64Test,
+                         ::testing::Values(Base64Isa::kScalar,
+                                           Base64Isa::kSsse3,
+                                           Base64Isa::kAvx2));
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
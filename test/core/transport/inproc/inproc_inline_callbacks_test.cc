@@ -0,0 +1,378 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/byte_buffer.h>
+#include <grpc/byte_buffer_reader.h>
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/support/time.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/surface/completion_queue.h"
+#include "src/core/util/notification.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// How deeply callbacks are nested on this thread, and the deepest nesting
+// seen on any thread.
+thread_local int g_callback_depth = 0;
+std::atomic<int> g_max_callback_depth{0};
+
+// A completion queue functor that runs a closure.
+class Callback final : public grpc_completion_queue_functor {
+ public:
+  explicit Callback(absl::AnyInvocable<void(bool)> fn) : fn_(std::move(fn)) {
+    functor_run = &Callback::Run;
+    inlineable = false;
+  }
+
+ private:
+  static void Run(grpc_completion_queue_functor* functor, int ok) {
+    const int depth = ++g_callback_depth;
+    int max_depth = g_max_callback_depth.load();
+    while (depth > max_depth &&
+           !g_max_callback_depth.compare_exchange_weak(max_depth, depth)) {
+    }
+    static_cast<Callback*>(functor)->fn_(ok != 0);
+    --g_callback_depth;
+  }
+
+  absl::AnyInvocable<void(bool)> fn_;
+};
+
+std::string ReadAll(grpc_byte_buffer* buffer) {
+  grpc_byte_buffer_reader reader;
+  EXPECT_TRUE(grpc_byte_buffer_reader_init(&reader, buffer));
+  grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
+  std::string out(reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(slice)),
+                  GRPC_SLICE_LENGTH(slice));
+  grpc_slice_unref(slice);
+  grpc_byte_buffer_reader_destroy(&reader);
+  return out;
+}
+
+grpc_byte_buffer* MakeBuffer(absl::string_view message) {
+  grpc_slice slice = grpc_slice_from_copied_buffer(message.data(),
+                                                   message.size());
+  grpc_byte_buffer* buffer = grpc_raw_byte_buffer_create(&slice, 1);
+  grpc_slice_unref(slice);
+  return buffer;
+}
+
+TEST(CqEndOpInlineTest, RunsTheCallbackBeforeReturning) {
+  Notification shutdown;
+  Callback on_shutdown([&shutdown](bool) { shutdown.Notify(); });
+  grpc_completion_queue* cq =
+      grpc_completion_queue_create_for_callback(&on_shutdown, nullptr);
+  std::thread::id runner;
+  Callback on_done([&runner](bool ok) {
+    EXPECT_TRUE(ok);
+    runner = std::this_thread::get_id();
+  });
+  grpc_cq_completion completion;
+  {
+    ExecCtx exec_ctx;
+    ASSERT_TRUE(grpc_cq_begin_op(cq, &on_done));
+    grpc_cq_end_op_inline(
+        cq, &on_done, absl::OkStatus(), [](void*, grpc_cq_completion*) {},
+        nullptr, &completion);
+    EXPECT_EQ(runner, std::this_thread::get_id());
+  }
+  grpc_completion_queue_shutdown(cq);
+  shutdown.WaitForNotification();
+  grpc_completion_queue_destroy(cq);
+}
+
+TEST(CqEndOpInlineTest, QueuesOnOtherCompletionQueues) {
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  int tag;
+  bool released = false;
+  grpc_cq_completion completion;
+  {
+    ExecCtx exec_ctx;
+    ASSERT_TRUE(grpc_cq_begin_op(cq, &tag));
+    grpc_cq_end_op_inline(
+        cq, &tag, absl::OkStatus(),
+        [](void* arg, grpc_cq_completion*) { *static_cast<bool*>(arg) = true; },
+        &released, &completion);
+  }
+  EXPECT_FALSE(released);
+  grpc_event ev =
+      grpc_completion_queue_next(cq, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr);
+  EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, &tag);
+  EXPECT_TRUE(ev.success);
+  EXPECT_TRUE(released);
+  grpc_completion_queue_shutdown(cq);
+  ev = grpc_completion_queue_next(cq, gpr_inf_past(GPR_CLOCK_REALTIME),
+                                  nullptr);
+  EXPECT_EQ(ev.type, GRPC_QUEUE_SHUTDOWN);
+  grpc_completion_queue_destroy(cq);
+}
+
+// The server side of one call, driven entirely from callbacks: each batch is
+// started from the callback of the one before. It reads until the client
+// half-closes, then echoes the last message and reports in the status
+// details how many it read.
+class ServerCall {
+ public:
+  ServerCall(grpc_server* server, grpc_completion_queue* cq) {
+    grpc_call_details_init(&details_);
+    grpc_metadata_array_init(&request_metadata_);
+    EXPECT_EQ(grpc_server_request_call(server, &call_, &details_,
+                                       &request_metadata_, cq, cq,
+                                       &on_request_),
+              GRPC_CALL_OK);
+  }
+
+  ~ServerCall() {
+    if (call_ != nullptr) grpc_call_unref(call_);
+    grpc_slice_unref(status_details_);
+    grpc_call_details_destroy(&details_);
+    grpc_metadata_array_destroy(&request_metadata_);
+  }
+
+  void WaitForDone() { done_.WaitForNotification(); }
+
+ private:
+  void OnRequest(bool ok) {
+    EXPECT_TRUE(ok);
+    grpc_op ops[2] = {};
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_RECV_MESSAGE;
+    ops[1].data.recv_message.recv_message = &request_;
+    EXPECT_EQ(grpc_call_start_batch(call_, ops, 2, &on_read_, nullptr),
+              GRPC_CALL_OK);
+  }
+
+  void OnRead(bool ok) {
+    EXPECT_TRUE(ok);
+    if (request_ != nullptr) {
+      ++messages_;
+      last_message_ = ReadAll(request_);
+      grpc_byte_buffer_destroy(request_);
+      request_ = nullptr;
+      grpc_op op = {};
+      op.op = GRPC_OP_RECV_MESSAGE;
+      op.data.recv_message.recv_message = &request_;
+      EXPECT_EQ(grpc_call_start_batch(call_, &op, 1, &on_read_, nullptr),
+                GRPC_CALL_OK);
+      return;
+    }
+    response_ = MakeBuffer(last_message_);
+    status_details_ =
+        grpc_slice_from_copied_string(absl::StrCat(messages_).c_str());
+    grpc_op ops[3] = {};
+    ops[0].op = GRPC_OP_SEND_MESSAGE;
+    ops[0].data.send_message.send_message = response_;
+    ops[1].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    ops[1].data.send_status_from_server.status = GRPC_STATUS_OK;
+    ops[1].data.send_status_from_server.status_details = &status_details_;
+    ops[2].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    ops[2].data.recv_close_on_server.cancelled = &cancelled_;
+    EXPECT_EQ(grpc_call_start_batch(call_, ops, 3, &on_finish_, nullptr),
+              GRPC_CALL_OK);
+  }
+
+  void OnFinish(bool ok) {
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(cancelled_, 0);
+    grpc_byte_buffer_destroy(response_);
+    done_.Notify();
+  }
+
+  grpc_call* call_ = nullptr;
+  grpc_call_details details_;
+  grpc_metadata_array request_metadata_;
+  grpc_byte_buffer* request_ = nullptr;
+  grpc_byte_buffer* response_ = nullptr;
+  grpc_slice status_details_ = grpc_empty_slice();
+  int cancelled_ = 1;
+  size_t messages_ = 0;
+  std::string last_message_;
+  Notification done_;
+  Callback on_request_{[this](bool ok) { OnRequest(ok); }};
+  Callback on_read_{[this](bool ok) { OnRead(ok); }};
+  Callback on_finish_{[this](bool ok) { OnFinish(ok); }};
+};
+
+// Runs calls over the promise based inproc transport against a callback
+// completion queue server, with and without inline callbacks.
+class InprocInlineCallbacksTest : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    g_max_callback_depth = 0;
+    server_cq_ =
+        grpc_completion_queue_create_for_callback(&on_cq_shutdown_, nullptr);
+    grpc_arg server_arg = grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_INPROC_INLINE_CALLBACKS), GetParam());
+    grpc_channel_args server_args = {1, &server_arg};
+    server_ = grpc_server_create(&server_args, nullptr);
+    grpc_server_register_completion_queue(server_, server_cq_, nullptr);
+    grpc_server_start(server_);
+    grpc_arg client_arg = grpc_channel_arg_integer_create(
+        const_cast<char*>("grpc.experimental.promise_based_inproc_transport"),
+        1);
+    grpc_channel_args client_args = {1, &client_arg};
+    channel_ = grpc_inproc_channel_create(server_, &client_args, nullptr);
+    client_cq_ = grpc_completion_queue_create_for_next(nullptr);
+  }
+
+  void TearDown() override {
+    grpc_channel_destroy(channel_);
+    Notification server_shutdown;
+    Callback on_server_shutdown(
+        [&server_shutdown](bool) { server_shutdown.Notify(); });
+    grpc_server_shutdown_and_notify(server_, server_cq_, &on_server_shutdown);
+    server_shutdown.WaitForNotification();
+    grpc_server_destroy(server_);
+    grpc_completion_queue_shutdown(server_cq_);
+    cq_shutdown_.WaitForNotification();
+    grpc_completion_queue_destroy(server_cq_);
+    grpc_completion_queue_shutdown(client_cq_);
+    while (grpc_completion_queue_next(client_cq_,
+                                      gpr_inf_future(GPR_CLOCK_REALTIME),
+                                      nullptr)
+               .type != GRPC_QUEUE_SHUTDOWN) {
+    }
+    grpc_completion_queue_destroy(client_cq_);
+  }
+
+  void StartBatchAndWait(grpc_call* call, const grpc_op* ops, size_t nops) {
+    int tag;
+    ASSERT_EQ(grpc_call_start_batch(call, ops, nops, &tag, nullptr),
+              GRPC_CALL_OK);
+    grpc_event ev = grpc_completion_queue_next(
+        client_cq_, grpc_timeout_seconds_to_deadline(10), nullptr);
+    ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+    EXPECT_EQ(ev.tag, &tag);
+    EXPECT_TRUE(ev.success);
+  }
+
+  // Sends the messages on a new call and half-closes it. Returns the status
+  // details, and the message the server sent back in *response.
+  std::string RunCall(const std::vector<std::string>& messages,
+                      std::string* response) {
+    ServerCall server_call(server_, server_cq_);
+    grpc_call* call = grpc_channel_create_call(
+        channel_, nullptr, GRPC_PROPAGATE_DEFAULTS, client_cq_,
+        grpc_slice_from_static_string("/test.Service/Method"), nullptr,
+        grpc_timeout_seconds_to_deadline(10), nullptr);
+    grpc_op op = {};
+    op.op = GRPC_OP_SEND_INITIAL_METADATA;
+    StartBatchAndWait(call, &op, 1);
+    for (const std::string& message : messages) {
+      grpc_byte_buffer* buffer = MakeBuffer(message);
+      op = {};
+      op.op = GRPC_OP_SEND_MESSAGE;
+      op.data.send_message.send_message = buffer;
+      StartBatchAndWait(call, &op, 1);
+      grpc_byte_buffer_destroy(buffer);
+    }
+    grpc_metadata_array initial_metadata;
+    grpc_metadata_array trailing_metadata;
+    grpc_metadata_array_init(&initial_metadata);
+    grpc_metadata_array_init(&trailing_metadata);
+    grpc_byte_buffer* reply = nullptr;
+    grpc_status_code status;
+    grpc_slice details;
+    grpc_op ops[4] = {};
+    ops[0].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    ops[1].op = GRPC_OP_RECV_INITIAL_METADATA;
+    ops[1].data.recv_initial_metadata.recv_initial_metadata =
+        &initial_metadata;
+    ops[2].op = GRPC_OP_RECV_MESSAGE;
+    ops[2].data.recv_message.recv_message = &reply;
+    ops[3].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[3].data.recv_status_on_client.trailing_metadata = &trailing_metadata;
+    ops[3].data.recv_status_on_client.status = &status;
+    ops[3].data.recv_status_on_client.status_details = &details;
+    StartBatchAndWait(call, ops, 4);
+    server_call.WaitForDone();
+    EXPECT_EQ(status, GRPC_STATUS_OK);
+    EXPECT_NE(reply, nullptr);
+    if (reply != nullptr) {
+      *response = ReadAll(reply);
+      grpc_byte_buffer_destroy(reply);
+    }
+    std::string out(
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(details)),
+        GRPC_SLICE_LENGTH(details));
+    grpc_slice_unref(details);
+    grpc_metadata_array_destroy(&initial_metadata);
+    grpc_metadata_array_destroy(&trailing_metadata);
+    grpc_call_unref(call);
+    return out;
+  }
+
+  Notification cq_shutdown_;
+  Callback on_cq_shutdown_{[this](bool) { cq_shutdown_.Notify(); }};
+  grpc_completion_queue* server_cq_ = nullptr;
+  grpc_completion_queue* client_cq_ = nullptr;
+  grpc_server* server_ = nullptr;
+  grpc_channel* channel_ = nullptr;
+};
+
+TEST_P(InprocInlineCallbacksTest, UnaryCallsComplete) {
+  for (int i = 0; i < 20; ++i) {
+    const std::string request = absl::StrCat("request ", i);
+    std::string response;
+    EXPECT_EQ(RunCall({request}, &response), "1");
+    EXPECT_EQ(response, request);
+  }
+}
+
+// Each server callback starts the call's next batch. When the callbacks run
+// inline, that batch is started from inside the call's own completion, and
+// must neither deadlock nor nest a level deeper for every message.
+TEST_P(InprocInlineCallbacksTest, BatchesStartedFromCallbacksDoNotNest) {
+  constexpr int kMessages = 100;
+  std::vector<std::string> requests;
+  for (int i = 0; i < kMessages; ++i) {
+    requests.push_back(absl::StrCat("request ", i));
+  }
+  std::string response;
+  EXPECT_EQ(RunCall(requests, &response), absl::StrCat(kMessages));
+  EXPECT_EQ(response, requests.back());
+  EXPECT_LT(g_max_callback_depth.load(), 4);
+}
+
+INSTANTIATE_TEST_SUITE_P(InprocInlineCallbacksTest, InprocInlineCallbacksTest,
+                         ::testing::Bool(), [](const auto& info) {
+                           return info.param ? "Inline" : "EventEngine";
+                         });
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -0,0 +1,242 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_connection.h"
+
+#include <fcntl.h>
+#include <grpc/support/port_platform.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/shm/shm_ring.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace shm {
+namespace {
+
+// A server socket that accepts connections but leaves the handoff to each
+// test.
+class ShmConnectionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto doorbell = CreateDoorbell();
+    if (absl::IsUnimplemented(doorbell.status())) {
+      GTEST_SKIP() << "shm handoff is not supported here";
+    }
+    ASSERT_TRUE(doorbell.ok()) << doorbell.status();
+    cancel_fd_ = *doorbell;
+    path_ = absl::StrCat("/tmp/shm_connection_test.", getpid());
+    sockaddr_un* un = reinterpret_cast<sockaddr_un*>(address_.addr);
+    memset(un, 0, sizeof(*un));
+    un->sun_family = AF_UNIX;
+    ASSERT_LT(path_.size(), sizeof(un->sun_path));
+    memcpy(un->sun_path, path_.data(), path_.size());
+    address_.len = sizeof(*un);
+    unlink(path_.c_str());
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    ASSERT_GE(listen_fd_, 0);
+    ASSERT_EQ(bind(listen_fd_, reinterpret_cast<sockaddr*>(un), address_.len),
+              0);
+    ASSERT_EQ(listen(listen_fd_, 4), 0);
+  }
+
+  void TearDown() override {
+    if (listen_fd_ >= 0) close(listen_fd_);
+    if (cancel_fd_ >= 0) close(cancel_fd_);
+    unlink(path_.c_str());
+  }
+
+  // Accepts the next connection the way the listener does.
+  int AcceptSocket() {
+    return accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+  }
+
+  // Connects without speaking the handoff.
+  int ConnectRaw() {
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    EXPECT_EQ(connect(fd, reinterpret_cast<const sockaddr*>(address_.addr),
+                      address_.len),
+              0);
+    return fd;
+  }
+
+  static bool Readable(int fd, int timeout_ms) {
+    pollfd pfd{fd, POLLIN | POLLRDHUP, 0};
+    return poll(&pfd, 1, timeout_ms) == 1;
+  }
+
+  // Sends the client's half of the handoff with the given fds.
+  static void SendHello(int socket, std::vector<int> fds) {
+    const uint32_t hello[2] = {0x67736d68, 1};
+    iovec iov{const_cast<uint32_t*>(hello), sizeof(hello)};
+    alignas(cmsghdr) char control[CMSG_SPACE(2 * sizeof(int))] = {};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = CMSG_SPACE(fds.size() * sizeof(int));
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(fds.size() * sizeof(int));
+    memcpy(CMSG_DATA(cmsg), fds.data(), fds.size() * sizeof(int));
+    ASSERT_EQ(sendmsg(socket, &msg, 0), sizeof(hello));
+  }
+
+  std::string path_;
+  grpc_resolved_address address_;
+  int listen_fd_ = -1;
+  int cancel_fd_ = -1;
+};
+
+TEST_F(ShmConnectionTest, HandoffConnectsRingsAndDoorbells) {
+  absl::StatusOr<std::unique_ptr<ShmConnection>> client;
+  std::thread client_thread([&]() {
+    client = ShmConnection::Connect(address_, ShmSegment::kMinRingSize,
+                                    Timestamp::Now() + Duration::Seconds(10));
+  });
+  const int socket = AcceptSocket();
+  ASSERT_GE(socket, 0);
+  ASSERT_TRUE(Readable(socket, 10000));
+  auto server = ShmConnection::Accept(socket);
+  client_thread.join();
+  ASSERT_TRUE(server.ok()) << server.status();
+  ASSERT_TRUE(client.ok()) << client.status();
+  EXPECT_TRUE((*client)->is_client());
+  EXPECT_FALSE((*server)->is_client());
+  const uint8_t in[] = {1, 2, 3};
+  ASSERT_EQ(*(*client)->outgoing().Write(in), 3u);
+  uint8_t out[3];
+  ASSERT_EQ(*(*server)->incoming().Read(absl::MakeSpan(out)), 3u);
+  EXPECT_EQ(memcmp(in, out, 3), 0);
+  // Each side's peer doorbell wakes the other side.
+  RingDoorbell((*client)->peer_doorbell());
+  EXPECT_TRUE(Readable((*server)->local_doorbell(), 0));
+  RingDoorbell((*server)->peer_doorbell());
+  EXPECT_TRUE(Readable((*client)->local_doorbell(), 0));
+}
+
+TEST_F(ShmConnectionTest, PeerGoingAwayShowsOnTheSocket) {
+  absl::StatusOr<std::unique_ptr<ShmConnection>> client;
+  std::thread client_thread([&]() {
+    client = ShmConnection::Connect(address_, ShmSegment::kMinRingSize,
+                                    Timestamp::Now() + Duration::Seconds(10));
+  });
+  const int socket = AcceptSocket();
+  ASSERT_GE(socket, 0);
+  ASSERT_TRUE(Readable(socket, 10000));
+  auto server = ShmConnection::Accept(socket);
+  client_thread.join();
+  ASSERT_TRUE(server.ok()) << server.status();
+  ASSERT_TRUE(client.ok()) << client.status();
+  EXPECT_FALSE(Readable((*server)->socket(), 0));
+  client->reset();
+  EXPECT_TRUE(Readable((*server)->socket(), 10000));
+}
+
+TEST_F(ShmConnectionTest, AcceptDoesNotWaitForASilentClient) {
+  const int client = ConnectRaw();
+  const int socket = AcceptSocket();
+  ASSERT_GE(socket, 0);
+  const Timestamp start = Timestamp::Now();
+  auto server = ShmConnection::Accept(socket);
+  EXPECT_FALSE(server.ok());
+  EXPECT_LT(Timestamp::Now() - start, Duration::Seconds(1));
+  close(client);
+}
+
+TEST_F(ShmConnectionTest, AcceptRejectsADoorbellThatIsNotAnEventfd) {
+  auto segment = ShmSegment::Create(ShmSegment::kMinRingSize);
+  ASSERT_TRUE(segment.ok()) << segment.status();
+  // A pipe's writes block once it is full, which would stall the server.
+  int pipe_fds[2];
+  ASSERT_EQ(pipe(pipe_fds), 0);
+  const int client = ConnectRaw();
+  SendHello(client, {(*segment)->fd(), pipe_fds[1]});
+  const int socket = AcceptSocket();
+  ASSERT_GE(socket, 0);
+  ASSERT_TRUE(Readable(socket, 10000));
+  auto server = ShmConnection::Accept(socket);
+  EXPECT_EQ(server.status().code(), absl::StatusCode::kInvalidArgument)
+      << server.status();
+  close(pipe_fds[0]);
+  close(pipe_fds[1]);
+  close(client);
+}
+
+TEST_F(ShmConnectionTest, PeerDoorbellIsMadeNonBlocking) {
+  auto segment = ShmSegment::Create(ShmSegment::kMinRingSize);
+  ASSERT_TRUE(segment.ok()) << segment.status();
+  auto doorbell = CreateDoorbell();
+  ASSERT_TRUE(doorbell.ok()) << doorbell.status();
+  ASSERT_EQ(fcntl(*doorbell, F_SETFL, 0), 0);
+  const int client = ConnectRaw();
+  SendHello(client, {(*segment)->fd(), *doorbell});
+  const int socket = AcceptSocket();
+  ASSERT_GE(socket, 0);
+  ASSERT_TRUE(Readable(socket, 10000));
+  auto server = ShmConnection::Accept(socket);
+  ASSERT_TRUE(server.ok()) << server.status();
+  EXPECT_NE(fcntl(*doorbell, F_GETFL) & O_NONBLOCK, 0);
+  close(*doorbell);
+  close(client);
+}
+
+TEST_F(ShmConnectionTest, ConnectTimesOutOnASilentServer) {
+  // The connection sits in the backlog without the server ever answering.
+  auto client =
+      ShmConnection::Connect(address_, ShmSegment::kMinRingSize,
+                             Timestamp::Now() + Duration::Milliseconds(100));
+  EXPECT_EQ(client.status().code(), absl::StatusCode::kDeadlineExceeded)
+      << client.status();
+}
+
+TEST_F(ShmConnectionTest, ConnectIsCancelledByTheCancelFd) {
+  std::thread canceller([this]() {
+    absl::SleepFor(absl::Milliseconds(100));
+    RingDoorbell(cancel_fd_);
+  });
+  const Timestamp start = Timestamp::Now();
+  auto client = ShmConnection::Connect(
+      address_, ShmSegment::kMinRingSize,
+      Timestamp::Now() + Duration::Seconds(30), cancel_fd_);
+  canceller.join();
+  EXPECT_EQ(client.status().code(), absl::StatusCode::kCancelled)
+      << client.status();
+  EXPECT_LT(Timestamp::Now() - start, Duration::Seconds(10));
+}
+
+}  // namespace
+}  // namespace shm
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
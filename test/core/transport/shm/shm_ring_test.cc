@@ -0,0 +1,159 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_ring.h"
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace shm {
+namespace {
+
+constexpr uint64_t kCapacity = 64;
+
+class ShmRingTest : public ::testing::Test {
+ protected:
+  ShmRing MakeRing() { return ShmRing(&header_, data_, kCapacity); }
+
+  RingHeader header_{};
+  uint8_t data_[kCapacity] = {};
+};
+
+std::vector<uint8_t> Bytes(size_t n, uint8_t first) {
+  std::vector<uint8_t> v(n);
+  std::iota(v.begin(), v.end(), first);
+  return v;
+}
+
+TEST_F(ShmRingTest, StartsEmpty) {
+  ShmRing ring = MakeRing();
+  EXPECT_EQ(*ring.Readable(), 0u);
+  EXPECT_EQ(*ring.Writable(), kCapacity);
+  EXPECT_FALSE(ring.ReaderAtEnd());
+}
+
+TEST_F(ShmRingTest, WriteThenRead) {
+  ShmRing ring = MakeRing();
+  auto in = Bytes(10, 0);
+  EXPECT_EQ(*ring.Write(in), 10u);
+  EXPECT_EQ(*ring.Readable(), 10u);
+  std::vector<uint8_t> out(10);
+  EXPECT_EQ(*ring.Read(absl::MakeSpan(out)), 10u);
+  EXPECT_EQ(out, in);
+  EXPECT_EQ(*ring.Readable(), 0u);
+}
+
+TEST_F(ShmRingTest, WriteStopsWhenFull) {
+  ShmRing ring = MakeRing();
+  EXPECT_EQ(*ring.Write(Bytes(100, 0)), kCapacity);
+  EXPECT_EQ(*ring.Writable(), 0u);
+  EXPECT_EQ(*ring.Write(Bytes(1, 0)), 0u);
+}
+
+TEST_F(ShmRingTest, WrapsAround) {
+  ShmRing ring = MakeRing();
+  std::vector<uint8_t> out(kCapacity);
+  // Push the positions near the end of the data, then write across it.
+  ASSERT_EQ(*ring.Write(Bytes(50, 0)), 50u);
+  ASSERT_EQ(*ring.Read(absl::MakeSpan(out.data(), 50)), 50u);
+  auto in = Bytes(40, 100);
+  ASSERT_EQ(*ring.Write(in), 40u);
+  ASSERT_EQ(*ring.Read(absl::MakeSpan(out.data(), 40)), 40u);
+  EXPECT_EQ(std::vector<uint8_t>(out.begin(), out.begin() + 40), in);
+}
+
+TEST_F(ShmRingTest, ReaderAtEndOnlyAfterDraining) {
+  ShmRing ring = MakeRing();
+  ASSERT_EQ(*ring.Write(Bytes(4, 0)), 4u);
+  ring.CloseWriter();
+  EXPECT_FALSE(ring.ReaderAtEnd());
+  std::vector<uint8_t> out(4);
+  ASSERT_EQ(*ring.Read(absl::MakeSpan(out)), 4u);
+  EXPECT_TRUE(ring.ReaderAtEnd());
+}
+
+TEST_F(ShmRingTest, CorruptPositionsAreRejected) {
+  ShmRing ring = MakeRing();
+  header_.write_position.store(kCapacity + 1);
+  EXPECT_FALSE(ring.Readable().ok());
+  std::vector<uint8_t> out(4);
+  EXPECT_FALSE(ring.Read(absl::MakeSpan(out)).ok());
+  header_.write_position.store(0);
+  header_.read_position.store(1);
+  EXPECT_FALSE(ring.Writable().ok());
+  EXPECT_FALSE(ring.Write(Bytes(1, 0)).ok());
+}
+
+TEST_F(ShmRingTest, ReaderWaitsOnlyWhenEmpty) {
+  ShmRing ring = MakeRing();
+  ASSERT_EQ(*ring.Write(Bytes(1, 0)), 1u);
+  EXPECT_FALSE(ring.PrepareToWaitForData());
+  EXPECT_FALSE(ring.WakeReader());
+  std::vector<uint8_t> out(1);
+  ASSERT_EQ(*ring.Read(absl::MakeSpan(out)), 1u);
+  EXPECT_TRUE(ring.PrepareToWaitForData());
+  // The writer wakes a waiting reader exactly once.
+  ASSERT_EQ(*ring.Write(Bytes(1, 0)), 1u);
+  EXPECT_TRUE(ring.WakeReader());
+  EXPECT_FALSE(ring.WakeReader());
+}
+
+TEST_F(ShmRingTest, WriterWaitsOnlyWhenFull) {
+  ShmRing ring = MakeRing();
+  EXPECT_FALSE(ring.PrepareToWaitForSpace());
+  ASSERT_EQ(*ring.Write(Bytes(kCapacity, 0)), kCapacity);
+  EXPECT_TRUE(ring.PrepareToWaitForSpace());
+  std::vector<uint8_t> out(1);
+  ASSERT_EQ(*ring.Read(absl::MakeSpan(out)), 1u);
+  EXPECT_TRUE(ring.WakeWriter());
+  EXPECT_FALSE(ring.WakeWriter());
+}
+
+TEST(ShmSegmentTest, RejectsBadRingSizes) {
+  EXPECT_FALSE(ShmSegment::Create(ShmSegment::kMinRingSize / 2).ok());
+  EXPECT_FALSE(ShmSegment::Create(ShmSegment::kMinRingSize + 1).ok());
+}
+
+TEST(ShmSegmentTest, MappedSegmentSharesRings) {
+  auto created = ShmSegment::Create(ShmSegment::kMinRingSize);
+  if (absl::IsUnimplemented(created.status())) {
+    GTEST_SKIP() << "shared memory segments are not supported here";
+  }
+  ASSERT_TRUE(created.ok()) << created.status();
+  auto mapped = ShmSegment::Map(dup((*created)->fd()));
+  ASSERT_TRUE(mapped.ok()) << mapped.status();
+  EXPECT_EQ((*mapped)->ring_size(), ShmSegment::kMinRingSize);
+  auto in = Bytes(16, 7);
+  ASSERT_EQ(*(*created)->client_to_server().Write(in), 16u);
+  std::vector<uint8_t> out(16);
+  ASSERT_EQ(*(*mapped)->client_to_server().Read(absl::MakeSpan(out)), 16u);
+  EXPECT_EQ(out, in);
+  // The other direction is independent.
+  EXPECT_EQ(*(*mapped)->server_to_client().Readable(), 0u);
+}
+
+}  // namespace
+}  // namespace shm
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,353 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_transport.h"
+
+#include <fcntl.h>
+#include <grpc/byte_buffer.h>
+#include <grpc/byte_buffer_reader.h>
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/impl/propagation_bits.h>
+#include <grpc/slice.h>
+#include <grpc/status.h>
+#include <grpc/support/time.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/shm/shm_ring.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace shm {
+namespace {
+
+void* Tag(intptr_t t) { return CqVerifier::tag(t); }
+
+std::string ByteBufferToString(grpc_byte_buffer* buffer) {
+  grpc_byte_buffer_reader reader;
+  EXPECT_TRUE(grpc_byte_buffer_reader_init(&reader, buffer));
+  grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
+  std::string out(StringViewFromSlice(slice));
+  grpc_slice_unref(slice);
+  grpc_byte_buffer_reader_destroy(&reader);
+  return out;
+}
+
+// A server listening on a shm: address, and a channel to it.
+class ShmTransportTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto doorbell = CreateDoorbell();
+    if (absl::IsUnimplemented(doorbell.status())) {
+      GTEST_SKIP() << "shm transport is not supported here";
+    }
+    ASSERT_TRUE(doorbell.ok()) << doorbell.status();
+    close(*doorbell);
+    path_ = absl::StrCat("/tmp/shm_transport_test.", getpid());
+    target_ = absl::StrCat(Scheme(), ":", path_);
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    server_ = grpc_server_create(nullptr, nullptr);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    grpc_server_credentials* server_creds =
+        grpc_insecure_server_credentials_create();
+    ASSERT_NE(grpc_server_add_http2_port(server_, target_.c_str(),
+                                         server_creds),
+              0);
+    grpc_server_credentials_release(server_creds);
+    grpc_server_start(server_);
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    channel_ = grpc_channel_create(target_.c_str(), creds, nullptr);
+    grpc_channel_credentials_release(creds);
+  }
+
+  void TearDown() override {
+    if (cq_ == nullptr) return;
+    if (channel_ != nullptr) grpc_channel_destroy(channel_);
+    ShutdownServer();
+    grpc_completion_queue_shutdown(cq_);
+    while (grpc_completion_queue_next(cq_, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                      nullptr)
+               .type != GRPC_QUEUE_SHUTDOWN) {
+    }
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  void ShutdownServer() {
+    if (server_ == nullptr) return;
+    CqVerifier cqv(cq_);
+    grpc_server_shutdown_and_notify(server_, cq_, Tag(1000));
+    grpc_server_cancel_all_calls(server_);
+    cqv.Expect(Tag(1000), true);
+    cqv.Verify();
+    grpc_server_destroy(server_);
+    server_ = nullptr;
+  }
+
+  std::string path_;
+  std::string target_;
+  grpc_completion_queue* cq_ = nullptr;
+  grpc_server* server_ = nullptr;
+  grpc_channel* channel_ = nullptr;
+};
+
+// The state of one call, from both ends.
+class Call {
+ public:
+  Call(grpc_channel* channel, grpc_completion_queue* cq) {
+    client_ = grpc_channel_create_call(
+        channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq,
+        grpc_slice_from_static_string("/foo"), nullptr,
+        grpc_timeout_seconds_to_deadline(30), nullptr);
+    grpc_metadata_array_init(&initial_metadata_recv_);
+    grpc_metadata_array_init(&trailing_metadata_recv_);
+    grpc_metadata_array_init(&request_metadata_recv_);
+    grpc_call_details_init(&call_details_);
+  }
+
+  ~Call() {
+    if (response_ != nullptr) grpc_byte_buffer_destroy(response_);
+    if (request_ != nullptr) grpc_byte_buffer_destroy(request_);
+    grpc_slice_unref(details_);
+    grpc_metadata_array_destroy(&initial_metadata_recv_);
+    grpc_metadata_array_destroy(&trailing_metadata_recv_);
+    grpc_metadata_array_destroy(&request_metadata_recv_);
+    grpc_call_details_destroy(&call_details_);
+    grpc_call_unref(client_);
+    if (server_ != nullptr) grpc_call_unref(server_);
+  }
+
+  // Sends `request` and the close, and waits for the response and status.
+  void StartClient(absl::string_view request, void* tag) {
+    grpc_slice request_slice =
+        grpc_slice_from_copied_buffer(request.data(), request.size());
+    grpc_byte_buffer* request_payload =
+        grpc_raw_byte_buffer_create(&request_slice, 1);
+    grpc_slice_unref(request_slice);
+    grpc_op ops[6];
+    memset(ops, 0, sizeof(ops));
+    grpc_op* op = ops;
+    op->op = GRPC_OP_SEND_INITIAL_METADATA;
+    op++;
+    op->op = GRPC_OP_SEND_MESSAGE;
+    op->data.send_message.send_message = request_payload;
+    op++;
+    op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    op++;
+    op->op = GRPC_OP_RECV_INITIAL_METADATA;
+    op->data.recv_initial_metadata.recv_initial_metadata =
+        &initial_metadata_recv_;
+    op++;
+    op->op = GRPC_OP_RECV_MESSAGE;
+    op->data.recv_message.recv_message = &response_;
+    op++;
+    op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    op->data.recv_status_on_client.trailing_metadata =
+        &trailing_metadata_recv_;
+    op->data.recv_status_on_client.status = &status_;
+    op->data.recv_status_on_client.status_details = &details_;
+    op++;
+    EXPECT_EQ(grpc_call_start_batch(client_, ops,
+                                    static_cast<size_t>(op - ops), tag,
+                                    nullptr),
+              GRPC_CALL_OK);
+    grpc_byte_buffer_destroy(request_payload);
+  }
+
+  void RequestOnServer(grpc_server* server, grpc_completion_queue* cq,
+                       void* tag) {
+    EXPECT_EQ(grpc_server_request_call(server, &server_, &call_details_,
+                                       &request_metadata_recv_, cq, cq, tag),
+              GRPC_CALL_OK);
+  }
+
+  void ReceiveOnServer(void* tag) {
+    grpc_op ops[2];
+    memset(ops, 0, sizeof(ops));
+    grpc_op* op = ops;
+    op->op = GRPC_OP_SEND_INITIAL_METADATA;
+    op++;
+    op->op = GRPC_OP_RECV_MESSAGE;
+    op->data.recv_message.recv_message = &request_;
+    op++;
+    EXPECT_EQ(grpc_call_start_batch(server_, ops,
+                                    static_cast<size_t>(op - ops), tag,
+                                    nullptr),
+              GRPC_CALL_OK);
+  }
+
+  void RespondOnServer(absl::string_view response, void* tag) {
+    grpc_slice response_slice =
+        grpc_slice_from_copied_buffer(response.data(), response.size());
+    grpc_byte_buffer* response_payload =
+        grpc_raw_byte_buffer_create(&response_slice, 1);
+    grpc_slice_unref(response_slice);
+    grpc_slice status_details = grpc_slice_from_static_string("xyz");
+    grpc_op ops[3];
+    memset(ops, 0, sizeof(ops));
+    grpc_op* op = ops;
+    op->op = GRPC_OP_SEND_MESSAGE;
+    op->data.send_message.send_message = response_payload;
+    op++;
+    op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    op->data.send_status_from_server.status = GRPC_STATUS_OK;
+    op->data.send_status_from_server.status_details = &status_details;
+    op++;
+    op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    op->data.recv_close_on_server.cancelled = &cancelled_;
+    op++;
+    EXPECT_EQ(grpc_call_start_batch(server_, ops,
+                                    static_cast<size_t>(op - ops), tag,
+                                    nullptr),
+              GRPC_CALL_OK);
+    grpc_byte_buffer_destroy(response_payload);
+  }
+
+  grpc_status_code status() const { return status_; }
+  grpc_byte_buffer* request() const { return request_; }
+  grpc_byte_buffer* response() const { return response_; }
+
+ private:
+  grpc_call* client_;
+  grpc_call* server_ = nullptr;
+  grpc_metadata_array initial_metadata_recv_;
+  grpc_metadata_array trailing_metadata_recv_;
+  grpc_metadata_array request_metadata_recv_;
+  grpc_call_details call_details_;
+  grpc_byte_buffer* request_ = nullptr;
+  grpc_byte_buffer* response_ = nullptr;
+  grpc_status_code status_ = GRPC_STATUS_UNKNOWN;
+  grpc_slice details_ = grpc_empty_slice();
+  int cancelled_ = 2;
+};
+
+TEST_F(ShmTransportTest, UnaryCall) {
+  CqVerifier cqv(cq_);
+  Call call(channel_, cq_);
+  call.StartClient("hello", Tag(1));
+  call.RequestOnServer(server_, cq_, Tag(101));
+  cqv.Expect(Tag(101), true);
+  cqv.Verify();
+  call.ReceiveOnServer(Tag(102));
+  cqv.Expect(Tag(102), true);
+  cqv.Verify();
+  ASSERT_NE(call.request(), nullptr);
+  EXPECT_EQ(ByteBufferToString(call.request()), "hello");
+  call.RespondOnServer("world", Tag(103));
+  cqv.Expect(Tag(103), true);
+  cqv.Expect(Tag(1), true);
+  cqv.Verify();
+  EXPECT_EQ(call.status(), GRPC_STATUS_OK);
+  ASSERT_NE(call.response(), nullptr);
+  EXPECT_EQ(ByteBufferToString(call.response()), "world");
+}
+
+TEST_F(ShmTransportTest, CallsShareTheConnection) {
+  CqVerifier cqv(cq_);
+  for (int i = 0; i < 10; ++i) {
+    Call call(channel_, cq_);
+    call.StartClient(absl::StrCat("request ", i), Tag(1));
+    call.RequestOnServer(server_, cq_, Tag(101));
+    cqv.Expect(Tag(101), true);
+    cqv.Verify();
+    call.ReceiveOnServer(Tag(102));
+    cqv.Expect(Tag(102), true);
+    cqv.Verify();
+    ASSERT_NE(call.request(), nullptr);
+    EXPECT_EQ(ByteBufferToString(call.request()), absl::StrCat("request ", i));
+    call.RespondOnServer(absl::StrCat("response ", i), Tag(103));
+    cqv.Expect(Tag(103), true);
+    cqv.Expect(Tag(1), true);
+    cqv.Verify();
+    EXPECT_EQ(call.status(), GRPC_STATUS_OK);
+    ASSERT_NE(call.response(), nullptr);
+    EXPECT_EQ(ByteBufferToString(call.response()),
+              absl::StrCat("response ", i));
+  }
+}
+
+TEST_F(ShmTransportTest, ServerShutdownEndsCallsInFlight) {
+  CqVerifier cqv(cq_);
+  Call call(channel_, cq_);
+  call.StartClient("hello", Tag(1));
+  call.RequestOnServer(server_, cq_, Tag(101));
+  cqv.Expect(Tag(101), true);
+  cqv.Verify();
+  // The call is established; take the server away underneath it.
+  grpc_server_shutdown_and_notify(server_, cq_, Tag(1000));
+  grpc_server_cancel_all_calls(server_);
+  cqv.Expect(Tag(1000), true);
+  cqv.Expect(Tag(1), true);
+  cqv.Verify();
+  grpc_server_destroy(server_);
+  server_ = nullptr;
+  EXPECT_NE(call.status(), GRPC_STATUS_OK);
+  // The listener removes its socket on the way out.
+  struct stat st;
+  EXPECT_NE(stat(path_.c_str(), &st), 0);
+}
+
+TEST_F(ShmTransportTest, NewCallsFailOnceTheServerIsGone) {
+  ShutdownServer();
+  CqVerifier cqv(cq_);
+  Call call(channel_, cq_);
+  call.StartClient("hello", Tag(1));
+  cqv.Expect(Tag(1), true);
+  cqv.Verify();
+  EXPECT_EQ(call.status(), GRPC_STATUS_UNAVAILABLE);
+}
+
+TEST(ShmListenerTest, DoesNotRemoveAFileInTheWay) {
+  const std::string path =
+      absl::StrCat("/tmp/shm_transport_test.file.", getpid());
+  const int fd = open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0600);
+  ASSERT_GE(fd, 0);
+  close(fd);
+  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  grpc_server_credentials* server_creds =
+      grpc_insecure_server_credentials_create();
+  // Binding fails on the regular file rather than replacing it.
+  EXPECT_EQ(grpc_server_add_http2_port(
+                server, absl::StrCat(Scheme(), ":", path).c_str(),
+                server_creds),
+            0);
+  grpc_server_credentials_release(server_creds);
+  grpc_server_destroy(server);
+  struct stat st;
+  ASSERT_EQ(stat(path.c_str(), &st), 0);
+  EXPECT_TRUE(S_ISREG(st.st_mode));
+  unlink(path.c_str());
+}
+
+}  // namespace
+}  // namespace shm
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
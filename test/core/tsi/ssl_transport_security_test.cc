@@ -42,6 +42,10 @@
 #include "test/core/test_util/tls_utils.h"
 #include "test/core/tsi/transport_security_test_lib.h"
 
+#if defined(OPENSSL_IS_BORINGSSL)
+#include <openssl/aead.h>
+#endif
+
 #define SSL_TSI_TEST_ALPN1 "foo"
 #define SSL_TSI_TEST_ALPN2 "toto"
 #define SSL_TSI_TEST_ALPN3 "baz"
@@ -1185,6 +1189,123 @@ TEST_P(SslTransportSecurityTest, ConcurrentlyProtectAndUnprotectOnServer) {
   tsi_frame_protector_destroy(client_protector);
   tsi_frame_protector_destroy(server_protector);
 }
+
+// Seals plaintext into one application data record with the exported keys,
+// the way the kernel would.
+static std::string SealTlsRecord(const tsi_ktls_crypto_info& info,
+                                 absl::string_view plaintext) {
+  constexpr uint8_t kApplicationData = 0x17;
+  const EVP_AEAD* aead = info.cipher == TSI_KTLS_CIPHER_AES_128_GCM
+                             ? EVP_aead_aes_128_gcm()
+                             : EVP_aead_aes_256_gcm();
+  bssl::ScopedEVP_AEAD_CTX ctx;
+  EXPECT_EQ(EVP_AEAD_CTX_init(ctx.get(), aead, info.key, info.key_size,
+                              EVP_AEAD_DEFAULT_TAG_LENGTH, nullptr),
+            1);
+  uint8_t nonce[sizeof(info.salt) + sizeof(info.iv)];
+  memcpy(nonce, info.salt, sizeof(info.salt));
+  memcpy(nonce + sizeof(info.salt), info.iv, sizeof(info.iv));
+  std::string inner(plaintext);
+  std::string explicit_nonce;
+  uint8_t ad[13];
+  size_t ad_size;
+  const size_t tag_size = EVP_AEAD_max_overhead(aead);
+  if (info.version == TLS1_3_VERSION) {
+    // The nonce is the IV XORed with the sequence number, and the content
+    // type is sealed along with the data.
+    for (size_t i = 0; i < sizeof(info.rec_seq); ++i) {
+      nonce[sizeof(nonce) - sizeof(info.rec_seq) + i] ^= info.rec_seq[i];
+    }
+    inner.push_back(static_cast<char>(kApplicationData));
+    const size_t length = inner.size() + tag_size;
+    const uint8_t header[] = {kApplicationData, 0x03, 0x03,
+                              static_cast<uint8_t>(length >> 8),
+                              static_cast<uint8_t>(length)};
+    memcpy(ad, header, sizeof(header));
+    ad_size = sizeof(header);
+  } else {
+    // The explicit part of the nonce goes on the wire, and the additional
+    // data is the sequence number followed by the plaintext's header.
+    explicit_nonce.assign(reinterpret_cast<const char*>(info.iv),
+                          sizeof(info.iv));
+    memcpy(ad, info.rec_seq, sizeof(info.rec_seq));
+    const uint8_t header[] = {kApplicationData, 0x03, 0x03,
+                              static_cast<uint8_t>(plaintext.size() >> 8),
+                              static_cast<uint8_t>(plaintext.size())};
+    memcpy(ad + sizeof(info.rec_seq), header, sizeof(header));
+    ad_size = sizeof(info.rec_seq) + sizeof(header);
+  }
+  std::string sealed(inner.size() + tag_size, '\0');
+  size_t sealed_size;
+  EXPECT_EQ(
+      EVP_AEAD_CTX_seal(ctx.get(), reinterpret_cast<uint8_t*>(&sealed[0]),
+                        &sealed_size, sealed.size(), nonce, sizeof(nonce),
+                        reinterpret_cast<const uint8_t*>(inner.data()),
+                        inner.size(), ad, ad_size),
+      1);
+  sealed.resize(sealed_size);
+  const size_t length = explicit_nonce.size() + sealed.size();
+  std::string record = {static_cast<char>(kApplicationData), 0x03, 0x03,
+                        static_cast<char>(length >> 8),
+                        static_cast<char>(length & 0xff)};
+  return absl::StrCat(record, explicit_nonce, sealed);
+}
+
+TEST_P(SslTransportSecurityTest, GetKtlsTxCryptoInfo) {
+  LOG(INFO) << "ssl_tsi_test_get_ktls_tx_crypto_info";
+  const tsi_tls_version tls_version = std::get<0>(GetParam());
+  SetUpSslFixture(tls_version, /*send_client_ca_list=*/false);
+  DoHandshake();
+  tsi_ktls_crypto_info server_tx;
+  const unsigned char* server_bytes_to_send;
+  size_t server_bytes_to_send_size;
+  ASSERT_EQ(tsi_handshaker_result_get_ktls_tx_crypto_info(
+                ssl_tsi_test_fixture_->server_result, &server_tx,
+                &server_bytes_to_send, &server_bytes_to_send_size),
+            TSI_OK);
+  EXPECT_NE(server_tx.cipher, TSI_KTLS_CIPHER_NONE);
+  tsi_ktls_crypto_info client_tx;
+  const unsigned char* client_bytes_to_send;
+  size_t client_bytes_to_send_size;
+  ASSERT_EQ(tsi_handshaker_result_get_ktls_tx_crypto_info(
+                ssl_tsi_test_fixture_->client_result, &client_tx,
+                &client_bytes_to_send, &client_bytes_to_send_size),
+            TSI_OK);
+  EXPECT_EQ(client_bytes_to_send_size, 0u);
+  if (tls_version == tsi_tls_version::TSI_TLS1_3) {
+    // The server's session tickets are handed over rather than left behind.
+    EXPECT_GT(server_bytes_to_send_size, 0u);
+  }
+  // The keys may only be exported once.
+  EXPECT_EQ(tsi_handshaker_result_get_ktls_tx_crypto_info(
+                ssl_tsi_test_fixture_->server_result, &server_tx,
+                &server_bytes_to_send, &server_bytes_to_send_size),
+            TSI_FAILED_PRECONDITION);
+  tsi_frame_protector* client_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  tsi_frame_protector* server_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->server_result,
+                /*max_output_protected_frame_size=*/nullptr, &server_protector),
+            TSI_OK);
+  // Records sealed with the exported keys, after the handed over bytes, are
+  // accepted by the peer's frame protector.
+  const std::string server_message(1024, 'a');
+  std::string server_bytes(
+      reinterpret_cast<const char*>(server_bytes_to_send),
+      server_bytes_to_send_size);
+  server_bytes += SealTlsRecord(server_tx, server_message);
+  EXPECT_EQ(Unprotect(client_protector, server_bytes), server_message);
+  const std::string client_message(20, 'b');
+  EXPECT_EQ(Unprotect(server_protector,
+                      SealTlsRecord(client_tx, client_message)),
+            client_message);
+  tsi_frame_protector_destroy(client_protector);
+  tsi_frame_protector_destroy(server_protector);
+}
 #endif  // defined(OPENSSL_IS_BORINGSSL)
 
 static const tsi_ssl_handshaker_factory_vtable* original_vtable;
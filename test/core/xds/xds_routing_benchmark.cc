@@ -0,0 +1,171 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Compares XdsRouting's linear lookups with its precomputed indexes, over
+// generated configs shaped like a large service mesh: mostly per-method
+// routes, some per-service prefixes, and a few regex routes at the end.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/util/matchers.h"
+#include "src/core/xds/grpc/xds_route_config.h"
+#include "src/core/xds/grpc/xds_routing.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kMethodsPerService = 8;
+
+class RouteList final : public XdsRouting::RouteListIterator {
+ public:
+  explicit RouteList(int num_routes) {
+    for (int i = 0; static_cast<int>(routes_.size()) < num_routes; ++i) {
+      const std::string service = absl::StrCat("/pkg.Service", i, "/");
+      for (int j = 0; j < kMethodsPerService; ++j) {
+        std::string path = absl::StrCat(service, "Method", j);
+        Add(StringMatcher::Type::kExact, path);
+        paths_.push_back(std::move(path));
+      }
+      Add(StringMatcher::Type::kPrefix, service);
+      paths_.push_back(absl::StrCat(service, "Unlisted"));
+    }
+    Add(StringMatcher::Type::kSafeRegex, "/legacy\\..*");
+    Add(StringMatcher::Type::kPrefix, "");
+  }
+
+  size_t Size() const override { return routes_.size(); }
+  const XdsRouteConfigResource::Route::Matchers& GetMatchersForRoute(
+      size_t index) const override {
+    return routes_[index];
+  }
+
+  // Paths that each match some route, in random order.
+  std::vector<std::string> ShuffledPaths() const {
+    std::vector<std::string> paths = paths_;
+    absl::BitGen bitgen;
+    std::shuffle(paths.begin(), paths.end(), bitgen);
+    return paths;
+  }
+
+ private:
+  void Add(StringMatcher::Type type, absl::string_view path) {
+    XdsRouteConfigResource::Route::Matchers matchers;
+    matchers.path_matcher = StringMatcher::Create(type, path).value();
+    routes_.push_back(std::move(matchers));
+  }
+
+  std::vector<XdsRouteConfigResource::Route::Matchers> routes_;
+  std::vector<std::string> paths_;
+};
+
+class VirtualHostList final : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHostList(int num_vhosts) {
+    for (int i = 0; i < num_vhosts; ++i) {
+      domains_.push_back({absl::StrCat("svc", i, ".example.com"),
+                          absl::StrCat("svc", i, ".example.com:443"),
+                          absl::StrCat("*.svc", i, ".example.com")});
+      hosts_.push_back(absl::StrCat("api.svc", i, ".example.com"));
+    }
+    domains_.push_back({"*"});
+  }
+
+  size_t Size() const override { return domains_.size(); }
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+  const std::vector<std::string>& hosts() const { return hosts_; }
+
+ private:
+  std::vector<std::vector<std::string>> domains_;
+  std::vector<std::string> hosts_;
+};
+
+void BM_GetRouteForRequestLinear(benchmark::State& state) {
+  RouteList routes(state.range(0));
+  const std::vector<std::string> paths = routes.ShuffledPaths();
+  grpc_metadata_batch md;
+  size_t i = 0;
+  for (auto s : state) {
+    auto route = XdsRouting::GetRouteForRequest(
+        routes, paths[i++ % paths.size()], &md);
+    CHECK(route.has_value());
+    benchmark::DoNotOptimize(route);
+  }
+}
+BENCHMARK(BM_GetRouteForRequestLinear)->RangeMultiplier(10)->Range(10, 10000);
+
+void BM_GetRouteForRequestIndexed(benchmark::State& state) {
+  RouteList routes(state.range(0));
+  const std::vector<std::string> paths = routes.ShuffledPaths();
+  const XdsRouting::RouteIndex index(routes);
+  grpc_metadata_batch md;
+  size_t i = 0;
+  for (auto s : state) {
+    auto route =
+        index.GetRouteForRequest(routes, paths[i++ % paths.size()], &md);
+    CHECK(route.has_value());
+    benchmark::DoNotOptimize(route);
+  }
+}
+BENCHMARK(BM_GetRouteForRequestIndexed)->RangeMultiplier(10)->Range(10, 10000);
+
+void BM_FindVirtualHostLinear(benchmark::State& state) {
+  VirtualHostList vhosts(state.range(0));
+  size_t i = 0;
+  for (auto s : state) {
+    const std::string& host = vhosts.hosts()[i++ % vhosts.hosts().size()];
+    benchmark::DoNotOptimize(
+        XdsRouting::FindVirtualHostForDomain(vhosts, host));
+  }
+}
+BENCHMARK(BM_FindVirtualHostLinear)->RangeMultiplier(10)->Range(10, 1000);
+
+void BM_FindVirtualHostIndexed(benchmark::State& state) {
+  VirtualHostList vhosts(state.range(0));
+  const XdsRouting::VirtualHostIndex index(vhosts);
+  size_t i = 0;
+  for (auto s : state) {
+    const std::string& host = vhosts.hosts()[i++ % vhosts.hosts().size()];
+    benchmark::DoNotOptimize(index.Find(host));
+  }
+}
+BENCHMARK(BM_FindVirtualHostIndexed)->RangeMultiplier(10)->Range(10, 1000);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,257 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/xds/grpc/xds_routing.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/matchers.h"
+#include "src/core/xds/grpc/xds_route_config.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using Matchers = XdsRouteConfigResource::Route::Matchers;
+
+class VirtualHostList final : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHostList(std::vector<std::vector<std::string>> domains)
+      : domains_(std::move(domains)) {}
+
+  size_t Size() const override { return domains_.size(); }
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  std::vector<std::vector<std::string>> domains_;
+};
+
+class RouteList final : public XdsRouting::RouteListIterator {
+ public:
+  size_t Size() const override { return routes_.size(); }
+  const Matchers& GetMatchersForRoute(size_t index) const override {
+    return routes_[index];
+  }
+
+  RouteList& Add(StringMatcher::Type type, absl::string_view path,
+                 bool case_sensitive = true,
+                 std::vector<HeaderMatcher> header_matchers = {}) {
+    Matchers matchers;
+    matchers.path_matcher =
+        StringMatcher::Create(type, path, case_sensitive).value();
+    matchers.header_matchers = std::move(header_matchers);
+    routes_.push_back(std::move(matchers));
+    return *this;
+  }
+
+ private:
+  std::vector<Matchers> routes_;
+};
+
+// These check the index against the linear search as well.
+
+std::optional<size_t> FindVirtualHost(const VirtualHostList& vhosts,
+                                      absl::string_view domain) {
+  auto expected = XdsRouting::FindVirtualHostForDomain(vhosts, domain);
+  auto actual = XdsRouting::VirtualHostIndex(vhosts).Find(domain);
+  EXPECT_EQ(actual, expected) << domain;
+  return actual;
+}
+
+std::optional<size_t> GetRoute(const RouteList& routes, absl::string_view path,
+                               grpc_metadata_batch* md) {
+  auto expected = XdsRouting::GetRouteForRequest(routes, path, md);
+  auto actual =
+      XdsRouting::RouteIndex(routes).GetRouteForRequest(routes, path, md);
+  EXPECT_EQ(actual, expected) << path;
+  return actual;
+}
+
+TEST(VirtualHostIndexTest, MatchTypesInPriorityOrder) {
+  VirtualHostList vhosts({{"*"}, {"foo.*"}, {"*.example.com"},
+                          {"foo.example.com"}});
+  EXPECT_EQ(FindVirtualHost(vhosts, "foo.example.com"), 3);
+  EXPECT_EQ(FindVirtualHost(vhosts, "bar.example.com"), 2);
+  EXPECT_EQ(FindVirtualHost(vhosts, "foo.bar"), 1);
+  EXPECT_EQ(FindVirtualHost(vhosts, "bar"), 0);
+}
+
+TEST(VirtualHostIndexTest, LongestWildcardWinsThenFirstListed) {
+  VirtualHostList vhosts(
+      {{"*.com"}, {"*.example.com"}, {"*.xample.com", "*.other.com"}});
+  EXPECT_EQ(FindVirtualHost(vhosts, "a.example.com"), 1);
+  EXPECT_EQ(FindVirtualHost(vhosts, "a.other.com"), 2);
+  VirtualHostList ties({{"*.a.com"}, {"*.b.com", "*.a.com"}});
+  EXPECT_EQ(FindVirtualHost(ties, "x.a.com"), 0);
+}
+
+TEST(VirtualHostIndexTest, CaseInsensitive) {
+  VirtualHostList vhosts({{"Foo.Example.COM"}, {"*.EXAMPLE.com"}});
+  EXPECT_EQ(FindVirtualHost(vhosts, "foo.example.com"), 0);
+  EXPECT_EQ(FindVirtualHost(vhosts, "BAR.example.com"), 1);
+}
+
+TEST(VirtualHostIndexTest, WildcardMatchesAtLeastOneChar) {
+  VirtualHostList vhosts({{"*.example.com"}, {"example.com*"}});
+  EXPECT_EQ(FindVirtualHost(vhosts, ".example.com"), std::nullopt);
+  EXPECT_EQ(FindVirtualHost(vhosts, "example.com"), std::nullopt);
+  EXPECT_EQ(FindVirtualHost(vhosts, "example.com."), 1);
+}
+
+TEST(VirtualHostIndexTest, AgreesWithLinearSearchOnGeneratedConfigs) {
+  absl::BitGen bitgen;
+  const std::vector<std::string> labels = {"a", "b", "ab", "Ab"};
+  auto random_name = [&]() {
+    std::string name = labels[absl::Uniform<size_t>(bitgen, 0, labels.size())];
+    const size_t depth = absl::Uniform(bitgen, 0, 3);
+    for (size_t i = 0; i < depth; ++i) {
+      absl::StrAppend(
+          &name, ".", labels[absl::Uniform<size_t>(bitgen, 0, labels.size())]);
+    }
+    return name;
+  };
+  for (int config = 0; config < 50; ++config) {
+    std::vector<std::vector<std::string>> domains(
+        absl::Uniform(bitgen, 1, 10));
+    for (auto& vhost_domains : domains) {
+      const int num_domains = absl::Uniform(bitgen, 1, 4);
+      for (int i = 0; i < num_domains; ++i) {
+        switch (absl::Uniform(bitgen, 0, 4)) {
+          case 0:
+            vhost_domains.push_back(random_name());
+            break;
+          case 1:
+            vhost_domains.push_back(absl::StrCat("*", random_name()));
+            break;
+          case 2:
+            vhost_domains.push_back(absl::StrCat(random_name(), "*"));
+            break;
+          default:
+            vhost_domains.push_back("*");
+            break;
+        }
+      }
+    }
+    VirtualHostList vhosts(std::move(domains));
+    for (int i = 0; i < 100; ++i) FindVirtualHost(vhosts, random_name());
+  }
+}
+
+TEST(RouteIndexTest, FirstMatchWinsAcrossMatcherKinds) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kSafeRegex, "/other/.*")
+      .Add(StringMatcher::Type::kPrefix, "/svc/")
+      .Add(StringMatcher::Type::kExact, "/svc/Method")
+      .Add(StringMatcher::Type::kPrefix, "");
+  grpc_metadata_batch md;
+  EXPECT_EQ(GetRoute(routes, "/other/Method", &md), 0);
+  EXPECT_EQ(GetRoute(routes, "/svc/Method", &md), 1);
+  EXPECT_EQ(GetRoute(routes, "/unknown/Method", &md), 3);
+}
+
+TEST(RouteIndexTest, ExactBeforePrefixWhenListedFirst) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/svc/Method")
+      .Add(StringMatcher::Type::kPrefix, "/svc/")
+      .Add(StringMatcher::Type::kPrefix, "/svc/Method");
+  grpc_metadata_batch md;
+  EXPECT_EQ(GetRoute(routes, "/svc/Method", &md), 0);
+  EXPECT_EQ(GetRoute(routes, "/svc/Other", &md), 1);
+  EXPECT_EQ(GetRoute(routes, "/sv", &md), std::nullopt);
+}
+
+TEST(RouteIndexTest, CaseInsensitiveMatchersAreHonored) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/SVC/method", false)
+      .Add(StringMatcher::Type::kPrefix, "/Svc/", false)
+      .Add(StringMatcher::Type::kPrefix, "/svc/");
+  grpc_metadata_batch md;
+  EXPECT_EQ(GetRoute(routes, "/svc/Method", &md), 0);
+  EXPECT_EQ(GetRoute(routes, "/svc/Other", &md), 1);
+}
+
+TEST(RouteIndexTest, HeaderMismatchFallsThroughToLaterRoute) {
+  RouteList routes;
+  routes
+      .Add(StringMatcher::Type::kExact, "/svc/Method", true,
+           {HeaderMatcher::Create("env", HeaderMatcher::Type::kExact, "canary")
+                .value()})
+      .Add(StringMatcher::Type::kSuffix, "Method")
+      .Add(StringMatcher::Type::kPrefix, "/svc/");
+  grpc_metadata_batch md;
+  EXPECT_EQ(GetRoute(routes, "/svc/Method", &md), 1);
+  EXPECT_EQ(GetRoute(routes, "/svc/Other", &md), 2);
+  md.Append("env", Slice::FromCopiedString("canary"),
+            [](absl::string_view error, const Slice& value) {
+              FAIL() << error << " value:" << value.as_string_view();
+            });
+  EXPECT_EQ(GetRoute(routes, "/svc/Method", &md), 0);
+}
+
+TEST(RouteIndexTest, AgreesWithLinearSearchOnGeneratedConfigs) {
+  absl::BitGen bitgen;
+  const std::vector<std::string> segments = {"a", "b", "ab", "svc", "Svc"};
+  auto random_path = [&]() {
+    std::string path;
+    const size_t depth = absl::Uniform(bitgen, 0, 4);
+    for (size_t i = 0; i < depth; ++i) {
+      absl::StrAppend(&path, "/",
+                      segments[absl::Uniform<size_t>(bitgen, 0,
+                                                     segments.size())]);
+    }
+    return path;
+  };
+  const StringMatcher::Type kTypes[] = {
+      StringMatcher::Type::kExact, StringMatcher::Type::kPrefix,
+      StringMatcher::Type::kSuffix, StringMatcher::Type::kContains};
+  for (int config = 0; config < 50; ++config) {
+    RouteList routes;
+    const int num_routes = absl::Uniform(bitgen, 1, 40);
+    for (int i = 0; i < num_routes; ++i) {
+      routes.Add(kTypes[absl::Uniform(bitgen, 0, 4)], random_path(),
+                 absl::Bernoulli(bitgen, 0.8));
+    }
+    XdsRouting::RouteIndex index(routes);
+    grpc_metadata_batch md;
+    for (int i = 0; i < 100; ++i) {
+      std::string path = random_path();
+      EXPECT_EQ(index.GetRouteForRequest(routes, path, &md),
+                XdsRouting::GetRouteForRequest(routes, path, &md))
+          << path;
+    }
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
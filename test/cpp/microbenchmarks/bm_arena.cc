@@ -20,8 +20,11 @@
 
 #include <benchmark/benchmark.h>
 
+#include "src/core/call/call_arena_allocator.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
@@ -92,6 +95,31 @@ static void BM_Arena_NewDeleteComparison_Small(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_NewDeleteComparison_Small);
 
+// Call arenas as a channel makes them, one call at a time, with and without
+// recycling of arena storage.
+static void BM_CallArena(benchmark::State& state, bool recycle) {
+  auto quota = grpc_core::ResourceQuota::Default()->memory_quota();
+  auto allocator =
+      recycle ? grpc_core::MakeRefCounted<grpc_core::CallArenaAllocator>(
+                    quota->CreateMemoryAllocator("bm_arena"), 1024,
+                    quota->CreateMemoryOwner())
+              : grpc_core::MakeRefCounted<grpc_core::CallArenaAllocator>(
+                    quota->CreateMemoryAllocator("bm_arena"), 1024);
+  auto stats_before = grpc_core::global_stats().Collect();
+  for (auto _ : state) {
+    auto a = allocator->MakeArena();
+    for (int i = 0; i < state.range(0); i++) {
+      a->Alloc(state.range(1));
+    }
+  }
+  auto stats = grpc_core::global_stats().Collect()->Diff(*stats_before);
+  state.counters["allocs_per_call"] = benchmark::Counter(
+      static_cast<double>(stats->call_arena_storage_allocated) /
+      state.iterations());
+}
+BENCHMARK_CAPTURE(BM_CallArena, fresh, false)->Ranges({{1, 64}, {1, 1024}});
+BENCHMARK_CAPTURE(BM_CallArena, recycled, true)->Ranges({{1, 64}, {1, 1024}});
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -0,0 +1,115 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Base64 coding of binary metadata, by instruction set. kScalar is the
+// portable implementation, coding one group of bytes at a time.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
+#include "src/core/ext/transport/chttp2/transport/simd_base64.h"
+#include "src/core/lib/slice/slice.h"
+#include "test/core/test_util/test_config.h"
+
+using grpc_core::Base64Isa;
+
+static std::vector<uint8_t> RandomBytes(size_t n) {
+  std::mt19937 rng(0);
+  std::vector<uint8_t> v(n);
+  for (auto& b : v) b = rng();
+  return v;
+}
+
+static void BM_Encode(benchmark::State& state, Base64Isa isa) {
+  if (!grpc_core::Base64IsaSupported(isa)) {
+    state.SkipWithError("not supported by this CPU");
+    return;
+  }
+  const size_t triplets = state.range(0) / 3;
+  const std::vector<uint8_t> input = RandomBytes(triplets * 3);
+  std::vector<uint8_t> output(triplets * 4);
+  for (auto _ : state) {
+    grpc_core::Base64EncodeTripletsForTesting(isa, input.data(), triplets,
+                                              output.data());
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * triplets * 3);
+}
+BENCHMARK_CAPTURE(BM_Encode, scalar, Base64Isa::kScalar)->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(BM_Encode, ssse3, Base64Isa::kSsse3)->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(BM_Encode, avx2, Base64Isa::kAvx2)->Range(64, 64 * 1024);
+
+static void BM_Decode(benchmark::State& state, Base64Isa isa) {
+  if (!grpc_core::Base64IsaSupported(isa)) {
+    state.SkipWithError("not supported by this CPU");
+    return;
+  }
+  const size_t triplets = state.range(0) / 3;
+  std::vector<uint8_t> encoded(triplets * 4);
+  grpc_core::Base64EncodeTripletsForTesting(
+      Base64Isa::kScalar, RandomBytes(triplets * 3).data(), triplets,
+      encoded.data());
+  std::vector<uint8_t> output(triplets * 3);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_core::Base64DecodeQuadsForTesting(
+        isa, encoded.data(), triplets, output.data()));
+  }
+  state.SetBytesProcessed(state.iterations() * triplets * 3);
+}
+BENCHMARK_CAPTURE(BM_Decode, scalar, Base64Isa::kScalar)->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(BM_Decode, ssse3, Base64Isa::kSsse3)->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(BM_Decode, avx2, Base64Isa::kAvx2)->Range(64, 64 * 1024);
+
+// The paths the chttp2 transport takes, with the best supported instruction
+// set.
+static void BM_ChttpBase64Encode(benchmark::State& state) {
+  grpc_core::Slice input =
+      grpc_core::Slice::FromCopiedBuffer(RandomBytes(state.range(0)));
+  for (auto _ : state) {
+    grpc_core::Slice output(grpc_chttp2_base64_encode(input.c_slice()));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ChttpBase64Encode)->Range(64, 64 * 1024);
+
+static void BM_ChttpBase64EncodeAndHuffmanCompress(benchmark::State& state) {
+  grpc_core::Slice input =
+      grpc_core::Slice::FromCopiedBuffer(RandomBytes(state.range(0)));
+  uint32_t wire_size;
+  for (auto _ : state) {
+    grpc_core::Slice output(grpc_chttp2_base64_encode_and_huffman_compress(
+        input.c_slice(), &wire_size));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ChttpBase64EncodeAndHuffmanCompress)->Range(64, 64 * 1024);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
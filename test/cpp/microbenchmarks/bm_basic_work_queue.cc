@@ -20,6 +20,7 @@
 #include "absl/log/check.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/util/sync.h"
 #include "test/core/test_util/test_config.h"
 
@@ -27,10 +28,14 @@ namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::BasicWorkQueue;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
 using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::WorkQueue;
 
 grpc_core::Mutex globalMu;
 BasicWorkQueue globalWorkQueue;
+BasicWorkQueue globalStealBasicWorkQueue;
+ChaseLevWorkQueue globalStealChaseLevWorkQueue;
 std::deque<EventEngine::Closure*> globalDeque;
 
 // --- Multithreaded Tests ---------------------------------------------------
@@ -122,6 +127,61 @@ void BM_MultithreadedStdDequeLIFO(benchmark::State& state) {
 }
 BENCHMARK(BM_MultithreadedStdDequeLIFO)->Apply(MultithreadedTestArguments);
 
+// --- Work Stealing Tests ---------------------------------------------------
+
+void StealTestArguments(benchmark::internal::Benchmark* b) {
+  b->Range(1, 512)
+      ->UseRealTime()
+      ->MeasureProcessCPUTime()
+      ->Threads(2)
+      ->Threads(4)
+      ->ThreadPerCpu();
+}
+
+// Thread 0 owns the queue: it adds closures and pops the most recent ones,
+// the way a WorkStealingThreadPool worker uses its local queue. Every other
+// thread steals the oldest closures, as idle workers do.
+void MultithreadedOwnerWithThieves(benchmark::State& state, WorkQueue& queue) {
+  AnyInvocableClosure closure([] {});
+  int element_count = state.range(0);
+  double popped = 0;
+  double pop_attempts = 0;
+  const bool is_owner = state.thread_index() == 0;
+  for (auto _ : state) {
+    if (is_owner) {
+      for (int i = 0; i < element_count; i++) queue.Add(&closure);
+      while (!queue.Empty()) {
+        ++pop_attempts;
+        if (queue.PopMostRecent() != nullptr) ++popped;
+      }
+    } else {
+      for (int i = 0; i < element_count; i++) {
+        ++pop_attempts;
+        if (queue.PopOldest() != nullptr) ++popped;
+      }
+    }
+  }
+  state.counters["popped"] =
+      benchmark::Counter(popped, benchmark::Counter::kIsRate);
+  state.counters["pop_attempts"] = pop_attempts;
+  state.counters["hit_rate"] = benchmark::Counter(
+      pop_attempts > 0 ? popped / pop_attempts : 0,
+      benchmark::Counter::kAvgThreads);
+  if (is_owner) {
+    CHECK(queue.Empty());
+  }
+}
+
+void BM_MultithreadedBasicWorkQueueSteal(benchmark::State& state) {
+  MultithreadedOwnerWithThieves(state, globalStealBasicWorkQueue);
+}
+BENCHMARK(BM_MultithreadedBasicWorkQueueSteal)->Apply(StealTestArguments);
+
+void BM_MultithreadedChaseLevWorkQueueSteal(benchmark::State& state) {
+  MultithreadedOwnerWithThieves(state, globalStealChaseLevWorkQueue);
+}
+BENCHMARK(BM_MultithreadedChaseLevWorkQueueSteal)->Apply(StealTestArguments);
+
 // --- Basic Functionality Tests ---------------------------------------------
 
 void BM_WorkQueueIntptrPopMostRecent(benchmark::State& state) {
@@ -191,6 +251,29 @@ BENCHMARK(BM_WorkQueueAnyInvocableExecution)
     ->UseRealTime()
     ->MeasureProcessCPUTime();
 
+void BM_ChaseLevWorkQueueClosureExecution(benchmark::State& state) {
+  ChaseLevWorkQueue queue;
+  int element_count = state.range(0);
+  int run_count = 0;
+  grpc_event_engine::experimental::AnyInvocableClosure closure(
+      [&run_count] { ++run_count; });
+  for (auto _ : state) {
+    for (int i = 0; i < element_count; i++) queue.Add(&closure);
+    do {
+      queue.PopMostRecent()->Run();
+    } while (run_count < element_count);
+    run_count = 0;
+  }
+  state.counters["Added"] = element_count * state.iterations();
+  state.counters["Popped"] = state.counters["Added"];
+  state.counters["Pop Rate"] =
+      benchmark::Counter(state.counters["Popped"], benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ChaseLevWorkQueueClosureExecution)
+    ->Range(8, 128)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+
 }  // namespace
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
@@ -0,0 +1,102 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark callback-API unary calls over the promise based inproc transport,
+// with and without GRPC_ARG_INPROC_INLINE_CALLBACKS.
+
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/callback_unary_ping_pong.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+class PromiseInProcessConfiguration : public FixtureConfiguration {
+ public:
+  explicit PromiseInProcessConfiguration(bool inline_callbacks)
+      : inline_callbacks_(inline_callbacks) {}
+
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+    c->SetInt("grpc.experimental.promise_based_inproc_transport", 1);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+    b->AddChannelArgument(GRPC_ARG_INPROC_INLINE_CALLBACKS,
+                          inline_callbacks_ ? 1 : 0);
+  }
+
+ private:
+  const bool inline_callbacks_;
+};
+
+class PromiseInProcess : public FullstackFixture {
+ public:
+  explicit PromiseInProcess(Service* service)
+      : FullstackFixture(service, PromiseInProcessConfiguration(false), "") {}
+};
+
+class InlinePromiseInProcess : public FullstackFixture {
+ public:
+  explicit InlinePromiseInProcess(Service* service)
+      : FullstackFixture(service, PromiseInProcessConfiguration(true), "") {}
+};
+
+//******************************************************************************
+// CONFIGURATIONS
+//
+
+// Replace "benchmark::internal::Benchmark" with "::testing::Benchmark" to use
+// internal microbenchmarking tooling
+static void SweepSizesArgs(benchmark::internal::Benchmark* b) {
+  b->Args({0, 0});
+  for (int i = 1; i <= 1024 * 1024; i *= 8) {
+    // First argument is the message size of request
+    // Second argument is the message size of response
+    b->Args({i, 0});
+    b->Args({0, i});
+    b->Args({i, i});
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, PromiseInProcess, NoOpMutator,
+                   NoOpMutator)
+    ->Apply(SweepSizesArgs);
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InlinePromiseInProcess,
+                   NoOpMutator, NoOpMutator)
+    ->Apply(SweepSizesArgs);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -30,6 +30,7 @@
 #include "absl/log/log.h"
 #include "absl/random/random.h"
 #include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -512,6 +513,27 @@ class NonIndexedElem {
   }
 };
 
+// A literal whose value is Huffman coded, as peers commonly send longer
+// header values such as user-agent.
+class NonIndexedHuffmanElem {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    grpc_slice value = grpc_slice_from_static_string(
+        "grpc-c++/1.74.0 grpc-c/50.0.0 (linux; chttp2) "
+        "application/x-custom-client");
+    grpc_slice compressed = grpc_chttp2_huffman_compress(value);
+    CHECK_LT(GRPC_SLICE_LENGTH(compressed), 127u);
+    std::vector<uint8_t> v = {
+        0x00, 0x03, 'a', 'b', 'c',
+        static_cast<uint8_t>(0x80 | GRPC_SLICE_LENGTH(compressed))};
+    v.insert(v.end(), GRPC_SLICE_START_PTR(compressed),
+             GRPC_SLICE_END_PTR(compressed));
+    grpc_slice_unref(compressed);
+    return {MakeSlice(v)};
+  }
+};
+
 template <int kLength, bool kTrueBinary>
 class NonIndexedBinaryElem;
 
@@ -625,6 +647,7 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, IndexedSingleInternedElem);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, AddIndexedSingleInternedElem);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, KeyIndexedSingleInternedElem);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedElem);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedHuffmanElem);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<1, false>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<3, false>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<10, false>);
@@ -130,6 +130,35 @@ BENCHMARK(BM_EventEngine_RunClosure)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
 
+// A burst of callbacks is scheduled from within an EventEngine thread, so it
+// lands on that thread's local queue. Every other worker has to steal to
+// participate, which exercises the thread pool's work stealing path.
+void BM_EventEngine_RunBurstFromEngineThread(benchmark::State& state) {
+  auto engine = GetDefaultEventEngine();
+  const int cb_count = state.range(0);
+  std::atomic_int count{0};
+  for (auto _ : state) {
+    grpc_core::Notification signal;
+    auto cb = [&signal, &count, cb_count]() {
+      // Give thieves a chance to find work before the owner drains it all.
+      benchmark::DoNotOptimize(std::sqrt(static_cast<double>(count.load())));
+      if (++count == cb_count) signal.Notify();
+    };
+    engine->Run([engine = engine.get(), &cb, cb_count]() {
+      for (int i = 0; i < cb_count; i++) {
+        engine->Run(cb);
+      }
+    });
+    signal.WaitForNotification();
+    count.store(0);
+  }
+  state.SetItemsProcessed(cb_count * state.iterations());
+}
+BENCHMARK(BM_EventEngine_RunBurstFromEngineThread)
+    ->Range(100, 4096)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
 void FanoutTestArguments(benchmark::internal::Benchmark* b) {
   // TODO(hork): enable when the engines are fast enough to run these:
   // ->Args({10000, 1})  // chain of callbacks scheduling callbacks
@@ -0,0 +1,302 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Simulates a connection carrying one bulk stream alongside many small RPCs,
+// driving chttp2 flow control as the transport would, in simulated time.
+// Reports how long the bulk stream takes to reach the link rate, the rate it
+// settles at, and how much window the small streams are left holding.
+
+#include <benchmark/benchmark.h>
+#include <grpc/support/time.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/bdp_estimator.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+extern gpr_timespec (*gpr_now_impl)(gpr_clock_type clock_type);
+
+namespace grpc_core {
+namespace chttp2 {
+namespace {
+
+// 100Mbps with a 20ms round trip.
+constexpr int64_t kLinkBytesPerMs = 12500;
+constexpr int64_t kOneWayDelayMs = 10;
+constexpr int64_t kSimulatedMs = 2000;
+constexpr int64_t kPeriodicUpdateMs = 100;
+constexpr int64_t kSmallMessageSize = 1024;
+constexpr int64_t kSmallMessageIntervalMs = 2;
+constexpr int64_t kMaxFrameSize = 16384;
+
+gpr_timespec g_now;
+gpr_timespec now_impl(gpr_clock_type clock_type) {
+  gpr_timespec ts = g_now;
+  ts.clock_type = clock_type;
+  return ts;
+}
+
+class MixedWorkload {
+ public:
+  explicit MixedWorkload(int num_small_streams) {
+    streams_.emplace_back(&tfc_);
+    // The bulk stream always has more to send, and a reader waiting for it.
+    streams_[0].queued = std::numeric_limits<int64_t>::max();
+    SetMinProgressSize(0, 5);
+    for (int i = 0; i < num_small_streams; i++) streams_.emplace_back(&tfc_);
+  }
+
+  void Run() {
+    for (now_ms_ = 1; now_ms_ <= kSimulatedMs; now_ms_++) {
+      g_now = gpr_time_add(g_now, gpr_time_from_millis(1, GPR_TIMESPAN));
+      exec_ctx_.InvalidateNow();
+      if (streams_.size() > 1 && now_ms_ % kSmallMessageIntervalMs == 0) {
+        // The next small RPC sends a message to a waiting reader.
+        const size_t id = 1 + (now_ms_ / kSmallMessageIntervalMs) %
+                                  (streams_.size() - 1);
+        streams_[id].queued += kSmallMessageSize;
+        SetMinProgressSize(id, kSmallMessageSize + 5);
+      }
+      if (now_ms_ % kPeriodicUpdateMs == 0) Act(tfc_.PeriodicUpdate());
+      ReceiveUpdates();
+      SendData();
+      ReceiveData();
+      Write();
+    }
+  }
+
+  int64_t time_to_line_rate_ms() const { return time_to_line_rate_ms_; }
+  // The share of the link the bulk stream had over the last second.
+  double bulk_link_share() const {
+    return bulk_bytes_last_second_ / (kLinkBytesPerMs * 1000.0);
+  }
+  double small_stream_window() const {
+    if (streams_.size() == 1) return 0;
+    double total = 0;
+    for (size_t i = 1; i < streams_.size(); i++) {
+      total +=
+          tfc_.acked_init_window() + streams_[i].fc.announced_window_delta();
+    }
+    return total / (streams_.size() - 1);
+  }
+
+ private:
+  struct Stream {
+    explicit Stream(TransportFlowControl* tfc) : fc(tfc) {}
+    StreamFlowControl fc;
+    int64_t queued = 0;
+    // The peer's view of the stream window, relative to the initial window.
+    int64_t window_delta = 0;
+  };
+
+  struct Frame {
+    int64_t arrival_ms;
+    size_t stream;
+    int64_t size;
+  };
+
+  struct Update {
+    int64_t arrival_ms;
+    std::optional<size_t> stream;
+    int64_t size;
+    std::optional<uint32_t> initial_window_size;
+  };
+
+  void SetMinProgressSize(size_t id, int64_t size) {
+    StreamFlowControl::IncomingUpdateContext upd(&streams_[id].fc);
+    upd.SetMinProgressSize(size);
+    Act(upd.MakeAction(), id);
+  }
+
+  void Act(FlowControlAction action, std::optional<size_t> stream = {}) {
+    if (action.send_stream_update() !=
+        FlowControlAction::Urgency::NO_ACTION_NEEDED) {
+      streams_to_update_.push_back(*stream);
+    }
+    if (action.send_initial_window_update() !=
+        FlowControlAction::Urgency::NO_ACTION_NEEDED) {
+      queued_initial_window_size_ = action.initial_window_size();
+    }
+  }
+
+  void ReceiveUpdates() {
+    while (!to_peer_.empty() && to_peer_.front().arrival_ms <= now_ms_) {
+      const Update& update = to_peer_.front();
+      if (update.initial_window_size.has_value()) {
+        peer_initial_window_ = *update.initial_window_size;
+        // The settings ack is sent back at once.
+        acks_.push_back(
+            {now_ms_ + kOneWayDelayMs, *update.initial_window_size});
+      } else if (update.stream.has_value()) {
+        streams_[*update.stream].window_delta += update.size;
+      } else {
+        peer_transport_window_ += update.size;
+      }
+      to_peer_.pop_front();
+    }
+    while (!acks_.empty() && acks_.front().first <= now_ms_) {
+      Act(tfc_.SetAckedInitialWindow(acks_.front().second));
+      acks_.pop_front();
+    }
+    if (ping_pong_ms_.has_value() && *ping_pong_ms_ <= now_ms_) {
+      next_ping_ = tfc_.bdp_estimator()->CompletePing();
+      ping_pong_ms_.reset();
+    }
+  }
+
+  // The peer sends what flow control allows, up to the link rate.
+  void SendData() {
+    int64_t budget = kLinkBytesPerMs;
+    for (size_t i = 0; i < streams_.size() && budget > 0; i++) {
+      const size_t id = (i + now_ms_) % streams_.size();
+      Stream& s = streams_[id];
+      while (budget > 0) {
+        const int64_t size =
+            std::min({s.queued, peer_initial_window_ + s.window_delta,
+                      peer_transport_window_, budget, kMaxFrameSize});
+        if (size <= 0) break;
+        s.queued -= size;
+        s.window_delta -= size;
+        peer_transport_window_ -= size;
+        budget -= size;
+        to_us_.push_back({now_ms_ + kOneWayDelayMs, id, size});
+      }
+    }
+  }
+
+  void ReceiveData() {
+    while (!to_us_.empty() && to_us_.front().arrival_ms <= now_ms_) {
+      const Frame frame = to_us_.front();
+      to_us_.pop_front();
+      tfc_.bdp_estimator()->AddIncomingBytes(frame.size);
+      StreamFlowControl::IncomingUpdateContext upd(
+          &streams_[frame.stream].fc);
+      std::ignore = upd.RecvData(frame.size);
+      if (frame.stream == 0) {
+        // The bulk stream's reader consumes each frame and waits for more.
+        upd.SetMinProgressSize(5);
+        bulk_window_.push_back({now_ms_, frame.size});
+      }
+      Act(upd.MakeAction(), frame.stream);
+    }
+    while (!bulk_window_.empty() &&
+           bulk_window_.front().first <= now_ms_ - 1000) {
+      bulk_window_.pop_front();
+    }
+    int64_t recent = 0;
+    bulk_bytes_last_second_ = 0;
+    for (const auto& received : bulk_window_) {
+      if (received.first > now_ms_ - 100) recent += received.second;
+      bulk_bytes_last_second_ += received.second;
+    }
+    // The line rate, less what the small streams use, over 100ms.
+    const int64_t bulk_share_per_ms =
+        streams_.size() == 1
+            ? kLinkBytesPerMs
+            : kLinkBytesPerMs - kSmallMessageSize / kSmallMessageIntervalMs;
+    if (time_to_line_rate_ms_ < 0 && recent >= 90 * bulk_share_per_ms) {
+      time_to_line_rate_ms_ = now_ms_;
+    }
+  }
+
+  void Write() {
+    const int64_t arrival_ms = now_ms_ + kOneWayDelayMs;
+    if (Timestamp::Now() >= next_ping_ && !ping_pong_ms_.has_value()) {
+      tfc_.bdp_estimator()->SchedulePing();
+      tfc_.bdp_estimator()->StartPing();
+      ping_pong_ms_ = now_ms_ + 2 * kOneWayDelayMs;
+    }
+    if (queued_initial_window_size_.has_value()) {
+      to_peer_.push_back({arrival_ms, {}, 0, queued_initial_window_size_});
+      queued_initial_window_size_.reset();
+      tfc_.FlushedSettings();
+    }
+    for (size_t id : streams_to_update_) {
+      const uint32_t size = streams_[id].fc.MaybeSendUpdate();
+      if (size > 0) to_peer_.push_back({arrival_ms, id, size, {}});
+    }
+    streams_to_update_.clear();
+    const uint32_t size = tfc_.MaybeSendUpdate(false);
+    if (size > 0) to_peer_.push_back({arrival_ms, {}, size, {}});
+  }
+
+  ExecCtx exec_ctx_;
+  MemoryOwner memory_owner_ =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryOwner();
+  TransportFlowControl tfc_{"bm", true, &memory_owner_};
+  std::deque<Stream> streams_;
+  std::vector<size_t> streams_to_update_;
+  std::optional<uint32_t> queued_initial_window_size_;
+  std::deque<Frame> to_us_;
+  std::deque<Update> to_peer_;
+  std::deque<std::pair<int64_t, uint32_t>> acks_;
+  int64_t peer_initial_window_ = kDefaultWindow;
+  int64_t peer_transport_window_ = kDefaultWindow;
+  Timestamp next_ping_ = Timestamp::Now();
+  std::optional<int64_t> ping_pong_ms_;
+  std::deque<std::pair<int64_t, int64_t>> bulk_window_;
+  int64_t bulk_bytes_last_second_ = 0;
+  int64_t time_to_line_rate_ms_ = -1;
+  int64_t now_ms_ = 0;
+};
+
+// Arg: the number of small streams sharing the connection with the bulk one.
+void BM_BulkAndSmallStreams(benchmark::State& state) {
+  g_now = {1, 0, GPR_CLOCK_MONOTONIC};
+  TestOnlySetProcessEpoch(g_now);
+  gpr_now_impl = now_impl;
+  int64_t time_to_line_rate_ms = 0;
+  double bulk_link_share = 0;
+  double small_stream_window = 0;
+  for (auto _ : state) {
+    MixedWorkload workload(state.range(0));
+    workload.Run();
+    time_to_line_rate_ms = workload.time_to_line_rate_ms();
+    bulk_link_share = workload.bulk_link_share();
+    small_stream_window = workload.small_stream_window();
+  }
+  // Simulated results, the same for every iteration.
+  state.counters["time_to_line_rate_ms"] = time_to_line_rate_ms;
+  state.counters["bulk_link_share"] = bulk_link_share;
+  state.counters["small_stream_window"] = small_stream_window;
+}
+BENCHMARK(BM_BulkAndSmallStreams)->Arg(0)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace chttp2
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,158 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark streaming throughput over TLS, with records protected by the
+// frame protector in user space or by the kernel (kTLS).
+
+#include <grpc/grpc_security_constants.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/security/tls_certificate_provider.h>
+#include <grpcpp/security/tls_credentials_options.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/core/test_util/tls_utils.h"
+#include "test/cpp/microbenchmarks/fullstack_streaming_pump.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+constexpr char kCaCertPath[] = "src/core/tsi/test_creds/ca.pem";
+constexpr char kServerCertPath[] = "src/core/tsi/test_creds/server1.pem";
+constexpr char kServerKeyPath[] = "src/core/tsi/test_creds/server1.key";
+
+class TLSConfiguration : public FixtureConfiguration {
+ public:
+  explicit TLSConfiguration(bool kernel_offload)
+      : kernel_offload_(kernel_offload) {}
+
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+    c->SetSslTargetNameOverride("foo.test.google.fr");
+    c->SetInt(GRPC_ARG_TLS_KERNEL_OFFLOAD_ENABLED, kernel_offload_);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+    b->AddChannelArgument(GRPC_ARG_TLS_KERNEL_OFFLOAD_ENABLED, kernel_offload_);
+  }
+
+ private:
+  const bool kernel_offload_;
+};
+
+// A TCP fixture secured with TLS. Both sides can offload TLS 1.2 connections
+// to the kernel; with TLS 1.3 only the server side can, so the client keeps
+// the frame protector.
+template <grpc_tls_version kTlsVersion, bool kKernelOffload>
+class TLS : public FullstackFixture {
+ public:
+  explicit TLS(Service* service)
+      : FullstackFixture(service, TLSConfiguration(kKernelOffload),
+                         MakeAddress(&port_), ServerCredentials(),
+                         ChannelCredentials()) {}
+
+  ~TLS() override { grpc_recycle_unused_port(port_); }
+
+ private:
+  int port_;
+
+  static std::string MakeAddress(int* port) {
+    *port = grpc_pick_unused_port_or_die();
+    std::stringstream addr;
+    addr << "localhost:" << *port;
+    return addr.str();
+  }
+
+  static std::shared_ptr<experimental::StaticDataCertificateProvider>
+  CertificateProvider() {
+    std::vector<experimental::IdentityKeyCertPair> identity_key_cert_pairs = {
+        {grpc_core::testing::GetFileContents(kServerKeyPath),
+         grpc_core::testing::GetFileContents(kServerCertPath)}};
+    return std::make_shared<experimental::StaticDataCertificateProvider>(
+        grpc_core::testing::GetFileContents(kCaCertPath),
+        identity_key_cert_pairs);
+  }
+
+  static std::shared_ptr<grpc::ServerCredentials> ServerCredentials() {
+    experimental::TlsServerCredentialsOptions options(CertificateProvider());
+    options.watch_identity_key_cert_pairs();
+    options.set_min_tls_version(kTlsVersion);
+    options.set_max_tls_version(kTlsVersion);
+    return experimental::TlsServerCredentials(options);
+  }
+
+  static std::shared_ptr<grpc::ChannelCredentials> ChannelCredentials() {
+    experimental::TlsChannelCredentialsOptions options;
+    options.set_certificate_provider(CertificateProvider());
+    options.watch_root_certs();
+    options.set_min_tls_version(kTlsVersion);
+    options.set_max_tls_version(kTlsVersion);
+    return experimental::TlsCredentials(options);
+  }
+};
+
+typedef TLS<grpc_tls_version::TLS1_2, false> TLS12;
+typedef TLS<grpc_tls_version::TLS1_2, true> KernelTLS12;
+typedef TLS<grpc_tls_version::TLS1_3, false> TLS13;
+typedef TLS<grpc_tls_version::TLS1_3, true> KernelTLS13;
+
+//******************************************************************************
+// CONFIGURATIONS
+//
+
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, TLS12)
+    ->Range(1024, 16 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, KernelTLS12)
+    ->Range(1024, 16 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, TLS13)
+    ->Range(1024, 16 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, KernelTLS13)
+    ->Range(1024, 16 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, TLS12)
+    ->Range(1024, 16 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, KernelTLS12)
+    ->Range(1024, 16 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, TLS13)
+    ->Range(1024, 16 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, KernelTLS13)
+    ->Range(1024, 16 * 1024 * 1024);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
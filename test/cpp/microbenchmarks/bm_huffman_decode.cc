@@ -20,6 +20,7 @@
 #include "absl/strings/escaping.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/huff_table_decoder.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/util/no_destruct.h"
 #include "test/core/test_util/test_config.h"
@@ -85,6 +86,21 @@ static void BM_Decode(benchmark::State& state, CharSet chars_gen) {
 
 DECL_HUFFMAN_VARIANTS();
 
+// The table driven decoder used by the HPACK parser.
+static void BM_DecodeTable(benchmark::State& state, CharSet chars_gen) {
+  const std::vector<uint8_t>& chars = chars_gen();
+  std::vector<uint8_t> output;
+  for (auto _ : state) {
+    output.clear();
+    grpc_core::HuffDecodeAppend(chars.data(), chars.data() + chars.size(),
+                                &output);
+  }
+}
+BENCHMARK_CAPTURE(BM_DecodeTable, all_chars, AllChars);
+BENCHMARK_CAPTURE(BM_DecodeTable, base64_chars, Base64Chars);
+BENCHMARK_CAPTURE(BM_DecodeTable, ascii_chars, AsciiChars);
+BENCHMARK_CAPTURE(BM_DecodeTable, alpha_chars, AlphaChars);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
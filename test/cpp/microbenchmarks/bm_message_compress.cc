@@ -0,0 +1,176 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Message compression throughput and ratio, by algorithm and level, over
+// payloads shaped like typical protobuf messages: repeated records of varint
+// ids and timestamps, enums, short strings from a small vocabulary, and some
+// opaque bytes.
+
+#include <benchmark/benchmark.h>
+#include <grpc/slice_buffer.h>
+
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <random>
+#include <string>
+
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+
+void AppendVarint(std::string& out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<char>(value));
+}
+
+void AppendTag(std::string& out, int field, int wire_type) {
+  AppendVarint(out, (field << 3) | wire_type);
+}
+
+void AppendBytes(std::string& out, int field, const std::string& bytes) {
+  AppendTag(out, field, 2);
+  AppendVarint(out, bytes.size());
+  out += bytes;
+}
+
+std::string ProtobufLikePayload(size_t size) {
+  static const char* const kWords[] = {
+      "us-east1", "us-west2", "europe-west4", "asia-south1", "pending",
+      "running",  "done",     "cancelled",    "user",        "service",
+      "frontend", "backend",  "storage",      "compute",     "billing"};
+  std::mt19937 rng(0);
+  std::string payload;
+  uint64_t id = 1000000;
+  uint64_t timestamp = 1700000000000;
+  while (payload.size() < size) {
+    std::string record;
+    AppendTag(record, 1, 0);
+    AppendVarint(record, id += rng() % 16);
+    AppendTag(record, 2, 0);
+    AppendVarint(record, timestamp += rng() % 1000);
+    AppendTag(record, 3, 0);
+    AppendVarint(record, rng() % 4);
+    for (int i = 0; i < 3; i++) {
+      AppendBytes(record, 4, kWords[rng() % std::size(kWords)]);
+    }
+    std::string opaque(16, '\0');
+    for (auto& c : opaque) c = static_cast<char>(rng());
+    AppendBytes(record, 5, opaque);
+    AppendBytes(payload, 1, record);
+  }
+  payload.resize(size);
+  return payload;
+}
+
+void BM_Compress(benchmark::State& state,
+                 grpc_compression_algorithm algorithm) {
+  if (!grpc_core::CompressionAlgorithmSet::Supported().IsSet(algorithm)) {
+    state.SkipWithError("algorithm is not built in");
+    return;
+  }
+  const int level = state.range(0);
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::SliceBuffer input;
+  input.Append(grpc_core::Slice::FromCopiedString(
+      ProtobufLikePayload(state.range(1))));
+  size_t compressed_size = 0;
+  for (auto _ : state) {
+    grpc_core::SliceBuffer output;
+    grpc_msg_compress_with_level(algorithm, level, input.c_slice_buffer(),
+                                 output.c_slice_buffer());
+    compressed_size = output.Length();
+  }
+  state.SetBytesProcessed(state.iterations() * input.Length());
+  state.counters["ratio"] =
+      static_cast<double>(input.Length()) / compressed_size;
+}
+
+void BM_Decompress(benchmark::State& state,
+                   grpc_compression_algorithm algorithm) {
+  if (!grpc_core::CompressionAlgorithmSet::Supported().IsSet(algorithm)) {
+    state.SkipWithError("algorithm is not built in");
+    return;
+  }
+  const int level = state.range(0);
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::SliceBuffer input;
+  input.Append(grpc_core::Slice::FromCopiedString(
+      ProtobufLikePayload(state.range(1))));
+  grpc_core::SliceBuffer compressed;
+  grpc_msg_compress_with_level(algorithm, level, input.c_slice_buffer(),
+                               compressed.c_slice_buffer());
+  for (auto _ : state) {
+    grpc_core::SliceBuffer output;
+    grpc_msg_decompress(algorithm, compressed.c_slice_buffer(),
+                        output.c_slice_buffer());
+  }
+  state.SetBytesProcessed(state.iterations() * input.Length());
+}
+
+// Args: level, payload size.
+void ArgsForLevels(benchmark::internal::Benchmark* b,
+                   std::initializer_list<int> levels) {
+  for (int level : levels) {
+    for (int size : {1024, 64 * 1024, 1024 * 1024}) {
+      b->Args({level, size});
+    }
+  }
+}
+
+void CompressionArgs(benchmark::internal::Benchmark* b) {
+  ArgsForLevels(b, {1, 6, 9});
+}
+
+void ZstdArgs(benchmark::internal::Benchmark* b) {
+  ArgsForLevels(b, {1, 3, 9, 19});
+}
+
+// 0 is the fast compressor, 9 is LZ4HC.
+void Lz4Args(benchmark::internal::Benchmark* b) { ArgsForLevels(b, {0, 9}); }
+
+BENCHMARK_CAPTURE(BM_Compress, deflate, GRPC_COMPRESS_DEFLATE)
+    ->Apply(CompressionArgs);
+BENCHMARK_CAPTURE(BM_Compress, gzip, GRPC_COMPRESS_GZIP)
+    ->Apply(CompressionArgs);
+BENCHMARK_CAPTURE(BM_Decompress, deflate, GRPC_COMPRESS_DEFLATE)
+    ->Apply(CompressionArgs);
+BENCHMARK_CAPTURE(BM_Decompress, gzip, GRPC_COMPRESS_GZIP)
+    ->Apply(CompressionArgs);
+BENCHMARK_CAPTURE(BM_Compress, zstd, GRPC_COMPRESS_ZSTD)->Apply(ZstdArgs);
+BENCHMARK_CAPTURE(BM_Decompress, zstd, GRPC_COMPRESS_ZSTD)->Apply(ZstdArgs);
+BENCHMARK_CAPTURE(BM_Compress, lz4, GRPC_COMPRESS_LZ4)->Apply(Lz4Args);
+BENCHMARK_CAPTURE(BM_Decompress, lz4, GRPC_COMPRESS_LZ4)->Apply(Lz4Args);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
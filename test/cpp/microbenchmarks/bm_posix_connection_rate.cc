@@ -0,0 +1,147 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures how many connections per second a POSIX EventEngine listener can
+// accept while one client thread per core keeps connecting to it, with and
+// without poller shards (GRPC_POSIX_POLLER_SHARDS).
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/cpu.h>
+#include <grpcpp/impl/grpc_library.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "src/core/config/config_vars.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/wait_for_single_owner.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::PosixEventEngine;
+using ::grpc_event_engine::experimental::URIToResolvedAddress;
+
+constexpr int kConnectionsPerClient = 64;
+
+// Opens and immediately resets a connection to 127.0.0.1:port. The reset
+// keeps the client side out of TIME_WAIT, so the benchmark does not run out
+// of ephemeral ports.
+void ConnectAndReset(int port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  CHECK_GE(fd, 0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  CHECK_EQ(connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+  linger no_linger = {1, 0};
+  setsockopt(fd, SOL_SOCKET, SO_LINGER, &no_linger, sizeof(no_linger));
+  close(fd);
+}
+
+void BM_PosixListener_AcceptRate(benchmark::State& state) {
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.posix_poller_shards = state.range(0);
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  auto engine = PosixEventEngine::MakePosixEventEngine();
+  std::atomic<int> accepted{0};
+  grpc_core::ChannelArgs args;
+  args = args.Set(GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default());
+  ChannelArgsEndpointConfig config(args);
+  auto listener = engine->CreateListener(
+      [&accepted](std::unique_ptr<EventEngine::Endpoint> /*endpoint*/,
+                  grpc_event_engine::experimental::MemoryAllocator
+                  /*allocator*/) {
+        accepted.fetch_add(1, std::memory_order_relaxed);
+      },
+      [](absl::Status /*status*/) {}, config,
+      std::make_unique<grpc_core::MemoryQuota>(
+          grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+              "bm_posix_connection_rate")));
+  CHECK_OK(listener);
+  auto port = (*listener)->Bind(*URIToResolvedAddress("ipv4:127.0.0.1:0"));
+  CHECK_OK(port);
+  CHECK_OK((*listener)->Start());
+  const int num_clients = gpr_cpu_num_cores();
+  const int connections_per_iteration = num_clients * kConnectionsPerClient;
+  int expected = 0;
+  for (auto _ : state) {
+    expected += connections_per_iteration;
+    std::vector<std::thread> clients;
+    clients.reserve(num_clients);
+    for (int i = 0; i < num_clients; ++i) {
+      clients.emplace_back([port = *port]() {
+        for (int j = 0; j < kConnectionsPerClient; ++j) ConnectAndReset(port);
+      });
+    }
+    for (auto& client : clients) client.join();
+    while (accepted.load(std::memory_order_relaxed) < expected) {
+      std::this_thread::yield();
+    }
+  }
+  state.SetItemsProcessed(connections_per_iteration * state.iterations());
+  listener->reset();
+  grpc_core::WaitForSingleOwner(std::move(engine));
+  grpc_core::ConfigVars::Reset();
+}
+BENCHMARK(BM_PosixListener_AcceptRate)
+    ->Arg(0)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+
+}  // namespace
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,183 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Streams large messages over a loopback TCP connection between two POSIX
+// EventEngine endpoints, with receive-side zero copy (TCP_ZEROCOPY_RECEIVE)
+// off and on, to quantify what the reader saves by not copying payloads.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/impl/grpc_library.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/wait_for_single_owner.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::PosixEventEngine;
+using ::grpc_event_engine::experimental::Slice;
+using ::grpc_event_engine::experimental::SliceBuffer;
+using ::grpc_event_engine::experimental::URIToResolvedAddress;
+
+std::unique_ptr<grpc_core::MemoryQuota> MakeMemoryQuota() {
+  return std::make_unique<grpc_core::MemoryQuota>(
+      grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+          "bm_posix_endpoint_pump"));
+}
+
+// A connected pair of endpoints: the server side writes, the client side
+// reads with the given receive zero copy setting.
+struct EndpointPair {
+  std::unique_ptr<EventEngine::Listener> listener;
+  std::unique_ptr<EventEngine::Endpoint> writer;
+  std::unique_ptr<EventEngine::Endpoint> reader;
+};
+
+EndpointPair Connect(EventEngine* engine, bool rx_zerocopy) {
+  EndpointPair pair;
+  grpc_core::ChannelArgs args;
+  args = args.Set(GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default());
+  ChannelArgsEndpointConfig server_config(args);
+  grpc_core::Notification accepted;
+  auto listener = engine->CreateListener(
+      [&pair, &accepted](std::unique_ptr<EventEngine::Endpoint> endpoint,
+                         grpc_event_engine::experimental::MemoryAllocator
+                         /*allocator*/) {
+        pair.writer = std::move(endpoint);
+        accepted.Notify();
+      },
+      [](absl::Status /*status*/) {}, server_config, MakeMemoryQuota());
+  CHECK_OK(listener);
+  pair.listener = std::move(*listener);
+  auto port = pair.listener->Bind(*URIToResolvedAddress("ipv4:127.0.0.1:0"));
+  CHECK_OK(port);
+  CHECK_OK(pair.listener->Start());
+  auto addr = URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", *port));
+  CHECK_OK(addr);
+  args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, rx_zerocopy ? 1 : 0);
+  ChannelArgsEndpointConfig client_config(args);
+  grpc_core::Notification connected;
+  engine->Connect(
+      [&pair, &connected](
+          absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>> endpoint) {
+        CHECK_OK(endpoint);
+        pair.reader = std::move(*endpoint);
+        connected.Notify();
+      },
+      *addr, client_config,
+      MakeMemoryQuota()->CreateMemoryAllocator("bm_posix_endpoint_pump"),
+      std::chrono::seconds(10));
+  connected.WaitForNotification();
+  accepted.WaitForNotification();
+  return pair;
+}
+
+// Reads from the endpoint until `bytes` bytes have arrived. The read buffer is
+// discarded, as an application done with a message would.
+void ReadExactly(EventEngine::Endpoint* endpoint, size_t bytes) {
+  SliceBuffer buffer;
+  while (bytes > 0) {
+    EventEngine::Endpoint::ReadArgs args;
+    args.set_read_hint_bytes(bytes);
+    grpc_core::Notification done;
+    if (!endpoint->Read(
+            [&done](absl::Status status) {
+              CHECK_OK(status);
+              done.Notify();
+            },
+            &buffer, std::move(args))) {
+      done.WaitForNotification();
+    }
+    bytes -= buffer.Length();
+    buffer.Clear();
+  }
+}
+
+void BM_PosixEndpoint_StreamingPump(benchmark::State& state) {
+  const bool rx_zerocopy = state.range(0) != 0;
+  const size_t message_size = state.range(1);
+  auto engine = PosixEventEngine::MakePosixEventEngine();
+  EndpointPair pair = Connect(engine.get(), rx_zerocopy);
+  const std::string payload(message_size, 'x');
+  for (auto _ : state) {
+    SliceBuffer message;
+    message.Append(Slice::FromCopiedString(payload));
+    grpc_core::Notification written;
+    if (pair.writer->Write(
+            [&written](absl::Status status) {
+              CHECK_OK(status);
+              written.Notify();
+            },
+            &message, EventEngine::Endpoint::WriteArgs())) {
+      written.Notify();
+    }
+    ReadExactly(pair.reader.get(), message_size);
+    written.WaitForNotification();
+  }
+  state.SetBytesProcessed(message_size * state.iterations());
+  pair.reader.reset();
+  pair.writer.reset();
+  pair.listener.reset();
+  grpc_core::WaitForSingleOwner(std::move(engine));
+}
+BENCHMARK(BM_PosixEndpoint_StreamingPump)
+    ->ArgNames({"rx_zerocopy", "message_size"})
+    ->ArgsProduct({{0, 1}, {64 * 1024, 1024 * 1024, 4 * 1024 * 1024,
+                            16 * 1024 * 1024}})
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+
+}  // namespace
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
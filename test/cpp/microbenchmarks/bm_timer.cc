@@ -0,0 +1,179 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the POSIX EventEngine timer backends (TimerList's heaps and
+// TimerWheel) on a timer load shaped like an RPC server: a large population of
+// long-lived keepalive timers, plus a deadline timer per call that is nearly
+// always cancelled when the call completes, and otherwise fires shortly after
+// it was set. Time is simulated, so only the timer operations are measured.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpcpp/impl/grpc_library.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Timer;
+using ::grpc_event_engine::experimental::TimerList;
+using ::grpc_event_engine::experimental::TimerListHost;
+using ::grpc_event_engine::experimental::TimerWheel;
+
+// Calls in flight at once: a call's deadline timer is cancelled once this
+// many newer calls have started.
+constexpr size_t kCallsInFlight = 1024;
+// Calls started per simulated millisecond. Each millisecond ends with a
+// TimerCheck.
+constexpr int kCallsPerMillisecond = 16;
+
+class FakeHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override { return now_; }
+  void Kick() override {}
+
+  void Advance(grpc_core::Duration duration) { now_ = now_ + duration; }
+
+ private:
+  grpc_core::Timestamp now_ =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1);
+};
+
+// A timer that returns itself to the pool when it fires.
+struct PooledTimer final : public EventEngine::Closure {
+  void Run() override { free_list->push_back(this); }
+
+  Timer timer;
+  std::vector<PooledTimer*>* free_list;
+};
+
+class TimerPool {
+ public:
+  PooledTimer* Get() {
+    if (free_list_.empty()) {
+      timers_.push_back(std::make_unique<PooledTimer>());
+      timers_.back()->free_list = &free_list_;
+      return timers_.back().get();
+    }
+    PooledTimer* timer = free_list_.back();
+    free_list_.pop_back();
+    return timer;
+  }
+  void Put(PooledTimer* timer) { free_list_.push_back(timer); }
+
+ private:
+  std::vector<std::unique_ptr<PooledTimer>> timers_;
+  std::vector<PooledTimer*> free_list_;
+};
+
+template <typename Backend>
+void BM_TimerRpcDeadlines(benchmark::State& state) {
+  const int64_t keepalives = state.range(0);
+  const int cancel_percent = state.range(1);
+  FakeHost host;
+  Backend backend(&host);
+  TimerPool pool;
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int64_t> keepalive_ms(10 * 60 * 1000,
+                                                      2 * 3600 * 1000);
+  std::uniform_int_distribution<int64_t> deadline_ms(1000, 30 * 1000);
+  std::uniform_int_distribution<int64_t> expiring_deadline_ms(1, 50);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::vector<PooledTimer*> keepalive_timers;
+  keepalive_timers.reserve(keepalives);
+  for (int64_t i = 0; i < keepalives; ++i) {
+    PooledTimer* timer = pool.Get();
+    backend.TimerInit(&timer->timer,
+                      host.Now() + grpc_core::Duration::Milliseconds(
+                                       keepalive_ms(rng)),
+                      timer);
+    keepalive_timers.push_back(timer);
+  }
+  std::deque<PooledTimer*> calls;
+  int calls_this_millisecond = 0;
+  for (auto _ : state) {
+    PooledTimer* timer = pool.Get();
+    if (percent(rng) < cancel_percent) {
+      backend.TimerInit(&timer->timer,
+                        host.Now() + grpc_core::Duration::Milliseconds(
+                                         deadline_ms(rng)),
+                        timer);
+      calls.push_back(timer);
+      if (calls.size() > kCallsInFlight) {
+        CHECK(backend.TimerCancel(&calls.front()->timer));
+        pool.Put(calls.front());
+        calls.pop_front();
+      }
+    } else {
+      backend.TimerInit(&timer->timer,
+                        host.Now() + grpc_core::Duration::Milliseconds(
+                                         expiring_deadline_ms(rng)),
+                        timer);
+    }
+    if (++calls_this_millisecond == kCallsPerMillisecond) {
+      calls_this_millisecond = 0;
+      host.Advance(grpc_core::Duration::Milliseconds(1));
+      auto fired = backend.TimerCheck(nullptr);
+      CHECK(fired.has_value());
+      for (EventEngine::Closure* closure : *fired) closure->Run();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  for (PooledTimer* timer : calls) CHECK(backend.TimerCancel(&timer->timer));
+  for (PooledTimer* timer : keepalive_timers) {
+    (void)backend.TimerCancel(&timer->timer);
+  }
+  // Let the remaining expiring timers fire before the pool goes away.
+  host.Advance(grpc_core::Duration::Seconds(1));
+  auto fired = backend.TimerCheck(nullptr);
+  CHECK(fired.has_value());
+  for (EventEngine::Closure* closure : *fired) closure->Run();
+}
+BENCHMARK_TEMPLATE(BM_TimerRpcDeadlines, TimerList)
+    ->ArgNames({"keepalives", "cancel_percent"})
+    ->ArgsProduct({{0, 1 << 14, 1 << 20}, {100, 99, 90, 50}});
+BENCHMARK_TEMPLATE(BM_TimerRpcDeadlines, TimerWheel)
+    ->ArgNames({"keepalives", "cancel_percent"})
+    ->ArgsProduct({{0, 1 << 14, 1 << 20}, {100, 99, 90, 50}});
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
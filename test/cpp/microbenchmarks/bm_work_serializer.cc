@@ -0,0 +1,106 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Scheduling callbacks on a WorkSerializer from many threads at once, as
+// subchannel state updates do during endpoint churn.
+
+#include <benchmark/benchmark.h>
+#include <grpcpp/impl/grpc_library.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/work_serializer.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using grpc_event_engine::experimental::GetDefaultEventEngine;
+
+// Each of state.range(0) producer threads runs state.range(1) callbacks; an
+// iteration ends once they have all been executed.
+void BM_WorkSerializer_Run(benchmark::State& state) {
+  const int producers = state.range(0);
+  const int callbacks_per_producer = state.range(1);
+  const int total = producers * callbacks_per_producer;
+  grpc_core::WorkSerializer work_serializer(GetDefaultEventEngine());
+  for (auto _ : state) {
+    int executed = 0;
+    grpc_core::Notification done;
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+    for (int i = 0; i < producers; i++) {
+      threads.emplace_back([&]() {
+        while (!go.load(std::memory_order_acquire)) {
+        }
+        for (int j = 0; j < callbacks_per_producer; j++) {
+          // Callbacks are serialized, so `executed` needs no synchronization.
+          work_serializer.Run([&]() {
+            if (++executed == total) done.Notify();
+          });
+        }
+      });
+    }
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) thread.join();
+    done.WaitForNotification();
+  }
+  state.SetItemsProcessed(total * state.iterations());
+}
+BENCHMARK(BM_WorkSerializer_Run)
+    ->ArgsProduct({{1, 2, 4, 8, 16, 32}, {1000}})
+    ->UseRealTime();
+
+// A single thread scheduling callbacks: the uncontended cost of Run(), and
+// of draining the queue.
+void BM_WorkSerializer_RunAndDrain(benchmark::State& state) {
+  const int callbacks = state.range(0);
+  grpc_core::WorkSerializer work_serializer(GetDefaultEventEngine());
+  for (auto _ : state) {
+    int executed = 0;
+    grpc_core::Notification done;
+    for (int i = 0; i < callbacks; i++) {
+      work_serializer.Run([&]() {
+        if (++executed == callbacks) done.Notify();
+      });
+    }
+    done.WaitForNotification();
+  }
+  state.SetItemsProcessed(callbacks * state.iterations());
+}
+BENCHMARK(BM_WorkSerializer_RunAndDrain)->Range(1, 4096)->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -26,6 +26,8 @@
 #include <sstream>
 
 #include "absl/log/check.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
 #include "test/cpp/microbenchmarks/callback_test_service.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
@@ -82,6 +84,7 @@ static void BM_CallbackUnaryPingPong(benchmark::State& state) {
   std::mutex mu;
   std::condition_variable cv;
   bool done = false;
+  auto stats_before = grpc_core::global_stats().Collect();
   if (state.KeepRunning()) {
     SendCallbackUnaryPingPong(&state, &cli_ctx, &request, &response,
                               stub_.get(), &done, &mu, &cv);
@@ -93,6 +96,12 @@ static void BM_CallbackUnaryPingPong(benchmark::State& state) {
   fixture.reset();
   state.SetBytesProcessed((request_msgs_size * state.iterations()) +
                           (response_msgs_size * state.iterations()));
+  // Call arenas, client and server side, whose storage came from the heap
+  // rather than from a finished call.
+  auto stats = grpc_core::global_stats().Collect()->Diff(*stats_before);
+  state.counters["arena_allocs_per_rpc"] = benchmark::Counter(
+      static_cast<double>(stats->call_arena_storage_allocated) /
+      state.iterations());
 }
 
 }  // namespace testing
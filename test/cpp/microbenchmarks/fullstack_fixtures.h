@@ -73,10 +73,17 @@ class BaseFixture {
 class FullstackFixture : public BaseFixture {
  public:
   FullstackFixture(Service* service, const FixtureConfiguration& config,
-                   const std::string& address) {
+                   const std::string& address)
+      : FullstackFixture(service, config, address, InsecureServerCredentials(),
+                         InsecureChannelCredentials()) {}
+
+  FullstackFixture(Service* service, const FixtureConfiguration& config,
+                   const std::string& address,
+                   std::shared_ptr<ServerCredentials> server_credentials,
+                   std::shared_ptr<ChannelCredentials> channel_credentials) {
     ServerBuilder b;
     if (!address.empty()) {
-      b.AddListeningPort(address, InsecureServerCredentials());
+      b.AddListeningPort(address, std::move(server_credentials));
     }
     cq_ = b.AddCompletionQueue(true);
     b.RegisterService(service);
@@ -85,8 +92,8 @@ class FullstackFixture : public BaseFixture {
     ChannelArguments args;
     config.ApplyCommonChannelArguments(&args);
     if (!address.empty()) {
-      channel_ = grpc::CreateCustomChannel(address,
-                                           InsecureChannelCredentials(), args);
+      channel_ = grpc::CreateCustomChannel(
+          address, std::move(channel_credentials), args);
     } else {
       channel_ = server_->InProcessChannel(args);
     }